@@ -27,6 +27,8 @@ enum settings_ram_profiles
 #define DEFAULT_LIBS_PATH "libs/"
 #define DEFAULT_LOG_PATH  "log/"
 
+#define DEFAULT_METRICS_ADDRESS "127.0.0.1"
+
 static struct core_settings_s *settings = NULL;
 
 static void initCoreSettings(void)
@@ -37,6 +39,7 @@ static void initCoreSettings(void)
     memorySet(settings, 0, sizeof(struct core_settings_s));
 
     settings->config_paths = vec_config_path_t_with_capacity(2);
+    settings->dns_servers  = vec_dns_server_t_with_capacity(2);
 }
 
 static void parseLogPartOfJsonNoCheck(const cJSON *log_obj)
@@ -169,6 +172,55 @@ static void parseConfigPartOfJson(const cJSON *config_array)
     }
 }
 
+static void parseDnsPartOfJson(const cJSON *dns_obj)
+{
+    if (! cJSON_IsObject(dns_obj) || (dns_obj->child == NULL))
+    {
+        return;
+    }
+
+    const cJSON *servers = cJSON_GetObjectItemCaseSensitive(dns_obj, "servers");
+    if (servers == NULL)
+    {
+        return;
+    }
+    if (! cJSON_IsArray(servers))
+    {
+        printError("CoreSettings: \"servers\" in the dns block must be an array of addresses \n");
+        terminateProgram(1);
+    }
+
+    const cJSON *server = NULL;
+    cJSON_ArrayForEach(server, servers)
+    {
+        if (! cJSON_IsString(server) || server->valuestring == NULL)
+        {
+            printError("CoreSettings: \"servers\" in the dns block must be an array of addresses \n");
+            terminateProgram(1);
+        }
+        vec_dns_server_t_push(&settings->dns_servers, stringDuplicate(server->valuestring));
+    }
+}
+
+static void parseMetricsPartOfJson(const cJSON *metrics_obj)
+{
+    if (! cJSON_IsObject(metrics_obj) || (metrics_obj->child == NULL))
+    {
+        return;
+    }
+
+    int port = 0;
+    getIntFromJsonObjectOrDefault(&port, metrics_obj, "port", 0);
+    if (port < 0 || port > UINT16_MAX)
+    {
+        printError("CoreSettings: \"port\" in the metrics block must be in range [0 - 65535] \n");
+        terminateProgram(1);
+    }
+    settings->metrics_port = (uint16_t) port;
+
+    getStringFromJsonObjectOrDefault(&(settings->metrics_address), metrics_obj, "address", DEFAULT_METRICS_ADDRESS);
+}
+
 static void parseMiscPartOfJson(cJSON *misc_obj)
 {
     if (cJSON_IsObject(misc_obj) && (misc_obj->child != NULL))
@@ -282,6 +334,8 @@ void parseCoreSettings(const char *data_json)
     parseLogPartOfJson(cJSON_GetObjectItemCaseSensitive(json, "log"));
     parseConfigPartOfJson(cJSON_GetObjectItemCaseSensitive(json, "configs"));
     parseMiscPartOfJson(cJSON_GetObjectItemCaseSensitive(json, "misc"));
+    parseDnsPartOfJson(cJSON_GetObjectItemCaseSensitive(json, "dns"));
+    parseMetricsPartOfJson(cJSON_GetObjectItemCaseSensitive(json, "metrics"));
 
     if (settings->workers_count <= 0)
     {
@@ -295,8 +349,6 @@ void parseCoreSettings(const char *data_json)
     }
 
     cJSON_Delete(json);
-
-    // TODO (DNS) Implement dns settings and backend
 }
 
 struct core_settings_s *getCoreSettings(void)
@@ -313,6 +365,10 @@ void destroyCoreSettings(void)
     c_foreach(k, vec_config_path_t, settings->config_paths){
         memoryFree(*k.ref);
     }
+    c_foreach(k, vec_dns_server_t, settings->dns_servers)
+    {
+        memoryFree(*k.ref);
+    }
 
     // Free all strings
     memoryFree(settings->log_path);
@@ -325,6 +381,7 @@ void destroyCoreSettings(void)
     memoryFree(settings->dns_log_file);
     memoryFree(settings->dns_log_level);
     memoryFree(settings->libs_path);
+    memoryFree(settings->metrics_address);
 
     // Free full paths
     memoryFree(settings->internal_log_file_fullpath);
@@ -333,6 +390,7 @@ void destroyCoreSettings(void)
     memoryFree(settings->dns_log_file_fullpath);
 
     vec_config_path_t_drop(&settings->config_paths);
+    vec_dns_server_t_drop(&settings->dns_servers);
 
     // Free the settings structure itself
     memoryFree(settings);
@@ -6,6 +6,10 @@
 #define i_key  char *            // NOLINT
 #include "stc/vec.h"
 
+#define i_type vec_dns_server_t // NOLINT
+#define i_key  char *           // NOLINT
+#include "stc/vec.h"
+
 struct core_settings_s
 {
 
@@ -36,6 +40,10 @@ struct core_settings_s
     char        *libs_path;
 
     vec_config_path_t config_paths;
+    vec_dns_server_t  dns_servers; // empty means the system name servers are used
+
+    char    *metrics_address;
+    uint16_t metrics_port; // 0 means the metrics are disabled
 };
 
 void                    parseCoreSettings(const char *data_json);
@@ -74,6 +74,22 @@ int main(void)
     LOGI("Starting Waterwall version %s", TOSTRING(WATERWALL_VERSION));
     LOGI("Parsing core file complete");
     registerAtExitCallBack(exitHandle, NULL);
+
+    c_foreach(k, vec_dns_server_t, getCoreSettings()->dns_servers)
+    {
+        if (! dnsresolverAddNameServer(*k.ref))
+        {
+            LOGF("Core: invalid dns server \"%s\" in core settings", *k.ref);
+            terminateProgram(1);
+        }
+    }
+
+    // tunnels get their counters when they are created, so this comes before the config files
+    if (getCoreSettings()->metrics_port != 0)
+    {
+        metricsmanagerCreate(getCoreSettings()->metrics_address, getCoreSettings()->metrics_port);
+    }
+
     increaseFileLimit();
     loadImportedTunnelsIntoCore();
 
@@ -99,5 +115,9 @@ int main(void)
 
     LOGD("Core: starting workers ...");
     socketmanagerStart();
+    if (metricsmanagerIsEnabled())
+    {
+        metricsmanagerStart();
+    }
     runMainThread();
 }
@@ -0,0 +1,347 @@
+/*
+    Connection rate benchmark, reuse-port listeners against a single listener
+
+    runs the real runtime in this process with two chains over loopback, built from a config file like bench_chain:
+
+        single-in (TcpListener)                    -> single-out (TcpConnector) -> door
+        reuse-in  (TcpListener, "reuse-port": true) -> reuse-out  (TcpConnector) -> door
+
+    the single listener accepts every connection on the socket manager worker and hands it to a worker, with
+    reuse-port every worker owns a listener of the port and the kernel spreads the SYNs between them
+
+    each client thread opens a connection, sends one byte, waits for it to come back through the chain and closes,
+    in a loop; the door is an epoll echo server on its own thread. a run measures the connections/sec and the time
+    from connect() to the echo (p50, p99 and max), the client count sweep goes from one connection at a time to
+    bursts of kBenchMaxClients simultaneous SYNs
+
+    loopback reuses the TIME_WAIT ports by default (net.ipv4.tcp_tw_reuse = 2), so the runs do not exhaust the
+    ephemeral ports; with a reuse of 0 lower kBenchRunMs
+
+    usage: bench_accept [workers]        (default 2)
+*/
+
+#include "wwapi.h"
+
+#include "tunnels/TcpConnector/include/interface.h"
+#include "tunnels/TcpListener/include/interface.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdio.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+enum
+{
+    kBenchSinglePort   = 17200, // the single listener chain listens here
+    kBenchReusePort    = 17201, // the reuse-port chain listens here
+    kBenchDoorPort     = 17202, // both chains connect to the echo server here
+    kBenchMaxClients   = 64,
+    kBenchRunMs        = 2000,
+    kBenchMaxSamples   = 1 << 16, // setup times kept per client for the percentiles
+    kBenchConnectTries = 500,
+    kBenchDoorEvents   = 64
+};
+
+static const char kBenchConfigPath[] = "bench_accept_config.json";
+
+typedef struct bench_client_s
+{
+    atomic_bool *start;
+    atomic_bool *stop;
+    uint16_t     port;
+    uint32_t     count;      // completed connections
+    uint32_t     failures;   // connections the chain closed before the echo
+    uint64_t    *setup_us;   // one per completed connection, up to kBenchMaxSamples
+    wthread_t    thread;
+
+} bench_client_t;
+
+static struct sockaddr_in benchLoopbackAddress(uint16_t port)
+{
+    struct sockaddr_in addr = {0};
+    addr.sin_family         = AF_INET;
+    addr.sin_port           = htons(port);
+    addr.sin_addr.s_addr    = htonl(INADDR_LOOPBACK);
+    return addr;
+}
+
+static int benchListen(uint16_t port)
+{
+    struct sockaddr_in addr = benchLoopbackAddress(port);
+    int                one  = 1;
+    int                fd   = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (bind(fd, (struct sockaddr *) &addr, sizeof(addr)) != 0 || listen(fd, SOMAXCONN) != 0)
+    {
+        printError("bench_accept: could not listen on 127.0.0.1:%u\n", (unsigned int) port);
+        exit(1);
+    }
+    return fd;
+}
+
+// echoes whatever arrives and closes when the chain does, every connection of both chains ends here
+static WTHREAD_ROUTINE(benchDoorThread)
+{
+    int                listen_fd = (int) (intptr_t) userdata;
+    int                epfd      = epoll_create1(0);
+    struct epoll_event events[kBenchDoorEvents];
+    struct epoll_event ev = {.events = EPOLLIN, .data.fd = listen_fd};
+
+    epoll_ctl(epfd, EPOLL_CTL_ADD, listen_fd, &ev);
+
+    while (true)
+    {
+        int n = epoll_wait(epfd, events, kBenchDoorEvents, -1);
+        for (int i = 0; i < n; i++)
+        {
+            int fd = events[i].data.fd;
+            if (fd == listen_fd)
+            {
+                int cfd;
+                while ((cfd = accept4(listen_fd, NULL, NULL, SOCK_NONBLOCK)) >= 0)
+                {
+                    ev = (struct epoll_event) {.events = EPOLLIN, .data.fd = cfd};
+                    epoll_ctl(epfd, EPOLL_CTL_ADD, cfd, &ev);
+                }
+                continue;
+            }
+
+            uint8_t buf[64];
+            ssize_t len = recv(fd, buf, sizeof(buf), 0);
+            if (len > 0)
+            {
+                discard send(fd, buf, (size_t) len, MSG_NOSIGNAL);
+                continue;
+            }
+            if (len < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                continue;
+            }
+            epoll_ctl(epfd, EPOLL_CTL_DEL, fd, NULL);
+            close(fd);
+        }
+    }
+    return 0;
+}
+
+// the listeners of the chain are bound by the socket manager after it starts, so the first connects may be refused
+static void benchWaitListener(uint16_t port)
+{
+    struct sockaddr_in addr = benchLoopbackAddress(port);
+
+    for (int i = 0; i < kBenchConnectTries; i++)
+    {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (connect(fd, (struct sockaddr *) &addr, sizeof(addr)) == 0)
+        {
+            close(fd);
+            return;
+        }
+        close(fd);
+        ww_msleep(10);
+    }
+    printError("bench_accept: could not connect to the chain on 127.0.0.1:%u\n", (unsigned int) port);
+    exit(1);
+}
+
+static WTHREAD_ROUTINE(benchClientThread)
+{
+    bench_client_t    *client = userdata;
+    struct sockaddr_in addr   = benchLoopbackAddress(client->port);
+    int                one    = 1;
+    uint8_t            byte   = 'w';
+
+    while (! atomicLoadExplicit(client->start, memory_order_acquire))
+    {
+        YIELD_THREAD();
+    }
+
+    while (! atomicLoadExplicit(client->stop, memory_order_relaxed))
+    {
+        uint64_t begin = getHRTimeUs();
+        int      fd    = socket(AF_INET, SOCK_STREAM, 0);
+
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        if (connect(fd, (struct sockaddr *) &addr, sizeof(addr)) != 0 || send(fd, &byte, 1, MSG_NOSIGNAL) != 1 ||
+            recv(fd, &byte, 1, 0) != 1)
+        {
+            client->failures++;
+            close(fd);
+            continue;
+        }
+        close(fd);
+
+        if (client->count < kBenchMaxSamples)
+        {
+            client->setup_us[client->count] = getHRTimeUs() - begin;
+        }
+        client->count++;
+    }
+    return 0;
+}
+
+static uint64_t benchCpuTimeUs(void)
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (uint64_t) (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000ULL +
+           (uint64_t) (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+static int benchCompareU64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a;
+    uint64_t y = *(const uint64_t *) b;
+    return (x > y) - (x < y);
+}
+
+static void runConnections(const char *name, uint16_t port, int clients_count)
+{
+    bench_client_t clients[kBenchMaxClients];
+    atomic_bool    start = false;
+    atomic_bool    stop  = false;
+
+    for (int i = 0; i < clients_count; i++)
+    {
+        clients[i]        = (bench_client_t) {.start    = &start,
+                                              .stop     = &stop,
+                                              .port     = port,
+                                              .setup_us = memoryAllocate(sizeof(uint64_t) * kBenchMaxSamples)};
+        clients[i].thread = threadCreate(benchClientThread, &clients[i]);
+    }
+
+    uint64_t cpu_begin = benchCpuTimeUs();
+    uint64_t begin     = getHRTimeUs();
+
+    atomicStoreExplicit(&start, true, memory_order_release);
+    ww_msleep(kBenchRunMs);
+    atomicStoreExplicit(&stop, true, memory_order_relaxed);
+
+    uint64_t samples_count = 0;
+    uint64_t total         = 0;
+    uint64_t failures      = 0;
+    for (int i = 0; i < clients_count; i++)
+    {
+        threadJoin(clients[i].thread);
+        total += clients[i].count;
+        failures += clients[i].failures;
+        samples_count += min(clients[i].count, (uint32_t) kBenchMaxSamples);
+    }
+
+    uint64_t cpu     = benchCpuTimeUs() - cpu_begin;
+    double   seconds = (double) max(getHRTimeUs() - begin, 1ULL) / 1e6;
+
+    uint64_t *samples = memoryAllocate(sizeof(uint64_t) * max(samples_count, 1ULL));
+    uint64_t  k       = 0;
+    for (int i = 0; i < clients_count; i++)
+    {
+        uint32_t kept = min(clients[i].count, (uint32_t) kBenchMaxSamples);
+        memoryCopy(samples + k, clients[i].setup_us, sizeof(uint64_t) * kept);
+        k += kept;
+        memoryFree(clients[i].setup_us);
+    }
+    qsort(samples, samples_count, sizeof(uint64_t), benchCompareU64);
+
+    if (samples_count == 0)
+    {
+        printf("%8s %8d %14s %10s %10s %10s %10llu %14s\n", name, clients_count, "0", "-", "-", "-",
+               (unsigned long long) failures, "-");
+    }
+    else
+    {
+        printf("%8s %8d %14.0f %10llu %10llu %10llu %10llu %14.1f\n", name, clients_count, (double) total / seconds,
+               (unsigned long long) samples[samples_count / 2], (unsigned long long) samples[samples_count * 99 / 100],
+               (unsigned long long) samples[samples_count - 1], (unsigned long long) failures,
+               total ? (double) cpu / (double) total : 0.0);
+    }
+    memoryFree(samples);
+}
+
+static void writeChainConfig(void)
+{
+    FILE *f = fopen(kBenchConfigPath, "w");
+    if (f == NULL)
+    {
+        printError("bench_accept: could not write \"%s\"\n", kBenchConfigPath);
+        exit(1);
+    }
+
+    fprintf(f,
+            "{\"name\": \"bench_accept\", \"nodes\": [\n"
+            "{\"name\": \"single-in\", \"type\": \"TcpListener\", \"next\": \"single-out\",\n"
+            " \"settings\": {\"address\": \"127.0.0.1\", \"port\": %d, \"nodelay\": true}},\n"
+            "{\"name\": \"single-out\", \"type\": \"TcpConnector\",\n"
+            " \"settings\": {\"address\": \"127.0.0.1\", \"port\": %d, \"nodelay\": true}},\n"
+            "{\"name\": \"reuse-in\", \"type\": \"TcpListener\", \"next\": \"reuse-out\",\n"
+            " \"settings\": {\"address\": \"127.0.0.1\", \"port\": %d, \"nodelay\": true, \"reuse-port\": true}},\n"
+            "{\"name\": \"reuse-out\", \"type\": \"TcpConnector\",\n"
+            " \"settings\": {\"address\": \"127.0.0.1\", \"port\": %d, \"nodelay\": true}}\n"
+            "]}\n",
+            kBenchSinglePort, kBenchDoorPort, kBenchReusePort, kBenchDoorPort);
+    fclose(f);
+}
+
+static WTHREAD_ROUTINE(benchMainThread)
+{
+    discard userdata;
+
+    threadCreate(benchDoorThread, (void *) (intptr_t) benchListen(kBenchDoorPort));
+
+    benchWaitListener(kBenchSinglePort);
+    benchWaitListener(kBenchReusePort);
+
+    printf("\nconnections: %d ms per run, %u workers\n", kBenchRunMs,
+           (unsigned int) getWorkersCount() - WORKER_ADDITIONS);
+    printf("%8s %8s %14s %10s %10s %10s %10s %14s\n", "listener", "clients", "conns/sec", "p50(us)", "p99(us)",
+           "max(us)", "failed", "cpu(us)/conn");
+
+    for (int clients = 1; clients <= kBenchMaxClients; clients *= 4)
+    {
+        runConnections("single", kBenchSinglePort, clients);
+        runConnections("reuse", kBenchReusePort, clients);
+    }
+
+    // the workers are still running the chains, the process ends here without tearing them down
+    fflush(stdout);
+    exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    initWLibc();
+
+    char log_levels[4][8] = {"WARN", "WARN", "WARN", "WARN"};
+    char no_file[]        = "";
+
+    ww_construction_data_t runtime_data = {
+        .workers_count        = argc > 1 ? (unsigned int) atoi(argv[1]) : 2,
+        .ram_profile          = kRamProfileM1Memory,
+        .internal_logger_data = {.log_file_path = no_file, .log_level = log_levels[0], .log_console = true},
+        .core_logger_data     = {.log_file_path = no_file, .log_level = log_levels[1], .log_console = true},
+        .network_logger_data  = {.log_file_path = no_file, .log_level = log_levels[2], .log_console = true},
+        .dns_logger_data      = {.log_file_path = no_file, .log_level = log_levels[3], .log_console = true},
+    };
+    createGlobalState(runtime_data);
+
+    nodelibraryRegister(nodeTcpListenerGet());
+    nodelibraryRegister(nodeTcpConnectorGet());
+
+    writeChainConfig();
+    config_file_t *cfile = configfileParse(kBenchConfigPath);
+    remove(kBenchConfigPath);
+    if (! cfile)
+    {
+        terminateProgram(1);
+    }
+    nodemanagerRunConfigFile(cfile);
+
+    socketmanagerStart();
+    threadCreate(benchMainThread, NULL);
+    runMainThread();
+    return 0;
+}
@@ -0,0 +1,296 @@
+/*
+    ChaCha20-Poly1305 batch benchmark
+
+    encrypts and decrypts bursts of same sized packets under one key, once with a loop of single message calls and
+    once with the batch api, the packet sizes cover small acks, mid sized and full mtu wireguard payloads
+
+    the binary measures the crypto backend it was built with, to compare them:
+
+        cmake -B build-sodium   -DBUILD_BENCHMARKS=ON -DWCRYPTO_BACKEND_SODIUM=ON
+        cmake -B build-software -DBUILD_BENCHMARKS=ON -DWCRYPTO_BACKEND_SOFTWARE=ON
+        cmake -B build-openssl  -DBUILD_BENCHMARKS=ON -DWCRYPTO_BACKEND_OPENSSL=ON
+
+    the numbers are for one core (single thread)
+
+    before measuring, the RFC 8439 (2.8.2) test vector goes through the single and the batch calls and the batch
+    output is compared with the single calls for every size from 0 to kBenchMaxPacket, with nonces that use all 12
+    bytes and one forged tag per burst; the binary exits with 1 when a check fails
+*/
+
+#include "wcrypto.h"
+#include "wlibc.h"
+
+#ifdef WCRYPTO_BACKEND_SODIUM
+#include "sodium_instance.h"
+#endif
+
+#include <stdio.h>
+
+enum
+{
+    kBenchBurst      = 32,       // packets per batch call, a typical receive burst
+    kBenchBytesTotal = 1 << 28,  // bytes processed per measurement
+    kBenchAdLen      = 16,
+    kBenchTagLen     = 16,
+    kBenchMaxPacket  = 1400
+};
+
+typedef struct bench_packet_s
+{
+    unsigned char plain[kBenchMaxPacket];
+    unsigned char cipher[kBenchMaxPacket + kBenchTagLen];
+    unsigned char ad[kBenchAdLen];
+
+} bench_packet_t;
+
+static bench_packet_t     packets[kBenchBurst];
+static wcrypto_aead_msg_t msgs[kBenchBurst];
+static unsigned char      key[32];
+
+static void benchPrepare(size_t packet_size, bool decrypt)
+{
+    for (int i = 0; i < kBenchBurst; i++)
+    {
+        msgs[i] = (wcrypto_aead_msg_t) {.dst     = decrypt ? packets[i].plain : packets[i].cipher,
+                                        .src     = decrypt ? packets[i].cipher : packets[i].plain,
+                                        .src_len = decrypt ? packet_size + kBenchTagLen : packet_size,
+                                        .ad      = packets[i].ad,
+                                        .ad_len  = kBenchAdLen};
+        memoryCopy(msgs[i].nonce + 4, &i, sizeof(i));
+    }
+}
+
+// RFC 8439 2.8.2, AEAD_CHACHA20_POLY1305 test vector
+static const unsigned char kRfcPlain[] = "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for "
+                                         "the future, sunscreen would be it.";
+static const unsigned char kRfcAd[]    = {0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7};
+static const unsigned char kRfcNonce[] = {0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47};
+static const unsigned char kRfcCipher[] = {
+    0xd3, 0x1a, 0x8d, 0x34, 0x64, 0x8e, 0x60, 0xdb, 0x7b, 0x86, 0xaf, 0xbc, 0x53, 0xef, 0x7e, 0xc2, 0xa4, 0xad, 0xed,
+    0x51, 0x29, 0x6e, 0x08, 0xfe, 0xa9, 0xe2, 0xb5, 0xa7, 0x36, 0xee, 0x62, 0xd6, 0x3d, 0xbe, 0xa4, 0x5e, 0x8c, 0xa9,
+    0x67, 0x12, 0x82, 0xfa, 0xfb, 0x69, 0xda, 0x92, 0x72, 0x8b, 0x1a, 0x71, 0xde, 0x0a, 0x9e, 0x06, 0x0b, 0x29, 0x05,
+    0xd6, 0xa5, 0xb6, 0x7e, 0xcd, 0x3b, 0x36, 0x92, 0xdd, 0xbd, 0x7f, 0x2d, 0x77, 0x8b, 0x8c, 0x98, 0x03, 0xae, 0xe3,
+    0x28, 0x09, 0x1b, 0x58, 0xfa, 0xb3, 0x24, 0xe4, 0xfa, 0xd6, 0x75, 0x94, 0x55, 0x85, 0x80, 0x8b, 0x48, 0x31, 0xd7,
+    0xbc, 0x3f, 0xf4, 0xde, 0xf0, 0x8e, 0x4b, 0x7a, 0x9d, 0xe5, 0x76, 0xd2, 0x65, 0x86, 0xce, 0xc6, 0x4b, 0x61, 0x16,
+    // tag
+    0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09, 0xe2, 0x6a, 0x7e, 0x90, 0x2e, 0xcb, 0xd0, 0x60, 0x06, 0x91};
+
+enum
+{
+    kRfcPlainLen = sizeof(kRfcPlain) - 1
+};
+
+static bool checkRfcVector(void)
+{
+    unsigned char      rfc_key[32];
+    unsigned char      out[kRfcPlainLen + kBenchTagLen];
+    wcrypto_aead_msg_t msg;
+
+    for (int i = 0; i < (int) sizeof(rfc_key); i++)
+    {
+        rfc_key[i] = (unsigned char) (0x80 + i);
+    }
+
+    if (chacha20poly1305Encrypt(out, kRfcPlain, kRfcPlainLen, kRfcAd, sizeof(kRfcAd), kRfcNonce, rfc_key) != 0 ||
+        memoryCompare(out, kRfcCipher, sizeof(kRfcCipher)) != 0)
+    {
+        printf("check failed: RFC 8439 vector, single encrypt\n");
+        return false;
+    }
+    if (chacha20poly1305Decrypt(out, kRfcCipher, sizeof(kRfcCipher), kRfcAd, sizeof(kRfcAd), kRfcNonce, rfc_key) != 0 ||
+        memoryCompare(out, kRfcPlain, kRfcPlainLen) != 0)
+    {
+        printf("check failed: RFC 8439 vector, single decrypt\n");
+        return false;
+    }
+
+    msg = (wcrypto_aead_msg_t) {
+        .dst = out, .src = kRfcPlain, .src_len = kRfcPlainLen, .ad = kRfcAd, .ad_len = sizeof(kRfcAd)};
+    memoryCopy(msg.nonce, kRfcNonce, sizeof(kRfcNonce));
+    if (chacha20poly1305EncryptBatch(&msg, 1, rfc_key) != 0 || memoryCompare(out, kRfcCipher, sizeof(kRfcCipher)) != 0)
+    {
+        printf("check failed: RFC 8439 vector, batch encrypt\n");
+        return false;
+    }
+
+    msg.src     = kRfcCipher;
+    msg.src_len = sizeof(kRfcCipher);
+    if (chacha20poly1305DecryptBatch(&msg, 1, rfc_key) != 0 || memoryCompare(out, kRfcPlain, kRfcPlainLen) != 0)
+    {
+        printf("check failed: RFC 8439 vector, batch decrypt\n");
+        return false;
+    }
+    return true;
+}
+
+// every size of a burst differs, so messages of all lengths share the lanes of the batch block function
+static bool checkBatchMatchesSingle(void)
+{
+    static unsigned char expected[kBenchBurst][kBenchMaxPacket + kBenchTagLen];
+
+    for (size_t first = 0; first <= kBenchMaxPacket; first += kBenchBurst)
+    {
+        for (int i = 0; i < kBenchBurst; i++)
+        {
+            size_t len = min(first + (size_t) i, (size_t) kBenchMaxPacket);
+
+            for (size_t k = 0; k < len; k++)
+            {
+                packets[i].plain[k] = (unsigned char) (k * 31 + len);
+            }
+            memorySet(packets[i].ad, (int) len, kBenchAdLen);
+
+            msgs[i] = (wcrypto_aead_msg_t) {.dst     = packets[i].cipher,
+                                            .src     = packets[i].plain,
+                                            .src_len = len,
+                                            .ad      = packets[i].ad,
+                                            .ad_len  = (size_t) i % (kBenchAdLen + 1)};
+            for (int k = 0; k < (int) sizeof(msgs[i].nonce); k++)
+            {
+                msgs[i].nonce[k] = (unsigned char) (len * 13 + (size_t) k);
+            }
+
+            chacha20poly1305Encrypt(expected[i], msgs[i].src, len, msgs[i].ad, msgs[i].ad_len, msgs[i].nonce, key);
+        }
+
+        if (chacha20poly1305EncryptBatch(msgs, kBenchBurst, key) != 0)
+        {
+            printf("check failed: batch encrypt reported a failure\n");
+            return false;
+        }
+        for (int i = 0; i < kBenchBurst; i++)
+        {
+            if (memoryCompare(packets[i].cipher, expected[i], msgs[i].src_len + kBenchTagLen) != 0)
+            {
+                printf("check failed: batch encrypt differs from single, size %zu\n", msgs[i].src_len);
+                return false;
+            }
+        }
+
+        // the last message gets a forged tag, only that one may fail
+        packets[kBenchBurst - 1].cipher[msgs[kBenchBurst - 1].src_len] ^= 0x01;
+        for (int i = 0; i < kBenchBurst; i++)
+        {
+            msgs[i].src     = packets[i].cipher;
+            msgs[i].dst     = packets[i].plain;
+            msgs[i].src_len = msgs[i].src_len + kBenchTagLen;
+            memorySet(packets[i].plain, 0, msgs[i].src_len - kBenchTagLen);
+        }
+
+        if (chacha20poly1305DecryptBatch(msgs, kBenchBurst, key) != 1 || msgs[kBenchBurst - 1].result != -1)
+        {
+            printf("check failed: batch decrypt did not reject exactly the forged tag\n");
+            return false;
+        }
+        for (int i = 0; i < kBenchBurst - 1; i++)
+        {
+            size_t len = msgs[i].src_len - kBenchTagLen;
+            for (size_t k = 0; k < len; k++)
+            {
+                if (packets[i].plain[k] != (unsigned char) (k * 31 + len))
+                {
+                    printf("check failed: batch decrypt differs from the plaintext, size %zu\n", len);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static double benchGbps(unsigned long long elapsed_us, size_t bytes)
+{
+    return ((double) bytes * 8.0) / ((double) max(elapsed_us, 1ULL) * 1e3);
+}
+
+static void runBench(size_t packet_size)
+{
+    const size_t rounds = kBenchBytesTotal / (packet_size * kBenchBurst);
+    const size_t bytes  = rounds * packet_size * kBenchBurst;
+    int          failed = 0;
+
+    for (int i = 0; i < kBenchBurst; i++)
+    {
+        memorySet(packets[i].plain, i, packet_size);
+        memorySet(packets[i].ad, 0xAD, kBenchAdLen);
+    }
+
+    benchPrepare(packet_size, false);
+    unsigned long long begin = getHRTimeUs();
+    for (size_t r = 0; r < rounds; r++)
+    {
+        for (int i = 0; i < kBenchBurst; i++)
+        {
+            failed += chacha20poly1305Encrypt(msgs[i].dst, msgs[i].src, msgs[i].src_len, msgs[i].ad, msgs[i].ad_len,
+                                              msgs[i].nonce, key) != 0;
+        }
+    }
+    double enc_single = benchGbps(getHRTimeUs() - begin, bytes);
+
+    begin = getHRTimeUs();
+    for (size_t r = 0; r < rounds; r++)
+    {
+        failed += chacha20poly1305EncryptBatch(msgs, kBenchBurst, key);
+    }
+    double enc_batch = benchGbps(getHRTimeUs() - begin, bytes);
+
+    benchPrepare(packet_size, true);
+    begin = getHRTimeUs();
+    for (size_t r = 0; r < rounds; r++)
+    {
+        for (int i = 0; i < kBenchBurst; i++)
+        {
+            failed += chacha20poly1305Decrypt(msgs[i].dst, msgs[i].src, msgs[i].src_len, msgs[i].ad, msgs[i].ad_len,
+                                              msgs[i].nonce, key) != 0;
+        }
+    }
+    double dec_single = benchGbps(getHRTimeUs() - begin, bytes);
+
+    begin = getHRTimeUs();
+    for (size_t r = 0; r < rounds; r++)
+    {
+        failed += chacha20poly1305DecryptBatch(msgs, kBenchBurst, key);
+    }
+    double dec_batch = benchGbps(getHRTimeUs() - begin, bytes);
+
+    printf("%8zu %12.2f %12.2f %12.2f %12.2f%s\n", packet_size, enc_single, enc_batch, dec_single, dec_batch,
+           failed != 0 ? "  (failures!)" : "");
+}
+
+int main(void)
+{
+#if defined(WCRYPTO_BACKEND_SODIUM)
+    if (initSodium() < 0)
+    {
+        printf("could not initialize libsodium\n");
+        return 1;
+    }
+    printf("crypto backend: sodium\n");
+#elif defined(WCRYPTO_BACKEND_OPENSSL)
+    printf("crypto backend: openssl\n");
+#else
+    printf("crypto backend: software\n");
+#endif
+
+    for (int i = 0; i < (int) sizeof(key); i++)
+    {
+        key[i] = (unsigned char) (i * 7 + 1);
+    }
+
+    if (! checkRfcVector() || ! checkBatchMatchesSingle())
+    {
+        return 1;
+    }
+    printf("checks: RFC 8439 vector and batch == single passed\n");
+
+    printf("burst: %d packets, Gbps on one core\n\n", kBenchBurst);
+    printf("%8s %12s %12s %12s %12s\n", "size", "enc single", "enc batch", "dec single", "dec batch");
+
+    const size_t sizes[] = {64, 512, kBenchMaxPacket};
+
+    for (unsigned int s = 0; s < ARRAY_SIZE(sizes); s++)
+    {
+        runBench(sizes[s]);
+    }
+    return 0;
+}
@@ -0,0 +1,769 @@
+/*
+    End to end chain benchmark
+
+    runs the real runtime in this process with chains over loopback, all built from a config file like the ones
+    users write:
+
+        stream-in (TcpListener) -> stream-pass (Template) -> stream-out (TcpConnector) -> sink
+        direct-in (TcpListener) ---------------------------> direct-out (TcpConnector) -> sink
+        ping-in   (TcpListener) -> ping-pass   (Template) -> ping-out   (TcpConnector) -> echo
+
+        wg-a-in (BenchPacketDevice) -> wg-a (WireGuardDevice) -> wg-a-udp (UdpStatelessSocket) --+
+                                                                                                  | udp
+        wg-b-in (BenchPacketDevice) <- wg-b (WireGuardDevice) <- wg-b-udp (UdpStatelessSocket) <-+
+
+    the sink and the echo servers and the clients are plain blocking sockets on their own threads
+
+    stream: each connection writes payload sized messages as fast as it can, the sink counts what made it through
+    the chain, this measures throughput (Gbps and payloads/sec) and the cpu time spent per byte; the direct chain
+    has no node in the middle, so the listener and the connector can hand the stream to each other with splice
+
+    ping: each connection keeps one payload in flight and waits for the echo before sending the next one, this
+    measures the round trip through the chain in both directions (p50, p99 and max)
+
+    wireguard: BenchPacketDevice stands in for TunDevice (which needs root), it reads ip packets from one end of a
+    datagram socketpair and writes the packets that come back down to it, the two devices are peers of each other
+    with keys generated at startup; the benchmark writes ip packets into the first socketpair as fast as it can and
+    counts the ones that come out of the second, so each packet is encrypted, sent over udp and decrypted once
+    (built when WireGuardDevice and UdpStatelessSocket are included)
+
+    the cpu column is the time of the whole process, so it includes the clients and the servers, compare it
+    between revisions rather than reading it as the cost of the chain alone
+
+    usage: bench_chain [workers]        (default 2)
+*/
+
+#include "wwapi.h"
+
+#include "tunnels/TcpConnector/include/interface.h"
+#include "tunnels/TcpListener/include/interface.h"
+#include "tunnels/template/include/interface.h"
+
+#if defined(INCLUDE_WIREGUARD_DEVICE) && defined(INCLUDE_UDP_STATELESS_SOCKET)
+#define BENCH_WIREGUARD 1
+#include "tunnels/UdpStatelessSocket/include/interface.h"
+#include "tunnels/WireGuardDevice/include/interface.h"
+#else
+#define BENCH_WIREGUARD 0
+#endif
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdio.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+enum
+{
+    kBenchStreamPort     = 17100, // the stream chain listens here, the sink on the next port
+    kBenchPingPort       = 17102, // the ping chain listens here, the echo server on the next port
+    kBenchDirectPort     = 17104, // the direct chain listens here, it feeds the stream sink
+    kBenchWireGuardPort  = 17106, // udp port of the first wireguard device, the second one on the next port
+    kBenchMaxConnections = 64,
+    kBenchMaxPayload     = 1 << 14,
+    kBenchStreamMs       = 2000,
+    kBenchPingRounds     = 1 << 14, // split between the connections
+    kBenchConnectTries   = 500,
+    kBenchPacketMax      = 1400, // inner ip packet, leaves room for the wireguard header in a small buffer
+    kBenchHandshakeMs    = 5000, // how long the wireguard peers may take to agree on keys
+    kBenchKeyBase64Size  = 45    // base64 of a 32 byte key plus the terminator
+};
+
+static const char kBenchConfigPath[] = "bench_chain_config.json";
+
+typedef struct bench_conn_s
+{
+    int       fd;
+    bool      echo;
+    wthread_t thread;
+
+} bench_conn_t;
+
+typedef struct bench_server_s
+{
+    int          listen_fd;
+    bool         echo;
+    int          expected; // connections of the current run
+    wthread_t    thread;
+    bench_conn_t conns[kBenchMaxConnections];
+
+} bench_server_t;
+
+typedef struct bench_client_s
+{
+    atomic_bool *start;
+    atomic_bool *stop;
+    uint16_t     port;
+    uint32_t     size;
+    uint32_t     rounds;  // ping only
+    uint64_t    *rtts_us; // ping only, one per round
+    wthread_t    thread;
+
+} bench_client_t;
+
+// bytes that reached the sink
+static atomic_ullong sink_bytes;
+
+static uint8_t payload[kBenchMaxPayload];
+
+#if BENCH_WIREGUARD
+
+typedef struct bench_packet_device_s
+{
+    int fd; // our end of the socketpair
+
+} bench_packet_device_t;
+
+// [0] is the end the benchmark uses, [1] is held by the BenchPacketDevice of that side
+static int packets_in[2];
+static int packets_out[2];
+
+// packets that came out of the second wireguard device
+static atomic_ullong packets_received;
+
+static void benchPacketDeviceOnRead(wio_t *io, sbuf_t *buf)
+{
+    tunnel_t *t = weventGetUserdata(io);
+    line_t   *l = tunnelchainGetPacketLine(tunnelGetChain(t), wloopGetWid(weventGetLoop(io)));
+
+    lineLock(l);
+    tunnelNextUpStreamPayload(t, l, buf);
+    lineUnlock(l);
+}
+
+static void benchPacketDeviceDownStreamPayload(tunnel_t *t, line_t *l, sbuf_t *buf)
+{
+    bench_packet_device_t *state = tunnelGetState(t);
+
+    // a full socket buffer drops the packet, like a tun device does
+    discard send(state->fd, sbufGetRawPtr(buf), sbufGetLength(buf), MSG_DONTWAIT);
+    bufferpoolReuseBuffer(getWorkerBufferPool(lineGetWID(l)), buf);
+}
+
+static void benchPacketDeviceOnStart(tunnel_t *t)
+{
+    bench_packet_device_t *state = tunnelGetState(t);
+
+    for (wid_t i = 0; i < getWorkersCount() - WORKER_ADDITIONS; i++)
+    {
+        tunnelNextUpStreamInit(t, tunnelchainGetPacketLine(tunnelGetChain(t), i));
+    }
+
+    // one reader on the first worker, like the single queue reader of TunDevice
+    wio_t *io = wioGet(getWorkerLoop(0), state->fd);
+    weventSetUserData(io, t);
+    wioSetCallBackRead(io, benchPacketDeviceOnRead);
+    wioRead(io);
+}
+
+static tunnel_t *benchPacketDeviceCreate(node_t *node)
+{
+    tunnel_t *t = tunnelCreate(node, sizeof(bench_packet_device_t), 0);
+
+    t->fnPayloadD = &benchPacketDeviceDownStreamPayload;
+    t->onStart    = &benchPacketDeviceOnStart;
+
+    bench_packet_device_t *state = tunnelGetState(t);
+    if (! getIntFromJsonObject(&state->fd, node->node_settings_json, "fd"))
+    {
+        printError("bench_chain: BenchPacketDevice->settings->fd is missing\n");
+        return NULL;
+    }
+    return t;
+}
+
+static void benchPacketDeviceDestroy(tunnel_t *t)
+{
+    tunnelDestroy(t);
+}
+
+static api_result_t benchPacketDeviceApi(tunnel_t *instance, sbuf_t *message)
+{
+    discard instance;
+    bufferpoolReuseBuffer(getWorkerBufferPool(getWID()), message);
+    return (api_result_t) {.result_code = kApiResultOk};
+}
+
+static node_t benchPacketDeviceGet(void)
+{
+    const char *type_name = "BenchPacketDevice";
+    node_t      node      = {
+                  .type                  = stringDuplicate(type_name),
+                  .hash_type             = calcHashBytes(type_name, stringLength(type_name)),
+                  .version               = 0001,
+                  .createHandle          = benchPacketDeviceCreate,
+                  .destroyHandle         = benchPacketDeviceDestroy,
+                  .apiHandle             = benchPacketDeviceApi,
+                  .flags                 = kNodeFlagChainHead,
+                  .required_padding_left = 0,
+                  .layer_group           = kNodeLayer3,
+                  .layer_group_next_node = kNodeLayerAnything,
+                  .layer_group_prev_node = kNodeLayerAnything,
+                  .can_have_next         = true,
+                  .can_have_prev         = true,
+    };
+    return node;
+}
+
+// an x25519 key pair in the base64 form the WireGuardDevice settings take
+static void benchWireGuardKeys(char private_key[kBenchKeyBase64Size], char public_key[kBenchKeyBase64Size])
+{
+    static const uint8_t kBasepoint[32] = {9};
+    uint8_t              secret[32];
+    uint8_t              point[32];
+
+    getRandomBytes(secret, sizeof(secret));
+    secret[0] &= 248;
+    secret[31] = (secret[31] & 127) | 64;
+    if (performX25519(point, secret, kBasepoint) != 0)
+    {
+        printError("bench_chain: could not generate a wireguard key\n");
+        exit(1);
+    }
+    private_key[wwBase64Encode(secret, sizeof(secret), private_key)] = '\0';
+    public_key[wwBase64Encode(point, sizeof(point), public_key)]     = '\0';
+}
+
+// an ipv4 / udp packet from 10.66.0.1 to 10.66.0.2, the address both peers route to each other
+static void benchFillIpPacket(uint8_t *packet, uint32_t size)
+{
+    static const uint8_t kHeader[28] = {
+        0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 64, 17, 0x00, 0x00, // length and checksum filled below
+        10,   66,   0,    1,    10,   66,   0,    2,                        // 10.66.0.1 -> 10.66.0.2
+        0x9c, 0x40, 0x9c, 0x41, 0x00, 0x00, 0x00, 0x00                      // udp 40000 -> 40001
+    };
+    memoryCopy(packet, kHeader, sizeof(kHeader));
+    memorySet(packet + sizeof(kHeader), 'w', size - sizeof(kHeader));
+
+    packet[2]  = (uint8_t) (size >> 8);
+    packet[3]  = (uint8_t) size;
+    packet[24] = (uint8_t) ((size - 20) >> 8);
+    packet[25] = (uint8_t) (size - 20);
+
+    uint32_t sum = 0;
+    for (int i = 0; i < 20; i += 2)
+    {
+        sum += ((uint32_t) packet[i] << 8) | packet[i + 1];
+    }
+    while (sum >> 16)
+    {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+    packet[10] = (uint8_t) (~sum >> 8);
+    packet[11] = (uint8_t) ~sum;
+}
+
+#endif
+
+static bool benchSendAll(int fd, const uint8_t *data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+        if (n <= 0)
+        {
+            return false;
+        }
+        data += n;
+        len -= (size_t) n;
+    }
+    return true;
+}
+
+static bool benchRecvAll(int fd, uint8_t *data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = recv(fd, data, len, 0);
+        if (n <= 0)
+        {
+            return false;
+        }
+        data += n;
+        len -= (size_t) n;
+    }
+    return true;
+}
+
+static struct sockaddr_in benchLoopbackAddress(uint16_t port)
+{
+    struct sockaddr_in addr = {0};
+    addr.sin_family         = AF_INET;
+    addr.sin_port           = htons(port);
+    addr.sin_addr.s_addr    = htonl(INADDR_LOOPBACK);
+    return addr;
+}
+
+static int benchListen(uint16_t port)
+{
+    struct sockaddr_in addr = benchLoopbackAddress(port);
+    int                one  = 1;
+    int                fd   = socket(AF_INET, SOCK_STREAM, 0);
+
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (bind(fd, (struct sockaddr *) &addr, sizeof(addr)) != 0 || listen(fd, kBenchMaxConnections) != 0)
+    {
+        printError("bench_chain: could not listen on 127.0.0.1:%u\n", (unsigned int) port);
+        exit(1);
+    }
+    return fd;
+}
+
+// the listeners of the chain are bound by the socket manager after it starts, so the first connects may be refused
+static int benchConnect(uint16_t port)
+{
+    struct sockaddr_in addr = benchLoopbackAddress(port);
+    int                one  = 1;
+
+    for (int i = 0; i < kBenchConnectTries; i++)
+    {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (connect(fd, (struct sockaddr *) &addr, sizeof(addr)) == 0)
+        {
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            return fd;
+        }
+        close(fd);
+        ww_msleep(10);
+    }
+    printError("bench_chain: could not connect to the chain on 127.0.0.1:%u\n", (unsigned int) port);
+    exit(1);
+}
+
+static WTHREAD_ROUTINE(benchConnThread)
+{
+    bench_conn_t *conn = userdata;
+    uint8_t       buf[kBenchMaxPayload];
+    ssize_t       n;
+
+    while ((n = recv(conn->fd, buf, sizeof(buf), 0)) > 0)
+    {
+        if (! conn->echo)
+        {
+            atomicAddExplicit(&sink_bytes, (unsigned long long) n, memory_order_relaxed);
+        }
+        else if (! benchSendAll(conn->fd, buf, (size_t) n))
+        {
+            break;
+        }
+    }
+    close(conn->fd);
+    return 0;
+}
+
+static WTHREAD_ROUTINE(benchServerThread)
+{
+    bench_server_t *server = userdata;
+
+    for (int i = 0; i < server->expected; i++)
+    {
+        server->conns[i]        = (bench_conn_t) {.fd = accept(server->listen_fd, NULL, NULL), .echo = server->echo};
+        server->conns[i].thread = threadCreate(benchConnThread, &server->conns[i]);
+    }
+    for (int i = 0; i < server->expected; i++)
+    {
+        threadJoin(server->conns[i].thread);
+    }
+    return 0;
+}
+
+static void benchWaitStart(bench_client_t *client)
+{
+    while (! atomicLoadExplicit(client->start, memory_order_acquire))
+    {
+        YIELD_THREAD();
+    }
+}
+
+static WTHREAD_ROUTINE(benchStreamClientThread)
+{
+    bench_client_t *client = userdata;
+    int             fd     = benchConnect(client->port);
+
+    benchWaitStart(client);
+
+    while (! atomicLoadExplicit(client->stop, memory_order_relaxed))
+    {
+        if (! benchSendAll(fd, payload, client->size))
+        {
+            break;
+        }
+    }
+    close(fd);
+    return 0;
+}
+
+static WTHREAD_ROUTINE(benchPingClientThread)
+{
+    bench_client_t *client = userdata;
+    int             fd     = benchConnect(client->port);
+    uint8_t         buf[kBenchMaxPayload];
+
+    benchWaitStart(client);
+
+    for (uint32_t i = 0; i < client->rounds; i++)
+    {
+        uint64_t begin = getHRTimeUs();
+        if (! benchSendAll(fd, payload, client->size) || ! benchRecvAll(fd, buf, client->size))
+        {
+            printError("bench_chain: the ping chain closed the connection\n");
+            exit(1);
+        }
+        client->rtts_us[i] = getHRTimeUs() - begin;
+    }
+    close(fd);
+    return 0;
+}
+
+static uint64_t benchCpuTimeUs(void)
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (uint64_t) (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000ULL +
+           (uint64_t) (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+static int benchCompareU64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a;
+    uint64_t y = *(const uint64_t *) b;
+    return (x > y) - (x < y);
+}
+
+static void runStream(bench_server_t *sink, uint16_t port, int conns, uint32_t size)
+{
+    bench_client_t clients[kBenchMaxConnections];
+    atomic_bool    start = false;
+    atomic_bool    stop  = false;
+
+    sink->expected = conns;
+    sink->thread   = threadCreate(benchServerThread, sink);
+
+    for (int i = 0; i < conns; i++)
+    {
+        clients[i] = (bench_client_t) {.start = &start, .stop = &stop, .port = port, .size = size};
+        clients[i].thread = threadCreate(benchStreamClientThread, &clients[i]);
+    }
+
+    // lets the connections settle before the window opens
+    ww_msleep(100);
+
+    unsigned long long bytes_begin = atomicLoadExplicit(&sink_bytes, memory_order_relaxed);
+    uint64_t           cpu_begin   = benchCpuTimeUs();
+    uint64_t           begin       = getHRTimeUs();
+
+    atomicStoreExplicit(&start, true, memory_order_release);
+    ww_msleep(kBenchStreamMs);
+
+    unsigned long long bytes   = atomicLoadExplicit(&sink_bytes, memory_order_relaxed) - bytes_begin;
+    uint64_t           cpu     = benchCpuTimeUs() - cpu_begin;
+    double             seconds = (double) max(getHRTimeUs() - begin, 1ULL) / 1e6;
+
+    atomicStoreExplicit(&stop, true, memory_order_relaxed);
+    for (int i = 0; i < conns; i++)
+    {
+        threadJoin(clients[i].thread);
+    }
+    threadJoin(sink->thread);
+
+    printf("%8d %10u %10.3f %14.0f %16.3f\n", conns, size, (double) bytes * 8 / seconds / 1e9,
+           (double) bytes / size / seconds, bytes ? (double) cpu * 1e3 / (double) bytes : 0.0);
+}
+
+static void runPing(bench_server_t *echo, int conns, uint32_t size)
+{
+    bench_client_t clients[kBenchMaxConnections];
+    atomic_bool    start  = false;
+    uint32_t       rounds = max(kBenchPingRounds / (uint32_t) conns, 1U);
+    uint64_t       count  = (uint64_t) rounds * (uint64_t) conns;
+    uint64_t      *rtts   = memoryAllocate(sizeof(uint64_t) * count);
+
+    echo->expected = conns;
+    echo->thread   = threadCreate(benchServerThread, echo);
+
+    for (int i = 0; i < conns; i++)
+    {
+        clients[i] = (bench_client_t) {
+            .start = &start, .port = kBenchPingPort, .size = size, .rounds = rounds, .rtts_us = rtts + i * rounds};
+        clients[i].thread = threadCreate(benchPingClientThread, &clients[i]);
+    }
+
+    ww_msleep(100);
+
+    uint64_t begin = getHRTimeUs();
+    atomicStoreExplicit(&start, true, memory_order_release);
+
+    for (int i = 0; i < conns; i++)
+    {
+        threadJoin(clients[i].thread);
+    }
+    double seconds = (double) max(getHRTimeUs() - begin, 1ULL) / 1e6;
+    threadJoin(echo->thread);
+
+    qsort(rtts, count, sizeof(uint64_t), benchCompareU64);
+
+    printf("%8d %10u %14.0f %10llu %10llu %10llu\n", conns, size, (double) count / seconds,
+           (unsigned long long) rtts[count * 50 / 100], (unsigned long long) rtts[count * 99 / 100],
+           (unsigned long long) rtts[count - 1]);
+
+    memoryFree(rtts);
+}
+
+#if BENCH_WIREGUARD
+
+static WTHREAD_ROUTINE(benchPacketSinkThread)
+{
+    atomic_bool *stop = userdata;
+    uint8_t      buf[kBenchPacketMax + 64]; // decrypted packets keep the wireguard padding
+
+    while (! atomicLoadExplicit(stop, memory_order_relaxed))
+    {
+        if (recv(packets_out[0], buf, sizeof(buf), 0) > 0)
+        {
+            atomicAddExplicit(&packets_received, 1, memory_order_relaxed);
+        }
+    }
+    return 0;
+}
+
+// packets sent before the peers have keys are dropped by the device, so this keeps probing until one gets through
+static bool benchWaitHandshake(void)
+{
+    uint8_t  packet[64];
+    uint8_t  buf[kBenchPacketMax + 64];
+    uint64_t deadline = getHRTimeUs() + (uint64_t) kBenchHandshakeMs * 1000;
+
+    benchFillIpPacket(packet, sizeof(packet));
+    while (getHRTimeUs() < deadline)
+    {
+        discard send(packets_in[0], packet, sizeof(packet), 0);
+        if (recv(packets_out[0], buf, sizeof(buf), 0) > 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void runPackets(uint32_t size)
+{
+    uint8_t            packet[kBenchPacketMax];
+    atomic_bool        stop = false;
+    unsigned long long sent = 0;
+
+    benchFillIpPacket(packet, size);
+
+    wthread_t sink = threadCreate(benchPacketSinkThread, &stop);
+
+    unsigned long long received_begin = atomicLoadExplicit(&packets_received, memory_order_relaxed);
+    uint64_t           cpu_begin      = benchCpuTimeUs();
+    uint64_t           begin          = getHRTimeUs();
+    uint64_t           end            = begin + (uint64_t) kBenchStreamMs * 1000;
+
+    while (getHRTimeUs() < end)
+    {
+        if (send(packets_in[0], packet, size, 0) > 0)
+        {
+            sent++;
+        }
+    }
+
+    // packets still inside the chain at this point are counted as lost
+    unsigned long long received = atomicLoadExplicit(&packets_received, memory_order_relaxed) - received_begin;
+    uint64_t           cpu      = benchCpuTimeUs() - cpu_begin;
+    double             seconds  = (double) max(getHRTimeUs() - begin, 1ULL) / 1e6;
+    unsigned long long bytes    = received * size;
+
+    atomicStoreExplicit(&stop, true, memory_order_relaxed);
+    threadJoin(sink);
+
+    printf("%10u %10.3f %14.0f %10.2f %16.3f\n", size, (double) bytes * 8 / seconds / 1e9, (double) received / seconds,
+           sent ? (double) (sent - min(received, sent)) * 100 / (double) sent : 0.0,
+           bytes ? (double) cpu * 1e3 / (double) bytes : 0.0);
+}
+
+#endif
+
+static void writeChainConfig(void)
+{
+    FILE *f = fopen(kBenchConfigPath, "w");
+    if (f == NULL)
+    {
+        printError("bench_chain: could not write \"%s\"\n", kBenchConfigPath);
+        exit(1);
+    }
+
+    fprintf(f, "{\"name\": \"bench_chain\", \"nodes\": [\n");
+
+    const char *prefixes[] = {"stream", "ping"};
+    const int   ports[]    = {kBenchStreamPort, kBenchPingPort};
+
+    for (unsigned int i = 0; i < ARRAY_SIZE(prefixes); i++)
+    {
+        fprintf(f,
+                "%s{\"name\": \"%s-in\", \"type\": \"TcpListener\", \"next\": \"%s-pass\",\n"
+                " \"settings\": {\"address\": \"127.0.0.1\", \"port\": %d, \"nodelay\": true}},\n"
+                "{\"name\": \"%s-pass\", \"type\": \"Template\", \"next\": \"%s-out\"},\n"
+                "{\"name\": \"%s-out\", \"type\": \"TcpConnector\",\n"
+                " \"settings\": {\"address\": \"127.0.0.1\", \"port\": %d, \"nodelay\": true}}\n",
+                i == 0 ? "" : ",", prefixes[i], prefixes[i], ports[i], prefixes[i], prefixes[i], prefixes[i],
+                ports[i] + 1);
+    }
+
+    // no node in the middle, so nothing stops the listener and the connector from splicing the stream
+    fprintf(f,
+            ",{\"name\": \"direct-in\", \"type\": \"TcpListener\", \"next\": \"direct-out\",\n"
+            " \"settings\": {\"address\": \"127.0.0.1\", \"port\": %d, \"nodelay\": true}},\n"
+            "{\"name\": \"direct-out\", \"type\": \"TcpConnector\",\n"
+            " \"settings\": {\"address\": \"127.0.0.1\", \"port\": %d, \"nodelay\": true}}\n",
+            kBenchDirectPort, kBenchStreamPort + 1);
+
+#if BENCH_WIREGUARD
+    char private_keys[2][kBenchKeyBase64Size];
+    char public_keys[2][kBenchKeyBase64Size];
+    benchWireGuardKeys(private_keys[0], public_keys[0]);
+    benchWireGuardKeys(private_keys[1], public_keys[1]);
+
+    // both devices know the endpoint of the other and initiate on the same timer tick, the retry jitter of
+    // WireGuardDevice has to pick one of them
+    const char *sides[] = {"a", "b"};
+    const int   fds[]   = {packets_in[1], packets_out[1]};
+
+    for (unsigned int i = 0; i < ARRAY_SIZE(sides); i++)
+    {
+        unsigned int peer = 1 - i;
+        fprintf(f,
+                ",{\"name\": \"wg-%s-in\", \"type\": \"BenchPacketDevice\", \"next\": \"wg-%s\",\n"
+                " \"settings\": {\"fd\": %d}},\n"
+                "{\"name\": \"wg-%s\", \"type\": \"WireGuardDevice\", \"next\": \"wg-%s-udp\",\n"
+                " \"settings\": {\"privatekey\": \"%s\", \"peers\": [{\"publickey\": \"%s\",\n"
+                "  \"allowedips\": \"10.66.0.0/24,fd66::/64\", \"endpoint\": \"127.0.0.1:%d\"}]}},\n"
+                "{\"name\": \"wg-%s-udp\", \"type\": \"UdpStatelessSocket\",\n"
+                " \"settings\": {\"listen-address\": \"127.0.0.1\", \"listen-port\": %d}}\n",
+                sides[i], sides[i], fds[i], sides[i], sides[i], private_keys[i], public_keys[peer],
+                kBenchWireGuardPort + (int) peer, sides[i], kBenchWireGuardPort + (int) i);
+    }
+#endif
+    fprintf(f, "]}\n");
+    fclose(f);
+}
+
+static WTHREAD_ROUTINE(benchMainThread)
+{
+    discard userdata;
+
+    bench_server_t *sink = memoryAllocate(sizeof(bench_server_t));
+    bench_server_t *echo = memoryAllocate(sizeof(bench_server_t));
+
+    *sink = (bench_server_t) {.listen_fd = benchListen(kBenchStreamPort + 1), .echo = false};
+    *echo = (bench_server_t) {.listen_fd = benchListen(kBenchPingPort + 1), .echo = true};
+
+    const uint32_t sizes[] = {64, 1400, kBenchMaxPayload};
+
+    printf("\nstream: %d ms per run, %u workers\n", kBenchStreamMs, (unsigned int) getWorkersCount() - WORKER_ADDITIONS);
+    printf("%8s %10s %10s %14s %16s\n", "conns", "payload", "Gbps", "payloads/sec", "cpu(ns)/byte");
+    for (unsigned int s = 0; s < ARRAY_SIZE(sizes); s++)
+    {
+        for (int conns = 1; conns <= kBenchMaxConnections; conns *= 4)
+        {
+            runStream(sink, kBenchStreamPort, conns, sizes[s]);
+        }
+    }
+
+    printf("\ndirect stream: TcpListener -> TcpConnector\n");
+    printf("%8s %10s %10s %14s %16s\n", "conns", "payload", "Gbps", "payloads/sec", "cpu(ns)/byte");
+    for (unsigned int s = 0; s < ARRAY_SIZE(sizes); s++)
+    {
+        for (int conns = 1; conns <= kBenchMaxConnections; conns *= 4)
+        {
+            runStream(sink, kBenchDirectPort, conns, sizes[s]);
+        }
+    }
+
+    printf("\nping: %d round trips per run\n", kBenchPingRounds);
+    printf("%8s %10s %14s %10s %10s %10s\n", "conns", "payload", "rtt/sec", "p50(us)", "p99(us)", "max(us)");
+    for (unsigned int s = 0; s < ARRAY_SIZE(sizes); s++)
+    {
+        for (int conns = 1; conns <= kBenchMaxConnections; conns *= 4)
+        {
+            runPing(echo, conns, sizes[s]);
+        }
+    }
+
+#if BENCH_WIREGUARD
+    if (! benchWaitHandshake())
+    {
+        printError("bench_chain: the wireguard peers did not complete a handshake in %d ms\n", kBenchHandshakeMs);
+        exit(1);
+    }
+
+    const uint32_t packet_sizes[] = {64, 512, kBenchPacketMax};
+
+    printf("\nwireguard: %d ms per run, one flow through two WireGuardDevice peers\n", kBenchStreamMs);
+    printf("%10s %10s %14s %10s %16s\n", "packet", "Gbps", "packets/sec", "lost(%)", "cpu(ns)/byte");
+    for (unsigned int s = 0; s < ARRAY_SIZE(packet_sizes); s++)
+    {
+        runPackets(packet_sizes[s]);
+    }
+#endif
+
+    // the workers are still running the chains, the process ends here without tearing them down
+    fflush(stdout);
+    exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    initWLibc();
+
+    char log_levels[4][8] = {"WARN", "WARN", "WARN", "WARN"};
+    char no_file[]        = "";
+
+    ww_construction_data_t runtime_data = {
+        .workers_count        = argc > 1 ? (unsigned int) atoi(argv[1]) : 2,
+        .ram_profile          = kRamProfileM1Memory,
+        .internal_logger_data = {.log_file_path = no_file, .log_level = log_levels[0], .log_console = true},
+        .core_logger_data     = {.log_file_path = no_file, .log_level = log_levels[1], .log_console = true},
+        .network_logger_data  = {.log_file_path = no_file, .log_level = log_levels[2], .log_console = true},
+        .dns_logger_data      = {.log_file_path = no_file, .log_level = log_levels[3], .log_console = true},
+    };
+    createGlobalState(runtime_data);
+
+    nodelibraryRegister(nodeTcpListenerGet());
+    nodelibraryRegister(nodeTemplateGet());
+    nodelibraryRegister(nodeTcpConnectorGet());
+
+#if BENCH_WIREGUARD
+    nodelibraryRegister(benchPacketDeviceGet());
+    nodelibraryRegister(nodeWireGuardDeviceGet());
+    nodelibraryRegister(nodeUdpStatelessSocketGet());
+
+    if (socketpair(AF_UNIX, SOCK_DGRAM, 0, packets_in) != 0 || socketpair(AF_UNIX, SOCK_DGRAM, 0, packets_out) != 0)
+    {
+        printError("bench_chain: could not create the packet socketpairs\n");
+        exit(1);
+    }
+    // the benchmark side never blocks for long, so the runs can check their clock
+    struct timeval timeout = {.tv_sec = 0, .tv_usec = 100 * 1000};
+    setsockopt(packets_in[0], SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    setsockopt(packets_out[0], SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+#endif
+
+    writeChainConfig();
+    config_file_t *cfile = configfileParse(kBenchConfigPath);
+    remove(kBenchConfigPath);
+    if (! cfile)
+    {
+        terminateProgram(1);
+    }
+    nodemanagerRunConfigFile(cfile);
+
+    memorySet(payload, 'w', sizeof(payload));
+
+    socketmanagerStart();
+    threadCreate(benchMainThread, NULL);
+    runMainThread();
+    return 0;
+}
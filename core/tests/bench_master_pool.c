@@ -0,0 +1,134 @@
+/*
+    Master pool contention benchmark
+
+    every thread acts like a worker whose local pool keeps running dry / overflowing, it recharges a batch from the
+    master pool and returns a batch to it in a tight loop; this is what device reader threads and workers do with
+    the shared buffer pools (batch of half a generic pool) and with the reader message pools (batch of 1)
+
+    the binary measures the master pool variant it was built with, to compare both:
+
+        cmake -B build-mutex    -DBUILD_BENCHMARKS=ON -DMASTER_POOL_LOCKFREE=OFF
+        cmake -B build-lockfree -DBUILD_BENCHMARKS=ON -DMASTER_POOL_LOCKFREE=ON
+
+    then run bench_master_pool from both build directories and compare the items/sec columns
+*/
+
+#include "master_pool.h"
+#include "wlibc.h"
+#include "wthread.h"
+
+#include <stdio.h>
+
+enum
+{
+    kBenchPoolWidth  = 1024, // same order as the buffer pools master width
+    kBenchBatch      = 64,   // items moved per recharge, half of a generic pool
+    kBenchItemsMoved = 1280000,
+    kBenchMaxThreads = 64,
+    kBenchItemSize   = 64
+};
+
+typedef struct bench_thread_s
+{
+    master_pool_t *pool;
+    atomic_bool   *start;
+    uint32_t       batch;
+    wthread_t      thread;
+
+} bench_thread_t;
+
+static atomic_ullong created_count;
+
+static master_pool_item_t *benchCreateItem(master_pool_t *pool, void *userdata)
+{
+    discard pool;
+    discard userdata;
+    atomicIncRelaxed(&created_count);
+    return memoryAllocate(kBenchItemSize);
+}
+
+static void benchDestroyItem(master_pool_t *pool, master_pool_item_t *item, void *userdata)
+{
+    discard pool;
+    discard userdata;
+    memoryFree(item);
+}
+
+static WTHREAD_ROUTINE(benchThread)
+{
+    bench_thread_t *t = userdata;
+    void           *items[kBenchBatch];
+
+    while (! atomicLoadExplicit(t->start, memory_order_acquire))
+    {
+    }
+
+    const uint32_t rounds = kBenchItemsMoved / t->batch;
+
+    for (uint32_t i = 0; i < rounds; i++)
+    {
+        masterpoolGetItems(t->pool, (master_pool_item_t const **) items, t->batch, NULL);
+        masterpoolReuseItems(t->pool, items, t->batch, NULL);
+    }
+    return 0;
+}
+
+static void runBench(int threads_count, uint32_t batch)
+{
+    bench_thread_t threads[kBenchMaxThreads];
+    atomic_bool    start = false;
+
+    master_pool_t *pool = masterpoolCreateWithCapacity(kBenchPoolWidth);
+    masterpoolInstallCallBacks(pool, benchCreateItem, benchDestroyItem);
+
+    atomicStore(&created_count, 0);
+
+    for (int i = 0; i < threads_count; i++)
+    {
+        threads[i] = (bench_thread_t) {.pool = pool, .start = &start, .batch = batch};
+        threads[i].thread = threadCreate(benchThread, &threads[i]);
+    }
+
+    unsigned long long begin = getHRTimeUs();
+    atomicStoreExplicit(&start, true, memory_order_release);
+
+    for (int i = 0; i < threads_count; i++)
+    {
+        threadJoin(threads[i].thread);
+    }
+    unsigned long long elapsed = max(getHRTimeUs() - begin, 1ULL);
+
+    masterpoolMakeEmpty(pool, NULL);
+    masterpoolDestroy(pool);
+
+    // every round moves batch items out of the pool and batch items back in
+    double moved  = 2.0 * (double) (kBenchItemsMoved / batch) * (double) batch * (double) threads_count;
+    double misses = (double) atomicLoad(&created_count);
+
+    printf("%8d %14.0f %12.3f %13.2f%%\n", threads_count, moved / ((double) elapsed / 1e6), (double) elapsed / 1e3,
+           100.0 * misses / (moved / 2.0));
+}
+
+int main(void)
+{
+#ifdef MASTER_POOL_LOCKFREE
+    printf("master pool variant: lock-free\n");
+#else
+    printf("master pool variant: mutex\n");
+#endif
+    printf("items moved per thread: %d, pool width: %d\n", 2 * kBenchItemsMoved, kBenchPoolWidth);
+
+    const uint32_t batches[] = {kBenchBatch, 1};
+
+    for (unsigned int b = 0; b < ARRAY_SIZE(batches); b++)
+    {
+        printf("\nbatch: %u items\n", batches[b]);
+        printf("%8s %14s %12s %14s\n", "threads", "items/sec", "time(ms)", "create ratio");
+
+        for (int threads_count = 2; threads_count <= kBenchMaxThreads; threads_count *= 2)
+        {
+            runBench(threads_count, batches[b]);
+        }
+    }
+    return 0;
+}
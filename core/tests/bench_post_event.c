@@ -0,0 +1,175 @@
+/*
+    Cross thread event posting benchmark
+
+    producer threads post events to one running loop with wloopPostEvent, like workers do with sendWorkerMessage,
+    the device reader threads with the packet distribution and the pipe tunnel with its hops
+
+    flood: the producers post as fast as they can, this measures the throughput of the inbox, the latency column
+    is mostly the backlog of the loop
+
+    ping: each producer keeps one event in flight and waits for the loop to run it before posting the next one,
+    this measures the wakeup latency while the producers contend for the inbox
+
+    to compare with the previous (mutex + eventfd write per post) inbox, build this file on the parent revision of
+    the change that added the ring and compare the events/sec and latency columns
+*/
+
+#include "buffer_pool.h"
+#include "loggers/internal_logger.h"
+#include "master_pool.h"
+#include "wevent.h"
+#include "wlibc.h"
+#include "wloop.h"
+#include "wmutex.h"
+#include "wthread.h"
+
+#include <stdio.h>
+
+enum
+{
+    kBenchEvents     = 1 << 21, // split between the producers
+    kBenchPingEvents = 1 << 16,
+    kBenchMaxThreads = 64
+};
+
+typedef struct bench_thread_s
+{
+    wloop_t     *loop;
+    atomic_bool *start;
+    uint32_t     events;
+    bool         ping;
+    atomic_bool  acked;
+    wthread_t    thread;
+
+} bench_thread_t;
+
+// only touched by the loop thread
+static uint64_t received;
+static uint64_t expected;
+static uint64_t latency_sum_us;
+static uint64_t latency_max_us;
+
+static void benchOnEvent(wevent_t *ev)
+{
+    bench_thread_t *t       = weventGetUserdata(ev);
+    uint64_t        latency = getHRTimeUs() - (uint64_t) (uintptr_t) ev->privdata;
+
+    latency_sum_us += latency;
+    latency_max_us = max(latency_max_us, latency);
+
+    if (t->ping)
+    {
+        atomicStoreExplicit(&t->acked, true, memory_order_release);
+    }
+    if (++received == expected)
+    {
+        wloopStop(weventGetLoop(ev));
+    }
+}
+
+static void benchNoop(wevent_t *ev)
+{
+    discard ev;
+}
+
+static WTHREAD_ROUTINE(benchLoopThread)
+{
+    wloopRun((wloop_t *) userdata);
+    return 0;
+}
+
+static WTHREAD_ROUTINE(benchProducerThread)
+{
+    bench_thread_t *t = userdata;
+
+    while (! atomicLoadExplicit(t->start, memory_order_acquire))
+    {
+    }
+
+    for (uint32_t i = 0; i < t->events; i++)
+    {
+        wevent_t ev = {0};
+        ev.cb       = benchOnEvent;
+        ev.privdata = (void *) (uintptr_t) getHRTimeUs();
+        weventSetUserData(&ev, t);
+
+        atomicStoreExplicit(&t->acked, false, memory_order_relaxed);
+        wloopPostEvent(t->loop, &ev);
+
+        while (t->ping && ! atomicLoadExplicit(&t->acked, memory_order_acquire))
+        {
+            YIELD_THREAD();
+        }
+    }
+    return 0;
+}
+
+static void runBench(buffer_pool_t *pool, int threads_count, bool ping)
+{
+    bench_thread_t threads[kBenchMaxThreads];
+    atomic_bool    start = false;
+
+    wloop_t *loop = wloopCreate(0, pool, 0);
+
+    // creates the eventfd on this thread before the loop runs, as the first post of a worker would
+    wevent_t first = {0};
+    first.cb       = benchNoop;
+    wloopPostEvent(loop, &first);
+
+    const uint32_t per_thread = (ping ? kBenchPingEvents : kBenchEvents) / (uint32_t) threads_count;
+
+    received       = 0;
+    expected       = (uint64_t) per_thread * (uint64_t) threads_count;
+    latency_sum_us = 0;
+    latency_max_us = 0;
+
+    wthread_t loop_thread = threadCreate(benchLoopThread, loop);
+
+    for (int i = 0; i < threads_count; i++)
+    {
+        threads[i] = (bench_thread_t) {.loop = loop, .start = &start, .events = per_thread, .ping = ping};
+        threads[i].thread = threadCreate(benchProducerThread, &threads[i]);
+    }
+
+    unsigned long long begin = getHRTimeUs();
+    atomicStoreExplicit(&start, true, memory_order_release);
+
+    for (int i = 0; i < threads_count; i++)
+    {
+        threadJoin(threads[i].thread);
+    }
+    threadJoin(loop_thread);
+
+    unsigned long long elapsed = max(getHRTimeUs() - begin, 1ULL);
+
+    wloopDestroy(&loop);
+
+    printf("%8d %14.0f %12.3f %16.2f %16llu\n", threads_count, (double) expected / ((double) elapsed / 1e6),
+           (double) elapsed / 1e3, (double) latency_sum_us / (double) expected, (unsigned long long) latency_max_us);
+}
+
+int main(void)
+{
+    // the loop logs its shutdown on the internal logger
+    loggerSetLevelByString(loggerGetDefaultLogger(), "WARN");
+
+    master_pool_t *mp_large = masterpoolCreateWithCapacity(64);
+    master_pool_t *mp_small = masterpoolCreateWithCapacity(64);
+    buffer_pool_t *pool     = bufferpoolCreate(mp_large, mp_small, 16, 1 << 15, 1024);
+
+    const bool pings[] = {false, true};
+
+    for (unsigned int p = 0; p < ARRAY_SIZE(pings); p++)
+    {
+        printf("\n%s: %d events per run\n", pings[p] ? "ping" : "flood", pings[p] ? kBenchPingEvents : kBenchEvents);
+        printf("%8s %14s %12s %16s %16s\n", "threads", "events/sec", "time(ms)", "avg latency(us)", "max latency(us)");
+
+        for (int threads_count = 1; threads_count <= kBenchMaxThreads; threads_count *= 2)
+        {
+            runBench(pool, threads_count, pings[p]);
+        }
+    }
+
+    bufferpoolDestroy(pool);
+    return 0;
+}
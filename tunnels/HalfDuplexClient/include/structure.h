@@ -8,10 +8,9 @@ enum
     kHLFDCmdDownload = 128
 };
 
-// in tunnel create we said the size is 0 , change if you added state
 typedef struct halfduplexclient_tstate_s
 {
-    int unused;
+    bool chained_intro; // the tunnel that reads our upload payloads takes chained buffers
 } halfduplexclient_tstate_t;
 
 typedef struct halfduplexclient_lstate_s
@@ -4,7 +4,7 @@
 
 tunnel_t *halfduplexclientTunnelCreate(node_t *node)
 {
-    tunnel_t *t = tunnelCreate(node, 0, sizeof(halfduplexclient_lstate_t));
+    tunnel_t *t = tunnelCreate(node, sizeof(halfduplexclient_tstate_t), sizeof(halfduplexclient_lstate_t));
 
     t->fnInitU    = &halfduplexclientTunnelUpStreamInit;
     t->fnEstU     = &halfduplexclientTunnelUpStreamEst;
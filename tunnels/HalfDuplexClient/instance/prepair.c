@@ -4,6 +4,8 @@
 
 void halfduplexclientTunnelOnPrepair(tunnel_t *t)
 {
-    (void)t;
+    halfduplexclient_tstate_t *ts = tunnelGetState(t);
+
+    ts->chained_intro = tunnelNextAcceptsChainU(t);
 }
 
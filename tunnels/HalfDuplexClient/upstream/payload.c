@@ -33,13 +33,32 @@ void halfduplexclientTunnelUpStreamPayload(tunnel_t *t, line_t *l, sbuf_t *buf)
 
         cid_bytes[0] = cid_bytes[0] & kHLFDCmdUpload;
 
-        sbuf_t *intro_upload_payload =
-            sbufCreateWithPadding(sbufGetLength(buf), sizeof(cids) + tunnelGetChain(t)->sum_padding_left);
+        halfduplexclient_tstate_t *ts = tunnelGetState(t);
+        sbuf_t                    *intro_upload_payload;
 
-        sbufSetLength(intro_upload_payload, sbufGetLength(buf));
-        memoryCopyLarge(sbufGetMutablePtr(intro_upload_payload), sbufGetRawPtr(buf), sbufGetLength(buf));
-        sbufShiftLeft(intro_upload_payload, sizeof(cids));
-        sbufWrite(intro_upload_payload, cid_bytes, sizeof(cids));
+        if (ts->chained_intro)
+        {
+            // the connection id goes in front of the first payload as its own segment, the payload is not copied
+            sbuf_t *intro_upload_header = bufferpoolGetSmallBuffer(getWorkerBufferPool(lineGetWID(ls->upload_line)));
+            sbufSetLength(intro_upload_header, sizeof(cids));
+            sbufWrite(intro_upload_header, cid_bytes, sizeof(cids));
+
+            intro_upload_payload = sbufchainCreate();
+            sbufchainAppend(intro_upload_payload, intro_upload_header);
+            sbufchainAppend(intro_upload_payload, buf);
+        }
+        else
+        {
+            intro_upload_payload =
+                sbufCreateWithPadding(sbufGetLength(buf), sizeof(cids) + tunnelGetChain(t)->sum_padding_left);
+
+            sbufSetLength(intro_upload_payload, sbufGetLength(buf));
+            memoryCopyLarge(sbufGetMutablePtr(intro_upload_payload), sbufGetRawPtr(buf), sbufGetLength(buf));
+            sbufShiftLeft(intro_upload_payload, sizeof(cids));
+            sbufWrite(intro_upload_payload, cid_bytes, sizeof(cids));
+
+            bufferpoolReuseBuffer(getWorkerBufferPool(lineGetWID(l)), buf);
+        }
 
         line_t *upload_line = ls->upload_line;
         tunnelNextUpStreamPayload(t, upload_line, intro_upload_payload);
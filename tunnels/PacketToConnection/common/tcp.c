@@ -148,48 +148,33 @@ err_t lwipThreadPtcTcpRecvCallback(void *arg, struct tcp_pcb *tpcb, struct pbuf
         return ERR_OK;
     }
 
-    /*
-        This is a chained buffer and we must copy it anyway, so dont bother all nodes for it
-    */
-    if (p->tot_len <= bufferpoolGetLargeBufferSize(bp))
+    // a single pbuf built on one of our input packets, the packet buffer itself carries the payload
+    buf = ptcPbufDetachSbuf(p);
+    if (buf != NULL)
     {
-
-        if (p->tot_len <= bufferpoolGetSmallBufferSize(bp))
-        {
-            buf = bufferpoolGetSmallBuffer(bp);
-        }
-        else
-        {
-            buf = bufferpoolGetLargeBuffer(bp);
-        }
-
-        sbufSetLength(buf, p->tot_len);
-        pbuf_copy_partial(p, sbufGetMutablePtr(buf), p->tot_len, 0);
+        pbuf_free(p);
+        atomicInc(&lstate->messages);
+        sendWorkerMessageForceQueue(lineGetWID(lstate->line), localThreadPtcTcpRecvCallback, lstate, buf, NULL);
+        return ERR_OK;
     }
-    else
+
+    // chained or shared pbufs (e.g. out of order segments merged by lwip) are copied, in pieces if they are too large
+    uint16_t offset = 0;
+    while (offset < p->tot_len)
     {
-        assert(false); // not implemented
-    }
-    pbuf_free(p);
+        uint16_t len = (uint16_t) min((uint32_t) (p->tot_len - offset), bufferpoolGetLargeBufferSize(bp));
 
-    wid_t target_wid = lineGetWID(lstate->line);
-    // wid_t current_wid = getWID();
+        buf = len <= bufferpoolGetSmallBufferSize(bp) ? bufferpoolGetSmallBuffer(bp) : bufferpoolGetLargeBuffer(bp);
 
-    atomicInc(&lstate->messages);
+        sbufSetLength(buf, len);
+        pbuf_copy_partial(p, sbufGetMutablePtr(buf), len, offset);
+        offset = (uint16_t) (offset + len);
 
-    sendWorkerMessageForceQueue(target_wid, localThreadPtcTcpRecvCallback, lstate, buf, NULL);
+        atomicInc(&lstate->messages);
+        sendWorkerMessageForceQueue(lineGetWID(lstate->line), localThreadPtcTcpRecvCallback, lstate, buf, NULL);
+    }
+    pbuf_free(p);
 
-    // bool doing_direct_stack    = (current_wid == target_wid) && (atomicLoad(&lstate->messages) == 0);
-    // lstate->stack_owned_locked = doing_direct_stack;
-    // if (! doing_direct_stack)
-    // {
-    //     atomicInc(&lstate->messages);
-    //     sendWorkerMessageForceQueue(target_wid, localThreadPtcTcpRecvCallback, lstate, buf, NULL);
-    // }
-    // else
-    // {
-    //     sendWorkerMessage(target_wid, localThreadPtcTcpRecvCallback, lstate, buf, NULL);
-    // }
     return ERR_OK;
 }
 
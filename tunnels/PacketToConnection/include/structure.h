@@ -136,5 +136,15 @@ void ptcUdpReceived(void *arg, struct udp_pcb *upcb, struct pbuf *p, const ip_ad
 void updateCheckSumTcp(u16_t *_hc, const void *_orig, const void *_new, int n);
 void updateCheckSumUdp(u16_t *hc, const void *orig, const void *new, int n);
 
+/**
+ * @brief Takes the buffer out of a pbuf that lwip built on top of an input packet, without copying the payload.
+ *
+ * Only works for a single pbuf that nobody else references, the returned buffer contains just the payload and the
+ * pbuf must still be freed.
+ *
+ * @return The buffer, or NULL if the payload has to be copied.
+ */
+sbuf_t *ptcPbufDetachSbuf(struct pbuf *p);
+
 void  ptcFlushWriteQueue(ptc_lstate_t *lstate);
 err_t ptcTcpSendCompleteCallback(void *arg, struct tcp_pcb *tpcb, u16_t len);
@@ -2,24 +2,60 @@
 
 #include "loggers/network_logger.h"
 
-LWIP_MEMPOOL_DECLARE(RX_POOL, 10, sizeof(my_custom_pbuf_t), "Zero-copy RX PBUF pool")
+// a pbuf stays in this pool while lwip holds the packet, out of order segments are kept until the gap is filled
+LWIP_MEMPOOL_DECLARE(RX_POOL, 256, sizeof(my_custom_pbuf_t), "Zero-copy RX PBUF pool")
 
-
-static void my_pbuf_free_custom(struct pbuf  *p)
+static void my_pbuf_free_custom(struct pbuf *p)
 {
 
     my_custom_pbuf_t *custombuf = (my_custom_pbuf_t *) p;
 
-    bufferpoolReuseBuffer(getWorkerBufferPool(getWID()), custombuf->sbuf);
+    // the buffer is gone if the payload was detached by ptcPbufDetachSbuf
+    if (custombuf->sbuf != NULL)
+    {
+        bufferpoolReuseBuffer(getWorkerBufferPool(getWID()), custombuf->sbuf);
+    }
     LWIP_MEMPOOL_FREE(RX_POOL, custombuf);
 }
 
+sbuf_t *ptcPbufDetachSbuf(struct pbuf *p)
+{
+    if (p->next != NULL || p->ref != 1 || (p->flags & PBUF_FLAG_IS_CUSTOM) == 0 ||
+        ((struct pbuf_custom *) p)->custom_free_function != my_pbuf_free_custom)
+    {
+        return NULL;
+    }
+
+    my_custom_pbuf_t *custombuf = (my_custom_pbuf_t *) p;
+    sbuf_t           *buf       = custombuf->sbuf;
+
+    if (buf == NULL)
+    {
+        return NULL;
+    }
+
+    // the payload of the pbuf points inside the packet, only the headers in front of it are dropped
+    uint32_t offset = (uint32_t) ((uint8_t *) p->payload - sbufGetMutablePtr(buf));
+    assert(offset + p->len <= sbufGetLength(buf));
+
+    custombuf->sbuf = NULL;
+    sbufShiftRight(buf, offset);
+    sbufSetLength(buf, p->len);
+
+    return buf;
+}
+
 static void passToTcpIp(sbuf_t *buf, wid_t wid, struct netif *inp)
 {
-    discard wid;
     discard inp;
 
-    my_custom_pbuf_t *custombuf       = (my_custom_pbuf_t *) LWIP_MEMPOOL_ALLOC(RX_POOL);
+    my_custom_pbuf_t *custombuf = (my_custom_pbuf_t *) LWIP_MEMPOOL_ALLOC(RX_POOL);
+    if (custombuf == NULL)
+    {
+        // the stack holds too many packets, tcp will retransmit this one
+        bufferpoolReuseBuffer(getWorkerBufferPool(wid), buf);
+        return;
+    }
     custombuf->p.custom_free_function = my_pbuf_free_custom;
     custombuf->sbuf                   = buf;
 
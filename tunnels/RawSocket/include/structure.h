@@ -30,6 +30,8 @@ typedef struct rawsocket_tstate_s
 
 
     int  firewall_mark;
+    int  queue_limit; // max packets queued on a worker before the capture reader thread blocks
+    enum packet_distribution_policy_e distribution_policy; // which worker receives a captured packet
     bool write_direction_upstream; // this means we write to upstream when receiving packets
 
 } rawsocket_tstate_t;
@@ -1,5 +1,6 @@
 #include "structure.h"
 
+#include "device_settings.h"
 #include "loggers/network_logger.h"
 
 tunnel_t *rawsocketCreate(node_t *node)
@@ -58,6 +59,13 @@ tunnel_t *rawsocketCreate(node_t *node)
     }
 
     getIntFromJsonObjectOrDefault((&state->firewall_mark), settings, "mark", 0);
+
+    if (! deviceParseQueueSettings(settings, "RawSocket", kDeviceBackpressureDefaultLimit, &(state->queue_limit),
+                                   &(state->distribution_policy)))
+    {
+        return NULL;
+    }
+
     state->write_direction_upstream = (node->hash_next != 0x0);
 
     return t;
@@ -8,7 +8,8 @@ void rawsocketOnPrepair(tunnel_t *t)
     rawsocket_tstate_t *state = tunnelGetState(t);
 
     state->capture_device =
-        caputredeviceCreate(state->capture_device_name, state->capture_ip, t, rawsocketOnIPPacketReceived);
+        caputredeviceCreate(state->capture_device_name, state->capture_ip, state->queue_limit, t,
+                            rawsocketOnIPPacketReceived);
 
     if (state->capture_device == NULL)
     {
@@ -16,9 +17,19 @@ void rawsocketOnPrepair(tunnel_t *t)
         terminateProgram(1);
     }
 
+    state->capture_device->distribution_policy = state->distribution_policy;
+
     // we are not going to read, so pass read call back as null therfore no buffers for read will be allocated
     state->raw_device = rawdeviceCreate(state->raw_device_name, state->firewall_mark, t, NULL);
 
+    if (state->raw_device == NULL)
+    {
+        LOGF("RawDevice: could not create device");
+        terminateProgram(1);
+    }
+
+    state->raw_device->distribution_policy = state->distribution_policy;
+
     caputredeviceBringUp(state->capture_device);
     rawdeviceBringUp(state->raw_device);
 }
@@ -39,6 +39,25 @@ static void onRecv(wio_t *io, sbuf_t *buf)
     tunnelPrevDownStreamPayload(t, l, buf);
 }
 
+void tcpconnectorOnSplice(wio_t *io, int pipe_fd, uint32_t len)
+{
+    tcpconnector_lstate_t *lstate = weventGetUserdata(io);
+    if (UNLIKELY(lstate == NULL))
+    {
+        bufferpoolReuseBuffer(wloopGetBufferPool(weventGetLoop(io)), wioSpliceTakeBuffer(io, pipe_fd, len));
+        return;
+    }
+    tunnel_t *t = lstate->tunnel;
+    line_t   *l = lstate->line;
+
+    if (tunnelPrevDownStreamSplice(t, l, pipe_fd, len) == kSCRequiredBytes)
+    {
+        // the pipe can not pass anymore, this line goes back to buffers
+        wioSetCallBackSplice(io, NULL);
+        tunnelPrevDownStreamPayload(t, l, wioSpliceTakeBuffer(io, pipe_fd, len));
+    }
+}
+
 static bool resumeWriteQueue(tcpconnector_lstate_t *lstate)
 {
     buffer_queue_t *pause_queue = &lstate->pause_queue;
@@ -108,7 +127,15 @@ void tcpconnectorOnOutBoundConnected(wio_t *upstream_io)
         lstate->write_paused = false;
     }
 
+    lineLock(l);
     tunnelPrevDownStreamEst(t, l);
+
+    // when no node on the way needs the bytes, the socket splices them to the listener (linux only)
+    if (lineIsAlive(l) && tunnelPrevDownStreamSplice(t, l, -1, 0) == kSCSuccessNoData)
+    {
+        wioSetCallBackSplice(upstream_io, tcpconnectorOnSplice);
+    }
+    lineUnlock(l);
 }
 
 void tcpconnectorFlushWriteQueue(tcpconnector_lstate_t *lstate)
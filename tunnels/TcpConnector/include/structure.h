@@ -21,9 +21,10 @@ typedef struct tcpconnector_tstate_s
 
 typedef struct tcpconnector_lstate_s
 {
-    tunnel_t *tunnel; // reference to the tunnel (TcpListener)
-    line_t   *line;   // reference to the line
-    wio_t    *io;     // IO handle for the connection (socket)
+    tunnel_t      *tunnel;      // reference to the tunnel (TcpListener)
+    line_t        *line;        // reference to the line
+    wio_t         *io;          // IO handle for the connection (socket), NULL while resolving the destination
+    dns_request_t *dns_request; // pending destination lookup, NULL when not resolving
     // These fields are used internally for the queue implementation for TCP
     buffer_queue_t pause_queue;
     buffer_pool_t *buffer_pool;
@@ -67,6 +68,7 @@ void tcpconnectorTunnelUpStreamFinish(tunnel_t *t, line_t *l);
 void tcpconnectorTunnelUpStreamPayload(tunnel_t *t, line_t *l, sbuf_t *buf);
 void tcpconnectorTunnelUpStreamPause(tunnel_t *t, line_t *l);
 void tcpconnectorTunnelUpStreamResume(tunnel_t *t, line_t *l);
+splice_retcode_t tcpconnectorTunnelUpStreamSplice(tunnel_t *t, line_t *l, int pipe_fd, size_t len);
 
 void tcpconnectorTunnelDownStreamInit(tunnel_t *t, line_t *l);
 void tcpconnectorTunnelDownStreamEst(tunnel_t *t, line_t *l);
@@ -82,4 +84,5 @@ bool tcpconnectorApplyFreeBindRandomDestIp(tunnel_t *self, address_context_t *de
 void tcpconnectorFlushWriteQueue(tcpconnector_lstate_t *lstate);
 void tcpconnectorOnOutBoundConnected(wio_t *upstream_io);
 void tcpconnectorOnWriteComplete(wio_t *io);
+void tcpconnectorOnSplice(wio_t *io, int pipe_fd, uint32_t len);
 void tcpconnectorOnClose(wio_t *io);
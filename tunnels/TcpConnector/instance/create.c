@@ -12,6 +12,10 @@ tunnel_t *tcpconnectorTunnelCreate(node_t *node)
     t->fnPayloadU = &tcpconnectorTunnelUpStreamPayload;
     t->fnPauseU   = &tcpconnectorTunnelUpStreamPause;
     t->fnResumeU  = &tcpconnectorTunnelUpStreamResume;
+    t->fnSpliceU  = &tcpconnectorTunnelUpStreamSplice;
+
+    // chained payloads are written with wioWriteChain, one sendmsg for all the segments
+    t->accepts_chain_u = true;
 
     t->onPrepair = &tcpconnectorTunnelOnPrepair;
     t->onStart   = &tcpconnectorTunnelOnStart;
@@ -6,6 +6,14 @@ void tcpconnectorTunnelUpStreamFinish(tunnel_t *t, line_t *l)
 {
     tcpconnector_lstate_t *lstate = lineGetState(l, t);
 
+    if (lstate->dns_request != NULL)
+    {
+        // still resolving, there is no socket yet
+        dnsresolverCancel(lstate->dns_request);
+        tcpconnectorLinestateDestroy(lstate);
+        return;
+    }
+
     // This indicates that line is closed. Even if we get the closeCallback
     // while flushing the queue, no FIN will be sent to downstroam
     weventSetUserData(lstate->io, NULL);
@@ -2,6 +2,103 @@
 
 #include "loggers/network_logger.h"
 
+static bool connectToDestination(tunnel_t *t, line_t *l)
+{
+    tcpconnector_tstate_t *state    = tunnelGetState(t);
+    tcpconnector_lstate_t *lstate   = lineGetState(l, t);
+    address_context_t     *dest_ctx = &(l->routing_context.dest_ctx);
+
+    // apply free bind if needed
+    if (state->outbound_ip_range > 0)
+    {
+        if (! tcpconnectorApplyFreeBindRandomDestIp(t, dest_ctx))
+        {
+            return false;
+        }
+    }
+
+    // sockaddr_set_ipport(&(dest_ctx.addr), "127.0.0.1", 443);
+
+    wloop_t *loop = getWorkerLoop(getWID());
+
+    assert(dest_ctx->ip_address.type == IPADDR_TYPE_V4 || dest_ctx->ip_address.type == IPADDR_TYPE_V6);
+    int addr_type = dest_ctx->ip_address.type == IPADDR_TYPE_V4 ? AF_INET : AF_INET6;
+
+    int sockfd = (int) socket(addr_type, SOCK_STREAM, 0);
+
+    if (sockfd < 0)
+    {
+        LOGE("TcpConnector: could not create socket");
+        return false;
+    }
+
+    if (state->option_tcp_no_delay)
+    {
+        tcpNoDelay(sockfd, 1);
+    }
+
+#ifdef TCP_FASTOPEN
+    if (state->option_tcp_fast_open)
+    {
+        const int yes = 1;
+        setsockopt(sockfd, IPPROTO_TCP, TCP_FASTOPEN, (const char *) &yes, sizeof(yes));
+    }
+#endif
+
+#if defined(SO_MARK)
+    if (state->fwmark != kFwMarkInvalid)
+    {
+        if (setsockopt(sockfd, SOL_SOCKET, SO_MARK, &state->fwmark, sizeof(state->fwmark)) < 0)
+        {
+            LOGE("TcpConnector: setsockopt SO_MARK error");
+            return false;
+        }
+    }
+#endif
+
+    wio_t *upstream_io = wioGet(loop, sockfd);
+    assert(upstream_io != NULL);
+
+    sockaddr_u addr = addresscontextToSockAddr(dest_ctx);
+
+    wioSetPeerAddr(upstream_io, (struct sockaddr *) &(addr), (int) sockaddrLen(&(addr)));
+    lstate->io = upstream_io;
+    weventSetUserData(upstream_io, lstate);
+    wioSetCallBackConnect(upstream_io, tcpconnectorOnOutBoundConnected);
+    wioSetCallBackClose(upstream_io, tcpconnectorOnClose);
+    wioSetReadTimeout(upstream_io, 1600 * 1000);
+
+    // issue connect on the socket
+    wioConnect(upstream_io);
+
+    return true;
+}
+
+static void onDestinationResolved(void *userdata, const ip_addr_t *addr)
+{
+    tcpconnector_lstate_t *lstate = userdata;
+    tunnel_t              *t      = lstate->tunnel;
+    line_t                *l      = lstate->line;
+
+    lstate->dns_request = NULL;
+
+    if (addr != NULL)
+    {
+        address_context_t *dest_ctx = &(l->routing_context.dest_ctx);
+
+        dest_ctx->ip_address = *addr;
+        dest_ctx->type_ip    = true;
+
+        if (connectToDestination(t, l))
+        {
+            return;
+        }
+    }
+
+    tcpconnectorLinestateDestroy(lstate);
+    tunnelPrevDownStreamFinish(t, l);
+}
+
 void tcpconnectorTunnelUpStreamInit(tunnel_t *t, line_t *l)
 {
     tcpconnector_tstate_t *state  = tunnelGetState(t);
@@ -46,7 +143,7 @@ void tcpconnectorTunnelUpStreamInit(tunnel_t *t, line_t *l)
         break;
     }
 
-    // resolve domain name if needed (TODO : make it async and consider domain strategy)
+    // resolve domain name if needed, the worker resolver answers from its cache or lets us wait without blocking
     if (! dest_ctx->type_ip)
     {
         if (dest_ctx->domain == NULL)
@@ -55,77 +152,29 @@ void tcpconnectorTunnelUpStreamInit(tunnel_t *t, line_t *l)
             goto fail;
         }
 
-        if (! resolveContextSync(dest_ctx))
+        if (state->domain_strategy != kDsInvalid)
         {
-
-            goto fail;
+            dest_ctx->domain_strategy = (enum domain_strategy) state->domain_strategy;
         }
-    }
 
-    // apply free bind if needed
-    if (state->outbound_ip_range > 0)
-    {
-        if (! tcpconnectorApplyFreeBindRandomDestIp(t, dest_ctx))
+        switch (dnsresolverResolve(dest_ctx, onDestinationResolved, lstate, &lstate->dns_request))
         {
+        case kDnsResultResolved:
+            break;
+        case kDnsResultPending:
+            // payloads are queued (write_paused) until the connection is made
+            return;
+        default:
+        case kDnsResultFailed:
             goto fail;
         }
     }
 
-    // sockaddr_set_ipport(&(dest_ctx.addr), "127.0.0.1", 443);
-
-    wloop_t *loop = getWorkerLoop(getWID());
-
-    assert(dest_ctx->ip_address.type == IPADDR_TYPE_V4 || dest_ctx->ip_address.type == IPADDR_TYPE_V6);
-    int addr_type = dest_ctx->ip_address.type == IPADDR_TYPE_V4 ? AF_INET : AF_INET6;
-
-    int sockfd = (int) socket(addr_type, SOCK_STREAM, 0);
-
-    if (sockfd < 0)
-    {
-        LOGE("TcpConnector: could not create socket");
-        goto fail;
-    }
-
-    if (state->option_tcp_no_delay)
+    if (connectToDestination(t, l))
     {
-        tcpNoDelay(sockfd, 1);
+        return;
     }
 
-#ifdef TCP_FASTOPEN
-    if (state->option_tcp_fast_open)
-    {
-        const int yes = 1;
-        setsockopt(sockfd, IPPROTO_TCP, TCP_FASTOPEN, (const char *) &yes, sizeof(yes));
-    }
-#endif
-
-#if defined(SO_MARK)
-    if (state->fwmark != kFwMarkInvalid)
-    {
-        if (setsockopt(sockfd, SOL_SOCKET, SO_MARK, &state->fwmark, sizeof(state->fwmark)) < 0)
-        {
-            LOGE("TcpConnector: setsockopt SO_MARK error");
-            goto fail;
-        }
-    }
-#endif
-
-    wio_t *upstream_io = wioGet(loop, sockfd);
-    assert(upstream_io != NULL);
-
-    sockaddr_u addr = addresscontextToSockAddr(dest_ctx);
-
-    wioSetPeerAddr(upstream_io, (struct sockaddr *) &(addr), (int) sockaddrLen(&(addr)));
-    lstate->io = upstream_io;
-    weventSetUserData(upstream_io, lstate);
-    wioSetCallBackConnect(upstream_io, tcpconnectorOnOutBoundConnected);
-    wioSetCallBackClose(upstream_io, tcpconnectorOnClose);
-    wioSetReadTimeout(upstream_io, 1600 * 1000);
-
-    // issue connect on the socket
-    wioConnect(upstream_io);
-
-    return;
 fail:
     tcpconnectorLinestateDestroy(lstate);
     tunnelPrevDownStreamFinish(t, l);
@@ -9,6 +9,9 @@ void tcpconnectorTunnelUpStreamPause(tunnel_t *t, line_t *l)
     if (! lstate->read_paused)
     {
         lstate->read_paused = true;
-        wioReadStop(lstate->io);
+        if (lstate->io != NULL)
+        {
+            wioReadStop(lstate->io);
+        }
     }
 }
@@ -9,12 +9,17 @@ void tcpconnectorTunnelUpStreamPayload(tunnel_t *t, line_t *l, sbuf_t *buf)
     if (lstate->write_paused)
     {
         tunnelPrevDownStreamPause(t, l);
+        if (UNLIKELY(sbufIsChained(buf)))
+        {
+            // the pause queue only holds plain buffers
+            buf = tunnelLinearizePayload(l, buf);
+        }
         bufferqueuePush(&lstate->pause_queue, buf);
     }
     else
     {
         int bytes  = (int) sbufGetLength(buf);
-        int nwrite = wioWrite(lstate->io, buf);
+        int nwrite = UNLIKELY(sbufIsChained(buf)) ? wioWriteChain(lstate->io, buf) : wioWrite(lstate->io, buf);
 
 
         if (nwrite >= 0 && nwrite < bytes)
@@ -9,6 +9,9 @@ void tcpconnectorTunnelUpStreamResume(tunnel_t *t, line_t *l)
     if (lstate->read_paused)
     {
         lstate->read_paused = false;
-        wioRead(lstate->io);
+        if (lstate->io != NULL)
+        {
+            wioRead(lstate->io);
+        }
     }
 }
@@ -16,6 +16,25 @@ static void onRecv(wio_t *io, sbuf_t *buf)
     tunnelNextUpStreamPayload(t, l, buf);
 }
 
+void tcplistenerOnSplice(wio_t *io, int pipe_fd, uint32_t len)
+{
+    tcplistener_lstate_t *lstate = (tcplistener_lstate_t *) (weventGetUserdata(io));
+    if (UNLIKELY(lstate == NULL))
+    {
+        bufferpoolReuseBuffer(wloopGetBufferPool(weventGetLoop(io)), wioSpliceTakeBuffer(io, pipe_fd, len));
+        return;
+    }
+    line_t   *l = lstate->line;
+    tunnel_t *t = lstate->tunnel;
+
+    if (tunnelNextUpStreamSplice(t, l, pipe_fd, len) == kSCRequiredBytes)
+    {
+        // the pipe can not pass anymore, this line goes back to buffers
+        wioSetCallBackSplice(io, NULL);
+        tunnelNextUpStreamPayload(t, l, wioSpliceTakeBuffer(io, pipe_fd, len));
+    }
+}
+
 static void onClose(wio_t *io)
 {
     tcplistener_lstate_t *lstate = (tcplistener_lstate_t *) (weventGetUserdata(io));
@@ -9,4 +9,10 @@ void tcplistenerTunnelDownStreamEst(tunnel_t *t, line_t *l)
     assert(! lstate->established);
     lstate->established = true;
     wioSetKeepaliveTimeout(lstate->io, kEstablishedKeepAliveTimeOutMs);
+
+    // when no node on the way needs the bytes, the socket splices them to the connector (linux only)
+    if (tunnelNextUpStreamSplice(t, l, -1, 0) == kSCSuccessNoData)
+    {
+        wioSetCallBackSplice(lstate->io, tcplistenerOnSplice);
+    }
 }
@@ -0,0 +1,33 @@
+#include "structure.h"
+
+#include "loggers/network_logger.h"
+
+splice_retcode_t tcplistenerTunnelDownStreamSplice(tunnel_t *t, line_t *l, int pipe_fd, size_t len)
+{
+    tcplistener_lstate_t *lstate = lineGetState(l, t);
+
+    if (len == 0)
+    {
+        // probe, the pipe can come all the way to the socket
+        return wioIsClosed(lstate->io) ? kSCRequiredBytes : kSCSuccessNoData;
+    }
+
+    if (lstate->write_paused)
+    {
+        tunnelNextUpStreamPause(t, l);
+        bufferqueuePush(&lstate->pause_queue, wioSpliceTakeBuffer(lstate->io, pipe_fd, (uint32_t) len));
+        return kSCBlocked;
+    }
+
+    // on error the bytes are dropped from the pipe and the socket closes, same as a failed payload write
+    int nwrite = wioSpliceWrite(lstate->io, pipe_fd, (uint32_t) len);
+
+    if (nwrite >= 0 && (size_t) nwrite < len)
+    {
+        lstate->write_paused = true;
+        wioSetCallBackWrite(lstate->io, tcplistenerOnWriteComplete);
+        tunnelNextUpStreamPause(t, l);
+        return kSCBlocked;
+    }
+    return kSCSuccess;
+}
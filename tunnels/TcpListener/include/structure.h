@@ -12,6 +12,7 @@ typedef struct tcplistener_tstate_s
     uint16_t listen_port_min;          // min port to listen on (minimum of the range)
     uint16_t listen_port_max;          // max port to listen on (maximum of the range)
     bool     option_tcp_no_delay;      // apply TCP no delay option on sockets
+    bool     option_reuse_port;        // one SO_REUSEPORT listener per worker, accepts happen on the owner worker
 
 } tcplistener_tstate_t;
 
@@ -61,6 +62,7 @@ void tcplistenerTunnelDownStreamFinish(tunnel_t *t, line_t *l);
 void tcplistenerTunnelDownStreamPayload(tunnel_t *t, line_t *l, sbuf_t *buf);
 void tcplistenerTunnelDownStreamPause(tunnel_t *t, line_t *l);
 void tcplistenerTunnelDownStreamResume(tunnel_t *t, line_t *l);
+splice_retcode_t tcplistenerTunnelDownStreamSplice(tunnel_t *t, line_t *l, int pipe_fd, size_t len);
 
 void tcplistenerLinestateInitialize(tcplistener_lstate_t *ls, wio_t *io, tunnel_t *t, line_t *l);
 void tcplistenerLinestateDestroy(tcplistener_lstate_t *ls);
@@ -68,3 +70,4 @@ void tcplistenerLinestateDestroy(tcplistener_lstate_t *ls);
 void tcplistenerFlushWriteQueue(tcplistener_lstate_t *lstate);
 void tcplistenerOnInboundConnected(wevent_t *ev);
 void tcplistenerOnWriteComplete(wio_t *io);
+void tcplistenerOnSplice(wio_t *io, int pipe_fd, uint32_t len);
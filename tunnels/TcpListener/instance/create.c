@@ -57,6 +57,10 @@ tunnel_t *tcplistenerTunnelCreate(node_t *node)
     t->fnPayloadD = &tcplistenerTunnelDownStreamPayload;
     t->fnPauseD   = &tcplistenerTunnelDownStreamPause;
     t->fnResumeD  = &tcplistenerTunnelDownStreamResume;
+    t->fnSpliceD  = &tcplistenerTunnelDownStreamSplice;
+
+    // chained payloads are written with wioWriteChain, one sendmsg for all the segments
+    t->accepts_chain_d = true;
 
     t->onPrepair = &tcplistenerTunnelOnPrepair;
     t->onStart   = &tcplistenerTunnelOnStart;
@@ -73,6 +77,7 @@ tunnel_t *tcplistenerTunnelCreate(node_t *node)
     }
 
     getBoolFromJsonObject(&(state->option_tcp_no_delay), settings, "nodelay");
+    getBoolFromJsonObject(&(state->option_reuse_port), settings, "reuse-port");
 
     if (! getStringFromJsonObject(&(state->listen_address), settings, "address"))
     {
@@ -82,7 +87,24 @@ tunnel_t *tcplistenerTunnelCreate(node_t *node)
 
     socket_filter_option_t filter_opt;
     socketfilteroptionInit(&filter_opt);
-    filter_opt.no_delay = state->option_tcp_no_delay;
+    filter_opt.no_delay   = state->option_tcp_no_delay;
+    filter_opt.reuse_port = state->option_reuse_port;
+
+    if (state->option_reuse_port)
+    {
+        dynamic_value_t dy_steering =
+            parseDynamicStrValueFromJsonObject(settings, "reuse-port-steering", 2, "kernel", "cpu");
+        if (dy_steering.status == kDvsConstant)
+        {
+            LOGF("JSON Error: TcpListener->settings->reuse-port-steering (string field) : must be one of kernel, cpu");
+            dynamicvalueDestroy(dy_steering);
+            return NULL;
+        }
+        if (dy_steering.status == 3)
+        {
+            filter_opt.reuse_port_steering = kReusePortSteeringCpu;
+        }
+    }
 
     getStringFromJsonObject(&(filter_opt.balance_group_name), settings, "balance-group");
     getIntFromJsonObject((int *) &(filter_opt.balance_group_interval), settings, "balance-interval");
@@ -13,10 +13,16 @@
 typedef struct tundevice_tstate_s
 {
     // settings form json
-    char *name;        // name of the device
-    char *ip_subnet;   // ip/subnet
-    char *ip_present;  //  only ip
-    int   subnet_mask; // only subnet mask
+    char *name;            // name of the device
+    char *ip_subnet;       // ip/subnet
+    char *ip_present;      //  only ip
+    int   subnet_mask;     // only subnet mask
+    int   read_batch_size; // max packets handed to a worker per reader wakeup
+    int   queue_limit;     // max packets queued on a worker before the reader thread blocks
+    bool  multi_queue;     // one tun queue per worker instead of reader / writer threads (linux only)
+    bool  offload;         // vnet_hdr TSO/USO and checksum offload, super-packets are split on read (linux only)
+
+    enum packet_distribution_policy_e distribution_policy; // which worker receives a packet read from the device
 
     tun_device_t *tdev;
 
@@ -1,5 +1,6 @@
 #include "structure.h"
 
+#include "device_settings.h"
 #include "loggers/network_logger.h"
 
 tunnel_t *tundeviceTunnelCreate(node_t *node)
@@ -60,6 +61,37 @@ tunnel_t *tundeviceTunnelCreate(node_t *node)
 
     state->subnet_mask = atoi(subnet_part);
 
+    getIntFromJsonObjectOrDefault(&(state->read_batch_size), settings, "read-batch-size", kTunDefaultReadBatchSize);
+
+    if (state->read_batch_size < 1 || state->read_batch_size > kMaxReadQueueSize)
+    {
+        LOGF("JSON Error: TunDevice->settings->read-batch-size (int field) : The value must be in range [1 - %d]",
+             kMaxReadQueueSize);
+        return NULL;
+    }
+
+    if (! deviceParseQueueSettings(settings, "TunDevice", kTunDefaultQueueLimit, &(state->queue_limit),
+                                   &(state->distribution_policy)))
+    {
+        return NULL;
+    }
+
+    getBoolFromJsonObjectOrDefault(&(state->multi_queue), settings, "multi-queue", false);
+    getBoolFromJsonObjectOrDefault(&(state->offload), settings, "offload", false);
+
+#ifndef OS_LINUX
+    if (state->multi_queue)
+    {
+        LOGW("TunDevice: multi-queue is only supported on linux, falling back to a single queue");
+        state->multi_queue = false;
+    }
+    if (state->offload)
+    {
+        LOGW("TunDevice: offload is only supported on linux, ignored");
+        state->offload = false;
+    }
+#endif
+
     // tun creation must be done in prepair or start padding, in create method paddings are not calculated yout
 
     // on windows we need admin to load win tun driver
@@ -6,7 +6,16 @@ void tundeviceTunnelOnPrepair(tunnel_t *t)
 {
     tundevice_tstate_t * state = tunnelGetState(t);
 
-    state->tdev = tundeviceCreate(state->name, false, t, tundeviceOnIPPacketReceived);
+#ifdef OS_LINUX
+    if (state->multi_queue)
+    {
+        state->tdev = tundeviceCreateMultiQueue(state->name, state->offload, t, tundeviceOnIPPacketReceived);
+    }
+    else
+#endif
+    {
+        state->tdev = tundeviceCreate(state->name, state->offload, t, tundeviceOnIPPacketReceived);
+    }
 
     if (state->tdev == NULL)
     {
@@ -14,6 +23,12 @@ void tundeviceTunnelOnPrepair(tunnel_t *t)
         terminateProgram(1);
     }
 
+    state->tdev->read_batch_size     = (uint32_t) state->read_batch_size;
+    state->tdev->distribution_policy = state->distribution_policy;
+#ifndef OS_WIN
+    state->tdev->backpressure.limit = state->queue_limit;
+#endif
+
     tundeviceAssignIP(state->tdev, state->ip_present, (unsigned int )state->subnet_mask);
 
     tundeviceBringUp(state->tdev);
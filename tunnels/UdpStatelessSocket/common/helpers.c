@@ -2,43 +2,53 @@
 
 #include "loggers/network_logger.h"
 
-void udpstatelesssocketOnRecvFrom(wio_t *io, sbuf_t *buf)
+void udpstatelesssocketOnRecvFrom(wio_t *io, wio_datagram_t *datagrams, unsigned int count)
 {
     tunnel_t *t   = (tunnel_t *) (weventGetUserdata(io));
     wid_t     wid = wloopGetWid(weventGetLoop(io));
-    
-    if (UNLIKELY(t == NULL))
-    {
-        assert(false);
-        bufferpoolReuseBuffer(getWorkerBufferPool(wid), buf);
-        return;
-    }
 
-    if (wioGetPeerAddrU(io)->sa.sa_family == 0)
+    if (UNLIKELY(t == NULL))
     {
         assert(false);
-        bufferpoolReuseBuffer(getWorkerBufferPool(wid), buf);
+        for (unsigned int i = 0; i < count; i++)
+        {
+            bufferpoolReuseBuffer(getWorkerBufferPool(wid), datagrams[i].buf);
+        }
         return;
     }
 
     line_t *line      = tunnelchainGetPacketLine(tunnelGetChain(t), wid);
     line->established = true;
 
-    char localaddrstr[SOCKADDR_STRLEN] = {0};
-    char peeraddrstr[SOCKADDR_STRLEN]  = {0};
+    // the whole recvmmsg batch goes down under one lock
+    lineLock(line);
+    for (unsigned int i = 0; i < count; i++)
+    {
+        sbuf_t     *buf  = datagrams[i].buf;
+        sockaddr_u *peer = &datagrams[i].peer;
 
-    LOGD("UdpStatelessSocket: received %u bytes from [%s] <= [%s]", sbufGetLength(buf),
-         SOCKADDR_STR(wioGetLocaladdrU(io), localaddrstr), SOCKADDR_STR(wioGetPeerAddrU(io), peeraddrstr));
+        if (peer->sa.sa_family == 0)
+        {
+            assert(false);
+            bufferpoolReuseBuffer(getWorkerBufferPool(wid), buf);
+            continue;
+        }
 
-    addresscontextFromSockAddr(&line->routing_context.src_ctx, wioGetPeerAddrU(io));
+        char localaddrstr[SOCKADDR_STRLEN] = {0};
+        char peeraddrstr[SOCKADDR_STRLEN]  = {0};
 
-    lineLock(line);
-    tunnelPrevDownStreamPayload(t, line, buf);
+        LOGD("UdpStatelessSocket: received %u bytes from [%s] <= [%s]", sbufGetLength(buf),
+             SOCKADDR_STR(wioGetLocaladdrU(io), localaddrstr), SOCKADDR_STR(peer, peeraddrstr));
 
-    if (! lineIsAlive(line))
-    {
-        LOGF("UdpStatelessSocket: line is not alive, rule of packet tunnels is violated");
-        terminateProgram(1);
+        addresscontextFromSockAddr(&line->routing_context.src_ctx, peer);
+
+        tunnelPrevDownStreamPayload(t, line, buf);
+
+        if (! lineIsAlive(line))
+        {
+            LOGF("UdpStatelessSocket: line is not alive, rule of packet tunnels is violated");
+            terminateProgram(1);
+        }
     }
     lineUnlock(line);
 }
@@ -50,4 +50,4 @@ void udpstatelesssocketTunnelDownStreamResume(tunnel_t *t, line_t *l);
 void udpstatelesssocketLinestateInitialize(udpstatelesssocket_lstate_t *ls);
 void udpstatelesssocketLinestateDestroy(udpstatelesssocket_lstate_t *ls);
 
-void udpstatelesssocketOnRecvFrom(wio_t *io, sbuf_t *buf);
+void udpstatelesssocketOnRecvFrom(wio_t *io, wio_datagram_t *datagrams, unsigned int count);
@@ -65,7 +65,7 @@ tunnel_t *udpstatelesssocketTunnelCreate(node_t *node)
     state->io_wid = getWID();
 
     weventSetUserData(state->io, t);
-    wioSetCallBackRead(state->io, udpstatelesssocketOnRecvFrom);
+    wioSetCallBackReadBatch(state->io, udpstatelesssocketOnRecvFrom);
     wioRead(state->io);
 
     
@@ -25,9 +25,8 @@ static inline void localThreadUdpStatelessSocketUpStream(struct worker_s *worker
     }
     // tunnelPrevDownStreamPayload(t, l, buf);
 
-    wioSetPeerAddr(state->io, &(addr.sa), (int) sockaddrLen(&addr));
-
-    wioWrite(state->io, buf);
+    // queued, everything written to the socket in this loop iteration leaves with one sendmmsg
+    wioWriteTo(state->io, buf, &addr);
 }
 
 void udpstatelesssocketTunnelUpStreamPayload(tunnel_t *t, line_t *l, sbuf_t *buf)
@@ -42,18 +42,27 @@ static err_t wireguardStartHandshake(wireguard_device_t *device, wireguard_peer_
     buf = wireguarddeviceCreateiateHandshake(device, peer, &msg, &result);
     if (buf)
     {
-        result                   = wireguardifPeerOutput(device, buf, peer);
+        // update the peer before sending, the output releases the device mutex
         peer->send_handshake     = false;
         peer->last_initiation_tx = getTickMS();
+        peer->initiation_jitter  = fastRand() % (REKEY_TIMEOUT_JITTER_MAX + 1);
         memoryCopy(peer->handshake_mac1, msg.mac1, WIREGUARD_COOKIE_LEN);
         peer->handshake_mac1_valid = true;
+        result                     = wireguardifPeerOutput(device, buf, peer);
     }
     return result;
 }
 
+/*
+    when both peers initiate at once, each one answers the other initiation and that replaces its own handshake, so
+    both drop the answer to their own and keep a responder keypair that waits for data; retrying on the same tick
+    repeats this forever (devices that share a timer never get out), so the retry waits a random extra 0..333 ms
+    like the linux implementation does
+*/
 static bool wireguardifCanSendInitiation(wireguard_peer_t *peer)
 {
-    return ((peer->last_initiation_tx == 0) || (wireguardExpired(peer->last_initiation_tx, REKEY_TIMEOUT)));
+    return ((peer->last_initiation_tx == 0) ||
+            (getTickMS() - peer->last_initiation_tx >= (REKEY_TIMEOUT * 1000) + peer->initiation_jitter));
 }
 
 static bool shouldSendInitiation(wireguard_peer_t *peer)
@@ -117,49 +126,70 @@ static bool shouldResetPeer(wireguard_peer_t *peer)
 
 void wireguarddeviceLoop(wireguard_device_t *device)
 {
+    wgd_tstate_t     *ts = (wgd_tstate_t *) device;
     wireguard_peer_t *peer;
-    int               x;
+    uint32_t          x;
 
     // Check periodic things
     bool link_up = false;
-    for (x = 0; x < WIREGUARD_MAX_PEERS; x++)
+    for (x = 0;; x++)
     {
-        peer = &device->peers[x];
-        if (peer->valid)
+        // the peer table may grow while the mutex is released, so it is only read with the mutex held
+        wireguarddeviceLock(ts);
+        if (x >= device->peers_count)
         {
-            // Do we need to rekey / send a handshake?
-            if (shouldResetPeer(peer))
-            {
-                // Nothing back for too long - we should wipe out all crypto state
-                keypairDestroy(&peer->next_keypair);
-                keypairDestroy(&peer->curr_keypair);
-                keypairDestroy(&peer->prev_keypair);
-                // TODO: Also destroy handshake?
-
-                // Revert back to default IP/port if these were altered
-                peer->ip   = peer->connect_ip;
-                peer->port = peer->connect_port;
-            }
-            if (shouldDestroyCurrentKeypair(peer))
-            {
-                // Destroy current keypair
-                keypairDestroy(&peer->curr_keypair);
-            }
-            if (shouldSendKeepalive(peer))
-            {
-                wireguardifSendKeepalive(device, peer);
-            }
-            if (shouldSendInitiation(peer))
-            {
-                LOGD("Sending handshake to peer %d.%d.%d.%d", ip4_addr1(ip_2_ip4(&peer->ip)),
-                     ip4_addr2(ip_2_ip4(&peer->ip)), ip4_addr3(ip_2_ip4(&peer->ip)), ip4_addr4(ip_2_ip4(&peer->ip)));
-                wireguardStartHandshake(device, peer);
-            }
+            wireguarddeviceUnlock(ts);
+            break;
+        }
+        peer = device->peers[x];
+        if (! peer->valid)
+        {
+            wireguarddeviceUnlock(ts);
+            continue;
+        }
 
-            if ((peer->curr_keypair.valid) || (peer->prev_keypair.valid))
-            {
-                link_up = true;
-            }
+        // Do we need to rekey / send a handshake?
+        if (shouldResetPeer(peer))
+        {
+            // Nothing back for too long - we should wipe out all crypto state
+            peerKeypairsWriteBegin(peer);
+            keypairDestroy(&peer->next_keypair);
+            keypairDestroy(&peer->curr_keypair);
+            keypairDestroy(&peer->prev_keypair);
+            // TODO: Also destroy handshake?
+
+            // Revert back to default IP/port if these were altered
+            peer->ip   = peer->connect_ip;
+            peer->port = peer->connect_port;
+            peerKeypairsWriteEnd(peer);
+        }
+        if (shouldDestroyCurrentKeypair(peer))
+        {
+            // Destroy current keypair
+            peerKeypairsWriteBegin(peer);
+            keypairDestroy(&peer->curr_keypair);
+            peerKeypairsWriteEnd(peer);
+        }
+        if ((peer->curr_keypair.valid) || (peer->prev_keypair.valid))
+        {
+            link_up = true;
+        }
+
+        // keepalives go through the data path which does not need the mutex
+        const bool send_keepalive = shouldSendKeepalive(peer);
+
+        if (shouldSendInitiation(peer))
+        {
+            LOGD("Sending handshake to peer %d.%d.%d.%d", ip4_addr1(ip_2_ip4(&peer->ip)),
+                 ip4_addr2(ip_2_ip4(&peer->ip)), ip4_addr3(ip_2_ip4(&peer->ip)), ip4_addr4(ip_2_ip4(&peer->ip)));
+            wireguardStartHandshake(device, peer);
+        }
+
+        wireguarddeviceUnlock(ts);
+
+        if (send_keepalive)
+        {
+            wireguardifSendKeepalive(device, peer);
         }
     }
 
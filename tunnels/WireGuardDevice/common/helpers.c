@@ -8,11 +8,7 @@ err_t wireguardifPeerOutput(wireguard_device_t *device, sbuf_t *q, wireguard_pee
     // TODO: Support DSCP and ECN - lwip requires this set on PCB globally, not per packet
     wgd_tstate_t *ts = (wgd_tstate_t *) device;
 
-    if (ts->locked)
-    {
-        ts->locked = false;
-        mutexUnlock(&ts->mutex);
-    }
+    wireguarddeviceUnlock(ts);
     tunnel_t *tunnel = ts->tunnel;
     line_t   *line   = tunnelchainGetPacketLine(tunnel->chain, getWID());
     addresscontextSetIpPort(&(line->routing_context.dest_ctx), &peer->ip, peer->port);
@@ -24,11 +20,8 @@ err_t wireguardifPeerOutput(wireguard_device_t *device, sbuf_t *q, wireguard_pee
 err_t wireguardifDeviceOutput(wireguard_device_t *device, sbuf_t *q, const ip_addr_t *ipaddr, uint16_t port)
 {
     wgd_tstate_t *ts = (wgd_tstate_t *) device;
-    if (ts->locked)
-    {
-        ts->locked = false;
-        mutexUnlock(&ts->mutex);
-    }
+
+    wireguarddeviceUnlock(ts);
     tunnel_t *tunnel = ts->tunnel;
     line_t   *line   = tunnelchainGetPacketLine(tunnel->chain, getWID());
     addresscontextSetIpPort(&(line->routing_context.dest_ctx), ipaddr, port);
@@ -37,7 +30,7 @@ err_t wireguardifDeviceOutput(wireguard_device_t *device, sbuf_t *q, const ip_ad
     // return udpSendTo(device->udp_pcb, q, ipaddr, port);
 }
 
-static bool peerAddIp(wireguard_peer_t *peer, ip_addr_t ip, ip_addr_t mask)
+static bool peerAddIp(wireguard_device_t *device, wireguard_peer_t *peer, ip_addr_t ip, ip_addr_t mask)
 {
     bool                    result = false;
     wireguard_allowed_ip_t *allowed;
@@ -68,10 +61,14 @@ static bool peerAddIp(wireguard_peer_t *peer, ip_addr_t ip, ip_addr_t mask)
             }
         }
     }
+    if (result)
+    {
+        wireguardAllowedIpsInsert(&device->allowed_ips, &ip, wireguardAllowedIpsMaskToCidr(&mask), peer);
+    }
     return result;
 }
 
-err_t wireguardifAddPeer(wireguard_device_t *device, wireguard_peer_init_data_t *p, uint8_t *peer_index)
+err_t wireguardifAddPeer(wireguard_device_t *device, wireguard_peer_init_data_t *p, uint32_t *peer_index)
 {
     assert(p != NULL);
 
@@ -111,13 +108,15 @@ err_t wireguardifAddPeer(wireguard_device_t *device, wireguard_peer_init_data_t
                 {
                     peer->keepalive_interval = p->keep_alive;
                 }
-                peerAddIp(peer, p->allowed_ip, p->allowed_mask);
+                peerAddIp(device, peer, p->allowed_ip, p->allowed_mask);
                 memoryCopy(peer->greatest_timestamp, p->greatest_timestamp, sizeof(peer->greatest_timestamp));
 
                 result = ERR_OK;
             }
             else
             {
+                // the entry stays in the table for the next peerAlloc
+                device->peers_removed++;
                 result = ERR_ARG;
             }
         }
@@ -152,7 +151,7 @@ void wireguardifSendKeepalive(wireguard_device_t *device, wireguard_peer_t *peer
     wireguardifOutputToPeer(device, empty_buf, NULL, peer);
 }
 
-static err_t wireguardifLookupPeer(wireguard_device_t *device, uint8_t peer_index, wireguard_peer_t **out)
+static err_t wireguardifLookupPeer(wireguard_device_t *device, uint32_t peer_index, wireguard_peer_t **out)
 {
     assert(device != NULL);
     wireguard_peer_t *peer = NULL;
@@ -178,7 +177,7 @@ static err_t wireguardifLookupPeer(wireguard_device_t *device, uint8_t peer_inde
     return result;
 }
 
-err_t wireguardifPeerIsUp(wireguard_device_t *device, uint8_t peer_index, ip_addr_t *current_ip, uint16_t *current_port)
+err_t wireguardifPeerIsUp(wireguard_device_t *device, uint32_t peer_index, ip_addr_t *current_ip, uint16_t *current_port)
 {
     wireguard_peer_t *peer;
     err_t             result = wireguardifLookupPeer(device, peer_index, &peer);
@@ -204,20 +203,31 @@ err_t wireguardifPeerIsUp(wireguard_device_t *device, uint8_t peer_index, ip_add
     return result;
 }
 
-err_t wireguardifRemovePeer(wireguard_device_t *device, uint8_t peer_index)
+err_t wireguardifAddAllowedIp(wireguard_device_t *device, uint32_t peer_index, const ip_addr_t *ip, uint8_t cidr)
+{
+    wireguard_peer_t *peer;
+    err_t             result = wireguardifLookupPeer(device, peer_index, &peer);
+    if (result == ERR_OK)
+    {
+        result = wireguardAllowedIpsInsert(&device->allowed_ips, ip, cidr, peer) ? ERR_OK : ERR_ARG;
+    }
+    return result;
+}
+
+err_t wireguardifRemovePeer(wireguard_device_t *device, uint32_t peer_index)
 {
     wireguard_peer_t *peer;
     err_t             result = wireguardifLookupPeer(device, peer_index, &peer);
     if (result == ERR_OK)
     {
-        wCryptoZero(peer, sizeof(wireguard_peer_t));
-        peer->valid = false;
-        result      = ERR_OK;
+        wireguardAllowedIpsRemoveByPeer(&device->allowed_ips, peer);
+        peerRemove(device, peer);
+        result = ERR_OK;
     }
     return result;
 }
 
-err_t wireguardifUpdateEndpoint(wireguard_device_t *device, uint8_t peer_index, const ip_addr_t *ip, uint16_t port)
+err_t wireguardifUpdateEndpoint(wireguard_device_t *device, uint32_t peer_index, const ip_addr_t *ip, uint16_t port)
 {
     wireguard_peer_t *peer;
     err_t             result = wireguardifLookupPeer(device, peer_index, &peer);
@@ -230,7 +240,7 @@ err_t wireguardifUpdateEndpoint(wireguard_device_t *device, uint8_t peer_index,
     return result;
 }
 
-err_t wireguardifConnect(wireguard_device_t *device, uint8_t peer_index)
+err_t wireguardifConnect(wireguard_device_t *device, uint32_t peer_index)
 {
     wireguard_peer_t *peer;
     err_t             result = wireguardifLookupPeer(device, peer_index, &peer);
@@ -241,9 +251,11 @@ err_t wireguardifConnect(wireguard_device_t *device, uint8_t peer_index)
         {
             // Set the flag that we want to try connecting
             peer->active = true;
-            peer->ip     = peer->connect_ip;
-            peer->port   = peer->connect_port;
-            result       = ERR_OK;
+            peerKeypairsWriteBegin(peer);
+            peer->ip   = peer->connect_ip;
+            peer->port = peer->connect_port;
+            peerKeypairsWriteEnd(peer);
+            result = ERR_OK;
         }
         else
         {
@@ -253,7 +265,7 @@ err_t wireguardifConnect(wireguard_device_t *device, uint8_t peer_index)
     return result;
 }
 
-err_t wireguardifDisconnect(wireguard_device_t *device, uint8_t peer_index)
+err_t wireguardifDisconnect(wireguard_device_t *device, uint32_t peer_index)
 {
     wireguard_peer_t *peer;
     err_t             result = wireguardifLookupPeer(device, peer_index, &peer);
@@ -262,9 +274,11 @@ err_t wireguardifDisconnect(wireguard_device_t *device, uint8_t peer_index)
         // Set the flag that we want to try connecting
         peer->active = false;
         // Wipe out current keys
+        peerKeypairsWriteBegin(peer);
         keypairDestroy(&peer->next_keypair);
         keypairDestroy(&peer->curr_keypair);
         keypairDestroy(&peer->prev_keypair);
+        peerKeypairsWriteEnd(peer);
         result = ERR_OK;
     }
     return result;
@@ -35,6 +35,12 @@ static const uint8_t LABEL_COOKIE[8] = {
 
 static const uint8_t zero_key[WIREGUARD_PUBLIC_KEY_LEN] = {0};
 
+enum
+{
+    kWireguardPeersInitialCap = 8,
+    kWireguardIndexMapSlack   = 64 // index map entries allowed beyond what the peers can hold before a sweep
+};
+
 // Calculated in wireguardInit
 static uint8_t construction_hash[WIREGUARD_HASH_LEN];
 static uint8_t identifier_hash[WIREGUARD_HASH_LEN];
@@ -91,108 +97,127 @@ void wireguardInit(void)
 wireguard_peer_t *peerAlloc(wireguard_device_t *device)
 {
     wireguard_peer_t *result = NULL;
-    wireguard_peer_t *tmp;
-    int               x;
-    for (x = 0; x < WIREGUARD_MAX_PEERS; x++)
+    uint32_t          x;
+
+    // reuse the entry of a removed peer first, its address may still be held by a lock-free reader
+    if (device->peers_removed > 0)
     {
-        tmp = &device->peers[x];
-        if (! tmp->valid)
+        for (x = 0; x < device->peers_count; x++)
         {
-            result = tmp;
-            break;
+            if (! device->peers[x]->valid)
+            {
+                device->peers_removed--;
+                return device->peers[x];
+            }
         }
     }
+
+    if (device->peers_count >= WIREGUARD_MAX_PEERS)
+    {
+        return NULL;
+    }
+
+    if (device->peers_count == device->peers_cap)
+    {
+        uint32_t new_cap  = device->peers_cap == 0 ? kWireguardPeersInitialCap : device->peers_cap * 2;
+        new_cap           = min(new_cap, (uint32_t) WIREGUARD_MAX_PEERS);
+        device->peers     = memoryReAllocate(device->peers, (size_t) new_cap * sizeof(wireguard_peer_t *));
+        device->peers_cap = new_cap;
+    }
+
+    result = memoryAllocate(sizeof(wireguard_peer_t));
+    memorySet(result, 0, sizeof(wireguard_peer_t));
+    result->index                        = device->peers_count;
+    device->peers[device->peers_count++] = result;
     return result;
 }
 
-wireguard_peer_t *peerLookupByPubkey(wireguard_device_t *device, uint8_t *public_key)
+void peerRemove(wireguard_device_t *device, wireguard_peer_t *peer)
 {
-    wireguard_peer_t *result = NULL;
-    wireguard_peer_t *tmp;
-    int               x;
-    for (x = 0; x < WIREGUARD_MAX_PEERS; x++)
+    if (peer->valid)
     {
-        tmp = &device->peers[x];
-        if (tmp->valid)
-        {
-            if (memcmp(tmp->public_key, public_key, WIREGUARD_PUBLIC_KEY_LEN) == 0)
-            {
-                result = tmp;
-                break;
-            }
-        }
+        hmap_wgpubkey_t_erase(&device->pubkey_map, calcHashBytes(peer->public_key, WIREGUARD_PUBLIC_KEY_LEN));
+        device->peers_removed++;
     }
-    return result;
+    // index map entries of this peer become stale, they fail the lookup checks and get swept later
+    uint32_t index = peer->index;
+    wCryptoZero(peer, sizeof(wireguard_peer_t));
+    peer->valid = false;
+    peer->index = index;
 }
 
-uint8_t wireguardPeerIndex(wireguard_device_t *device, wireguard_peer_t *peer)
+wireguard_peer_t *peerLookupByPubkey(wireguard_device_t *device, uint8_t *public_key)
 {
-    uint8_t result = 0xFF;
-    uint8_t x;
-    for (x = 0; x < WIREGUARD_MAX_PEERS; x++)
+    const hmap_wgpubkey_t_value *entry =
+        hmap_wgpubkey_t_get(&device->pubkey_map, calcHashBytes(public_key, WIREGUARD_PUBLIC_KEY_LEN));
+
+    if (entry != NULL && entry->second->valid &&
+        memcmp(entry->second->public_key, public_key, WIREGUARD_PUBLIC_KEY_LEN) == 0)
     {
-        if (peer == &device->peers[x])
-        {
-            result = x;
-            break;
-        }
+        return entry->second;
     }
-    return result;
+    return NULL;
 }
 
-wireguard_peer_t *peerLookupByPeerIndex(wireguard_device_t *device, uint8_t peer_index)
+uint32_t wireguardPeerIndex(wireguard_device_t *device, wireguard_peer_t *peer)
+{
+    discard device;
+    return peer->index;
+}
+
+wireguard_peer_t *peerLookupByPeerIndex(wireguard_device_t *device, uint32_t peer_index)
 {
     wireguard_peer_t *result = NULL;
-    if (peer_index < WIREGUARD_MAX_PEERS)
+    if (peer_index < device->peers_count)
     {
-        if (device->peers[peer_index].valid)
+        if (device->peers[peer_index]->valid)
         {
-            result = &device->peers[peer_index];
+            result = device->peers[peer_index];
         }
     }
     return result;
 }
 
-wireguard_peer_t *peerLookupByReceiver(wireguard_device_t *device, uint32_t receiver)
+static wireguard_peer_t *peerLookupByIndex(wireguard_device_t *device, uint32_t receiver)
 {
-    wireguard_peer_t *result = NULL;
-    wireguard_peer_t *tmp;
-    int               x;
-    for (x = 0; x < WIREGUARD_MAX_PEERS; x++)
+    const hmap_wgindex_t_value *entry = hmap_wgindex_t_get(&device->index_map, receiver);
+    if (entry != NULL && entry->second->valid)
     {
-        tmp = &device->peers[x];
-        if (tmp->valid)
-        {
-            if ((tmp->curr_keypair.valid && (tmp->curr_keypair.local_index == receiver)) ||
+        return entry->second;
+    }
+    return NULL;
+}
+
+static bool peerHoldsIndex(wireguard_peer_t *peer, uint32_t index)
+{
+    return peer->valid && ((peer->handshake.valid && (peer->handshake.local_index == index)) ||
+                           (peer->curr_keypair.valid && (peer->curr_keypair.local_index == index)) ||
+                           (peer->next_keypair.valid && (peer->next_keypair.local_index == index)) ||
+                           (peer->prev_keypair.valid && (peer->prev_keypair.local_index == index)));
+}
+
+wireguard_peer_t *peerLookupByReceiver(wireguard_device_t *device, uint32_t receiver)
+{
+    wireguard_peer_t *tmp = peerLookupByIndex(device, receiver);
+
+    if (tmp && ((tmp->curr_keypair.valid && (tmp->curr_keypair.local_index == receiver)) ||
                 (tmp->next_keypair.valid && (tmp->next_keypair.local_index == receiver)) ||
-                (tmp->prev_keypair.valid && (tmp->prev_keypair.local_index == receiver)))
-            {
-                result = tmp;
-                break;
-            }
-        }
+                (tmp->prev_keypair.valid && (tmp->prev_keypair.local_index == receiver))))
+    {
+        return tmp;
     }
-    return result;
+    return NULL;
 }
 
 wireguard_peer_t *peerLookupByHandshake(wireguard_device_t *device, uint32_t receiver)
 {
-    wireguard_peer_t *result = NULL;
-    wireguard_peer_t *tmp;
-    int               x;
-    for (x = 0; x < WIREGUARD_MAX_PEERS; x++)
+    wireguard_peer_t *tmp = peerLookupByIndex(device, receiver);
+
+    if (tmp && tmp->handshake.valid && tmp->handshake.initiator && (tmp->handshake.local_index == receiver))
     {
-        tmp = &device->peers[x];
-        if (tmp->valid)
-        {
-            if (tmp->handshake.valid && tmp->handshake.initiator && (tmp->handshake.local_index == receiver))
-            {
-                result = tmp;
-                break;
-            }
-        }
+        return tmp;
     }
-    return result;
+    return NULL;
 }
 
 bool wireguardExpired(uint32_t created_millis, uint32_t valid_seconds)
@@ -452,14 +477,35 @@ wireguard_keypair_t *getPeerKeypairForIdx(wireguard_peer_t *peer, uint32_t idx)
     return NULL;
 }
 
-static uint32_t wireguardGenerateUniqueIndex(wireguard_device_t *device)
+// drops the index map entries that no peer holds anymore, every peer holds at most 4 (handshake and 3 keypairs)
+static void wireguardSweepIndexMap(wireguard_device_t *device)
+{
+    if (hmap_wgindex_t_size(&device->index_map) <= (ptrdiff_t) (4 * device->peers_count + kWireguardIndexMapSlack))
+    {
+        return;
+    }
+    hmap_wgindex_t_iter it = hmap_wgindex_t_begin(&device->index_map);
+    while (it.ref)
+    {
+        if (peerHoldsIndex(it.ref->second, it.ref->first))
+        {
+            hmap_wgindex_t_next(&it);
+        }
+        else
+        {
+            it = hmap_wgindex_t_erase_at(&device->index_map, it);
+        }
+    }
+}
+
+static uint32_t wireguardGenerateUniqueIndex(wireguard_device_t *device, wireguard_peer_t *peer)
 {
     // We need a random 32-bit number but make sure it's not already been used in the context of this device
-    uint32_t          result;
-    uint8_t           buf[4];
-    int               x;
-    wireguard_peer_t *peer;
-    bool              existing;
+    uint32_t result;
+    uint8_t  buf[4];
+    bool     existing;
+
+    wireguardSweepIndexMap(device);
     do
     {
         do
@@ -468,15 +514,11 @@ static uint32_t wireguardGenerateUniqueIndex(wireguard_device_t *device)
             result = U8TO32_LITTLE(buf);
         } while ((result == 0) || (result == 0xFFFFFFFF)); // Don't allow 0 or 0xFFFFFFFF as valid values
 
-        existing = false;
-        for (x = 0; x < WIREGUARD_MAX_PEERS; x++)
-        {
-            peer     = &device->peers[x];
-            existing = (result == peer->curr_keypair.local_index) || (result == peer->prev_keypair.local_index) ||
-                       (result == peer->next_keypair.local_index) || (result == peer->handshake.local_index);
-        }
+        const hmap_wgindex_t_value *entry = hmap_wgindex_t_get(&device->index_map, result);
+        existing                          = entry != NULL && peerHoldsIndex(entry->second, result);
     } while (existing);
 
+    hmap_wgindex_t_insert_or_assign(&device->index_map, result, peer);
     return result;
 }
 
@@ -538,37 +580,49 @@ void keypairDestroy(wireguard_keypair_t *keypair)
     keypair->valid = false;
 }
 
+// the sending counter may be advanced by workers encrypting with src while the copy runs, it is read again
+// atomically after the write section started so that no nonce taken by a reader that did not retry is lost
+void keypairCopy(wireguard_keypair_t *dst, wireguard_keypair_t *src)
+{
+    memoryCopy(dst, src, sizeof(wireguard_keypair_t));
+    atomicStore(&dst->sending_counter, atomicLoad(&src->sending_counter));
+}
+
 void keypairUpdate(wireguard_peer_t *peer, wireguard_keypair_t *received_keypair)
 {
     bool key_is_next = (received_keypair == &peer->next_keypair);
     if (key_is_next)
     {
-        peer->prev_keypair = peer->curr_keypair;
-        peer->curr_keypair = peer->next_keypair;
+        peerKeypairsWriteBegin(peer);
+        keypairCopy(&peer->prev_keypair, &peer->curr_keypair);
+        keypairCopy(&peer->curr_keypair, &peer->next_keypair);
         keypairDestroy(&peer->next_keypair);
+        peerKeypairsWriteEnd(peer);
     }
 }
 
-static void addNewKeypair(wireguard_peer_t *peer, wireguard_keypair_t new_keypair)
+static void addNewKeypair(wireguard_peer_t *peer, wireguard_keypair_t *new_keypair)
 {
-    if (new_keypair.initiator)
+    peerKeypairsWriteBegin(peer);
+    if (new_keypair->initiator)
     {
         if (peer->next_keypair.valid)
         {
-            peer->prev_keypair = peer->next_keypair;
+            keypairCopy(&peer->prev_keypair, &peer->next_keypair);
             keypairDestroy(&peer->next_keypair);
         }
         else
         {
-            peer->prev_keypair = peer->curr_keypair;
+            keypairCopy(&peer->prev_keypair, &peer->curr_keypair);
         }
-        peer->curr_keypair = new_keypair;
+        keypairCopy(&peer->curr_keypair, new_keypair);
     }
     else
     {
-        peer->next_keypair = new_keypair;
+        keypairCopy(&peer->next_keypair, new_keypair);
         keypairDestroy(&peer->prev_keypair);
     }
+    peerKeypairsWriteEnd(peer);
 }
 
 void wireguardStartSession(wireguard_peer_t *peer, bool initiator)
@@ -613,7 +667,8 @@ void wireguardStartSession(wireguard_peer_t *peer, bool initiator)
     handshake->local_index  = 0;
     handshake->valid        = false;
 
-    addNewKeypair(peer, new_keypair);
+    addNewKeypair(peer, &new_keypair);
+    wCryptoZero(&new_keypair, sizeof(wireguard_keypair_t));
 }
 
 uint8_t wireguardGetMessageType(const uint8_t *data, size_t len)
@@ -973,7 +1028,7 @@ bool wireguardCreateHandshakeInitiation(wireguard_device_t *device, wireguard_pe
             wireguardMixHash(handshake->hash, dst->enc_timestamp, sizeof(dst->enc_timestamp));
 
             dst->type   = MESSAGE_HANDSHAKE_INITIATION;
-            dst->sender = wireguardGenerateUniqueIndex(device);
+            dst->sender = wireguardGenerateUniqueIndex(device, peer);
 
             handshake->valid       = true;
             handshake->initiator   = true;
@@ -1070,7 +1125,7 @@ bool wireguardCreateHandshakeResponse(wireguard_device_t *device, wireguard_peer
 
                     dst->type     = MESSAGE_HANDSHAKE_RESPONSE;
                     dst->receiver = handshake->remote_index;
-                    dst->sender   = wireguardGenerateUniqueIndex(device);
+                    dst->sender   = wireguardGenerateUniqueIndex(device, peer);
                     // Update handshake object too
                     handshake->local_index = dst->sender;
 
@@ -1137,7 +1192,9 @@ bool wireguardPeerInit(wireguard_device_t *device, wireguard_peer_t *peer, const
                        const uint8_t *preshared_key)
 {
     // Clear out structure
+    uint32_t index = peer->index;
     memorySet(peer, 0, sizeof(wireguard_peer_t));
+    peer->index = index;
 
     if (device->valid)
     {
@@ -1166,7 +1223,10 @@ bool wireguardPeerInit(wireguard_device_t *device, wireguard_peer_t *peer, const
             wireguardMacKey(peer->label_mac1_key, peer->public_key, LABEL_MAC1, sizeof(LABEL_MAC1));
             wireguardMacKey(peer->label_cookie_key, peer->public_key, LABEL_COOKIE, sizeof(LABEL_COOKIE));
 
-            peer->valid = true;
+            // a 64 bit hash collision with another peer key is treated like a bad key
+            peer->valid = hmap_wgpubkey_t_insert(&device->pubkey_map,
+                                                 calcHashBytes(peer->public_key, WIREGUARD_PUBLIC_KEY_LEN), peer)
+                              .inserted;
         }
         else
         {
@@ -1182,6 +1242,13 @@ bool wireguardDeviceInit(wireguard_device_t *device, const uint8_t *private_key)
     memoryCopy(device->private_key, private_key, WIREGUARD_PRIVATE_KEY_LEN);
     // Ensure private key is correctly "clamped"
     wireguardClampPrivateKey(device->private_key);
+    wireguardAllowedIpsInit(&device->allowed_ips);
+    device->peers         = NULL;
+    device->peers_count   = 0;
+    device->peers_cap     = 0;
+    device->peers_removed = 0;
+    device->index_map     = hmap_wgindex_t_with_capacity(kWireguardIndexMapSlack);
+    device->pubkey_map    = hmap_wgpubkey_t_with_capacity(kWireguardPeersInitialCap);
     device->valid = wireguardGeneratePublicKey(device->public_key, private_key);
     if (device->valid)
     {
@@ -1198,12 +1265,29 @@ bool wireguardDeviceInit(wireguard_device_t *device, const uint8_t *private_key)
     return device->valid;
 }
 
+void wireguardDeviceDestroy(wireguard_device_t *device)
+{
+    wireguardAllowedIpsDestroy(&device->allowed_ips);
+    for (uint32_t x = 0; x < device->peers_count; x++)
+    {
+        wCryptoZero(device->peers[x], sizeof(wireguard_peer_t));
+        memoryFree(device->peers[x]);
+    }
+    memoryFree(device->peers);
+    device->peers       = NULL;
+    device->peers_count = 0;
+    device->peers_cap   = 0;
+    hmap_wgindex_t_drop(&device->index_map);
+    hmap_wgpubkey_t_drop(&device->pubkey_map);
+    wCryptoZero(device->private_key, WIREGUARD_PRIVATE_KEY_LEN);
+}
+
 // Modify packet functions to use the wrappers:
-void wireguardEncryptPacket(uint8_t *dst, const uint8_t *src, size_t src_len, wireguard_keypair_t *keypair)
+// the caller reserves the counter (nonce) from the keypair, so workers can encrypt for the same peer in parallel
+void wireguardEncryptPacket(uint8_t *dst, const uint8_t *src, size_t src_len, uint64_t counter,
+                            const uint8_t *sending_key)
 {
-    // Use the wrapper with keypair->sending_counter passed by value.
-    chacha20poly1305EncryptWrapper(dst, src, src_len, NULL, 0, keypair->sending_counter, keypair->sending_key);
-    keypair->sending_counter++;
+    chacha20poly1305EncryptWrapper(dst, src, src_len, NULL, 0, counter, sending_key);
 }
 
 bool wireguardDecryptPacket(uint8_t *dst, const uint8_t *src, size_t src_len, uint64_t counter,
@@ -0,0 +1,242 @@
+#include "structure.h"
+
+#include "loggers/network_logger.h"
+
+static inline uint8_t allowedipsBitAt(const uint8_t *bits, uint8_t index)
+{
+    return (bits[index >> 3] >> (7 - (index & 7))) & 1;
+}
+
+// number of equal leading bits of a and b, at most max_bits
+static uint8_t allowedipsCommonBits(const uint8_t *a, const uint8_t *b, uint8_t max_bits)
+{
+    uint8_t i = 0;
+    for (; i + 8 <= max_bits; i += 8)
+    {
+        uint8_t x = a[i >> 3] ^ b[i >> 3];
+        if (x != 0)
+        {
+            while ((x & 0x80) == 0)
+            {
+                x = (uint8_t) (x << 1);
+                i++;
+            }
+            return i;
+        }
+    }
+    for (; i < max_bits; i++)
+    {
+        if (allowedipsBitAt(a, i) != allowedipsBitAt(b, i))
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+static void allowedipsCopyMasked(uint8_t *dst, const uint8_t *src, uint8_t cidr)
+{
+    memorySet(dst, 0, 16);
+    memoryCopy(dst, src, cidr / 8);
+    if (cidr % 8 != 0)
+    {
+        dst[cidr / 8] = src[cidr / 8] & (uint8_t) (0xFF << (8 - (cidr % 8)));
+    }
+}
+
+static wireguard_allowedips_node_t *allowedipsNodeCreate(const uint8_t *bits, uint8_t cidr, wireguard_peer_t *peer)
+{
+    wireguard_allowedips_node_t *node = memoryAllocate(sizeof(wireguard_allowedips_node_t));
+
+    atomicStoreExplicit(&node->child[0], (uintptr_t) NULL, memory_order_relaxed);
+    atomicStoreExplicit(&node->child[1], (uintptr_t) NULL, memory_order_relaxed);
+    atomicStoreExplicit(&node->peer, (uintptr_t) peer, memory_order_relaxed);
+    allowedipsCopyMasked(node->bits, bits, cidr);
+    node->cidr = cidr;
+    return node;
+}
+
+static void allowedipsNodeDestroy(wireguard_allowedips_node_t *node)
+{
+    if (node == NULL)
+    {
+        return;
+    }
+    allowedipsNodeDestroy((wireguard_allowedips_node_t *) atomicLoadExplicit(&node->child[0], memory_order_relaxed));
+    allowedipsNodeDestroy((wireguard_allowedips_node_t *) atomicLoadExplicit(&node->child[1], memory_order_relaxed));
+    memoryFree(node);
+}
+
+static void allowedipsNodeRemovePeer(wireguard_allowedips_node_t *node, wireguard_peer_t *peer)
+{
+    if (node == NULL)
+    {
+        return;
+    }
+    if (atomicLoadExplicit(&node->peer, memory_order_relaxed) == (uintptr_t) peer)
+    {
+        atomicStoreExplicit(&node->peer, (uintptr_t) NULL, memory_order_release);
+    }
+    allowedipsNodeRemovePeer((wireguard_allowedips_node_t *) atomicLoadExplicit(&node->child[0], memory_order_relaxed),
+                             peer);
+    allowedipsNodeRemovePeer((wireguard_allowedips_node_t *) atomicLoadExplicit(&node->child[1], memory_order_relaxed),
+                             peer);
+}
+
+static bool allowedipsAddressBytes(const ip_addr_t *ip, uint8_t *bytes, bool *ipv6)
+{
+    if (IP_IS_V4(ip))
+    {
+        memoryCopy(bytes, &(ip_2_ip4(ip)->addr), 4);
+        *ipv6 = false;
+        return true;
+    }
+    if (IP_IS_V6(ip))
+    {
+        memoryCopy(bytes, &(ip_2_ip6(ip)->addr[0]), 16);
+        *ipv6 = true;
+        return true;
+    }
+    return false;
+}
+
+void wireguardAllowedIpsInit(wireguard_allowedips_t *table)
+{
+    atomicStoreExplicit(&table->root4, (uintptr_t) NULL, memory_order_relaxed);
+    atomicStoreExplicit(&table->root6, (uintptr_t) NULL, memory_order_release);
+}
+
+void wireguardAllowedIpsDestroy(wireguard_allowedips_t *table)
+{
+    allowedipsNodeDestroy((wireguard_allowedips_node_t *) atomicLoadExplicit(&table->root4, memory_order_acquire));
+    allowedipsNodeDestroy((wireguard_allowedips_node_t *) atomicLoadExplicit(&table->root6, memory_order_acquire));
+    wireguardAllowedIpsInit(table);
+}
+
+bool wireguardAllowedIpsInsert(wireguard_allowedips_t *table, const ip_addr_t *ip, uint8_t cidr,
+                               wireguard_peer_t *peer)
+{
+    uint8_t addr[16] = {0};
+    uint8_t bits[16];
+    bool    ipv6;
+
+    if (! allowedipsAddressBytes(ip, addr, &ipv6))
+    {
+        return false;
+    }
+    if (cidr > (ipv6 ? kWireguardAllowedIpsV6Bits : kWireguardAllowedIpsV4Bits))
+    {
+        return false;
+    }
+    allowedipsCopyMasked(bits, addr, cidr);
+
+    atomic_uintptr_t *slot = ipv6 ? &table->root6 : &table->root4;
+
+    // new nodes are fully built before the release store that links them, so a lock-free reader sees either the
+    // old or the new subtree
+    while (true)
+    {
+        wireguard_allowedips_node_t *node =
+            (wireguard_allowedips_node_t *) atomicLoadExplicit(slot, memory_order_relaxed);
+
+        if (node == NULL)
+        {
+            atomicStoreExplicit(slot, (uintptr_t) allowedipsNodeCreate(bits, cidr, peer), memory_order_release);
+            return true;
+        }
+
+        uint8_t common = allowedipsCommonBits(node->bits, bits, node->cidr < cidr ? node->cidr : cidr);
+
+        if (common == node->cidr && common == cidr)
+        {
+            // same prefix, re-assign it
+            atomicStoreExplicit(&node->peer, (uintptr_t) peer, memory_order_release);
+            return true;
+        }
+
+        if (common == node->cidr)
+        {
+            // node is a shorter prefix of ours, go down
+            slot = &node->child[allowedipsBitAt(bits, node->cidr)];
+            continue;
+        }
+
+        wireguard_allowedips_node_t *parent;
+        if (common == cidr)
+        {
+            // our prefix is a shorter prefix of node, it takes node's place
+            parent = allowedipsNodeCreate(bits, cidr, peer);
+        }
+        else
+        {
+            // prefixes diverge at bit common, split them with a branch node
+            wireguard_allowedips_node_t *leaf = allowedipsNodeCreate(bits, cidr, peer);
+            parent                            = allowedipsNodeCreate(bits, common, NULL);
+            atomicStoreExplicit(&parent->child[allowedipsBitAt(bits, common)], (uintptr_t) leaf, memory_order_relaxed);
+        }
+        atomicStoreExplicit(&parent->child[allowedipsBitAt(node->bits, common)], (uintptr_t) node,
+                            memory_order_relaxed);
+        atomicStoreExplicit(slot, (uintptr_t) parent, memory_order_release);
+        return true;
+    }
+}
+
+void wireguardAllowedIpsRemoveByPeer(wireguard_allowedips_t *table, wireguard_peer_t *peer)
+{
+    allowedipsNodeRemovePeer((wireguard_allowedips_node_t *) atomicLoadExplicit(&table->root4, memory_order_relaxed),
+                             peer);
+    allowedipsNodeRemovePeer((wireguard_allowedips_node_t *) atomicLoadExplicit(&table->root6, memory_order_relaxed),
+                             peer);
+}
+
+wireguard_peer_t *wireguardAllowedIpsLookup(wireguard_allowedips_t *table, const uint8_t *addr, bool ipv6)
+{
+    const uint8_t     max_bits = ipv6 ? kWireguardAllowedIpsV6Bits : kWireguardAllowedIpsV4Bits;
+    wireguard_peer_t *result   = NULL;
+
+    wireguard_allowedips_node_t *node = (wireguard_allowedips_node_t *) atomicLoadExplicit(
+        ipv6 ? &table->root6 : &table->root4, memory_order_acquire);
+
+    while (node != NULL && allowedipsCommonBits(node->bits, addr, node->cidr) == node->cidr)
+    {
+        wireguard_peer_t *peer = (wireguard_peer_t *) atomicLoadExplicit(&node->peer, memory_order_acquire);
+        if (peer != NULL)
+        {
+            result = peer;
+        }
+        if (node->cidr == max_bits)
+        {
+            break;
+        }
+        node = (wireguard_allowedips_node_t *) atomicLoadExplicit(&node->child[allowedipsBitAt(addr, node->cidr)],
+                                                                  memory_order_acquire);
+    }
+    return result;
+}
+
+wireguard_peer_t *wireguardAllowedIpsLookupAddr(wireguard_allowedips_t *table, const ip_addr_t *ip)
+{
+    uint8_t addr[16];
+    bool    ipv6;
+
+    if (! allowedipsAddressBytes(ip, addr, &ipv6))
+    {
+        return NULL;
+    }
+    return wireguardAllowedIpsLookup(table, addr, ipv6);
+}
+
+uint8_t wireguardAllowedIpsMaskToCidr(const ip_addr_t *mask)
+{
+    uint8_t addr[16];
+    bool    ipv6;
+
+    if (! allowedipsAddressBytes(mask, addr, &ipv6))
+    {
+        return 0;
+    }
+
+    const uint8_t ones[16] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                              0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    return allowedipsCommonBits(addr, ones, ipv6 ? kWireguardAllowedIpsV6Bits : kWireguardAllowedIpsV4Bits);
+}
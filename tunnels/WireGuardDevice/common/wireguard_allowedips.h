@@ -0,0 +1,70 @@
+#pragma once
+
+#include "wwapi.h"
+
+/*
+    Allowed IPs (cryptokey routing table)
+
+    one path compressed binary trie per address family, a node holds a prefix (address bytes in network order masked
+    to cidr bits) and the peer that owns it, or NULL for the branch nodes that only exist to split two prefixes
+
+    lookups walk at most cidr-length nodes and return the peer of the longest matching prefix
+
+    writers (peer / allowed ip changes) are serialized by the device mutex, lookups run on any worker without it:
+    a node is fully built before the release store that links it in and existing nodes are never moved, removing a
+    peer only clears its peer pointers, so the nodes are freed when the table is destroyed
+*/
+
+struct wireguard_peer_s;
+
+enum
+{
+    kWireguardAllowedIpsV4Bits = 32,
+    kWireguardAllowedIpsV6Bits = 128
+};
+
+typedef struct wireguard_allowedips_node_s
+{
+    atomic_uintptr_t child[2]; // struct wireguard_allowedips_node_s *
+    atomic_uintptr_t peer;     // struct wireguard_peer_s *
+    uint8_t          bits[16];
+    uint8_t          cidr;
+
+} wireguard_allowedips_node_t;
+
+typedef struct wireguard_allowedips_s
+{
+    atomic_uintptr_t root4; // wireguard_allowedips_node_t *
+    atomic_uintptr_t root6; // wireguard_allowedips_node_t *
+
+} wireguard_allowedips_t;
+
+void wireguardAllowedIpsInit(wireguard_allowedips_t *table);
+void wireguardAllowedIpsDestroy(wireguard_allowedips_t *table);
+
+/**
+ * @brief Adds (or re-assigns) a prefix to a peer, the caller must hold the device mutex or own the device.
+ * @return false on invalid cidr
+ */
+bool wireguardAllowedIpsInsert(wireguard_allowedips_t *table, const ip_addr_t *ip, uint8_t cidr,
+                               struct wireguard_peer_s *peer);
+
+/**
+ * @brief Removes every prefix of the peer, the caller must hold the device mutex or own the device.
+ */
+void wireguardAllowedIpsRemoveByPeer(wireguard_allowedips_t *table, struct wireguard_peer_s *peer);
+
+/**
+ * @brief Longest prefix match of a raw address (network order), 4 bytes for ipv4 and 16 bytes for ipv6.
+ */
+struct wireguard_peer_s *wireguardAllowedIpsLookup(wireguard_allowedips_t *table, const uint8_t *addr, bool ipv6);
+
+/**
+ * @brief Longest prefix match of an lwip address.
+ */
+struct wireguard_peer_s *wireguardAllowedIpsLookupAddr(wireguard_allowedips_t *table, const ip_addr_t *ip);
+
+/**
+ * @brief Number of leading one bits of a (contiguous) lwip netmask.
+ */
+uint8_t wireguardAllowedIpsMaskToCidr(const ip_addr_t *mask);
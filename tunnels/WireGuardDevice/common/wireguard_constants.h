@@ -8,7 +8,7 @@
 #define WIREGUARDIF_DEFAULT_PORT      (51820)
 #define WIREGUARDIF_KEEPALIVE_DEFAULT (0xFFFF)
 
-#define WIREGUARD_MAX_PEERS   1
+#define WIREGUARD_MAX_PEERS   (1U << 16) // upper bound of the peer table, it grows on demand
 #define WIREGUARD_MAX_SRC_IPS 2
 
 // Per device limit on accepting (valid) initiation requests - per peer
@@ -38,10 +38,11 @@
 #define REKEY_AFTER_TIME			(120)
 #define REJECT_AFTER_TIME			(180)
 #define REKEY_TIMEOUT				(1)
+#define REKEY_TIMEOUT_JITTER_MAX	(333) // ms, a retried initiation waits REKEY_TIMEOUT plus up to this much
 #define KEEPALIVE_TIMEOUT			(10)
 
 
-#define SYSTEM_LOAD_THRESHOULD (0.9)
+#define SYSTEM_LOAD_THRESHOULD (90.0) // percent, isSystemUnderLoad takes a percent on every platform
 
 #define MESSAGE_INVALID              0
 #define MESSAGE_HANDSHAKE_INITIATION 1
@@ -50,4 +51,4 @@
 #define MESSAGE_TRANSPORT_DATA       4
 
 
-#define WIREGUARDIF_INVALID_INDEX (0xFF)
+#define WIREGUARDIF_INVALID_INDEX (0xFFFFFFFFU)
@@ -1,4 +1,5 @@
 #pragma once
+#include "wireguard_allowedips.h"
 #include "wireguard_constants.h"
 #include "wwapi.h"
 
@@ -105,15 +106,15 @@ struct wireguard_keypair_s
     bool initiator; // Did we initiate this session (send the initiation packet rather than sending the response packet)
     uint32_t keypair_millis;
 
-    uint8_t  sending_key[WIREGUARD_SESSION_KEY_LEN];
-    bool     sending_valid;
-    uint64_t sending_counter;
+    uint8_t       sending_key[WIREGUARD_SESSION_KEY_LEN];
+    bool          sending_valid;
+    atomic_ullong sending_counter; // nonce, taken with atomicAdd by the workers that encrypt with this keypair
 
     uint8_t receiving_key[WIREGUARD_SESSION_KEY_LEN];
     bool    receiving_valid;
 
-    uint32_t last_tx;
-    uint32_t last_rx;
+    atomic_uint last_tx;
+    atomic_uint last_rx;
 
     uint32_t replay_bitmap;
     uint64_t replay_counter;
@@ -145,13 +146,14 @@ typedef struct wireguard_allowed_ip_s
 
 struct wireguard_peer_s
 {
-    bool valid;  // Is this peer initialised?
+    bool     valid; // Is this peer initialised?
+    uint32_t index; // Position in the device peer table, kept across wireguardPeerInit
     bool active; // Should we be actively trying to connect?
 
     // This is the configured IP of the peer (endpoint)
     ip_addr_t connect_ip;
     uint16_t  connect_port;
-    // This is the latest received IP/port
+    // This is the latest received IP/port (written like the keypairs, inside peerKeypairsWriteBegin/End)
     ip_addr_t ip;
     uint16_t  port;
     // keep-alive interval in seconds, 0 is disable
@@ -165,7 +167,9 @@ struct wireguard_peer_s
     // Precomputed DH(Sprivi,Spubr) with device private key, and peer public key
     uint8_t public_key_dh[WIREGUARD_PUBLIC_KEY_LEN];
 
-    // Session keypairs
+    // Session keypairs, changed only under the device mutex and inside peerKeypairsWriteBegin/End so the data path
+    // can read them without the mutex (seqlock, odd while a writer is active)
+    atomic_uint                keypairs_seq;
     struct wireguard_keypair_s curr_keypair;
     struct wireguard_keypair_s prev_keypair;
     struct wireguard_keypair_s next_keypair;
@@ -192,16 +196,30 @@ struct wireguard_peer_s
     uint32_t last_initiation_rx;
     // The last time we sent an initiation message to this peer
     uint32_t last_initiation_tx;
+    // Random extra wait (ms) before that initiation may be retried
+    uint32_t initiation_jitter;
 
     // last_tx and last_rx of data packets
-    uint32_t last_tx;
-    uint32_t last_rx;
+    atomic_uint last_tx;
+    atomic_uint last_rx;
 
     // We set this flag on RX/TX of packets if we think that we should initiate a new handshake
-    bool send_handshake;
+    atomic_bool send_handshake;
 };
 typedef struct wireguard_peer_s wireguard_peer_t;
 
+// receiver index (the local_index of our handshakes and keypairs) -> peer
+#define i_type hmap_wgindex_t     // NOLINT
+#define i_key  uint32_t           // NOLINT
+#define i_val  wireguard_peer_t * // NOLINT
+#include "stc/hmap.h"
+
+// hash of the peer static public key -> peer
+#define i_type hmap_wgpubkey_t    // NOLINT
+#define i_key  hash_t             // NOLINT
+#define i_val  wireguard_peer_t * // NOLINT
+#include "stc/hmap.h"
+
 struct wireguard_device_s
 {
     // Maybe have a "Device private" member to abstract these?
@@ -220,8 +238,20 @@ struct wireguard_device_s
     uint8_t label_cookie_key[WIREGUARD_SESSION_KEY_LEN];
     uint8_t label_mac1_key[WIREGUARD_SESSION_KEY_LEN];
 
-    // List of peers associated with this device
-    wireguard_peer_t peers[WIREGUARD_MAX_PEERS];
+    // Peers associated with this device, the table grows on demand; every peer is a separate allocation so its
+    // address is stable, the upstream data path keeps peer pointers (allowed_ips) without the device mutex
+    wireguard_peer_t **peers;
+    uint32_t           peers_count;   // used entries of peers, removed ones included
+    uint32_t           peers_cap;     // allocated entries of peers
+    uint32_t           peers_removed; // entries of removed peers that peerAlloc can reuse
+
+    // Inbound demux, changed and read under the device mutex; index entries are verified against the peer on
+    // lookup and the stale ones (rotated keypairs, abandoned handshakes) are swept when the map outgrows the peers
+    hmap_wgindex_t  index_map;
+    hmap_wgpubkey_t pubkey_map;
+
+    // Cryptokey routing table, maps an inner destination address to the peer that owns the longest matching prefix
+    wireguard_allowedips_t allowed_ips;
 
     bool valid;
 };
@@ -55,8 +55,15 @@ static void wireguardifSendHandshakeCookie(wireguard_device_t *device, const uin
 
 static void updatePeerAddr(wireguard_peer_t *peer, const ip_addr_t *addr, uint16_t port)
 {
+    // called for every authenticated packet, only roaming bumps the sequence that the senders check
+    if (peer->port == port && ipAddrCmp(&peer->ip, addr))
+    {
+        return;
+    }
+    peerKeypairsWriteBegin(peer);
     peer->ip   = *addr;
     peer->port = port;
+    peerKeypairsWriteEnd(peer);
 }
 
 static void wireguardifProcessDataMessage(wireguard_device_t *device, wireguard_peer_t *peer,
@@ -104,9 +111,9 @@ static void wireguardifProcessDataMessage(wireguard_device_t *device, wireguard_
                     // to update the endpoint for peer TrMv...WXX0. Update the peer location
                     updatePeerAddr(peer, addr, port);
 
-                    now              = getTickMS();
-                    keypair->last_rx = now;
-                    peer->last_rx    = now;
+                    now = getTickMS();
+                    atomicStoreRelaxed(&keypair->last_rx, now);
+                    atomicStoreRelaxed(&peer->last_rx, now);
 
                     // Might need to shuffle next key --> current keypair
                     keypairUpdate(peer, keypair);
@@ -171,12 +178,8 @@ static void wireguardifProcessDataMessage(wireguard_device_t *device, wireguard_
                                     // Send packet to be process by LWIP
                                     // ip_input(buf, device->ts);
 
-                                    wgd_tstate_t *ts     = (wgd_tstate_t *) device;
-                                    if (ts->locked)
-                                    {
-                                        ts->locked = false;
-                                        mutexUnlock(&ts->mutex);
-                                    }
+                                    wgd_tstate_t *ts = (wgd_tstate_t *) device;
+                                    wireguarddeviceUnlock(ts);
                                     tunnel_t     *tunnel = ts->tunnel;
                                     line_t       *line   = tunnelchainGetPacketLine(tunnel->chain, getWID());
                                     tunnelPrevDownStreamPayload(tunnel, line, buf);
@@ -215,7 +218,9 @@ static void wireguardifProcessDataMessage(wireguard_device_t *device, wireguard_
             // After-Time seconds old,
             //  whichever comes first, WireGuard will refuse to send or receive any more transport data messages using
             //  the current secure session, until a new secure session is created through the 1-RTT handshake
+            peerKeypairsWriteBegin(peer);
             keypairDestroy(keypair);
+            peerKeypairsWriteEnd(peer);
         }
     }
     else
@@ -449,16 +454,10 @@ static void wireguardifNetworkRx(wireguard_device_t *device, sbuf_t *p, const ip
 void wireguarddeviceTunnelDownStreamPayload(tunnel_t *t, line_t *l, sbuf_t *buf)
 {
     wgd_tstate_t *state = tunnelGetState(t);
-    mutexLock(&state->mutex);
-    state->locked = true;
+    wireguarddeviceLock(state);
 
     wireguardifNetworkRx((wireguard_device_t *) tunnelGetState(t), buf, &l->routing_context.src_ctx.ip_address,
                          l->routing_context.src_ctx.port);
 
-    if (state->locked)
-    {
-        state->locked = false;
-        mutexUnlock(&state->mutex);
-    }
-    mutexUnlock(&state->mutex);
+    wireguarddeviceUnlock(state);
 }
@@ -11,9 +11,9 @@ typedef struct wgd_tstate_s
     // Note dont change the order of this struct, we use pointer casting to get the device and state
     wireguard_device_t wg_device;
 
-    tunnel_t *tunnel;
-    wmutex_t  mutex;
-    bool      locked; // this variable is protected by mutex
+    tunnel_t  *tunnel;
+    wmutex_t   mutex;      // covers handshakes and keypair rotation, the data path of the upstream does not take it
+    atomic_int lock_owner; // wid + 1 of the worker that holds the mutex, 0 if free
 
     // the data that came from json configuration, we build real wireguard device from this
     wireguard_device_init_data_t device_configuration;
@@ -57,6 +57,40 @@ void wireguarddeviceTunnelDownStreamResume(tunnel_t *t, line_t *l);
 void wireguarddeviceLinestateInitialize(wgd_lstate_t *ls);
 void wireguarddeviceLinestateDestroy(wgd_lstate_t *ls);
 
+/*
+    the mutex is released early by the output functions (before the packet leaves the tunnel), so the owner is
+    tracked per worker; wireguarddeviceUnlock is a no-op for a worker that does not hold the mutex
+*/
+static inline void wireguarddeviceLock(wgd_tstate_t *ts)
+{
+    mutexLock(&ts->mutex);
+    atomicStoreRelaxed(&ts->lock_owner, (int) getWID() + 1);
+}
+
+static inline void wireguarddeviceUnlock(wgd_tstate_t *ts)
+{
+    if (atomicLoadRelaxed(&ts->lock_owner) == (int) getWID() + 1)
+    {
+        atomicStoreRelaxed(&ts->lock_owner, 0);
+        mutexUnlock(&ts->mutex);
+    }
+}
+
+/*
+    keypairs (and the peer endpoint) are published with a per peer sequence counter, writers hold the device mutex
+    and keep the section short without calling out of the tunnel, readers retry when the counter moved
+*/
+static inline void peerKeypairsWriteBegin(wireguard_peer_t *peer)
+{
+    atomicAdd(&peer->keypairs_seq, 1);
+    atomicThreadFence(memory_order_release);
+}
+
+static inline void peerKeypairsWriteEnd(wireguard_peer_t *peer)
+{
+    atomicAdd(&peer->keypairs_seq, 1);
+}
+
 /***************************************** WireGuard Interface ****************************************** */
 
 /* wireguard device cycle is the heart of the device that is by defalut runs every 400 ms*/
@@ -67,22 +101,25 @@ void wireguardifPeerInit(wireguard_peer_init_data_t *peer);
 
 // Add a new peer to the specified interface - see wireguard.h for maximum number of peers allowed
 // On success the peer_index can be used to reference this peer in future function calls
-err_t wireguardifAddPeer(wireguard_device_t *device, wireguard_peer_init_data_t *peer, uint8_t *peer_index);
+err_t wireguardifAddPeer(wireguard_device_t *device, wireguard_peer_init_data_t *peer, uint32_t *peer_index);
+
+// Route an extra prefix (ipv4 or ipv6, cidr bits) to the given peer, see wireguard_allowedips.h
+err_t wireguardifAddAllowedIp(wireguard_device_t *device, uint32_t peer_index, const ip_addr_t *ip, uint8_t cidr);
 
 // Remove the given peer from the network interface
-err_t wireguardifRemovePeer(wireguard_device_t *device, uint8_t peer_index);
+err_t wireguardifRemovePeer(wireguard_device_t *device, uint32_t peer_index);
 
 // Update the "connect" IP of the given peer
-err_t wireguardifUpdateEndpoint(wireguard_device_t *device, uint8_t peer_index, const ip_addr_t *ip, uint16_t port);
+err_t wireguardifUpdateEndpoint(wireguard_device_t *device, uint32_t peer_index, const ip_addr_t *ip, uint16_t port);
 
 // Try and connect to the given peer
-err_t wireguardifConnect(wireguard_device_t *device, uint8_t peer_index);
+err_t wireguardifConnect(wireguard_device_t *device, uint32_t peer_index);
 
 // Stop trying to connect to the given peer
-err_t wireguardifDisconnect(wireguard_device_t *device, uint8_t peer_index);
+err_t wireguardifDisconnect(wireguard_device_t *device, uint32_t peer_index);
 
 // Is the given peer "up"? A peer is up if it has a valid session key it can communicate with
-err_t wireguardifPeerIsUp(wireguard_device_t *device, uint8_t peer_index, ip_addr_t *current_ip,
+err_t wireguardifPeerIsUp(wireguard_device_t *device, uint32_t peer_index, ip_addr_t *current_ip,
                           uint16_t *current_port);
 
 err_t wireguardifPeerOutput(wireguard_device_t *device, sbuf_t *q, wireguard_peer_t *peer);
@@ -94,19 +131,22 @@ err_t wireguardifOutputToPeer(wireguard_device_t *device, sbuf_t *q, const ip_ad
 
 void wireguardInit(void);
 bool wireguardDeviceInit(wireguard_device_t *device, const uint8_t *private_key);
+void wireguardDeviceDestroy(wireguard_device_t *device);
 bool wireguardPeerInit(wireguard_device_t *device, wireguard_peer_t *peer, const uint8_t *public_key,
                        const uint8_t *preshared_key);
 
 wireguard_peer_t *peerAlloc(wireguard_device_t *device);
-uint8_t           wireguardPeerIndex(wireguard_device_t *device, wireguard_peer_t *peer);
+void              peerRemove(wireguard_device_t *device, wireguard_peer_t *peer);
+uint32_t          wireguardPeerIndex(wireguard_device_t *device, wireguard_peer_t *peer);
 wireguard_peer_t *peerLookupByPubkey(wireguard_device_t *device, uint8_t *public_key);
-wireguard_peer_t *peerLookupByPeerIndex(wireguard_device_t *device, uint8_t peer_index);
+wireguard_peer_t *peerLookupByPeerIndex(wireguard_device_t *device, uint32_t peer_index);
 wireguard_peer_t *peerLookupByReceiver(wireguard_device_t *device, uint32_t receiver);
 wireguard_peer_t *peerLookupByHandshake(wireguard_device_t *device, uint32_t receiver);
 
 void wireguardStartSession(wireguard_peer_t *peer, bool initiator);
 void keypairUpdate(wireguard_peer_t *peer, wireguard_keypair_t *received_keypair);
 void keypairDestroy(wireguard_keypair_t *keypair);
+void keypairCopy(wireguard_keypair_t *dst, wireguard_keypair_t *src);
 
 wireguard_keypair_t *getPeerKeypairForIdx(wireguard_peer_t *peer, uint32_t idx);
 bool                 wireguardCheckReplay(wireguard_keypair_t *keypair, uint64_t seq);
@@ -130,7 +170,8 @@ bool wireguardCheckMac2(wireguard_device_t *device, const uint8_t *data, size_t
 
 bool wireguardExpired(uint32_t created_millis, uint32_t valid_seconds);
 
-void wireguardEncryptPacket(uint8_t *dst, const uint8_t *src, size_t src_len, wireguard_keypair_t *keypair);
+void wireguardEncryptPacket(uint8_t *dst, const uint8_t *src, size_t src_len, uint64_t counter,
+                            const uint8_t *sending_key);
 bool wireguardDecryptPacket(uint8_t *dst, const uint8_t *src, size_t src_len, uint64_t counter,
                             wireguard_keypair_t *keypair);
 
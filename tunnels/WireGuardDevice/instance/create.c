@@ -37,6 +37,26 @@
 // YIJmMTi+hQ4o/FBx1vWxLQRrOV4ShetmmjcHRveClBg=
 // uJb7QdPW9u5+1SjXUNf0VYeZzyFwT2iJCJ7hlH7f71k=
 
+// parses "address/cidr" (the string is modified), ipv4 or ipv6
+static bool parseAllowedIpPrefix(char *prefix_str, ip_addr_t *ip, uint8_t *cidr)
+{
+    char *slash_ptr = stringChr(prefix_str, '/');
+    if (! slash_ptr)
+    {
+        return false;
+    }
+    slash_ptr[0] = '\0';
+
+    int bits = atoi(slash_ptr + 1);
+    if (! ipaddr_aton(prefix_str, ip) || bits < 0 ||
+        bits > (IP_IS_V6(ip) ? kWireguardAllowedIpsV6Bits : kWireguardAllowedIpsV4Bits))
+    {
+        return false;
+    }
+    *cidr = (uint8_t) bits;
+    return true;
+}
+
 static void wireguarddeviceInit(wireguard_device_t *device, wireguard_device_init_data_t *data)
 {
     assert(data != NULL);
@@ -133,7 +153,7 @@ tunnel_t *wireguarddeviceTunnelCreate(node_t *node)
         LOGF("JSON Error: WireGuardDevice->settings->peers (array field) :  peers_count <= 0");
         return NULL;
     }
-    if (peers_count > WIREGUARD_MAX_PEERS)
+    if ((uint32_t) peers_count > WIREGUARD_MAX_PEERS)
     {
         LOGF("JSON Error: WireGuardDevice->settings->peers (array field) : peers_count > WIREGUARD_MAX_PEERS");
         return NULL;
@@ -185,6 +205,8 @@ tunnel_t *wireguarddeviceTunnelCreate(node_t *node)
         wireguardifPeerInit(&peer);
         peer.public_key    = (const uint8_t *) peer_public_key;
         peer.preshared_key = (const uint8_t *) peer_preshared_key;
+        ip_addr_t peer_allowed_ip6;
+        uint8_t   peer_allowed_cidr6 = 0;
         { //  10.0.0.1/24, fd86:ea04:1115::1/64
             char *peer_allowed_ips_nospace = stringNewWithoutSpace(peer_allowed_ips);
             memoryFree(peer_allowed_ips);
@@ -216,12 +238,18 @@ tunnel_t *wireguarddeviceTunnelCreate(node_t *node)
                      i);
                 return NULL;
             }
-            /*
-                TODO
-                currently only supports ipv4
-            */
             parseIPWithSubnetMask(ipv4_part,  &peer.allowed_ip,
                                   &peer.allowed_mask);
+
+            // the ipv6 prefix goes to the allowed ips trie once the peer is added
+            if (! parseAllowedIpPrefix(ipv6_part, &peer_allowed_ip6, &peer_allowed_cidr6))
+            {
+                LOGF("JSON Error: WireGuardDevice->settings->peers [ index %d  ]->allowedips (string field) (ipv6 "
+                     "part): The data "
+                     "was empty or invalid",
+                     i);
+                return NULL;
+            }
         }
         {
             char *colon_ptr = stringChr(peer_endpoint, ':');
@@ -248,11 +276,17 @@ tunnel_t *wireguarddeviceTunnelCreate(node_t *node)
             peer.endpoint_port = port;
         }
         // Add the peer
-        if (wireguardifAddPeer(device, &peer, NULL) != ERR_OK)
+        uint32_t peer_index = WIREGUARDIF_INVALID_INDEX;
+        if (wireguardifAddPeer(device, &peer, &peer_index) != ERR_OK)
         {
             LOGF("Error: wireguardifAddPeer failed");
             return NULL;
         }
+        if (wireguardifAddAllowedIp(device, peer_index, &peer_allowed_ip6, peer_allowed_cidr6) != ERR_OK)
+        {
+            LOGF("Error: wireguardifAddAllowedIp failed");
+            return NULL;
+        }
     }
 
     return t;
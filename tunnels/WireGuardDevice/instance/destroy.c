@@ -5,6 +5,7 @@
 void wireguarddeviceTunnelDestroy(tunnel_t *t)
 {
     wgd_tstate_t *state = tunnelGetState(t);
+    wireguardDeviceDestroy(&state->wg_device);
     mutexDestroy(&state->mutex);
     tunnelDestroy(t);
 }
@@ -13,9 +13,9 @@ void wireguarddeviceTunnelOnStart(tunnel_t *t)
     wgd_tstate_t *state = tunnelGetState(t);
 
     wireguard_device_t *device = (wireguard_device_t*) state;
-    for (uint8_t i = 0; i < WIREGUARD_MAX_PEERS; i++)
+    for (uint32_t i = 0; i < device->peers_count; i++)
     {
-        wireguard_peer_t *peer = &device->peers[i];
+        wireguard_peer_t *peer = device->peers[i];
         if (peer->valid)
         {
             if (wireguardifConnect(device, i) != ERR_OK)
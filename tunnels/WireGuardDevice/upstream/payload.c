@@ -4,47 +4,82 @@
 
 
 
-static wireguard_peer_t *peerLookupByAllowedIp(wireguard_device_t *device, const ip_addr_t *ipaddr)
+/*
+    what the data path needs from a peer to send one packet, read without the device mutex (see peerKeypairsWriteBegin)
+*/
+typedef struct wireguard_send_snapshot_s
 {
-    wireguard_peer_t *result = NULL;
-    wireguard_peer_t *tmp;
-    int x, y;
-    for (x = 0; (!result) && (x < WIREGUARD_MAX_PEERS); x++)
+    wireguard_keypair_t *keypair; // the slot the counter was taken from, only used for last_tx after sending
+    uint8_t              sending_key[WIREGUARD_SESSION_KEY_LEN];
+    uint64_t             counter;
+    uint32_t             remote_index;
+    uint32_t             keypair_millis;
+    bool                 initiator;
+    ip_addr_t            ip;
+    uint16_t             port;
+
+} wireguard_send_snapshot_t;
+
+enum wireguard_send_snapshot_result_e
+{
+    kSendSnapshotOk,
+    kSendSnapshotNoKeys,
+    kSendSnapshotExpired
+};
+
+static enum wireguard_send_snapshot_result_e peerSnapshotForSend(wireguard_peer_t          *peer,
+                                                                 wireguard_send_snapshot_t *snap)
+{
+    while (true)
     {
-        tmp = &device->peers[x];
-        if (tmp->valid)
+        const unsigned int seq = atomicLoadExplicit(&peer->keypairs_seq, memory_order_acquire);
+        if (seq & 1U)
+        {
+            // a writer is rotating the keypairs, the section is a few copies long
+            continue;
+        }
+
+        enum wireguard_send_snapshot_result_e result  = kSendSnapshotNoKeys;
+        wireguard_keypair_t                  *keypair = &peer->curr_keypair;
+
+        // Note: We may not be able to use the current keypair if we haven't received data, may need to resort to
+        // using previous keypair
+        if (keypair->valid && (! keypair->initiator) && (atomicLoadRelaxed(&keypair->last_rx) == 0))
         {
-            for (y = 0; y < WIREGUARD_MAX_SRC_IPS; y++)
+            keypair = &peer->prev_keypair;
+        }
+
+        if (keypair->valid && (keypair->initiator || atomicLoadRelaxed(&keypair->last_rx) != 0))
+        {
+            result = kSendSnapshotExpired;
+
+            if (! wireguardExpired(keypair->keypair_millis, REJECT_AFTER_TIME) &&
+                (atomicLoadRelaxed(&keypair->sending_counter) < REJECT_AFTER_MESSAGES))
             {
-                if (tmp->allowed_source_ips[y].valid)
+                memoryCopy(snap->sending_key, keypair->sending_key, WIREGUARD_SESSION_KEY_LEN);
+                snap->keypair        = keypair;
+                snap->remote_index   = keypair->remote_index;
+                snap->keypair_millis = keypair->keypair_millis;
+                snap->initiator      = keypair->initiator;
+                snap->ip             = peer->ip;
+                snap->port           = peer->port;
+
+                // the nonce is reserved inside the read section, if the section is retried this one is skipped
+                // (never reused) which the receiver replay window accepts
+                snap->counter = atomicAdd(&keypair->sending_counter, 1);
+                if (snap->counter < REJECT_AFTER_MESSAGES)
                 {
-                    if ((ipaddr->type == IPADDR_TYPE_V4) &&
-                        (tmp->allowed_source_ips[y].ip.type == IPADDR_TYPE_V4))
-                    {
-                        if (ip4AddrNetcmp(ip_2_ip4(ipaddr),
-                                           ip_2_ip4(&tmp->allowed_source_ips[y].ip),
-                                           ip_2_ip4(&tmp->allowed_source_ips[y].mask)))
-                        {
-                            result = tmp;
-                            break;
-                        }
-                    }
-                    else if ((ipaddr->type == IPADDR_TYPE_V6) &&
-                             (tmp->allowed_source_ips[y].ip.type == IPADDR_TYPE_V6))
-                    {
-                        if (ip6AddrNetcmp(ip_2_ip6(ipaddr),
-                                           ip_2_ip6(&tmp->allowed_source_ips[y].ip),
-                                           ip_2_ip6(&tmp->allowed_source_ips[y].mask)))
-                        {
-                            result = tmp;
-                            break;
-                        }
-                    }
+                    result = kSendSnapshotOk;
                 }
             }
         }
+
+        atomicThreadFence(memory_order_acquire);
+        if (atomicLoad(&peer->keypairs_seq) == seq)
+        {
+            return result;
+        }
     }
-    return result;
 }
 
 err_t wireguardifOutputToPeer(wireguard_device_t *device, sbuf_t *q, const ip_addr_t *ipaddr, wireguard_peer_t *peer)
@@ -53,6 +88,7 @@ err_t wireguardifOutputToPeer(wireguard_device_t *device, sbuf_t *q, const ip_ad
     discard ipaddr;
 
     // The LWIP IP layer wants to send an IP packet out over the interface - we need to encrypt and send it to the peer
+    // this runs on the calling worker without the device mutex, keypairs are read from a consistent snapshot
     message_transport_data_t *hdr;
     err_t                     result;
     uint32_t                  unpadded_len;
@@ -60,107 +96,80 @@ err_t wireguardifOutputToPeer(wireguard_device_t *device, sbuf_t *q, const ip_ad
     uint32_t                  header_len = 16;
     uint8_t                  *dst;
     uint32_t                  now;
-    wireguard_keypair_t      *keypair = &peer->curr_keypair;
+    wireguard_send_snapshot_t snap;
 
-    // Note: We may not be able to use the current keypair if we haven't received data, may need to resort to using
-    // previous keypair
-    if (keypair->valid && (! keypair->initiator) && (keypair->last_rx == 0))
+    switch (peerSnapshotForSend(peer, &snap))
     {
-        keypair = &peer->prev_keypair;
-    }
+    case kSendSnapshotOk:
+        // Calculate the outgoing packet size - round up to next 16 bytes, add 16 bytes for header
+        if (sbufGetLength(q) > 0)
+        {
+            // This is actual transport data
+            unpadded_len = sbufGetLength(q);
+        }
+        else
+        {
+            // This is a keep-alive
+            unpadded_len = 0;
+        }
+        padded_len = (unpadded_len + 15) & 0xFFFFFFF0; // Round up to next 16 byte boundary
+        assert(padded_len + WIREGUARD_AUTHTAG_LEN <= 1516);
+        assert(padded_len + WIREGUARD_AUTHTAG_LEN <= SMALL_BUFFER_SIZE);
+        sbufSetLength(q, padded_len + WIREGUARD_AUTHTAG_LEN); // 1500 is the max packet size which is divided by 16
 
-    if (keypair->valid && (keypair->initiator || keypair->last_rx != 0))
-    {
+        // The IP packet consists of 16 byte header (struct message_transport_data), data padded upto 16 byte
+        // boundary + encrypted auth tag (16 bytes)
+        sbufShiftLeft(q, header_len);
+        sbufWriteZeros(q, header_len);
 
-        if (! wireguardExpired(keypair->keypair_millis, REJECT_AFTER_TIME) &&
-            (keypair->sending_counter < REJECT_AFTER_MESSAGES))
-        {
+        hdr = (message_transport_data_t *) sbufGetMutablePtr(q);
 
-            // Calculate the outgoing packet size - round up to next 16 bytes, add 16 bytes for header
-            if (sbufGetLength(q) > 0)
-            {
-                // This is actual transport data
-                unpadded_len = sbufGetLength(q);
-            }
-            else
-            {
-                // This is a keep-alive
-                unpadded_len = 0;
-            }
-            padded_len = (unpadded_len + 15) & 0xFFFFFFF0; // Round up to next 16 byte boundary
-            assert(padded_len + WIREGUARD_AUTHTAG_LEN <= 1516);
-            assert(padded_len + WIREGUARD_AUTHTAG_LEN <= SMALL_BUFFER_SIZE);
-            sbufSetLength(q, padded_len + WIREGUARD_AUTHTAG_LEN); // 1500 is the max packet size which is divided by 16
-
-            // The buffer needs to be allocated from "transport" pool to leave room for LwIP generated IP headers
-            // The IP packet consists of 16 byte header (struct message_transport_data), data padded upto 16 byte
-            // boundary + encrypted auth tag (16 bytes)
-            // buf = pbufAlloc(sbuf_tRANSPORT, header_len + padded_len + WIREGUARD_AUTHTAG_LEN, PBUF_RAM);
-            sbufShiftLeft(q, header_len);
-            sbufWriteZeros(q, header_len);
-
-            // Note: allocating buf from RAM above guarantees that the buf is in one section and not chained
-            // - i.e payload points to the contiguous memory region
-            // memorySet(buf->payload, 0, buf->tot_len);
-
-            hdr = (message_transport_data_t *) sbufGetMutablePtr(q);
-
-            hdr->type     = MESSAGE_TRANSPORT_DATA;
-            hdr->receiver = keypair->remote_index;
-            // Alignment required... pbuf_alloc has probably aligned data, but want to be sure
-            U64TO8_LITTLE(hdr->counter, keypair->sending_counter);
-
-            // Copy the encrypted (padded) data to the output packet - chacha20poly1305Encrypt() can encrypt data
-            // in-place which avoids call to mem_malloc
-            dst = &hdr->enc_packet[0];
-            // if ((padded_len > 0) && q)
-            // {
-            //     // Note: before copying make sure we have inserted the IP header checksum
-            //     // The IP header checksum (and other checksums in the IP packet - e.g. ICMP) need to be calculated
-            //     // by LWIP before calling The Wireguard interface always needs checksums to be generated in software
-            //     // but the base ts may have some checksums generated by hardware
-
-            //     // Copy buf to memory - handles case where buf is chained
-            //     pbufCopyPartial(q, dst, unpadded_len, 0);
-            // }
-
-            // Then encrypt
-            wireguardEncryptPacket(dst, dst, padded_len, keypair);
-
-            result = wireguardifPeerOutput(device, q, peer);
-            q      = NULL; // buffer is consumed by wireguardifPeerOutput
-
-            if (result == ERR_OK)
-            {
-                now              = getTickMS();
-                peer->last_tx    = now;
-                keypair->last_tx = now;
-            }
+        hdr->type     = MESSAGE_TRANSPORT_DATA;
+        hdr->receiver = snap.remote_index;
+        // Alignment required... pbuf_alloc has probably aligned data, but want to be sure
+        U64TO8_LITTLE(hdr->counter, snap.counter);
 
-            // Check to see if we should rekey
-            if (keypair->sending_counter >= REKEY_AFTER_MESSAGES)
-            {
-                peer->send_handshake = true;
-            }
-            else if (keypair->initiator && wireguardExpired(keypair->keypair_millis, REKEY_AFTER_TIME))
-            {
-                peer->send_handshake = true;
-            }
+        // chacha20poly1305Encrypt() can encrypt data in-place
+        dst = &hdr->enc_packet[0];
+        wireguardEncryptPacket(dst, dst, padded_len, snap.counter, snap.sending_key);
+        wCryptoZero(snap.sending_key, WIREGUARD_SESSION_KEY_LEN);
+
+        result = wireguardifDeviceOutput(device, q, &snap.ip, snap.port);
+        q      = NULL; // buffer is consumed by wireguardifDeviceOutput
+
+        if (result == ERR_OK)
+        {
+            now = getTickMS();
+            atomicStoreRelaxed(&peer->last_tx, now);
+            atomicStoreRelaxed(&snap.keypair->last_tx, now);
         }
-        else
+
+        // Check to see if we should rekey
+        if (snap.counter + 1 >= REKEY_AFTER_MESSAGES)
         {
-            // key has expired...
-            LOGD("WrireugardDevice: DISCARDING PACKET - KEY EXPIRED");
-            keypairDestroy(keypair);
-            result = ERR_CONN;
+            atomicStoreRelaxed(&peer->send_handshake, true);
         }
-    }
-    else
-    {
+        else if (snap.initiator && wireguardExpired(snap.keypair_millis, REKEY_AFTER_TIME))
+        {
+            atomicStoreRelaxed(&peer->send_handshake, true);
+        }
+        break;
+
+    case kSendSnapshotExpired:
+        // key has expired... the device loop destroys it, it owns keypair rotation
+        LOGD("WrireugardDevice: DISCARDING PACKET - KEY EXPIRED");
+        atomicStoreRelaxed(&peer->send_handshake, true);
+        result = ERR_CONN;
+        break;
+
+    case kSendSnapshotNoKeys:
+    default:
         LOGD("WrireugardDevice: DISCARDING PACKET - NO VALID KEYS");
         // No valid keys!
         result = ERR_CONN;
+        break;
     }
+
     if (q != NULL)
     {
         bufferpoolReuseBuffer(getWorkerBufferPool(getWID()), q);
@@ -168,19 +177,6 @@ err_t wireguardifOutputToPeer(wireguard_device_t *device, sbuf_t *q, const ip_ad
     return result;
 }
 
-// This is used as the output function for the Wireguard INTERFACE
-// The ipaddr here is the one inside the VPN which we use to lookup the correct peer/endpoint
-static err_t wireguardifOutput(wireguard_device_t *device, sbuf_t *q, const ip_addr_t *ipaddr)
-{
-    // Send to peer that matches dest IP
-    wireguard_peer_t *peer = peerLookupByAllowedIp(device, ipaddr);
-    if (peer)
-    {
-        return wireguardifOutputToPeer(device, q, ipaddr, peer);
-    }
-    return ERR_RTE;
-}
-
 void wireguarddeviceTunnelUpStreamPayload(tunnel_t *t, line_t *l, sbuf_t *buf)
 {
     discard l;
@@ -190,29 +186,32 @@ void wireguarddeviceTunnelUpStreamPayload(tunnel_t *t, line_t *l, sbuf_t *buf)
         bufferpoolReuseBuffer(getWorkerBufferPool(getWID()), buf);
         return;
     }
-    wgd_tstate_t       *state = tunnelGetState(t);
-    wireguard_device_t *dev   = tunnelGetState(t);
-    uint8_t            *data  = sbufGetMutablePtr(buf);
-
-    mutexLock(&state->mutex);
-    state->locked = true;
+    // no device lock here, peers are looked up in the configured table and the keypair is taken from a snapshot
+    wireguard_device_t *dev  = tunnelGetState(t);
+    uint8_t            *data = sbufGetMutablePtr(buf);
 
+    // the inner destination address is looked up in the allowed ips trie straight from the header bytes
     wireguard_peer_t *peer = NULL;
-    ip_addr_t dest;
+    ip_addr_t         dest;
 
     if (IP_HDR_GET_VERSION(data) == 4)
     {
         ip4_hdr_t *header = (ip4_hdr_t *) data;
         ipAddrCopyFromIp4(dest, header->dest);
-        peer = peerLookupByAllowedIp(dev, &dest);
+        peer = wireguardAllowedIpsLookup(&dev->allowed_ips, (const uint8_t *) &header->dest, false);
     }
     else if (IP_HDR_GET_VERSION(data) == 6)
     {
+        if (sbufGetLength(buf) < sizeof(ip6_hdr_t))
+        {
+            bufferpoolReuseBuffer(getWorkerBufferPool(getWID()), buf);
+            return;
+        }
         ip6_hdr_t *header = (ip6_hdr_t *) data;
         ip6_addr_t dest_ip6;
         ip6AddrCopyFromPacket(dest_ip6, header->dest);
         ipAddrCopyFromIp6(dest, dest_ip6);
-        peer = peerLookupByAllowedIp(dev, &dest);
+        peer = wireguardAllowedIpsLookup(&dev->allowed_ips, (const uint8_t *) &header->dest, true);
     }
 
     if(peer)
@@ -224,11 +223,4 @@ void wireguarddeviceTunnelUpStreamPayload(tunnel_t *t, line_t *l, sbuf_t *buf)
         LOGD("WireguardDevice cannot route a packet");
         bufferpoolReuseBuffer(getWorkerBufferPool(getWID()), buf);
     }
-
-    if (state->locked)
-    {
-        state->locked = false;
-        mutexUnlock(&state->mutex);
-    
-    }
 }
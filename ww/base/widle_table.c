@@ -1,9 +1,12 @@
 /**
  * @file widle_table.c
- * @brief Implementation of a thread-safe idle table.
+ * @brief Implementation of a per-worker idle table.
  *
- * This file implements a heap-based timer mechanism that periodically
- * checks idle items for expiration and invokes their callbacks.
+ * Every worker owns a hierarchical timing wheel (4 levels of 64 slots) inside the table, items are linked into the
+ * slot of their expiration tick, so insert and removal are O(1) and a tick only touches one slot. Keep-alive only
+ * stores the new expiration time when it is later than the old one, the item is moved when its slot comes up.
+ *
+ * Only the owner worker touches its wheel, other threads send messages to it.
  */
 
 #include "widle_table.h"
@@ -11,52 +14,227 @@
 #include "global_state.h"
 #include "wdef.h"
 #include "wloop.h"
-#include "wmutex.h"
 
 enum
 {
-    kVecCap = 32
+    kVecCap        = 32,
+    kWheelLevels   = 4,
+    kWheelSlotBits = 6,
+    kWheelSlots    = 1 << kWheelSlotBits,
+    kWheelSlotMask = kWheelSlots - 1
 };
 
-#define i_type                    heapq_idles_t
-#define i_key                     widle_item_t *
-#define i_cmp                     -c_default_cmp                                // NOLINT
-#define idletable_less_func(x, y) ((*(x))->expire_at_ms < (*(y))->expire_at_ms) // NOLINT
-#define i_less                    idletable_less_func                           // NOLINT
-#include "stc/pqueue.h"
+// with 128ms ticks the top level reaches ~24 days, longer ages are parked in the top level and moved again later
+#define WHEEL_MAX_DELTA ((1ULL << (kWheelSlotBits * kWheelLevels)) - 1)
 
 #define i_type hmap_idles_t
 #define i_key  uint64_t
 #define i_val  widle_item_t *
 #include "stc/hmap.h"
 
+typedef MSVC_ATTR_ALIGNED_LINE_CACHE struct widle_wheel_s
+{
+    widle_item_t         *slots[kWheelLevels][kWheelSlots];
+    hmap_idles_t          hmap;
+    struct widle_table_s *table;
+    wtimer_t             *timer;    // only running while the wheel has items
+    widle_item_t         *expiring; // item whose callback is running
+    uint64_t              now_tick; // last processed tick
+    wid_t                 wid;
+
+} GNU_ATTR_ALIGNED_LINE_CACHE widle_wheel_t;
+
 typedef MSVC_ATTR_ALIGNED_LINE_CACHE struct widle_table_s
 {
-    wloop_t      *loop;
-    wtimer_t     *idle_handle;
-    heapq_idles_t hqueue;
-    hmap_idles_t  hmap;
-    wmutex_t      mutex;
-    uint64_t      last_update_ms;
     uintptr_t     memptr;
+    wid_t         wheels_count;
+    widle_wheel_t wheels[];
 
 } GNU_ATTR_ALIGNED_LINE_CACHE widle_table_t;
 
-void idleCallBack(wtimer_t *timer);
+typedef struct idle_table_msg_s
+{
+    widle_table_t *table;
+    hash_t         hash;
+    uint64_t       age_ms;
+    bool           remove;
+
+} idle_table_msg_t;
+
+static void wheelOnTick(wtimer_t *timer);
+
+static uint64_t expireTickOf(uint64_t expire_at_ms)
+{
+    return (expire_at_ms + kIdleTableTickMs - 1) / kIdleTableTickMs;
+}
+
+/**
+ * @brief Links an item into the slot of its expiration tick.
+ *
+ * The level is chosen by the distance to the current tick, the slots of the upper levels are moved down
+ * (cascaded) when the lower level wraps around.
+ */
+static void wheelLink(widle_wheel_t *wheel, widle_item_t *item)
+{
+    uint64_t expire_tick = max(expireTickOf(item->expire_at_ms), wheel->now_tick + 1);
+    uint64_t delta       = min(expire_tick - wheel->now_tick, WHEEL_MAX_DELTA);
+    int      level       = 0;
+
+    expire_tick = wheel->now_tick + delta;
+
+    while (level < kWheelLevels - 1 && delta >= (1ULL << (kWheelSlotBits * (level + 1))))
+    {
+        level++;
+    }
+
+    widle_item_t **slot = &wheel->slots[level][(expire_tick >> (kWheelSlotBits * level)) & kWheelSlotMask];
+
+    item->next = *slot;
+    if (item->next != NULL)
+    {
+        item->next->pprev = &item->next;
+    }
+    item->pprev = slot;
+    *slot       = item;
+}
+
+static void wheelUnlink(widle_item_t *item)
+{
+    if (item->pprev == NULL)
+    {
+        return;
+    }
+    *item->pprev = item->next;
+    if (item->next != NULL)
+    {
+        item->next->pprev = item->pprev;
+    }
+    item->next  = NULL;
+    item->pprev = NULL;
+}
+
+/**
+ * @brief Moves all the items of a slot into a local list, items can still be unlinked from there.
+ */
+static void wheelDetachSlot(widle_item_t **slot, widle_item_t **head)
+{
+    *head = *slot;
+    *slot = NULL;
+    if (*head != NULL)
+    {
+        (*head)->pprev = head;
+    }
+}
+
+static void wheelCascade(widle_wheel_t *wheel, int level)
+{
+    widle_item_t *head;
+    wheelDetachSlot(&wheel->slots[level][(wheel->now_tick >> (kWheelSlotBits * level)) & kWheelSlotMask], &head);
+
+    while (head != NULL)
+    {
+        widle_item_t *item = head;
+        wheelUnlink(item);
+        wheelLink(wheel, item);
+    }
+}
+
+/**
+ * @brief Expires the items of the current tick, items that were kept alive meanwhile are linked again.
+ */
+static void wheelExpireSlot(widle_wheel_t *wheel, uint64_t now)
+{
+    widle_item_t *head;
+    wheelDetachSlot(&wheel->slots[0][wheel->now_tick & kWheelSlotMask], &head);
+
+    while (head != NULL)
+    {
+        widle_item_t *item = head;
+        wheelUnlink(item);
+
+        if (item->expire_at_ms > now)
+        {
+            wheelLink(wheel, item);
+            continue;
+        }
+
+        uint64_t old_expire_at_ms = item->expire_at_ms;
+
+        if (item->cb)
+        {
+            wheel->expiring = item;
+            item->cb(item);
+            wheel->expiring = NULL;
+        }
+
+        if (! item->removed)
+        {
+            if (old_expire_at_ms != item->expire_at_ms && item->expire_at_ms > now)
+            {
+                wheelLink(wheel, item);
+                continue;
+            }
+            hmap_idles_t_erase(&(wheel->hmap), item->hash);
+        }
+        memoryFree(item);
+    }
+}
+
+/**
+ * @brief Timer callback of a worker wheel, processes every tick up to now.
+ *
+ * Stops the timer when the wheel has no more items.
+ *
+ * @param timer Pointer to the timer.
+ */
+static void wheelOnTick(wtimer_t *timer)
+{
+    widle_wheel_t *wheel       = weventGetUserdata(timer);
+    const uint64_t now         = wloopNowMS(weventGetLoop(timer));
+    const uint64_t target_tick = now / kIdleTableTickMs;
+
+    while (wheel->now_tick < target_tick)
+    {
+        wheel->now_tick++;
+
+        for (int level = 1; level < kWheelLevels; level++)
+        {
+            if ((wheel->now_tick & ((1ULL << (kWheelSlotBits * level)) - 1)) != 0)
+            {
+                break;
+            }
+            wheelCascade(wheel, level);
+        }
+
+        wheelExpireSlot(wheel, now);
+    }
+
+    if (hmap_idles_t_size(&(wheel->hmap)) == 0)
+    {
+        wtimerDelete(timer);
+        wheel->timer = NULL;
+    }
+}
+
+static widle_wheel_t *getWheel(widle_table_t *self, wid_t tid)
+{
+    assert(tid < self->wheels_count);
+    return &(self->wheels[tid]);
+}
 
 /**
  * @brief Creates and initializes a new idle table.
  *
- * Allocates memory aligned to cache boundaries, initializes the internal heap and map,
- * and starts the timer callback.
+ * Allocates memory aligned to cache boundaries and initializes one wheel for each worker, the wheel timers are
+ * started by the workers themselves.
  *
- * @param loop Pointer to the event loop.
  * @return Pointer to the newly created idle table.
  */
-widle_table_t *idleTableCreate(wloop_t *loop)
+widle_table_t *idleTableCreate(void)
 {
-    // assert(sizeof(widle_table_t) <= kCpuLineCacheSize); promotion to 128 bytes
-    size_t memsize = sizeof(widle_table_t);
+    const wid_t wheels_count = getWorkersCount();
+
+    size_t memsize = sizeof(widle_table_t) + (sizeof(widle_wheel_t) * wheels_count);
     // ensure we have enough space to offset the allocation by line cache (for alignment)
     memsize = ALIGN2(memsize + ((kCpuLineCacheSize + 1) / 2), kCpuLineCacheSize);
 
@@ -70,23 +248,25 @@ widle_table_t *idleTableCreate(wloop_t *loop)
     // allocate memory, placing widle_table_t at a line cache address boundary
     uintptr_t ptr = (uintptr_t) memoryAllocate(memsize);
 
-
     widle_table_t *newtable = (widle_table_t *) ALIGN2(ptr, kCpuLineCacheSize); // NOLINT
 
-    *newtable = (widle_table_t){.memptr         = ptr,
-                                .loop           = loop,
-                                .idle_handle    = wtimerAdd(loop, idleCallBack, 1000, INFINITE),
-                                .hqueue         = heapq_idles_t_with_capacity(kVecCap),
-                                .hmap           = hmap_idles_t_with_capacity(kVecCap),
-                                .last_update_ms = wloopNowMS(loop)};
+    newtable->memptr       = ptr;
+    newtable->wheels_count = wheels_count;
+
+    for (wid_t wi = 0; wi < wheels_count; wi++)
+    {
+        widle_wheel_t *wheel = &(newtable->wheels[wi]);
+        memorySet(wheel, 0, sizeof(widle_wheel_t));
+        wheel->hmap  = hmap_idles_t_with_capacity(kVecCap);
+        wheel->table = newtable;
+        wheel->wid   = wi;
+    }
 
-    mutexInit(&(newtable->mutex));
-    weventSetUserData(newtable->idle_handle, newtable);
     return newtable;
 }
 
 /**
- * @brief Creates a new idle item and inserts it into the table.
+ * @brief Creates a new idle item and inserts it into the wheel of the worker.
  *
  * @param self Pointer to the idle table.
  * @param key Hash key used for the item.
@@ -99,32 +279,42 @@ widle_table_t *idleTableCreate(wloop_t *loop)
 widle_item_t *idleItemNew(widle_table_t *self, hash_t key, void *userdata, ExpireCallBack cb, wid_t tid, uint64_t age_ms)
 {
     assert(self);
-    widle_item_t *item = memoryAllocate(sizeof(widle_item_t));
-    mutexLock(&(self->mutex));
-
-    *item = (widle_item_t){.expire_at_ms = wloopNowMS(getWorkerLoop(tid)) + age_ms,
-                          .hash         = key,
-                          .tid          = tid,
-                          .userdata     = userdata,
-                          .cb           = cb,
-                          .table        = self};
-
-    if (! hmap_idles_t_insert(&(self->hmap), item->hash, item).inserted)
+    assert(tid == getWID());
+    widle_wheel_t *wheel = getWheel(self, tid);
+    wloop_t       *loop  = getWorkerLoop(tid);
+    widle_item_t  *item  = memoryAllocate(sizeof(widle_item_t));
+
+    *item = (widle_item_t){.expire_at_ms = wloopNowMS(loop) + age_ms,
+                           .hash         = key,
+                           .tid          = tid,
+                           .userdata     = userdata,
+                           .cb           = cb,
+                           .table        = self};
+
+    if (! hmap_idles_t_insert(&(wheel->hmap), item->hash, item).inserted)
     {
         // hash is already in the table !
-        mutexUnlock(&(self->mutex));
         memoryFree(item);
         return NULL;
     }
-    heapq_idles_t_push(&(self->hqueue), item);
-    mutexUnlock(&(self->mutex));
+
+    if (wheel->timer == NULL)
+    {
+        // the wheel was empty, nothing to catch up with
+        wheel->now_tick = wloopNowMS(loop) / kIdleTableTickMs;
+        wheel->timer    = wtimerAdd(loop, wheelOnTick, kIdleTableTickMs, INFINITE);
+        weventSetUserData(wheel->timer, wheel);
+    }
+
+    wheelLink(wheel, item);
     return item;
 }
 
 /**
  * @brief Keeps an idle item alive for at least the specified duration.
  *
- * Updates the item's expiration based on current loop time.
+ * Updates the item's expiration based on current loop time, a later expiration is applied lazily when the slot of
+ * the item is processed, an earlier one moves the item right away.
  *
  * @param self Pointer to the idle table.
  * @param item Idle item to update.
@@ -132,15 +322,27 @@ widle_item_t *idleItemNew(widle_table_t *self, hash_t key, void *userdata, Expir
  */
 void idleTableKeepIdleItemForAtleast(widle_table_t *self, widle_item_t *item, uint64_t age_ms)
 {
+    if (item->tid != getWID())
+    {
+        idleTablePostKeepIdleItemByHash(item->tid, self, item->hash, age_ms);
+        return;
+    }
     if (item->removed)
     {
         return;
     }
-    item->expire_at_ms = wloopNowMS(self->loop) + age_ms;
 
-    mutexLock(&(self->mutex));
-    heapq_idles_t_make_heap(&self->hqueue);
-    mutexUnlock(&(self->mutex));
+    const uint64_t expire_at_ms = wloopNowMS(getWorkerLoop(item->tid)) + age_ms;
+    const bool     earlier      = expire_at_ms < item->expire_at_ms;
+
+    item->expire_at_ms = expire_at_ms;
+
+    if (earlier && item->pprev != NULL)
+    {
+        widle_wheel_t *wheel = getWheel(self, item->tid);
+        wheelUnlink(item);
+        wheelLink(wheel, item);
+    }
 }
 
 /**
@@ -153,22 +355,17 @@ void idleTableKeepIdleItemForAtleast(widle_table_t *self, widle_item_t *item, ui
  */
 widle_item_t *idleTableGetIdleItemByHash(wid_t tid, widle_table_t *self, hash_t key)
 {
-    mutexLock(&(self->mutex));
+    assert(tid == getWID());
+    const hmap_idles_t_value *find_result = hmap_idles_t_get(&(getWheel(self, tid)->hmap), key);
 
-    hmap_idles_t_iter find_result = hmap_idles_t_find(&(self->hmap), key);
-    if (find_result.ref == hmap_idles_t_end(&(self->hmap)).ref || find_result.ref->second->tid != tid)
-    {
-        mutexUnlock(&(self->mutex));
-        return NULL;
-    }
-    mutexUnlock(&(self->mutex));
-    return (find_result.ref->second);
+    return find_result == NULL ? NULL : find_result->second;
 }
 
 /**
  * @brief Removes an idle item from the table by its hash key.
  *
- * Performs a lazy deletion by marking the item as removed.
+ * The item is unlinked from its slot and freed, unless its expiration callback is running in which case it is
+ * freed after the callback returns.
  *
  * @param tid Thread ID.
  * @param self Pointer to the idle table.
@@ -177,128 +374,107 @@ widle_item_t *idleTableGetIdleItemByHash(wid_t tid, widle_table_t *self, hash_t
  */
 bool idleTableRemoveIdleItemByHash(wid_t tid, widle_table_t *self, hash_t key)
 {
-    mutexLock(&(self->mutex));
-    hmap_idles_t_iter find_result = hmap_idles_t_find(&(self->hmap), key);
-    if (find_result.ref == hmap_idles_t_end(&(self->hmap)).ref || find_result.ref->second->tid != tid)
+    assert(tid == getWID());
+    widle_wheel_t            *wheel       = getWheel(self, tid);
+    const hmap_idles_t_value *find_result = hmap_idles_t_get(&(wheel->hmap), key);
+
+    if (find_result == NULL)
     {
-        mutexUnlock(&(self->mutex));
         return false;
     }
-    widle_item_t *item = (find_result.ref->second);
-    hmap_idles_t_erase_at(&(self->hmap), find_result);
-    item->removed = true; // Note: The item remains in the heap (lazy deletion)
-    // heapq_idles_t_make_heap(&self->hqueue);
+    widle_item_t *item = find_result->second;
+    hmap_idles_t_erase(&(wheel->hmap), key);
+
+    item->removed = true;
+    wheelUnlink(item);
 
-    mutexUnlock(&(self->mutex));
+    if (wheel->expiring != item)
+    {
+        memoryFree(item);
+    }
     return true;
 }
 
-/**
- * @brief Callback invoked by the timer when an idle item is about to be closed.
- *
- * This function executes the expiration callback if applicable or removes
- * the idle item.
- *
- * @param ev Pointer to the event structure.
- */
-static void beforeCloseCallBack(wevent_t *ev)
+static void onIdleTableMessage(wevent_t *ev)
 {
-    widle_item_t *item = weventGetUserdata(ev);
-    if (! item->removed)
-    {
-        if (item->expire_at_ms > wloopNowMS(getWorkerLoop(item->tid)))
-        {
-            mutexLock(&(item->table->mutex));
-            heapq_idles_t_push(&(item->table->hqueue), item);
-            mutexUnlock(&(item->table->mutex));
-            return;
-        }
+    idle_table_msg_t *msg = weventGetUserdata(ev);
+    wid_t             wid = getWID();
 
-        uint64_t old_expire_at_ms = item->expire_at_ms;
-
-        if (item->cb)
-        {
-            item->cb(item);
-        }
-
-        if (old_expire_at_ms != item->expire_at_ms && item->expire_at_ms > wloopNowMS(getWorkerLoop(item->tid)))
-        {
-            mutexLock(&(item->table->mutex));
-            heapq_idles_t_push(&(item->table->hqueue), item);
-            mutexUnlock(&(item->table->mutex));
-        }
-        else
-        {
-            bool removal_result = idleTableRemoveIdleItemByHash(item->tid, item->table, item->hash);
-            assert(removal_result);
-            discard removal_result;
-            memoryFree(item);
-        }
+    if (msg->remove)
+    {
+        idleTableRemoveIdleItemByHash(wid, msg->table, msg->hash);
     }
     else
     {
-        memoryFree(item);
+        widle_item_t *item = idleTableGetIdleItemByHash(wid, msg->table, msg->hash);
+        if (item != NULL)
+        {
+            idleTableKeepIdleItemForAtleast(msg->table, item, msg->age_ms);
+        }
     }
+    memoryFree(msg);
+}
+
+static void postIdleTableMessage(wid_t tid, widle_table_t *self, hash_t key, uint64_t age_ms, bool remove)
+{
+    idle_table_msg_t *msg = memoryAllocate(sizeof(idle_table_msg_t));
+    *msg = (idle_table_msg_t) {.table = self, .hash = key, .age_ms = age_ms, .remove = remove};
+
+    wevent_t ev;
+    memorySet(&ev, 0, sizeof(ev));
+    ev.loop = getWorkerLoop(tid);
+    ev.cb   = onIdleTableMessage;
+    weventSetUserData(&ev, msg);
+    wloopPostEvent(getWorkerLoop(tid), &ev);
 }
 
 /**
- * @brief Timer callback for processing idle items.
- *
- * Iterates through idle items in the heap and processes those that have expired.
+ * @brief Posts a keep-alive to the worker that owns the item.
  *
- * @param timer Pointer to the timer.
+ * @param tid Thread ID that owns the item.
+ * @param self Pointer to the idle table.
+ * @param key Hash key of the idle item.
+ * @param age_ms Time in milliseconds to extend the item.
  */
-void idleCallBack(wtimer_t *timer)
+void idleTablePostKeepIdleItemByHash(wid_t tid, widle_table_t *self, hash_t key, uint64_t age_ms)
 {
-    widle_table_t *self  = weventGetUserdata(timer);
-    const uint64_t now   = wloopNowMS(self->loop);
-    self->last_update_ms = now;
-    mutexLock(&(self->mutex));
-
-    while (heapq_idles_t_size(&(self->hqueue)) > 0)
-    {
-        widle_item_t *item = *heapq_idles_t_top(&(self->hqueue));
-
-        if (item->expire_at_ms <= now)
-        {
-            heapq_idles_t_pop(&(self->hqueue));
+    postIdleTableMessage(tid, self, key, age_ms, false);
+}
 
-            if (item->removed)
-            {
-                // already removed
-                memoryFree(item);
-            }
-            else
-            {
-                // Post event to process item on its worker thread.
-                wevent_t ev;
-                memorySet(&ev, 0, sizeof(ev));
-                ev.loop = getWorkerLoop(item->tid);
-                ev.cb   = beforeCloseCallBack;
-                weventSetUserData(&ev, item);
-                wloopPostEvent(getWorkerLoop(item->tid), &ev);
-            }
-        }
-        else
-        {
-            break;
-        }
-    }
-    mutexUnlock(&(self->mutex));
+/**
+ * @brief Posts a removal to the worker that owns the item.
+ *
+ * @param tid Thread ID that owns the item.
+ * @param self Pointer to the idle table.
+ * @param key Hash key of the idle item.
+ */
+void idleTablePostRemoveIdleItemByHash(wid_t tid, widle_table_t *self, hash_t key)
+{
+    postIdleTableMessage(tid, self, key, 0, true);
 }
 
 /**
  * @brief Destroys the idle table and releases all resources.
  *
- * Deletes the timer handle, drops internal data structures, and frees allocated memory.
+ * Deletes the wheel timers, frees the remaining items and the allocated memory.
  *
  * @param self Pointer to the idle table.
  */
 void idleTableDestroy(widle_table_t *self)
 {
-    wtimerDelete(self->idle_handle);
-    heapq_idles_t_drop(&self->hqueue);
-    hmap_idles_t_drop(&self->hmap);
-    mutexDestroy(&self->mutex);
+    for (wid_t wi = 0; wi < self->wheels_count; wi++)
+    {
+        widle_wheel_t *wheel = &(self->wheels[wi]);
+
+        if (wheel->timer != NULL)
+        {
+            wtimerDelete(wheel->timer);
+        }
+        c_foreach(k, hmap_idles_t, wheel->hmap)
+        {
+            memoryFree(k.ref->second);
+        }
+        hmap_idles_t_drop(&wheel->hmap);
+    }
     memoryFree((void *) (self->memptr)); // NOLINT
 }
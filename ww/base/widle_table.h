@@ -1,12 +1,14 @@
 /**
  * @file widle_table.h
- * @brief Thread-safe idle table implementation.
+ * @brief Per-worker idle table implementation.
  *
  * The idle table stores widle_item_t objects that each have an expiration timeout.
  * When the timeout expires, the idle item is removed and its callback is invoked.
- * Items are thread-local, and operations must be performed on the same thread that created them.
+ * Items are thread-local, and operations must be performed on the same thread that created them,
+ * other threads can only post keep-alive or removal messages to the owning worker.
  *
- * Note: The underlying timer uses a heap-based mechanism.
+ * Note: Every worker has its own hierarchical timing wheel inside the table, insert, keep-alive and removal are
+ * O(1) and take no lock. Expiration has a resolution of kIdleTableTickMs and is processed per tick in batches.
  */
 
 #pragma once
@@ -15,6 +17,11 @@
 #include "wloop.h"
 #include "worker.h"
 
+enum
+{
+    kIdleTableTickMs = 128 // resolution of the expiration time
+};
+
 typedef struct widle_item_s widle_item_t;
 
 /**
@@ -33,6 +40,8 @@ struct widle_item_s
 {
     void                 *userdata;     ///< User data associated with the item.
     struct widle_table_s *table;        ///< Pointer to the parent idle table.
+    struct widle_item_s  *next;         ///< Next item in the same wheel slot.
+    struct widle_item_s **pprev;        ///< Link that points to this item, NULL when not in a slot.
     hash_t                hash;         ///< Hash used for item lookup.
     ExpireCallBack        cb;           ///< Expiration callback.
     uint64_t              expire_at_ms; ///< Expiration time in milliseconds.
@@ -44,15 +53,18 @@ typedef struct widle_table_s widle_table_t;
 /**
  * @brief Create an idle table.
  *
- * @param loop Pointer to the event loop.
+ * The table can be shared by all workers, each one gets its own wheel which starts ticking on the worker loop
+ * when the first item is added and stops when the wheel is empty again.
+ *
  * @return Pointer to a new idle table instance.
  */
-widle_table_t *idleTableCreate(wloop_t *loop);
+widle_table_t *idleTableCreate(void);
 
 /**
  * @brief Destroy an idle table.
  *
- * Releases all resources associated with the idle table.
+ * Releases all resources associated with the idle table, the items are freed without calling their callbacks.
+ * Must be called when the worker loops are not running.
  *
  * @param self Pointer to the idle table.
  */
@@ -88,6 +100,7 @@ widle_item_t *idleTableGetIdleItemByHash(wid_t tid, widle_table_t *self, hash_t
  * @brief Update the expiration of an idle item.
  *
  * The idle item will be kept for at least the specified duration from now.
+ * When called from another thread than the owner of the item, the update is posted to the owner worker.
  *
  * @param self Pointer to the idle table.
  * @param item The idle item to update.
@@ -106,3 +119,27 @@ void idleTableKeepIdleItemForAtleast(widle_table_t *self, widle_item_t *item, ui
  * @return true if the item was removed; false otherwise.
  */
 bool idleTableRemoveIdleItemByHash(wid_t tid, widle_table_t *self, hash_t key);
+
+/**
+ * @brief Post a keep-alive for an item of another worker.
+ *
+ * Can be called from any thread, the owner worker applies it when the message arrives (nothing happens if the
+ * item is gone by then).
+ *
+ * @param tid Thread ID that owns the item.
+ * @param self Pointer to the idle table.
+ * @param key Hash key of the item.
+ * @param age_ms Minimum age to keep the item.
+ */
+void idleTablePostKeepIdleItemByHash(wid_t tid, widle_table_t *self, hash_t key, uint64_t age_ms);
+
+/**
+ * @brief Post a removal for an item of another worker.
+ *
+ * Can be called from any thread, the owner worker removes the item when the message arrives.
+ *
+ * @param tid Thread ID that owns the item.
+ * @param self Pointer to the idle table.
+ * @param key Hash key of the item.
+ */
+void idleTablePostRemoveIdleItemByHash(wid_t tid, widle_table_t *self, hash_t key);
@@ -1,5 +1,6 @@
 #include "wlog.h"
 #include "wmutex.h"
+#include "wthread.h"
 
 // #include "wtime.h"
 #define SECONDS_PER_HOUR 3600
@@ -8,6 +9,16 @@
 
 static int s_gmtoff = 28800; // 8*3600
 
+enum
+{
+    kLogRingSize         = 1 << 17, // bytes of records a thread can have in flight
+    kLogMaxMessageLength = DEFAULT_LOG_MAX_BUFSIZE - 256,
+    kLogBatchSize        = 1 << 16,
+    kLogLineOverhead     = 512, // room for the prefix (time, level, colors) of a formatted line
+    kLogWriterIntervalMs = 10,
+    kLogRecordPadding    = 0xFFFF // level of a record that only skips to the start of the ring
+};
+
 struct logger_s
 {
     logger_handler handler;
@@ -16,6 +27,7 @@ struct logger_s
 
     int  level;
     int  enable_color;
+    int  async;
     char format[64];
 
     // for file logger
@@ -28,9 +40,79 @@ struct logger_s
     time_t             last_logfile_ts;
     int                can_write_cnt;
 
+    atomic_ullong      dropped;        // records that did not fit in the ring of their thread
+    unsigned long long reported_drops; // owned by the writer
+    struct logger_s   *next;           // all the loggers, for the writer
+
     wmutex_t mutex_; // thread-safe
 };
 
+/*
+    Asynchronous pipeline
+
+    every thread that logs owns a ring, the message is printed on the calling thread and stored as a record
+    (logger, level, time, text) without taking any lock, a single writer thread adds the prefix and hands the lines
+    to the handlers in batches
+
+    when a ring is full the record is dropped and counted on its logger, the writer reports the count later
+*/
+
+typedef struct log_record_s
+{
+    logger_t *logger;
+    int64_t   sec;
+    int32_t   usec;
+    uint16_t  level;
+    uint16_t  len; // bytes of text that follow the header
+
+} log_record_t;
+
+typedef struct log_ring_s
+{
+    atomic_ullong head; // written by the owner thread
+    uint8_t       pad0[kCpuLineCacheSize - sizeof(atomic_ullong)];
+    atomic_ullong tail; // written by the consumer
+    uint8_t       pad1[kCpuLineCacheSize - sizeof(atomic_ullong)];
+
+    struct log_ring_s *next;
+    uint8_t            data[kLogRingSize];
+
+} log_ring_t;
+
+static struct
+{
+    wmutex_t    mutex; // rings, loggers and the writer state
+    wcondvar_t  cond;
+    wmutex_t    consume_mutex; // only one thread drains the rings at a time
+    wthread_t   writer;
+    bool        running;
+    bool        best_effort; // set while a signal handler drains, a logger whose mutex is taken is skipped
+    atomic_uint generation; // changes when the rings are freed, threads then create a new one
+
+    log_ring_t *rings;
+    logger_t   *loggers;
+
+    // consecutive lines of the same logger and level are written with one handler call
+    char     *batch;
+    int       batch_len;
+    logger_t *batch_logger;
+    int       batch_level;
+
+} s_pipeline;
+
+static wonce_t s_pipeline_once = WONCE_INIT;
+
+static thread_local log_ring_t *tl_ring            = NULL;
+static thread_local uint32_t    tl_ring_generation = 0;
+
+static void initPipeline(void)
+{
+    mutexInit(&s_pipeline.mutex);
+    mutexInit(&s_pipeline.consume_mutex);
+    condvarInit(&s_pipeline.cond);
+    atomic_init(&s_pipeline.generation, 0);
+}
+
 static void initLogger(logger_t *logger)
 {
     logger->handler = NULL;
@@ -39,6 +121,7 @@ static void initLogger(logger_t *logger)
 
     logger->level        = DEFAULT_LOG_LEVEL;
     logger->enable_color = 0;
+    logger->async        = 1;
     // NOTE: format is faster 6% than snprintf
     // logger->format[0] = '\0';
 #if defined(OS_UNIX)
@@ -54,6 +137,8 @@ static void initLogger(logger_t *logger)
     loggerSetFile(logger, DEFAULT_LOG_FILE);
     logger->last_logfile_ts = 0;
     logger->can_write_cnt   = -1;
+    logger->reported_drops  = 0;
+    atomic_init(&logger->dropped, 0);
     mutexInit(&logger->mutex_);
 }
 
@@ -80,15 +165,76 @@ logger_t *loggerCreate(void)
     int gmt_hour = gmt_tm->tm_hour;
     s_gmtoff     = (local_hour - gmt_hour) * SECONDS_PER_HOUR;
 
+    wonce(&s_pipeline_once, initPipeline);
+
     logger_t *logger = (logger_t *) memoryAllocate(sizeof(logger_t));
     initLogger(logger);
+
+    mutexLock(&s_pipeline.mutex);
+    logger->next       = s_pipeline.loggers;
+    s_pipeline.loggers = logger;
+    mutexUnlock(&s_pipeline.mutex);
+
     return logger;
 }
 
+static void drainRecords(void);
+static void drainRecordsLocked(void);
+
+static void stopPipeline(void)
+{
+    threadJoin(s_pipeline.writer);
+
+    // a flush from another thread may be walking the rings
+    mutexLock(&s_pipeline.consume_mutex);
+    mutexLock(&s_pipeline.mutex);
+
+    while (s_pipeline.rings)
+    {
+        log_ring_t *next = s_pipeline.rings->next;
+        memoryFree(s_pipeline.rings);
+        s_pipeline.rings = next;
+    }
+    memoryFree(s_pipeline.batch);
+    s_pipeline.batch = NULL;
+    atomicIncRelaxed(&s_pipeline.generation);
+
+    mutexUnlock(&s_pipeline.mutex);
+    mutexUnlock(&s_pipeline.consume_mutex);
+}
+
 void loggerDestroy(logger_t *logger)
 {
     if (logger)
     {
+        // the writer can not be walking the loggers while this one is unlinked
+        mutexLock(&s_pipeline.consume_mutex);
+        drainRecordsLocked();
+
+        mutexLock(&s_pipeline.mutex);
+        for (logger_t **it = &s_pipeline.loggers; *it; it = &(*it)->next)
+        {
+            if (*it == logger)
+            {
+                *it = logger->next;
+                break;
+            }
+        }
+        // the writer stops with the last logger
+        bool stop = s_pipeline.loggers == NULL && s_pipeline.running;
+        if (stop)
+        {
+            s_pipeline.running = false;
+            condvarSignal(&s_pipeline.cond);
+        }
+        mutexUnlock(&s_pipeline.mutex);
+        mutexUnlock(&s_pipeline.consume_mutex);
+
+        if (stop)
+        {
+            stopPipeline();
+        }
+
         if (logger->buf)
         {
             memoryFree(logger->buf);
@@ -194,6 +340,16 @@ void loggerEnableColor(logger_t *logger, int on)
     logger->enable_color = on;
 }
 
+void loggerEnableAsync(logger_t *logger, int on)
+{
+    logger->async = on;
+}
+
+unsigned long long loggerGetDroppedCount(logger_t *logger)
+{
+    return atomicLoadRelaxed(&logger->dropped);
+}
+
 bool loggerSetFile(logger_t *logger, const char *filepath)
 {
     // when path ends with / means no log file
@@ -272,6 +428,8 @@ void loggerEnableFileSync(logger_t *logger, int on)
 
 void loggerSyncFile(logger_t *logger)
 {
+    drainRecords();
+
     mutexLock(&logger->mutex_);
     if (logger->fp_)
     {
@@ -426,36 +584,32 @@ static int i2a(int i, char *buf, int len)
     return len;
 }
 
-int loggerPrintVA(logger_t *logger, int level, const char *fmt, va_list ap)
+// formats one line from an already printed message, bufsize must leave kLogLineOverhead bytes beside the message
+static int formatLine(logger_t *logger, char *buf, int bufsize, int level, int64_t sec, int usec, const char *msg,
+                      int msglen)
 {
-    if (level < logger->level)
-        return -10;
+    static thread_local struct tm tm;
+    static thread_local int64_t   tm_sec = -1;
 
-    int year, month, day, hour, min, sec, us;
-#ifdef _WIN32
-    SYSTEMTIME tm;
-    GetLocalTime(&tm);
-    year  = tm.wYear;
-    month = tm.wMonth;
-    day   = tm.wDay;
-    hour  = tm.wHour;
-    min   = tm.wMinute;
-    sec   = tm.wSecond;
-    us    = tm.wMilliseconds * 1000;
+    if (sec != tm_sec)
+    {
+        time_t tt = (time_t) sec;
+#ifdef OS_UNIX
+        localtime_r(&tt, &tm);
 #else
-    struct timeval                tv;
-    static thread_local struct tm tm;
-    getTimeOfDay(&tv, NULL);
-    time_t tt = tv.tv_sec;
-    localtime_r(&tt, &tm);
-    year  = tm.tm_year + 1900;
-    month = tm.tm_mon + 1;
-    day   = tm.tm_mday;
-    hour  = tm.tm_hour;
-    min   = tm.tm_min;
-    sec   = tm.tm_sec;
-    us    = (int) tv.tv_usec;
+        localtime_s(&tm, &tt);
 #endif
+        tm_sec = sec;
+    }
+    int year  = tm.tm_year + 1900;
+    int month = tm.tm_mon + 1;
+    int day   = tm.tm_mday;
+    int hour  = tm.tm_hour;
+    int min   = tm.tm_min;
+    int secs  = tm.tm_sec;
+    int us    = usec;
+
+    msglen = min(msglen, bufsize - kLogLineOverhead);
 
     const char *pcolor = "";
     const char *plevel = "";
@@ -471,12 +625,7 @@ int loggerPrintVA(logger_t *logger, int level, const char *fmt, va_list ap)
     }
 #undef XXX
 
-    // lock logger->buf
-    mutexLock(&logger->mutex_);
-
-    char *buf     = logger->buf;
-    int   bufsize = (int)logger->bufsize;
-    int   len     = 0;
+    int len = 0;
 
     if (logger->enable_color)
     {
@@ -508,7 +657,7 @@ int loggerPrintVA(logger_t *logger, int level, const char *fmt, va_list ap)
                     len += i2a(min, buf + len, 2);
                     break;
                 case 'S':
-                    len += i2a(sec, buf + len, 2);
+                    len += i2a(secs, buf + len, 2);
                     break;
                 case 'z':
                     len += i2a(us / 1000, buf + len, 3);
@@ -526,7 +675,8 @@ int loggerPrintVA(logger_t *logger, int level, const char *fmt, va_list ap)
                     }
                     break;
                 case 's': {
-                    len += vsnprintf(buf + len, (size_t)(bufsize - len), fmt, ap);
+                    memoryCopy(buf + len, msg, (size_t) msglen);
+                    len += msglen;
                 }
                 break;
                 case '%':
@@ -545,10 +695,11 @@ int loggerPrintVA(logger_t *logger, int level, const char *fmt, va_list ap)
     }
     else
     {
-        len += snprintf(buf + len, (size_t)(bufsize - len), "%04d-%02d-%02d %02d:%02d:%02d.%03d %s ", year, month, day, hour, min,
-                        sec, us / 1000, plevel);
+        len += snprintf(buf + len, (size_t) (bufsize - len), "%04d-%02d-%02d %02d:%02d:%02d.%03d %s ", year, month, day,
+                        hour, min, secs, us / 1000, plevel);
 
-        len += vsnprintf(buf + len, (size_t) (bufsize - len), fmt, ap);
+        memoryCopy(buf + len, msg, (size_t) msglen);
+        len += msglen;
     }
 
     if (logger->enable_color)
@@ -561,20 +712,332 @@ int loggerPrintVA(logger_t *logger, int level, const char *fmt, va_list ap)
         buf[len++] = '\n';
     }
 
+    return len;
+}
+
+static int printSync(logger_t *logger, int level, const struct timeval *tv, const char *msg, int msglen)
+{
+    mutexLock(&logger->mutex_);
+
+    int len = formatLine(logger, logger->buf, (int) logger->bufsize, level, (int64_t) tv->tv_sec, (int) tv->tv_usec,
+                         msg, msglen);
+
     if (logger->handler)
     {
-        logger->handler(level, buf, len);
+        logger->handler(level, logger->buf, len);
     }
-    // else
-    // {
-    //     loggerWrite(logger, buf, len);
-    // }
 
     mutexUnlock(&logger->mutex_);
     return len;
 }
 
+static WTHREAD_ROUTINE(logWriterThread)
+{
+    discard userdata;
+
+#if ! defined(OS_WIN)
+    // signals are handled by the other threads, a handler that flushes the logs must never interrupt this drain
+    sigset_t all_signals;
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_BLOCK, &all_signals, NULL);
+#endif
+
+    mutexLock(&s_pipeline.mutex);
+    while (s_pipeline.running)
+    {
+        mutexUnlock(&s_pipeline.mutex);
+        drainRecords();
+        mutexLock(&s_pipeline.mutex);
+
+        if (s_pipeline.running)
+        {
+            condvarWaitFor(&s_pipeline.cond, &s_pipeline.mutex, kLogWriterIntervalMs);
+        }
+    }
+    mutexUnlock(&s_pipeline.mutex);
+
+    return 0;
+}
+
+static log_ring_t *getThreadRing(void)
+{
+    if (tl_ring != NULL && tl_ring_generation == atomicLoadRelaxed(&s_pipeline.generation))
+    {
+        return tl_ring;
+    }
+
+    log_ring_t *ring = memoryAllocate(sizeof(log_ring_t));
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+
+    mutexLock(&s_pipeline.mutex);
+
+    ring->next       = s_pipeline.rings;
+    s_pipeline.rings = ring;
+
+    if (! s_pipeline.running)
+    {
+        s_pipeline.batch   = memoryAllocate(kLogBatchSize);
+        s_pipeline.running = true;
+        s_pipeline.writer  = threadCreate(logWriterThread, NULL);
+    }
+    tl_ring_generation = atomicLoadRelaxed(&s_pipeline.generation);
 
+    mutexUnlock(&s_pipeline.mutex);
+
+    tl_ring = ring;
+    return ring;
+}
+
+// only called by the owner thread of the ring
+static bool ringPush(log_ring_t *ring, logger_t *logger, int level, const struct timeval *tv, const char *msg,
+                     uint32_t msglen)
+{
+    const uint32_t need   = (uint32_t) ALIGN2(sizeof(log_record_t) + msglen, sizeof(uint64_t));
+    uint64_t       head   = atomicLoadRelaxed(&ring->head);
+    uint64_t       tail   = atomicLoadExplicit(&ring->tail, memory_order_acquire);
+    uint32_t       index  = (uint32_t) (head & (kLogRingSize - 1));
+    uint32_t       contig = kLogRingSize - index;
+
+    // a record never wraps, the rest of the ring is skipped instead
+    uint32_t skip = contig < need ? contig : 0;
+
+    if (head + skip + need - tail > kLogRingSize)
+    {
+        return false;
+    }
+
+    if (skip > 0)
+    {
+        // a tail shorter than a header is skipped by the consumer without a marker
+        if (skip >= sizeof(log_record_t))
+        {
+            ((log_record_t *) (ring->data + index))->level = kLogRecordPadding;
+        }
+        head += skip;
+        index = 0;
+    }
+
+    log_record_t *record = (log_record_t *) (ring->data + index);
+    record->logger       = logger;
+    record->sec          = (int64_t) tv->tv_sec;
+    record->usec         = (int32_t) tv->tv_usec;
+    record->level        = (uint16_t) level;
+    record->len          = (uint16_t) msglen;
+    memoryCopy(ring->data + index + sizeof(log_record_t), msg, msglen);
+
+    atomicStoreExplicit(&ring->head, head + need, memory_order_release);
+
+    // the writer wakes up on its own, it is only hurried when the ring fills up
+    if (head + need - tail > kLogRingSize / 2)
+    {
+        condvarSignal(&s_pipeline.cond);
+    }
+    return true;
+}
+
+static void flushBatch(void)
+{
+    if (s_pipeline.batch_len == 0)
+    {
+        return;
+    }
+    logger_t *logger = s_pipeline.batch_logger;
+
+    if (s_pipeline.best_effort)
+    {
+        // the signal may have interrupted a thread inside printSync of this logger
+        if (! mutexTryLock(&logger->mutex_))
+        {
+            s_pipeline.batch_len = 0;
+            return;
+        }
+    }
+    else
+    {
+        mutexLock(&logger->mutex_);
+    }
+    if (logger->handler)
+    {
+        logger->handler(s_pipeline.batch_level, s_pipeline.batch, s_pipeline.batch_len);
+    }
+    mutexUnlock(&logger->mutex_);
+
+    s_pipeline.batch_len = 0;
+}
+
+static void appendLine(logger_t *logger, int level, int64_t sec, int usec, const char *msg, int msglen)
+{
+    if (s_pipeline.batch_len > 0 &&
+        (s_pipeline.batch_logger != logger || s_pipeline.batch_level != level ||
+         kLogBatchSize - s_pipeline.batch_len < msglen + kLogLineOverhead))
+    {
+        flushBatch();
+    }
+    s_pipeline.batch_logger = logger;
+    s_pipeline.batch_level  = level;
+    s_pipeline.batch_len += formatLine(logger, s_pipeline.batch + s_pipeline.batch_len,
+                                       kLogBatchSize - s_pipeline.batch_len, level, sec, usec, msg, msglen);
+}
+
+static void drainRing(log_ring_t *ring)
+{
+    uint64_t tail = atomicLoadRelaxed(&ring->tail);
+    uint64_t head = atomicLoadExplicit(&ring->head, memory_order_acquire);
+
+    while (tail < head)
+    {
+        uint32_t index  = (uint32_t) (tail & (kLogRingSize - 1));
+        uint32_t contig = kLogRingSize - index;
+
+        if (contig < sizeof(log_record_t) ||
+            ((const log_record_t *) (ring->data + index))->level == kLogRecordPadding)
+        {
+            tail += contig;
+            continue;
+        }
+
+        const log_record_t *record = (const log_record_t *) (ring->data + index);
+
+        appendLine(record->logger, record->level, record->sec, record->usec,
+                   (const char *) (ring->data + index + sizeof(log_record_t)), record->len);
+
+        tail += ALIGN2(sizeof(log_record_t) + record->len, sizeof(uint64_t));
+    }
+
+    atomicStoreExplicit(&ring->tail, tail, memory_order_release);
+}
+
+static void reportDrops(logger_t *loggers)
+{
+    for (logger_t *logger = loggers; logger; logger = logger->next)
+    {
+        unsigned long long dropped = atomicLoadRelaxed(&logger->dropped);
+        if (dropped == logger->reported_drops)
+        {
+            continue;
+        }
+
+        char msg[128];
+        int  msglen = snprintf(msg, sizeof(msg), "wlog: %llu log records were dropped, the writer could not keep up",
+                               dropped - logger->reported_drops);
+        logger->reported_drops = dropped;
+
+        if (logger->level <= LOG_LEVEL_WARN)
+        {
+            struct timeval tv;
+            getTimeOfDay(&tv, NULL);
+            appendLine(logger, LOG_LEVEL_WARN, (int64_t) tv.tv_sec, (int) tv.tv_usec, msg, msglen);
+        }
+    }
+}
+
+// writes the records of the given rings, the caller holds consume_mutex
+static void drainLists(log_ring_t *rings, logger_t *loggers, bool has_batch)
+{
+    for (log_ring_t *ring = rings; ring; ring = ring->next)
+    {
+        drainRing(ring);
+    }
+    if (has_batch)
+    {
+        reportDrops(loggers);
+        flushBatch();
+    }
+}
+
+// writes every record stored so far, the caller holds consume_mutex
+static void drainRecordsLocked(void)
+{
+    // the pipeline mutex is only held to read the list heads, the handlers do io and a thread registering its
+    // first ring or a new logger must not wait for that
+    // rings and loggers are added in front of the heads, they are only removed under consume_mutex
+    mutexLock(&s_pipeline.mutex);
+    log_ring_t *rings     = s_pipeline.rings;
+    logger_t   *loggers   = s_pipeline.loggers;
+    bool        has_batch = s_pipeline.batch != NULL;
+    mutexUnlock(&s_pipeline.mutex);
+
+    drainLists(rings, loggers, has_batch);
+}
+
+// any thread can call this
+static void drainRecords(void)
+{
+    mutexLock(&s_pipeline.consume_mutex);
+    drainRecordsLocked();
+    mutexUnlock(&s_pipeline.consume_mutex);
+}
+
+void loggerFlushAll(void)
+{
+    wonce(&s_pipeline_once, initPipeline);
+    drainRecords();
+}
+
+void loggerTryFlushAll(void)
+{
+    // running is only set after initPipeline, without it there is no ring to drain
+    if (! s_pipeline.running)
+    {
+        return;
+    }
+    // the interrupted thread may hold any of these mutexes, waiting for one of them would never return
+    if (! mutexTryLock(&s_pipeline.consume_mutex))
+    {
+        return;
+    }
+    if (! mutexTryLock(&s_pipeline.mutex))
+    {
+        mutexUnlock(&s_pipeline.consume_mutex);
+        return;
+    }
+    log_ring_t *rings     = s_pipeline.rings;
+    logger_t   *loggers   = s_pipeline.loggers;
+    bool        has_batch = s_pipeline.batch != NULL;
+    mutexUnlock(&s_pipeline.mutex);
+
+    s_pipeline.best_effort = true;
+    drainLists(rings, loggers, has_batch);
+    s_pipeline.best_effort = false;
+
+    mutexUnlock(&s_pipeline.consume_mutex);
+}
+
+int loggerPrintVA(logger_t *logger, int level, const char *fmt, va_list ap)
+{
+    if (level < logger->level)
+        return -10;
+
+    struct timeval tv;
+    getTimeOfDay(&tv, NULL);
+
+    static thread_local char msg[kLogMaxMessageLength];
+
+    int msglen = vsnprintf(msg, sizeof(msg), fmt, ap);
+    if (msglen < 0)
+    {
+        return msglen;
+    }
+    msglen = min(msglen, (int) sizeof(msg) - 1);
+
+    if (! logger->async || level >= LOG_LEVEL_FATAL)
+    {
+        // a fatal record is usually followed by exit, everything logged before it is written first
+        if (level >= LOG_LEVEL_FATAL)
+        {
+            drainRecords();
+        }
+        return printSync(logger, level, &tv, msg, msglen);
+    }
+
+    if (! ringPush(getThreadRing(), logger, level, &tv, msg, (uint32_t) msglen))
+    {
+        atomicIncRelaxed(&logger->dropped);
+        return 0;
+    }
+    return msglen;
+}
 
 void stdoutLogger(int loglevel, const char *buf, int len)
 {
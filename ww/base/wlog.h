@@ -3,6 +3,9 @@
 
 /*
  * wlog is thread-safe
+ *
+ * by default a logger is asynchronous, the caller only prints the message into a ring owned by its thread and a
+ * writer thread formats and writes the lines, fatal records and loggers with async disabled are written right away
  */
 
 #include "wlibc.h"
@@ -80,6 +83,10 @@ WW_EXPORT void fileLogger(int loglevel, const char *buf, int len);
 
 WW_EXPORT logger_t *loggerCreate(void);
 WW_EXPORT void      loggerDestroy(logger_t *logger);
+// writes the records that async loggers still hold, call it before the process exits
+WW_EXPORT void      loggerFlushAll(void);
+// best effort flush for signal handlers, returns without writing when the interrupted thread holds a log mutex
+WW_EXPORT void      loggerTryFlushAll(void);
 
 WW_EXPORT void loggerSetHandler(logger_t *logger, logger_handler fn);
 WW_EXPORT void loggerSetLevel(logger_t *logger, int level);
@@ -106,6 +113,9 @@ WW_EXPORT logger_handler loggerGetHandle(logger_t *logger);
 WW_EXPORT void loggerSetFormat(logger_t *logger, const char *format);
 WW_EXPORT void loggerSetMaxBufSIze(logger_t *logger, unsigned int bufsize);
 WW_EXPORT void loggerEnableColor(logger_t *logger, int on);
+WW_EXPORT void loggerEnableAsync(logger_t *logger, int on);
+// records dropped because the ring of the logging thread was full
+WW_EXPORT unsigned long long loggerGetDroppedCount(logger_t *logger);
 WW_EXPORT int  loggerPrintVA(logger_t *logger, int level, const char *fmt, va_list ap);
 
 static inline int loggerPrint(logger_t *logger, int level, const char *fmt, ...)
@@ -7,11 +7,12 @@
 
 #ifdef OS_WIN // Windows-specific definitions
 
-#define wmutex_t     CRITICAL_SECTION
-#define mutexInit    InitializeCriticalSection
-#define mutexDestroy DeleteCriticalSection
-#define mutexLock    EnterCriticalSection
-#define mutexUnlock  LeaveCriticalSection
+#define wmutex_t             CRITICAL_SECTION
+#define mutexInit            InitializeCriticalSection
+#define mutexDestroy         DeleteCriticalSection
+#define mutexLock            EnterCriticalSection
+#define mutexTryLock(pmutex) (TryEnterCriticalSection(pmutex) != 0)
+#define mutexUnlock          LeaveCriticalSection
 
 #define wrecursive_mutex_t    CRITICAL_SECTION
 #define recursivemutexInit    InitializeCriticalSection
@@ -80,11 +81,12 @@ static inline void wonce(wonce_t *once, wonce_fn fn)
 
 #else // POSIX-specific definitions
 
-#define wmutex_t          pthread_mutex_t
-#define mutexInit(pmutex) pthread_mutex_init(pmutex, NULL)
-#define mutexDestroy      pthread_mutex_destroy
-#define mutexLock         pthread_mutex_lock
-#define mutexUnlock       pthread_mutex_unlock
+#define wmutex_t             pthread_mutex_t
+#define mutexInit(pmutex)    pthread_mutex_init(pmutex, NULL)
+#define mutexDestroy         pthread_mutex_destroy
+#define mutexLock            pthread_mutex_lock
+#define mutexTryLock(pmutex) (pthread_mutex_trylock(pmutex) == 0)
+#define mutexUnlock          pthread_mutex_unlock
 
 #define wrecursive_mutex_t pthread_mutex_t
 #define recursivemutexInit(pmutex)                                                                                     \
@@ -132,8 +132,8 @@ bool isSystemUnderLoad(double threshold)
         return 0;
     }
 
-    // Calculate memory usage as a percentage
-    double memory_usage = (1.0 - ((double) mem_status.ullAvailPhys / (double)mem_status.ullTotalPhys));
+    // Calculate memory usage as a percentage, the same unit as the cpu counter and the threshold
+    double memory_usage = 100.0 * (1.0 - ((double) mem_status.ullAvailPhys / (double)mem_status.ullTotalPhys));
     if (memory_usage > threshold)
     {
         return 1; // System is under heavy memory load
@@ -68,7 +68,7 @@ static inline int getMemInfo(meminfo_t *mem)
     return -10;
 #endif
 }
-// threshould is  between 0 and 1
+// threshould is a percent between 0 and 100, on every platform (cpu load, and memory usage on windows)
 bool isSystemUnderLoad(double threshold);
 
 #endif // WW_SYS_INFO_H_
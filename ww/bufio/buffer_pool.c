@@ -20,6 +20,10 @@ struct buffer_pool_s
     atomic_size_t in_use;
 #endif
 
+    // only the owner worker writes these, the metrics manager reads them
+    atomic_ullong gets;
+    atomic_ullong misses; // gets that had to recharge from the master pool
+
     master_pool_t *large_buffers_mp;
     sbuf_t       **large_buffers;
     master_pool_t *small_buffers_mp;
@@ -56,6 +60,18 @@ uint16_t bufferpoolGetSmallBufferPadding(buffer_pool_t *pool)
     return pool->small_buffer_left_padding;
 }
 
+/**
+ * Reads the counters of the buffer pool, safe to call from any thread.
+ * @param pool The buffer pool.
+ * @param gets Receives the number of buffers taken from the pool.
+ * @param misses Receives the number of takes that had to recharge from the master pool.
+ */
+void bufferpoolGetStats(buffer_pool_t *pool, uint64_t *gets, uint64_t *misses)
+{
+    *gets   = atomicLoadRelaxed(&pool->gets);
+    *misses = atomicLoadRelaxed(&pool->misses);
+}
+
 /**
  * Creates a large buffer using the provided create handler.
  * @param pool The master pool.
@@ -210,12 +226,14 @@ sbuf_t *bufferpoolGetLargeBuffer(buffer_pool_t *pool)
 #if BUFFER_POOL_DEBUG == 1
     pool->in_use += 1;
 #endif
+    atomicAddSingleWriter(&pool->gets, 1);
 
     if (LIKELY(pool->large_buffers_container_len > 0))
     {
         --(pool->large_buffers_container_len);
         return pool->large_buffers[pool->large_buffers_container_len];
     }
+    atomicAddSingleWriter(&pool->misses, 1);
     reChargeLargeBuffers(pool);
 
     --(pool->large_buffers_container_len);
@@ -235,12 +253,14 @@ sbuf_t *bufferpoolGetSmallBuffer(buffer_pool_t *pool)
 #if BUFFER_POOL_DEBUG == 1
     pool->in_use += 1;
 #endif
+    atomicAddSingleWriter(&pool->gets, 1);
 
     if (LIKELY(pool->small_buffers_container_len > 0))
     {
         --(pool->small_buffers_container_len);
         return pool->small_buffers[pool->small_buffers_container_len];
     }
+    atomicAddSingleWriter(&pool->misses, 1);
     reChargeSmallBuffers(pool);
 
     --(pool->small_buffers_container_len);
@@ -259,6 +279,8 @@ void bufferpoolReuseBuffer(buffer_pool_t *pool, sbuf_t *b)
     {
         return;
     }
+    // chained buffers are consumed by the tunnel that accepts them (sbuf_chain.h), they never come back here
+    assert(! sbufIsChained(b));
 
 #if BYPASS_BUFFERPOOL == 1
     sbufDestroy(b);
@@ -87,6 +87,14 @@ uint16_t bufferpoolGetLargeBufferPadding(buffer_pool_t *pool);
 uint32_t bufferpoolGetSmallBufferSize(buffer_pool_t *pool);
 uint16_t bufferpoolGetSmallBufferPadding(buffer_pool_t *pool);
 
+/**
+ * Reads the counters of the buffer pool, safe to call from any thread.
+ * @param pool The buffer pool.
+ * @param gets Receives the number of buffers taken from the pool.
+ * @param misses Receives the number of takes that had to recharge from the master pool.
+ */
+void bufferpoolGetStats(buffer_pool_t *pool, uint64_t *gets, uint64_t *misses);
+
 /**
  * Checks if a buffer is a large buffer.
  * @param buf The buffer to check.
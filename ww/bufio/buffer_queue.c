@@ -13,6 +13,12 @@ enum
     kQCapDefault = 8 // Initial capacity of the queue
 };
 
+// the depth gauge of the current worker, a buffer popped on another worker leaves its slot negative, the sum is right
+static void countQueuedBuffers(long long n)
+{
+    atomicAddSingleWriter(&getWorker(getWID())->queued_buffers, n);
+}
+
 
 /**
  * @brief Creates a new buffer queue.
@@ -46,6 +52,7 @@ void bufferqueueDestory(buffer_queue_t *self)
         bufferpoolReuseBuffer(getWorkerBufferPool(wid), *i.ref);
     }
 
+    countQueuedBuffers(-(long long) ww_sbuffer_queue_t_size(&self->q));
     ww_sbuffer_queue_t_drop(&self->q);
 }
 
@@ -58,6 +65,7 @@ void bufferqueueDestory(buffer_queue_t *self)
 void bufferqueuePush(buffer_queue_t *self, sbuf_t *b)
 {
     ww_sbuffer_queue_t_push_back(&self->q, b);
+    countQueuedBuffers(1);
 }
 
 /**
@@ -69,6 +77,10 @@ void bufferqueuePush(buffer_queue_t *self, sbuf_t *b)
 sbuf_t *bufferqueuePopFront(buffer_queue_t *self)
 {
     sbuf_t *b = ww_sbuffer_queue_t_pull_front(&self->q);
+    if (b != NULL)
+    {
+        countQueuedBuffers(-1);
+    }
     return b;
 }
 
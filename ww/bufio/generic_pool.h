@@ -36,6 +36,8 @@ typedef void (*PoolItemDestroyHandle)(generic_pool_t *pool, pool_item_t *item);
     atomic_size_t         in_use;                                                                                      \
     PoolItemCreateHandle  create_item_handle;                                                                          \
     PoolItemDestroyHandle destroy_item_handle;                                                                         \
+    atomic_ullong         gets;                                                                                        \
+    atomic_ullong         misses;                                                                                      \
     master_pool_t        *mp;                                                                                          \
     pool_item_t          *available[];
 #else
@@ -47,6 +49,8 @@ typedef void (*PoolItemDestroyHandle)(generic_pool_t *pool, pool_item_t *item);
     uint32_t              item_size;                                                                                   \
     PoolItemCreateHandle  create_item_handle;                                                                          \
     PoolItemDestroyHandle destroy_item_handle;                                                                         \
+    atomic_ullong         gets;                                                                                        \
+    atomic_ullong         misses;                                                                                      \
     master_pool_t        *mp;                                                                                          \
     pool_item_t          *available[];
 
@@ -84,12 +88,15 @@ static inline pool_item_t *genericpoolGetItem(generic_pool_t *pool)
     pool->in_use += 1;
 #endif
 
+    atomicAddSingleWriter(&pool->gets, 1);
+
     if (LIKELY(pool->len > 0))
     {
         --(pool->len);
         return pool->available[pool->len];
     }
 
+    atomicAddSingleWriter(&pool->misses, 1);
     genericpoolReCharge(pool);
     --(pool->len);
     return pool->available[pool->len];
@@ -118,6 +125,18 @@ static inline void genericpoolReuseItem(generic_pool_t *pool, pool_item_t *b)
     pool->available[(pool->len)++] = b;
 }
 
+/**
+ * Reads the counters of the pool, safe to call from any thread.
+ * @param pool The generic pool.
+ * @param gets Receives the number of items taken from the pool.
+ * @param misses Receives the number of takes that had to recharge from the master pool.
+ */
+static inline void genericpoolGetStats(generic_pool_t *pool, uint64_t *gets, uint64_t *misses)
+{
+    *gets   = atomicLoadRelaxed(&pool->gets);
+    *misses = atomicLoadRelaxed(&pool->misses);
+}
+
 /**
  * Gets the item size of the pool.
  * @param pool The generic pool to get the item size from.
@@ -1,5 +1,7 @@
 #include "master_pool.h"
 
+#ifndef MASTER_POOL_LOCKFREE
+
 /**
  * Default create handler for the master pool.
  * @param pool The master pool.
@@ -125,3 +127,5 @@ void masterpoolDestroy(master_pool_t *pool)
     mutexDestroy(&pool->mutex);
     memoryFree(pool->memptr);
 }
+
+#endif
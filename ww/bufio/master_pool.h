@@ -1,6 +1,13 @@
 #pragma once
 
 #include "wlibc.h"
+
+#ifdef MASTER_POOL_LOCKFREE
+
+#include "master_pool_lockfree.h"
+
+#else
+
 #include "wmutex.h"
 
 /*
@@ -185,3 +192,5 @@ void masterpoolMakeEmpty(master_pool_t *pool,void *userdata);
  * @param pool The master pool to destroy.
  */
 void masterpoolDestroy(master_pool_t *pool);
+
+#endif
@@ -1,10 +1,6 @@
-/**
- * @file master_pool.c
- * @brief Implementation of the lock-free master object pool.
- */
-
 #include "master_pool.h"
-#include "wdef.h"
+
+#ifdef MASTER_POOL_LOCKFREE
 
 /**
  * Default create handler for the master pool.
@@ -37,55 +33,63 @@ static void defaultDestroyHandle(master_pool_t *pool, master_pool_item_t *item,
 
 /**
  * Creates a master pool with a specified capacity.
- * @param capacity The maximum number of items the pool can hold.
+ * @param pool_width The width of the pool.
  * @return A pointer to the created master pool.
  */
-master_pool_t *masterpoolCreateWithCapacity(uint32_t capacity)
+master_pool_t *masterpoolCreateWithCapacity(uint32_t pool_width)
 {
-    capacity = max((uint32_t)1, capacity);
-    
-    // Calculate required memory size
-    size_t items_size = capacity * sizeof(void*);
-    size_t next_size = capacity * sizeof(atomic_uint);
-    size_t total_size = sizeof(master_pool_t) + items_size + next_size;
-    
-    // Ensure alignment
-    total_size = ALIGN2(total_size + ((kCpuLineCacheSize + 1) / 2), kCpuLineCacheSize);
-
-    // Check for overflow
-    if (total_size < sizeof(master_pool_t))
+
+    pool_width = max((uint32_t) 1, pool_width);
+    // half of the pool is used, other half is free at startup
+    pool_width = 2 * pool_width;
+
+    if (pool_width >= kMasterPoolNilSlot)
     {
         printError("buffer size out of range");
         terminateProgram(1);
     }
 
-    // Allocate memory
-    uintptr_t ptr = (uintptr_t)memoryAllocate(total_size);
-    master_pool_t *pool = (master_pool_t *)ALIGN2(ptr, kCpuLineCacheSize);
-
-    // Initialize the pool structure
-    pool->memptr = (void*)ptr;
-    pool->cap = capacity;
-    pool->create_item_handle = defaultCreateHandle;
-    pool->destroy_item_handle = defaultDestroyHandle;
-    
-    // Initialize atomic variables
-    atomicStore(&pool->head, UINT32_MAX); // Empty stack marker
-    atomicStore(&pool->count, 0);
-    
-    // Set up memory layout
-    // Items array comes right after the master_pool_t structure
-    pool->items = (void**)(pool + 1);
-    
-    // Next array comes after items array
-    pool->next = (atomic_uint*)(((char*)pool->items) + items_size);
-    
-    // Initialize next array
-    for (uint32_t i = 0; i < capacity; i++) {
-        atomicStore(&pool->next[i], UINT32_MAX);
+    const size_t container_len = (size_t) pool_width * sizeof(master_pool_slot_t);
+
+    size_t memsize = (sizeof(master_pool_t) + container_len);
+    // ensure we have enough space to offset the allocation by line cache (for alignment)
+    memsize = ALIGN2(memsize + ((kCpuLineCacheSize + 1) / 2), kCpuLineCacheSize);
+
+    // check for overflow
+    if (memsize < sizeof(master_pool_t))
+    {
+        printError("buffer size out of range");
+        terminateProgram(1);
     }
 
-    return pool;
+    // allocate memory, placing master_pool_t at a line cache address boundary
+    uintptr_t ptr = (uintptr_t) memoryAllocate(memsize);
+
+    // align pointer to line cache boundary
+    master_pool_t *pool_ptr = (master_pool_t *) ALIGN2(ptr, kCpuLineCacheSize); // NOLINT
+
+#ifdef DEBUG
+    memorySet(pool_ptr, 0xEB, sizeof(master_pool_t) + container_len);
+#endif
+
+    master_pool_t pool = {.memptr              = (void *) ptr,
+                          .cap                 = pool_width,
+                          .create_item_handle  = defaultCreateHandle,
+                          .destroy_item_handle = defaultDestroyHandle};
+
+    memoryCopy(pool_ptr, &pool, sizeof(master_pool_t));
+
+    // every slot starts on the free stack, slot 0 on top
+    for (uint32_t i = 0; i < pool_width; i++)
+    {
+        atomicStoreExplicit(&(pool_ptr->slots[i].item), (uintptr_t) NULL, memory_order_relaxed);
+        atomicStoreExplicit(&(pool_ptr->slots[i].next), (i + 1 < pool_width) ? i + 1 : kMasterPoolNilSlot,
+                            memory_order_relaxed);
+    }
+    atomicStoreExplicit(&(pool_ptr->full_head), (unsigned long long) kMasterPoolNilSlot, memory_order_relaxed);
+    atomicStoreExplicit(&(pool_ptr->free_head), 0ULL, memory_order_release);
+
+    return pool_ptr;
 }
 
 /**
@@ -95,34 +99,54 @@ master_pool_t *masterpoolCreateWithCapacity(uint32_t capacity)
  * @param destroy_h The handler to destroy pool items.
  */
 void masterpoolInstallCallBacks(master_pool_t *pool, MasterPoolItemCreateHandle create_h,
-                              MasterPoolItemDestroyHandle destroy_h)
+                                MasterPoolItemDestroyHandle destroy_h)
 {
-    // No mutex needed, atomic exchange
-    pool->create_item_handle = create_h;
+    // callbacks are installed before the pool is shared, the fence publishes them to the other threads
+    pool->create_item_handle  = create_h;
     pool->destroy_item_handle = destroy_h;
-    
-    // Ensure memory ordering for callback installation
     atomicThreadFence(memory_order_release);
 }
 
 /**
- * Destroys the master pool and frees all items.
+ * Makes the master pool empty without destroying it.
+ * @param pool The master pool to make empty.
+ * @param userdata User data passed to the destroy handler.
+ */
+void masterpoolMakeEmpty(master_pool_t *pool, void *userdata)
+{
+    uint32_t first = kMasterPoolNilSlot;
+    uint32_t last  = kMasterPoolNilSlot;
+    uint32_t count = masterpoolPopChain(pool, &(pool->full_head), pool->cap, &first, &last, NULL);
+
+    uint32_t slot = first;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        master_pool_item_t *item =
+            (master_pool_item_t *) atomicLoadExplicit(&(pool->slots[slot].item), memory_order_relaxed);
+        pool->destroy_item_handle(pool, item, userdata);
+        atomicStoreExplicit(&(pool->slots[slot].item), (uintptr_t) NULL, memory_order_relaxed);
+        slot = atomicLoadExplicit(&(pool->slots[slot].next), memory_order_relaxed);
+    }
+
+    if (count > 0)
+    {
+        masterpoolPushChain(pool, &(pool->free_head), first, last);
+    }
+}
+
+/**
+ * Destroys the master pool and frees its resources.
  * @param pool The master pool to destroy.
  */
 void masterpoolDestroy(master_pool_t *pool)
 {
-    // Free any items still in the pool
-    uint32_t head = atomicLoad(&pool->head);
-    while (head != UINT32_MAX) {
-        void* item = pool->items[head];
-        head = atomicLoad(&pool->next[head]);
-        
-        // Destroy item if not NULL
-        if (item) {
-            pool->destroy_item_handle(pool, item, NULL);
-        }
+    if (masterpoolTaggedIndex(atomicLoadExplicit(&(pool->full_head), memory_order_acquire)) != kMasterPoolNilSlot)
+    {
+        printError("MasterPool: Destroying pool with items in it, this is a bug");
+        terminateProgram(1);
     }
-    
-    // Free the pool memory
+
     memoryFree(pool->memptr);
 }
+
+#endif
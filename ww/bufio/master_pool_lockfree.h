@@ -2,18 +2,11 @@
 
 #include "wlibc.h"
 
-/**
- * @file master_pool.h
- * @brief Lock-free implementation of a master object pool for sharing resources across worker threads.
- * 
- * The master pool provides a thread-safe way to allocate and recycle objects without
- * repeatedly calling malloc/free. Worker pools can retrieve objects from or return objects
- * to the master pool when their local pools are depleted or have excess items.
- */
-
 /*
     Master Pool (Lock-Free Implementation)
 
+    this header is selected by master_pool.h when the build enables MASTER_POOL_LOCKFREE, do not include it directly
+
     In some cases, workers need to send data/buffers to each other, while each have a thread local pool
 
     therefore, thread local pools may keep running out of items, and there is a need for a thread-safe-pool
@@ -21,6 +14,21 @@
     thread local pools will fall back to the master pool instead of allocating more memory or freeing it and
     interacting with os, malloc,free; in a single batch allocation for a full charge with only atomic operations
 
+    the pool owns a fixed array of slots, every slot is linked (by index) into one of two stacks:
+
+        full stack : slots holding an item
+        free stack : slots that are empty
+
+    a recharge pops a whole chain of slots from one stack with a single CAS, moves the items in or out and then
+    pushes the same chain on the other stack with a single CAS; so the cost is 2 CAS per batch regardless of the
+    batch size, the same as the lock / unlock pair of the mutex version
+
+    stack heads are 64 bit words, low 32 bits are the top slot index and high 32 bits are a tag that is bumped on
+    every successful CAS, this is what makes the pop ABA-safe: a chain that was popped and pushed back while another
+    thread was walking it changes the tag, so the stale CAS fails and the walk is retried
+
+    slots are never freed while the pool lives, so a walk over a stale chain only reads valid (atomic) indexes
+
 
                                 |-----------|
                                 |           |
@@ -64,40 +72,122 @@ typedef void master_pool_item_t;
 typedef master_pool_item_t *(*MasterPoolItemCreateHandle)(struct master_pool_s *pool, void *userdata);
 typedef void (*MasterPoolItemDestroyHandle)(struct master_pool_s *pool, master_pool_item_t *item, void *userdata);
 
-/**
- * @brief Lock-free implementation of the master pool structure.
- * 
- * The pool uses atomic operations to safely manage item allocation and recycling
- * across multiple threads without requiring locks.
- */
-typedef struct master_pool_s
+enum
+{
+    kMasterPoolNilSlot = UINT32_MAX
+};
+
+typedef struct master_pool_slot_s
+{
+    atomic_uintptr_t item; // written only by the thread that popped this slot, read by concurrent walkers
+    atomic_uint      next; // index of the slot below this one in its stack, read by concurrent walkers
+} master_pool_slot_t;
+
+/*
+    do not read this pool properties from the struct, its a multi-threaded object
+*/
+
+typedef MSVC_ATTR_ALIGNED_LINE_CACHE struct master_pool_s
 {
+    atomic_ullong full_head; // tagged head of the stack of slots holding items
+    uint8_t       pad0[kCpuLineCacheSize - sizeof(atomic_ullong)];
+    atomic_ullong free_head; // tagged head of the stack of empty slots
+    uint8_t       pad1[kCpuLineCacheSize - sizeof(atomic_ullong)];
+
     void                       *memptr;
     MasterPoolItemCreateHandle  create_item_handle;
     MasterPoolItemDestroyHandle destroy_item_handle;
-    
-    // Head index for the lock-free stack
-    atomic_uint                 head;
-    
-    // Items counter
-    atomic_uint                 count;
-    
-    // Maximum capacity
-    uint32_t              cap;
-    
-    // Next pointers for the lock-free stack (indices, not actual pointers)
-    atomic_uint                *next;
-    
-    // The pool items
-    void                      **items;
-} master_pool_t;
+    const uint32_t              cap;
+    master_pool_slot_t          slots[];
+} GNU_ATTR_ALIGNED_LINE_CACHE master_pool_t;
+
+static inline uint32_t masterpoolTaggedIndex(unsigned long long tagged)
+{
+    return (uint32_t) (tagged & 0xFFFFFFFFULL);
+}
+
+static inline unsigned long long masterpoolTaggedNext(unsigned long long tagged, uint32_t index)
+{
+    return (((tagged >> 32) + 1ULL) << 32) | (unsigned long long) index;
+}
+
+/**
+ * Pops a chain of up to max_count slots from a stack.
+ * @param pool The master pool.
+ * @param head The stack head (full_head or free_head).
+ * @param max_count Maximum number of slots to pop.
+ * @param first Receives the index of the first popped slot, slots are linked by their next field.
+ * @param last Receives the index of the last popped slot.
+ * @param items If not NULL, receives the items of the popped slots (copied during the walk).
+ * @return Number of popped slots, 0 if the stack was empty.
+ */
+static inline uint32_t masterpoolPopChain(master_pool_t *const pool, atomic_ullong *const head,
+                                          const uint32_t max_count, uint32_t *const first, uint32_t *const last,
+                                          master_pool_item_t const **const items)
+{
+    unsigned long long old_head = atomicLoadExplicit(head, memory_order_acquire);
+
+    while (true)
+    {
+        const uint32_t top = masterpoolTaggedIndex(old_head);
+        if (top == kMasterPoolNilSlot)
+        {
+            return 0;
+        }
+
+        // the walk may observe links (and items) that are being rewritten by other threads, the tag check in
+        // the CAS below rejects it in that case; when the CAS succeeds nothing was pushed or popped since the
+        // head was loaded, so everything read on the way is what the pushers published
+        uint32_t n    = 0;
+        uint32_t slot = top;
+        uint32_t next;
+        while (true)
+        {
+            if (items)
+            {
+                items[n] =
+                    (master_pool_item_t *) atomicLoadExplicit(&(pool->slots[slot].item), memory_order_relaxed);
+            }
+            next = atomicLoadExplicit(&(pool->slots[slot].next), memory_order_relaxed);
+            if (++n == max_count || next == kMasterPoolNilSlot)
+            {
+                break;
+            }
+            slot = next;
+        }
+
+        if (atomicCompareExchangeExplicit(head, &old_head, masterpoolTaggedNext(old_head, next),
+                                          memory_order_acquire, memory_order_acquire))
+        {
+            *first = top;
+            *last  = slot;
+            return n;
+        }
+    }
+}
+
+/**
+ * Pushes a chain of slots (already linked from first to last) on a stack.
+ * @param pool The master pool.
+ * @param head The stack head (full_head or free_head).
+ * @param first Index of the first slot of the chain.
+ * @param last Index of the last slot of the chain.
+ */
+static inline void masterpoolPushChain(master_pool_t *const pool, atomic_ullong *const head, const uint32_t first,
+                                       const uint32_t last)
+{
+    unsigned long long old_head = atomicLoadExplicit(head, memory_order_relaxed);
+
+    do
+    {
+        atomicStoreExplicit(&(pool->slots[last].next), masterpoolTaggedIndex(old_head), memory_order_relaxed);
+
+    } while (!atomicCompareExchangeExplicit(head, &old_head, masterpoolTaggedNext(old_head, first),
+                                            memory_order_release, memory_order_relaxed));
+}
 
 /**
- * @brief Retrieves a specified number of items from the master pool.
- *
- * Uses atomic operations to safely remove items from the pool without locking.
- * If the pool doesn't have enough items, it calls the create handler to make new ones.
- *
+ * Retrieves a specified number of items from the master pool.
  * @param pool The master pool.
  * @param iptr Pointer to the array where the items will be stored.
  * @param count The number of items to retrieve.
@@ -106,41 +196,23 @@ typedef struct master_pool_s
 static inline void masterpoolGetItems(master_pool_t *const pool, master_pool_item_t const **const iptr,
                                       const uint32_t count, void *userdata)
 {
-    uint32_t acquired = 0;
-    
-    // Try to get items from the pool
-    while (acquired < count && atomicLoad(&pool->count) > 0) {
-        // Get the current head
-        uint32_t old_head = atomicLoad(&pool->head);
-        if (old_head == UINT32_MAX) {
-            // Empty stack, break and create new items
-            break;
-        }
-        
-        // Get the next item in line
-        uint32_t new_head = atomicLoad(&pool->next[old_head]);
-        
-        // Try to update the head with compare-and-swap
-        if (atomicCompareExchange(&pool->head, &old_head, new_head)) {
-            // Success! We got an item
-            iptr[acquired++] = pool->items[old_head];
-            atomicSub(&pool->count, 1);
-        }
-        // If CAS fails, another thread took the item, try again
+    uint32_t first = kMasterPoolNilSlot;
+    uint32_t last  = kMasterPoolNilSlot;
+    uint32_t i     = count > 0 ? masterpoolPopChain(pool, &(pool->full_head), count, &first, &last, iptr) : 0;
+
+    if (i > 0)
+    {
+        masterpoolPushChain(pool, &(pool->free_head), first, last);
     }
-    
-    // Create any remaining items needed
-    for (; acquired < count; acquired++) {
-        iptr[acquired] = pool->create_item_handle(pool, userdata);
+
+    for (; i < count; i++)
+    {
+        iptr[i] = pool->create_item_handle(pool, userdata);
     }
 }
 
 /**
- * @brief Reuses a specified number of items by returning them to the master pool.
- *
- * Uses atomic operations to safely add items back to the pool without locking.
- * If the pool is full, it calls the destroy handler to free the excess items.
- *
+ * Reuses a specified number of items by returning them to the master pool.
  * @param pool The master pool.
  * @param iptr Pointer to the array of items to be reused.
  * @param count The number of items to reuse.
@@ -149,42 +221,32 @@ static inline void masterpoolGetItems(master_pool_t *const pool, master_pool_ite
 static inline void masterpoolReuseItems(master_pool_t *const pool, master_pool_item_t **const iptr,
                                         const uint32_t count, void *userdata)
 {
-    uint32_t returned = 0;
-    
-    // Try to return items to the pool while there's room
-    while (returned < count && atomicLoad(&pool->count) < pool->cap) {
-        // Find an empty slot in the next array
-        uint32_t slot = returned;
-        
-        // Store the item
-        pool->items[slot] = iptr[returned];
-        
-        // Get the current head
-        uint32_t old_head = atomicLoad(&pool->head);
-        
-        // Set our next pointer to the current head
-        atomicStore(&pool->next[slot], old_head);
-        
-        // Try to become the new head with compare-and-swap
-        if (atomicCompareExchange(&pool->head, &old_head, slot)) {
-            // Success! We added an item
-            atomicAdd(&pool->count, 1);
-            returned++;
-        } else {
-            // Someone else changed the head, try again
-            continue;
+    uint32_t i     = 0;
+    uint32_t first = kMasterPoolNilSlot;
+    uint32_t last  = kMasterPoolNilSlot;
+
+    const uint32_t consumed =
+        count > 0 ? masterpoolPopChain(pool, &(pool->free_head), count, &first, &last, NULL) : 0;
+
+    if (consumed > 0)
+    {
+        uint32_t slot = first;
+        for (; i < consumed; i++)
+        {
+            atomicStoreExplicit(&(pool->slots[slot].item), (uintptr_t) iptr[i], memory_order_relaxed);
+            slot = atomicLoadExplicit(&(pool->slots[slot].next), memory_order_relaxed);
         }
+        masterpoolPushChain(pool, &(pool->full_head), first, last);
     }
-    
-    // Destroy any remaining items
-    for (; returned < count; returned++) {
-        pool->destroy_item_handle(pool, iptr[returned], userdata);
+
+    for (; i < count; i++)
+    {
+        pool->destroy_item_handle(pool, iptr[i], userdata);
     }
 }
 
 /**
- * @brief Installs create and destroy callbacks for the master pool.
- * 
+ * Installs create and destroy callbacks for the master pool.
  * @param pool The master pool.
  * @param create_h The handler to create pool items.
  * @param destroy_h The handler to destroy pool items.
@@ -193,16 +255,19 @@ void masterpoolInstallCallBacks(master_pool_t *pool, MasterPoolItemCreateHandle
                                 MasterPoolItemDestroyHandle destroy_h);
 
 /**
- * @brief Creates a master pool with a specified capacity.
- * 
- * @param capacity The maximum number of items the pool can hold.
+ * Creates a master pool with a specified capacity.
+ * @param pool_width The width of the pool.
  * @return A pointer to the created master pool.
  */
-master_pool_t *masterpoolCreateWithCapacity(uint32_t capacity);
+master_pool_t *masterpoolCreateWithCapacity(uint32_t pool_width);
+
+/*
+* remove everything from the pool, but does not destroy it
+*/
+void masterpoolMakeEmpty(master_pool_t *pool, void *userdata);
 
 /**
- * @brief Destroys the master pool and frees its resources.
- * 
+ * Destroys the master pool and frees its resources.
  * @param pool The master pool to destroy.
  */
 void masterpoolDestroy(master_pool_t *pool);
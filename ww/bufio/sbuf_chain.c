@@ -0,0 +1,288 @@
+#include "sbuf_chain.h"
+
+static sbuf_segment_t *segmentCreate(sbuf_t *buf)
+{
+    assert(! sbufIsChained(buf));
+
+    sbuf_segment_t *seg = memoryAllocate(sizeof(sbuf_segment_t));
+    seg->buf            = buf;
+    atomic_init(&seg->refs, 1);
+    return seg;
+}
+
+static void segmentRetain(sbuf_segment_t *seg)
+{
+    atomicIncRelaxed(&seg->refs);
+}
+
+static void segmentRelease(sbuf_segment_t *seg, buffer_pool_t *pool)
+{
+    if (atomicDecExplicit(&seg->refs, memory_order_acq_rel) == 1)
+    {
+        if (pool != NULL)
+        {
+            bufferpoolReuseBuffer(pool, seg->buf);
+        }
+        else
+        {
+            sbufDestroy(seg->buf);
+        }
+        memoryFree(seg);
+    }
+}
+
+static bool segmentIsShared(sbuf_segment_t *seg)
+{
+    return atomicLoadExplicit(&seg->refs, memory_order_acquire) > 1;
+}
+
+static void reserveViews(sbuf_chain_t *list, uint32_t count)
+{
+    if (count <= list->cap)
+    {
+        return;
+    }
+    uint32_t new_cap = max(list->cap * 2, count);
+
+    if (list->views == list->inline_views)
+    {
+        list->views = memoryAllocate(sizeof(sbuf_chain_view_t) * new_cap);
+        memoryCopy(list->views, list->inline_views, sizeof(sbuf_chain_view_t) * list->count);
+    }
+    else
+    {
+        list->views = memoryReAllocate(list->views, sizeof(sbuf_chain_view_t) * new_cap);
+    }
+    list->cap = new_cap;
+}
+
+static void pushView(sbuf_t *self, sbuf_segment_t *seg, uint32_t offset, uint32_t len)
+{
+    sbuf_chain_t *list = sbufchainGetList(self);
+
+    reserveViews(list, list->count + 1);
+    list->views[list->count++] = (sbuf_chain_view_t) {.seg = seg, .offset = offset, .len = len};
+    self->len += len;
+}
+
+static const uint8_t *viewGetPtr(const sbuf_chain_view_t *view)
+{
+    return (const uint8_t *) sbufGetRawPtr(view->seg->buf) + view->offset;
+}
+
+sbuf_t *sbufchainCreate(void)
+{
+    sbuf_t *self = memoryAllocate(sizeof(sbuf_t) + sizeof(sbuf_chain_t));
+
+    self->is_temporary = false;
+    self->is_chain     = true;
+    self->len          = 0;
+    self->curpos       = 0;
+    self->capacity     = 0;
+    self->l_pad        = 0;
+
+    sbuf_chain_t *list = sbufchainGetList(self);
+    list->views        = list->inline_views;
+    list->count        = 0;
+    list->cap          = kSbufChainInlineViews;
+
+    return self;
+}
+
+// frees the chained buffer itself, the segments must be released or moved before
+static void chainFree(sbuf_t *self)
+{
+    sbuf_chain_t *list = sbufchainGetList(self);
+    if (list->views != list->inline_views)
+    {
+        memoryFree(list->views);
+    }
+    memoryFree(self);
+}
+
+void sbufchainDestroy(sbuf_t *self, buffer_pool_t *pool)
+{
+    sbuf_chain_t *list = sbufchainGetList(self);
+    for (uint32_t i = 0; i < list->count; i++)
+    {
+        segmentRelease(list->views[i].seg, pool);
+    }
+    chainFree(self);
+}
+
+void sbufchainAppend(sbuf_t *self, sbuf_t *buf)
+{
+    assert(self != buf);
+
+    if (! sbufIsChained(buf))
+    {
+        pushView(self, segmentCreate(buf), 0, sbufGetLength(buf));
+        return;
+    }
+
+    // the references of the other chain move over with its views
+    sbuf_chain_t *other = sbufchainGetList(buf);
+    reserveViews(sbufchainGetList(self), sbufchainGetList(self)->count + other->count);
+    for (uint32_t i = 0; i < other->count; i++)
+    {
+        pushView(self, other->views[i].seg, other->views[i].offset, other->views[i].len);
+    }
+    chainFree(buf);
+}
+
+void sbufchainPrepend(sbuf_t *self, sbuf_t *buf)
+{
+    sbuf_chain_t *list = sbufchainGetList(self);
+
+    reserveViews(list, list->count + 1);
+    memoryMove(list->views + 1, list->views, sizeof(sbuf_chain_view_t) * list->count);
+
+    list->views[0] = (sbuf_chain_view_t) {.seg = segmentCreate(buf), .offset = 0, .len = sbufGetLength(buf)};
+    list->count++;
+    self->len += sbufGetLength(buf);
+}
+
+sbuf_t *sbufchainSlice(const sbuf_t *self, uint32_t offset, uint32_t len)
+{
+    assert((uint64_t) offset + len <= sbufGetLength(self));
+
+    const sbuf_chain_t *list  = sbufchainGetListConst(self);
+    sbuf_t             *slice = sbufchainCreate();
+
+    for (uint32_t i = 0; i < list->count && len > 0; i++)
+    {
+        const sbuf_chain_view_t *view = &list->views[i];
+        if (offset >= view->len)
+        {
+            offset -= view->len;
+            continue;
+        }
+
+        uint32_t take = min(view->len - offset, len);
+        segmentRetain(view->seg);
+        pushView(slice, view->seg, view->offset + offset, take);
+
+        len -= take;
+        offset = 0;
+    }
+    return slice;
+}
+
+sbuf_t *sbufchainClone(const sbuf_t *self)
+{
+    return sbufchainSlice(self, 0, sbufGetLength(self));
+}
+
+void sbufchainConsume(sbuf_t *self, uint32_t bytes, buffer_pool_t *pool)
+{
+    assert(bytes <= sbufGetLength(self));
+
+    sbuf_chain_t *list = sbufchainGetList(self);
+    self->len -= bytes;
+
+    uint32_t dropped = 0;
+    while (bytes > 0)
+    {
+        sbuf_chain_view_t *view = &list->views[dropped];
+        if (bytes < view->len)
+        {
+            view->offset += bytes;
+            view->len -= bytes;
+            break;
+        }
+        bytes -= view->len;
+        segmentRelease(view->seg, pool);
+        dropped++;
+    }
+
+    if (dropped > 0)
+    {
+        list->count -= dropped;
+        memoryMove(list->views, list->views + dropped, sizeof(sbuf_chain_view_t) * list->count);
+    }
+}
+
+void sbufchainViewBytesAt(const sbuf_t *self, uint32_t at, uint8_t *dest, uint32_t len)
+{
+    assert((uint64_t) at + len <= sbufGetLength(self));
+
+    const sbuf_chain_t *list = sbufchainGetListConst(self);
+
+    for (uint32_t i = 0; i < list->count && len > 0; i++)
+    {
+        const sbuf_chain_view_t *view = &list->views[i];
+        if (at >= view->len)
+        {
+            at -= view->len;
+            continue;
+        }
+
+        uint32_t take = min(view->len - at, len);
+        memoryCopy(dest, viewGetPtr(view) + at, take);
+
+        dest += take;
+        len -= take;
+        at = 0;
+    }
+}
+
+// takes the buffer of an unshared segment, trimmed to the bytes of the view
+static sbuf_t *takeViewBuffer(sbuf_chain_view_t *view)
+{
+    sbuf_t *buf = view->seg->buf;
+    memoryFree(view->seg);
+
+    sbufShiftRight(buf, view->offset);
+    sbufSetLength(buf, view->len);
+    return buf;
+}
+
+sbuf_t *sbufchainLinearize(sbuf_t *self, buffer_pool_t *pool)
+{
+    sbuf_chain_t  *list  = sbufchainGetList(self);
+    const uint32_t total = sbufGetLength(self);
+    sbuf_t        *result;
+    uint32_t       first;
+
+    if (list->count > 0 && ! segmentIsShared(list->views[0].seg) &&
+        sbufGetRightCapacity(list->views[0].seg->buf) - list->views[0].offset >= total)
+    {
+        // the first buffer is ours and has room, only the bytes after it are copied (none for a single segment)
+        result = takeViewBuffer(&list->views[0]);
+        first  = 1;
+    }
+    else
+    {
+        if (total <= bufferpoolGetSmallBufferSize(pool))
+        {
+            result = bufferpoolGetSmallBuffer(pool);
+        }
+        else if (total <= bufferpoolGetLargeBufferSize(pool))
+        {
+            result = bufferpoolGetLargeBuffer(pool);
+        }
+        else
+        {
+            result = sbufCreateWithPadding(total, bufferpoolGetLargeBufferPadding(pool));
+        }
+        sbufSetLength(result, 0);
+        first = 0;
+    }
+
+    uint32_t written = sbufGetLength(result);
+    sbufSetLength(result, total);
+
+    for (uint32_t i = first; i < list->count; i++)
+    {
+        sbuf_chain_view_t *view = &list->views[i];
+
+        memoryCopy(sbufGetMutablePtr(result) + written, viewGetPtr(view), view->len);
+        written += view->len;
+
+        segmentRelease(view->seg, pool);
+    }
+    assert(written == total);
+
+    chainFree(self);
+    return result;
+}
@@ -0,0 +1,181 @@
+#pragma once
+#include "wlibc.h"
+
+#include "buffer_pool.h"
+#include "shiftbuffer.h"
+
+/*
+
+    A chained buffer is an sbuf_t whose is_chain flag is set, instead of bytes its buf holds a list of views over
+    segments, each segment is a normal sbuf_t owned through a reference count
+
+    the chained buffer travels through fnPayloadU / fnPayloadD like any other buffer, its len is the length of all
+    the views so metrics and flow control see the real size
+
+    a header is prepended by adding a segment in front of the payload, two payloads are joined by adding the
+    segments of one to the other, and slices or clones share the segments of the source, none of these copy bytes
+
+    the payload helpers of tunnel.h do not look at the flag, so a chained buffer is only sent to a tunnel that set
+    accepts_chain_u / accepts_chain_d; tunnels that keep the default payload routine only hand the buffer on and are
+    passed over. a producer asks tunnelNextAcceptsChainU() / tunnelPrevAcceptsChainD() once and sends a plain buffer
+    when the answer is false
+
+    the accepting tunnel consumes the chain, it writes it (wioWriteChain) or linearizes it before keeping it, so
+    chains never reach a queue, bufferpoolReuseBuffer() or sbufDestroy()
+
+    the bytes of a segment that is shared by more than one chain must not be changed
+
+    a segment can be released from any worker, its buffer goes to the pool given by whoever drops the last reference
+
+*/
+
+typedef struct sbuf_segment_s
+{
+    sbuf_t     *buf;
+    atomic_uint refs;
+
+} sbuf_segment_t;
+
+typedef struct sbuf_chain_view_s
+{
+    sbuf_segment_t *seg;
+    uint32_t        offset; // from the start of the data of the segment buffer
+    uint32_t        len;
+
+} sbuf_chain_view_t;
+
+enum
+{
+    kSbufChainInlineViews = 4
+};
+
+typedef struct sbuf_chain_s
+{
+    sbuf_chain_view_t *views;
+    uint32_t           count;
+    uint32_t           cap;
+    sbuf_chain_view_t  inline_views[kSbufChainInlineViews];
+
+} sbuf_chain_t;
+
+/**
+ * Creates an empty chained buffer.
+ * @return A pointer to the created buffer, sbufIsChained() is true for it.
+ */
+sbuf_t *sbufchainCreate(void);
+
+/**
+ * Destroys the chained buffer, the buffers of the segments it was the last user of go back to the pool.
+ * @param self The chained buffer.
+ * @param pool The buffer pool of the current worker, NULL destroys those buffers instead.
+ */
+void sbufchainDestroy(sbuf_t *self, buffer_pool_t *pool);
+
+/**
+ * Appends a buffer, the chain takes the ownership of the buffer.
+ *
+ * A plain buffer becomes a new segment, the segments of a chained buffer are moved over without copying.
+ *
+ * @param self The chained buffer.
+ * @param buf The buffer.
+ */
+void sbufchainAppend(sbuf_t *self, sbuf_t *buf);
+
+/**
+ * Prepends a plain buffer (usually a header) as a new segment, the chain takes the ownership of the buffer.
+ * @param self The chained buffer.
+ * @param buf The buffer.
+ */
+void sbufchainPrepend(sbuf_t *self, sbuf_t *buf);
+
+/**
+ * Creates a chained buffer that shares a range of the bytes of this chain.
+ * @param self The chained buffer.
+ * @param offset The first byte of the range.
+ * @param len The length of the range.
+ * @return A pointer to the created chained buffer.
+ */
+sbuf_t *sbufchainSlice(const sbuf_t *self, uint32_t offset, uint32_t len);
+
+/**
+ * Creates a chained buffer that shares all the bytes of this chain, for sending the same data to more than one place.
+ * @param self The chained buffer.
+ * @return A pointer to the created chained buffer.
+ */
+sbuf_t *sbufchainClone(const sbuf_t *self);
+
+/**
+ * Removes bytes from the start of the chain.
+ * @param self The chained buffer.
+ * @param bytes The number of bytes to remove.
+ * @param pool The buffer pool of the current worker.
+ */
+void sbufchainConsume(sbuf_t *self, uint32_t bytes, buffer_pool_t *pool);
+
+/**
+ * Copies a sequence of bytes out of the chain.
+ * @param self The chained buffer.
+ * @param at The position of the first byte.
+ * @param dest The destination.
+ * @param len The number of bytes to copy.
+ */
+void sbufchainViewBytesAt(const sbuf_t *self, uint32_t at, uint8_t *dest, uint32_t len);
+
+/**
+ * Turns the chain into one contiguous buffer and destroys the chain.
+ *
+ * A chain with a single segment that is not shared gives its buffer back without copying, otherwise the bytes are
+ * copied once, into the first segment buffer when it is not shared and has room or into a buffer of the pool.
+ *
+ * @param self The chained buffer.
+ * @param pool The buffer pool of the current worker.
+ * @return A pointer to the plain buffer.
+ */
+sbuf_t *sbufchainLinearize(sbuf_t *self, buffer_pool_t *pool);
+
+/**
+ * Gets the segment list of a chained buffer.
+ * @param self The chained buffer.
+ * @return A pointer to the segment list.
+ */
+static inline sbuf_chain_t *sbufchainGetList(sbuf_t *const self)
+{
+    assert(sbufIsChained(self));
+    return (sbuf_chain_t *) &self->buf[0];
+}
+
+/**
+ * Gets the segment list of a chained buffer (read only).
+ * @param self The chained buffer.
+ * @return A pointer to the segment list.
+ */
+static inline const sbuf_chain_t *sbufchainGetListConst(const sbuf_t *const self)
+{
+    assert(sbufIsChained(self));
+    return (const sbuf_chain_t *) &self->buf[0];
+}
+
+/**
+ * Gets the number of segments of the chain.
+ * @param self The chained buffer.
+ * @return The number of segments.
+ */
+static inline uint32_t sbufchainGetSegmentCount(const sbuf_t *const self)
+{
+    return sbufchainGetListConst(self)->count;
+}
+
+/**
+ * Gets the bytes of one segment of the chain, for writers that take a list of pointers (writev / sendmsg).
+ * @param self The chained buffer.
+ * @param index The index of the segment.
+ * @param len Set to the number of bytes of the segment.
+ * @return A pointer to the first byte of the segment.
+ */
+static inline const uint8_t *sbufchainGetSegment(const sbuf_t *const self, uint32_t index, uint32_t *len)
+{
+    const sbuf_chain_view_t *view = &sbufchainGetListConst(self)->views[index];
+
+    *len = view->len;
+    return (const uint8_t *) sbufGetRawPtr(view->seg->buf) + view->offset;
+}
@@ -16,6 +16,7 @@ void sbufDestroy(sbuf_t *b)
     {
         return;
     }
+    assert(! sbufIsChained(b)); // use sbufchainDestroy()
     memoryFree(b);
 }
 
@@ -41,6 +42,7 @@ sbuf_t *sbufCreateWithPadding(uint32_t minimum_capacity, uint16_t pad_left)
 #endif
 
     b->is_temporary = false;
+    b->is_chain     = false;
     b->len          = 0;
     b->curpos       = pad_left;
     b->capacity     = real_cap;
@@ -22,6 +22,7 @@ struct sbuf_s
     uint32_t capacity;
     uint16_t l_pad;
     bool     is_temporary; // if true, this buffer will not be freed or reused in pools (like stack buffer)
+    bool     is_chain;     // if true, buf holds a segment list instead of bytes (sbuf_chain.h)
     MSVC_ATTR_ALIGNED_16 uint8_t buf[] GNU_ATTR_ALIGNED_16;
 };
 
@@ -31,6 +32,16 @@ typedef struct sbuf_s sbuf_t;
 
 static_assert(SIZEOF_STRUCT_SBUF == 16, "sbuf_s size is not 16 bytes, see above comment");
 
+/**
+ * Checks if the buffer is a chained (multi-segment) buffer, its bytes are only reachable through sbuf_chain.h
+ * @param b The buffer.
+ * @return True if the buffer is chained.
+ */
+static inline bool sbufIsChained(const sbuf_t *const b)
+{
+    return b->is_chain;
+}
+
 /**
  * Destroys the shift buffer and frees its memory.
  * @param b The shift buffer to destroy.
@@ -490,6 +501,10 @@ static inline void sbufWriteUI16(sbuf_t *const b, const uint16_t data)
  */
 static sbuf_t *debugBufferWontBeReused(sbuf_t *b)
 {
+    if (sbufIsChained(b))
+    {
+        return b;
+    }
     sbuf_t *nbuf = sbufDuplicate(b);
     sbufDestroy(b);
     return nbuf;
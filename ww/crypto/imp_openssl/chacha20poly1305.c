@@ -101,3 +101,117 @@ cleanup:
     EVP_CIPHER_CTX_free(ctx);
     return ret;
 }
+
+// one cipher context for the whole batch, the key is set once and only the nonce changes per message
+int chacha20poly1305EncryptBatch(wcrypto_aead_msg_t *msgs, size_t count, const unsigned char *key)
+{
+    int             failed = 0;
+    int             len    = 0;
+    EVP_CIPHER_CTX *ctx    = EVP_CIPHER_CTX_new();
+
+    if (! ctx || EVP_EncryptInit_ex(ctx, EVP_chacha20_poly1305(), NULL, key, NULL) != 1)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            msgs[i].result = -1;
+        }
+        EVP_CIPHER_CTX_free(ctx);
+        return (int) count;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        wcrypto_aead_msg_t *msg            = &msgs[i];
+        int                 ciphertext_len = 0;
+
+        msg->result = -1;
+
+        if (EVP_EncryptInit_ex(ctx, NULL, NULL, NULL, msg->nonce) != 1)
+        {
+            failed++;
+            continue;
+        }
+        if (msg->ad_len > 0 && EVP_EncryptUpdate(ctx, NULL, &len, msg->ad, (int) msg->ad_len) != 1)
+        {
+            failed++;
+            continue;
+        }
+        if (EVP_EncryptUpdate(ctx, msg->dst, &len, msg->src, (int) msg->src_len) != 1)
+        {
+            failed++;
+            continue;
+        }
+        ciphertext_len += len;
+        if (EVP_EncryptFinal_ex(ctx, msg->dst + ciphertext_len, &len) != 1)
+        {
+            failed++;
+            continue;
+        }
+        ciphertext_len += len;
+        if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_GET_TAG, 16, msg->dst + ciphertext_len) != 1)
+        {
+            failed++;
+            continue;
+        }
+        msg->result = 0;
+    }
+
+    EVP_CIPHER_CTX_free(ctx);
+    return failed;
+}
+
+int chacha20poly1305DecryptBatch(wcrypto_aead_msg_t *msgs, size_t count, const unsigned char *key)
+{
+    int             failed = 0;
+    int             len    = 0;
+    EVP_CIPHER_CTX *ctx    = EVP_CIPHER_CTX_new();
+
+    if (! ctx || EVP_DecryptInit_ex(ctx, EVP_chacha20_poly1305(), NULL, key, NULL) != 1)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            msgs[i].result = -1;
+        }
+        EVP_CIPHER_CTX_free(ctx);
+        return (int) count;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        wcrypto_aead_msg_t *msg           = &msgs[i];
+        int                 plaintext_len = 0;
+
+        msg->result = -1;
+
+        if (msg->src_len < 16 || EVP_DecryptInit_ex(ctx, NULL, NULL, NULL, msg->nonce) != 1)
+        {
+            failed++;
+            continue;
+        }
+        if (msg->ad_len > 0 && EVP_DecryptUpdate(ctx, NULL, &len, msg->ad, (int) msg->ad_len) != 1)
+        {
+            failed++;
+            continue;
+        }
+        if (EVP_DecryptUpdate(ctx, msg->dst, &len, msg->src, (int) (msg->src_len - 16)) != 1)
+        {
+            failed++;
+            continue;
+        }
+        plaintext_len += len;
+        if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_SET_TAG, 16, (void *) (msg->src + msg->src_len - 16)) != 1)
+        {
+            failed++;
+            continue;
+        }
+        if (EVP_DecryptFinal_ex(ctx, msg->dst + plaintext_len, &len) != 1)
+        {
+            failed++;
+            continue;
+        }
+        msg->result = 0;
+    }
+
+    EVP_CIPHER_CTX_free(ctx);
+    return failed;
+}
@@ -47,3 +47,42 @@ int chacha20poly1305Decrypt(unsigned char *dst, const unsigned char *src, size_t
     // return (int) plaintext_len;
     return 0;
 }
+
+// libsodium has no multi-message api, its chacha20 already picks the widest simd implementation at init, so the
+// batch only saves the per call checks
+int chacha20poly1305EncryptBatch(wcrypto_aead_msg_t *msgs, size_t count, const unsigned char *key)
+{
+    assert(sodium_init() != -1 && "libsodium must be initialized before calling this function");
+
+    int failed = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        wcrypto_aead_msg_t *msg = &msgs[i];
+
+        msg->result = crypto_aead_chacha20poly1305_ietf_encrypt(msg->dst, NULL, msg->src, msg->src_len, msg->ad,
+                                                                msg->ad_len, NULL, msg->nonce, key) == 0
+                          ? 0
+                          : -1;
+        failed += (msg->result != 0);
+    }
+    return failed;
+}
+
+int chacha20poly1305DecryptBatch(wcrypto_aead_msg_t *msgs, size_t count, const unsigned char *key)
+{
+    assert(sodium_init() != -1 && "libsodium must be initialized before calling this function");
+
+    int failed = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        wcrypto_aead_msg_t *msg = &msgs[i];
+
+        // authentication failures are reported in result only, a burst may carry any number of forged packets
+        msg->result = crypto_aead_chacha20poly1305_ietf_decrypt(msg->dst, NULL, NULL, msg->src, msg->src_len, msg->ad,
+                                                                msg->ad_len, msg->nonce, key) == 0
+                          ? 0
+                          : -1;
+        failed += (msg->result != 0);
+    }
+    return failed;
+}
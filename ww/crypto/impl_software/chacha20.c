@@ -30,7 +30,7 @@
  * Author: Daniel Hope <daniel.hope@smartalock.com>
  */
 
-// RFC7539 implementation of ChaCha20 with modified nonce size for WireGuard
+// RFC7539 implementation of ChaCha20, WireGuard uses it with a 96-bit nonce whose first 4 bytes are zero
 // https://tools.ietf.org/html/rfc7539
 // Adapted from https://cr.yp.to/streamciphers/timings/estreambench/submissions/salsa20/chacha8/ref/chacha.c by D. J. Bernstein (Public Domain)
 // HChaCha20 is described here: https://tools.ietf.org/id/draft-arciszewski-xchacha-02.html
@@ -142,8 +142,9 @@ void chacha20(struct chacha20_ctx *ctx, uint8_t *out, const uint8_t *in, uint32_
 // The next eight words (4-11) are taken from the 256-bit key by reading the bytes in little-endian order, in 4-byte chunks.
 // Word 12 is a block counter.  Since each block is 64-byte, a 32-bit word is enough for 256 gigabytes of data.
 // Words 13-15 are a nonce, which should not be repeated for the same key.
+// The 96-bit nonce of RFC 8439 is read as three little-endian words, the batch lanes load it the same way
 // For wireguard: "nonce being composed of 32 bits of zeros followed by the 64-bit little-endian value of counter." where counter comes from the Wireguard layer and is separate from the block counter in word 12
-void chacha20_init(struct chacha20_ctx *ctx, const uint8_t *key, const uint64_t nonce) {
+void chacha20_init(struct chacha20_ctx *ctx, const uint8_t *key, const uint8_t *nonce) {
 	ctx->state[0] = CHACHA20_CONSTANT_1;
 	ctx->state[1] = CHACHA20_CONSTANT_2;
 	ctx->state[2] = CHACHA20_CONSTANT_3;
@@ -157,9 +158,9 @@ void chacha20_init(struct chacha20_ctx *ctx, const uint8_t *key, const uint64_t
 	ctx->state[10] = U8TO32_LITTLE(key + 24);
 	ctx->state[11] = U8TO32_LITTLE(key + 28);
 	ctx->state[12] = 0;
-	ctx->state[13] = 0;
-	ctx->state[14] = nonce & 0xFFFFFFFF;
-	ctx->state[15] = nonce >> 32;
+	ctx->state[13] = U8TO32_LITTLE(nonce + 0);
+	ctx->state[14] = U8TO32_LITTLE(nonce + 4);
+	ctx->state[15] = U8TO32_LITTLE(nonce + 8);
 }
 
 // 2.2. HChaCha20
@@ -197,3 +198,111 @@ void hchacha20(uint8_t *out, const uint8_t *nonce, const uint8_t *key) {
 	U32TO8_LITTLE(out + 24, state[14]);
 	U32TO8_LITTLE(out + 28, state[15]);
 }
+
+// Multi-buffer block function
+// The 16 state words of all lanes are kept as vectors (word i of lane l is x[i][l]), so one quarter round runs on
+// every lane at once: with AVX2 a vector is one ymm register, without it the compiler splits it in two SSE2 / NEON
+// registers. A burst of small packets fills the lanes with blocks of different messages, big packets with the
+// consecutive blocks of one message.
+#if defined(__GNUC__) || defined(__clang__)
+
+typedef uint32_t chacha20_u32xlanes __attribute__((vector_size(4 * CHACHA20_LANES)));
+
+#define VROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define VQUARTERROUND(a, b, c, d)       \
+    a += b;  d ^= a;  d = VROTL32(d, 16);  \
+    c += d;  b ^= c;  b = VROTL32(b, 12);  \
+    a += b;  d ^= a;  d = VROTL32(d,  8);  \
+    c += d;  b ^= c;  b = VROTL32(b,  7)
+
+static inline __attribute__((always_inline)) void chacha20_blocks_lanes_body(const uint32_t *key_words, const uint32_t *counter, const uint32_t *nonce, uint8_t *stream) {
+	chacha20_u32xlanes s[16];
+	chacha20_u32xlanes x[16];
+	int i, l;
+
+	s[0] = (chacha20_u32xlanes){0} + CHACHA20_CONSTANT_1;
+	s[1] = (chacha20_u32xlanes){0} + CHACHA20_CONSTANT_2;
+	s[2] = (chacha20_u32xlanes){0} + CHACHA20_CONSTANT_3;
+	s[3] = (chacha20_u32xlanes){0} + CHACHA20_CONSTANT_4;
+	for (i = 0; i < 8; ++i) {
+		s[4 + i] = (chacha20_u32xlanes){0} + key_words[i];
+	}
+	memcpy(&s[12], counter, sizeof(s[12]));
+	memcpy(&s[13], nonce + (0 * CHACHA20_LANES), sizeof(s[13]));
+	memcpy(&s[14], nonce + (1 * CHACHA20_LANES), sizeof(s[14]));
+	memcpy(&s[15], nonce + (2 * CHACHA20_LANES), sizeof(s[15]));
+
+	for (i = 0; i < 16; ++i) {
+		x[i] = s[i];
+	}
+
+	for (i = 0; i < 10; ++i) {
+		VQUARTERROUND(x[0], x[4], x[ 8], x[12]); // column 0
+		VQUARTERROUND(x[1], x[5], x[ 9], x[13]); // column 1
+		VQUARTERROUND(x[2], x[6], x[10], x[14]); // column 2
+		VQUARTERROUND(x[3], x[7], x[11], x[15]); // column 3
+		VQUARTERROUND(x[0], x[5], x[10], x[15]); // diagonal 1
+		VQUARTERROUND(x[1], x[6], x[11], x[12]); // diagonal 2
+		VQUARTERROUND(x[2], x[7], x[ 8], x[13]); // diagonal 3
+		VQUARTERROUND(x[3], x[4], x[ 9], x[14]); // diagonal 4
+	}
+
+	for (i = 0; i < 16; ++i) {
+		x[i] += s[i];
+	}
+
+	for (l = 0; l < CHACHA20_LANES; ++l) {
+		for (i = 0; i < 16; ++i) {
+			U32TO8_LITTLE(stream + (64 * l) + (4 * i), x[i][l]);
+		}
+	}
+
+	wCryptoZero(x, sizeof(x));
+	wCryptoZero(s, sizeof(s));
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("avx2"))) static void chacha20_blocks_lanes_avx2(const uint32_t *key_words, const uint32_t *counter, const uint32_t *nonce, uint8_t *stream) {
+	chacha20_blocks_lanes_body(key_words, counter, nonce, stream);
+}
+#endif
+
+static void chacha20_blocks_lanes_generic(const uint32_t *key_words, const uint32_t *counter, const uint32_t *nonce, uint8_t *stream) {
+	chacha20_blocks_lanes_body(key_words, counter, nonce, stream);
+}
+
+void chacha20_blocks_lanes(const uint32_t *key_words, const uint32_t *counter, const uint32_t *nonce, uint8_t *stream) {
+#if defined(__x86_64__) || defined(__i386__)
+	if (__builtin_cpu_supports("avx2")) {
+		chacha20_blocks_lanes_avx2(key_words, counter, nonce, stream);
+		return;
+	}
+#endif
+	chacha20_blocks_lanes_generic(key_words, counter, nonce, stream);
+}
+
+#else
+
+void chacha20_blocks_lanes(const uint32_t *key_words, const uint32_t *counter, const uint32_t *nonce, uint8_t *stream) {
+	struct chacha20_ctx ctx;
+	int i, l;
+
+	ctx.state[0] = CHACHA20_CONSTANT_1;
+	ctx.state[1] = CHACHA20_CONSTANT_2;
+	ctx.state[2] = CHACHA20_CONSTANT_3;
+	ctx.state[3] = CHACHA20_CONSTANT_4;
+	for (i = 0; i < 8; ++i) {
+		ctx.state[4 + i] = key_words[i];
+	}
+	for (l = 0; l < CHACHA20_LANES; ++l) {
+		ctx.state[12] = counter[l];
+		ctx.state[13] = nonce[(0 * CHACHA20_LANES) + l];
+		ctx.state[14] = nonce[(1 * CHACHA20_LANES) + l];
+		ctx.state[15] = nonce[(2 * CHACHA20_LANES) + l];
+		chacha20_block(&ctx, stream + (64 * l));
+	}
+	wCryptoZero(&ctx, sizeof(ctx));
+}
+
+#endif
@@ -41,13 +41,13 @@
 static const uint8_t zero[CHACHA20_BLOCK_SIZE] = { 0 };
 
 // 2.6.  Generating the Poly1305 Key Using ChaCha20
-static void generate_poly1305_key(struct poly1305_context *poly1305_state, struct chacha20_ctx *chacha20_state, const uint8_t *key, uint64_t nonce) {
+static void generate_poly1305_key(struct poly1305_context *poly1305_state, struct chacha20_ctx *chacha20_state, const uint8_t *key, const uint8_t *nonce) {
 	uint8_t block[POLY1305_KEY_SIZE] = {0};
 
 	// The method is to call the block function with the following parameters:
 	// - The 256-bit session integrity key is used as the ChaCha20 key.
 	// - The block counter is set to zero.
-	// - The protocol will specify a 96-bit or 64-bit nonce
+	// - The protocol will specify a 96-bit or 64-bit nonce (a 64-bit one is prefixed with 4 zero bytes, like WireGuard does)
 	chacha20_init(chacha20_state, key, nonce);
 
 	// We take the first 256 bits or the serialized state, and use those as the one-time Poly1305 key
@@ -65,13 +65,9 @@ int chacha20poly1305Encrypt(unsigned char *dst, const unsigned char *src, size_t
 	struct chacha20_ctx chacha20_state;
 	uint8_t block[8];
 	size_t padded_len;
-	
-	uint64_t nonce = 0;
-	nonce = *(uint64_t*)(&p_nonce[4]);
 
-		
 	// First, a Poly1305 one-time key is generated from the 256-bit key and nonce using the procedure described in Section 2.6.
-	generate_poly1305_key(&poly1305_state, &chacha20_state, key, nonce);
+	generate_poly1305_key(&poly1305_state, &chacha20_state, key, p_nonce);
 
 	// Next, the ChaCha20 encryption function is called to encrypt the plaintext, using the same key and nonce, and with the initial counter set to 1.
 	chacha20(&chacha20_state, dst, src, src_len);
@@ -116,8 +112,6 @@ int chacha20poly1305Decrypt(unsigned char *dst, const unsigned char *src, size_t
 	size_t padded_len;
 	int dst_len;
 	bool result = false;
-	uint64_t nonce = 0;
-	nonce = *(uint64_t*)(&p_nonce[4]);
 	// Decryption is similar [to encryption] with the following differences:
 	// - The roles of ciphertext and plaintext are reversed, so the ChaCha20 encryption function is applied to the ciphertext, producing the plaintext.
 	// - The Poly1305 function is still run on the AAD and the ciphertext, not the plaintext.
@@ -127,7 +121,7 @@ int chacha20poly1305Decrypt(unsigned char *dst, const unsigned char *src, size_t
 		dst_len = src_len - POLY1305_MAC_SIZE;
 
 		// First, a Poly1305 one-time key is generated from the 256-bit key and nonce using the procedure described in Section 2.6.
-		generate_poly1305_key(&poly1305_state, &chacha20_state, key, nonce);
+		generate_poly1305_key(&poly1305_state, &chacha20_state, key, p_nonce);
 
 		// Calculate the MAC before attempting decryption
 
@@ -165,6 +159,176 @@ int chacha20poly1305Decrypt(unsigned char *dst, const unsigned char *src, size_t
 	return result? 0 : -1;
 }
 
+// Batch AEAD
+// The keystream blocks of a burst are queued as lanes of the multi-buffer block function: block 0 of every message
+// (its Poly1305 one-time key) and then its data blocks (counter 1..n), so small packets share a block function call
+// with each other and big packets fill it alone. Poly1305 stays one message at a time.
+
+#define BATCH_CHUNK_MESSAGES	16 // messages whose poly1305 keys are kept on the stack at once
+
+struct aead_lanes {
+	uint32_t counter[CHACHA20_LANES];
+	uint32_t nonce[3][CHACHA20_LANES];
+	uint8_t *out[CHACHA20_LANES];       // data lanes: output, key lanes: the poly1305 key
+	const uint8_t *in[CHACHA20_LANES];  // data lanes: input, key lanes: NULL
+	uint32_t len[CHACHA20_LANES];
+	int n;
+	uint8_t stream[CHACHA20_LANES * CHACHA20_BLOCK_SIZE];
+};
+
+static void aead_lanes_flush(const uint32_t *key_words, struct aead_lanes *lanes) {
+	int l;
+	uint32_t i;
+
+	if (lanes->n == 0) {
+		return;
+	}
+	chacha20_blocks_lanes(key_words, lanes->counter, &lanes->nonce[0][0], lanes->stream);
+	for (l = 0; l < lanes->n; ++l) {
+		const uint8_t *ks = lanes->stream + (CHACHA20_BLOCK_SIZE * l);
+		if (lanes->in[l] == NULL) {
+			memcpy(lanes->out[l], ks, POLY1305_KEY_SIZE);
+		} else {
+			for (i = 0; i < lanes->len[l]; ++i) {
+				lanes->out[l][i] = lanes->in[l][i] ^ ks[i];
+			}
+		}
+	}
+	lanes->n = 0;
+}
+
+static void aead_lanes_push(const uint32_t *key_words, struct aead_lanes *lanes, const wcrypto_aead_msg_t *msg, uint32_t counter, uint8_t *out, const uint8_t *in, uint32_t len) {
+	const int l = lanes->n;
+	lanes->counter[l] = counter;
+	lanes->nonce[0][l] = U8TO32_LITTLE(msg->nonce + 0);
+	lanes->nonce[1][l] = U8TO32_LITTLE(msg->nonce + 4);
+	lanes->nonce[2][l] = U8TO32_LITTLE(msg->nonce + 8);
+	lanes->out[l] = out;
+	lanes->in[l] = in;
+	lanes->len[l] = len;
+	if (++lanes->n == CHACHA20_LANES) {
+		aead_lanes_flush(key_words, lanes);
+	}
+}
+
+// queues data blocks 1..n of a message, the keystream is xored from in to out
+static void aead_lanes_push_data(const uint32_t *key_words, struct aead_lanes *lanes, const wcrypto_aead_msg_t *msg, uint8_t *out, const uint8_t *in, size_t len) {
+	uint32_t counter = 1;
+	while (len > 0) {
+		uint32_t block_len = len < CHACHA20_BLOCK_SIZE ? (uint32_t)len : CHACHA20_BLOCK_SIZE;
+		aead_lanes_push(key_words, lanes, msg, counter++, out, in, block_len);
+		out += block_len;
+		in += block_len;
+		len -= block_len;
+	}
+}
+
+// 2.8.  AEAD Construction, the tag over (ad, ciphertext)
+static void aead_tag(const uint8_t *poly_key, const uint8_t *ad, size_t ad_len, const uint8_t *ct, size_t ct_len, uint8_t *tag) {
+	struct poly1305_context poly1305_state;
+	uint8_t block[8];
+	size_t padded_len;
+
+	poly1305_init(&poly1305_state, poly_key);
+	poly1305_update(&poly1305_state, ad, ad_len);
+	padded_len = (ad_len + 15) & ~(size_t)15;
+	poly1305_update(&poly1305_state, zero, padded_len - ad_len);
+	poly1305_update(&poly1305_state, ct, ct_len);
+	padded_len = (ct_len + 15) & ~(size_t)15;
+	poly1305_update(&poly1305_state, zero, padded_len - ct_len);
+	U64TO8_LITTLE(block, (uint64_t)ad_len);
+	poly1305_update(&poly1305_state, block, sizeof(block));
+	U64TO8_LITTLE(block, (uint64_t)ct_len);
+	poly1305_update(&poly1305_state, block, sizeof(block));
+	poly1305_finish(&poly1305_state, tag);
+
+	wCryptoZero(&poly1305_state, sizeof(poly1305_state));
+}
+
+static void aead_key_words(uint32_t *key_words, const unsigned char *key) {
+	int i;
+	for (i = 0; i < 8; ++i) {
+		key_words[i] = U8TO32_LITTLE(key + (4 * i));
+	}
+}
+
+int chacha20poly1305EncryptBatch(wcrypto_aead_msg_t *msgs, size_t count, const unsigned char *key) {
+	uint32_t key_words[8];
+	uint8_t poly_keys[BATCH_CHUNK_MESSAGES][POLY1305_KEY_SIZE];
+	struct aead_lanes lanes;
+	size_t first, i, n;
+
+	aead_key_words(key_words, key);
+	lanes.n = 0;
+
+	for (first = 0; first < count; first += n) {
+		n = count - first < BATCH_CHUNK_MESSAGES ? count - first : BATCH_CHUNK_MESSAGES;
+
+		// keys and data blocks of the whole chunk go through the same lanes
+		for (i = 0; i < n; ++i) {
+			wcrypto_aead_msg_t *msg = &msgs[first + i];
+			aead_lanes_push(key_words, &lanes, msg, 0, poly_keys[i], NULL, 0);
+			aead_lanes_push_data(key_words, &lanes, msg, msg->dst, msg->src, msg->src_len);
+		}
+		aead_lanes_flush(key_words, &lanes);
+
+		for (i = 0; i < n; ++i) {
+			wcrypto_aead_msg_t *msg = &msgs[first + i];
+			aead_tag(poly_keys[i], msg->ad, msg->ad_len, msg->dst, msg->src_len, msg->dst + msg->src_len);
+			msg->result = 0;
+		}
+	}
+
+	wCryptoZero(&lanes, sizeof(lanes));
+	wCryptoZero(poly_keys, sizeof(poly_keys));
+	wCryptoZero(key_words, sizeof(key_words));
+	return 0;
+}
+
+int chacha20poly1305DecryptBatch(wcrypto_aead_msg_t *msgs, size_t count, const unsigned char *key) {
+	uint32_t key_words[8];
+	uint8_t poly_keys[BATCH_CHUNK_MESSAGES][POLY1305_KEY_SIZE];
+	uint8_t mac[POLY1305_MAC_SIZE];
+	struct aead_lanes lanes;
+	size_t first, i, n;
+	int failed = 0;
+
+	aead_key_words(key_words, key);
+	lanes.n = 0;
+
+	for (first = 0; first < count; first += n) {
+		n = count - first < BATCH_CHUNK_MESSAGES ? count - first : BATCH_CHUNK_MESSAGES;
+
+		// the tags are checked before anything is decrypted, so only the keys are computed first
+		for (i = 0; i < n; ++i) {
+			aead_lanes_push(key_words, &lanes, &msgs[first + i], 0, poly_keys[i], NULL, 0);
+		}
+		aead_lanes_flush(key_words, &lanes);
+
+		for (i = 0; i < n; ++i) {
+			wcrypto_aead_msg_t *msg = &msgs[first + i];
+			msg->result = -1;
+			if (msg->src_len >= POLY1305_MAC_SIZE) {
+				const size_t ct_len = msg->src_len - POLY1305_MAC_SIZE;
+				aead_tag(poly_keys[i], msg->ad, msg->ad_len, msg->src, ct_len, mac);
+				if (wCryptoEqual(mac, msg->src + ct_len, POLY1305_MAC_SIZE)) {
+					msg->result = 0;
+					aead_lanes_push_data(key_words, &lanes, msg, msg->dst, msg->src, ct_len);
+				}
+			}
+			if (msg->result != 0) {
+				failed++;
+			}
+		}
+		aead_lanes_flush(key_words, &lanes);
+	}
+
+	wCryptoZero(&lanes, sizeof(lanes));
+	wCryptoZero(poly_keys, sizeof(poly_keys));
+	wCryptoZero(key_words, sizeof(key_words));
+	return failed;
+}
+
 // AEAD_XChaCha20_Poly1305
 // XChaCha20-Poly1305 is a variant of the ChaCha20-Poly1305 AEAD construction as defined in [RFC7539] that uses a 192-bit nonce instead of a 96-bit nonce.
 // The algorithm for XChaCha20-Poly1305 is as follows:
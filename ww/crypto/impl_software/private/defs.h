@@ -315,10 +315,15 @@ struct chacha20_ctx {
 	uint32_t state[16];
 };
 
-void chacha20_init(struct chacha20_ctx *ctx, const uint8_t *key, const uint64_t nonce);
+void chacha20_init(struct chacha20_ctx *ctx, const uint8_t *key, const uint8_t *nonce);
 void chacha20(struct chacha20_ctx *ctx, uint8_t *out, const uint8_t *in, uint32_t len);
 void hchacha20(uint8_t *out, const uint8_t *nonce, const uint8_t *key);
 
+// Multi-buffer block function, computes CHACHA20_LANES independent blocks under one key
+// lane i uses block counter counter[i] and nonce words nonce[w * CHACHA20_LANES + i] (w = 0..2), its 64 bytes of keystream go to stream + 64 * i
+#define CHACHA20_LANES			(8)
+void chacha20_blocks_lanes(const uint32_t *key_words, const uint32_t *counter, const uint32_t *nonce, uint8_t *stream);
+
 
 
 
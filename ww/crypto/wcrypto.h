@@ -114,7 +114,7 @@ int performX25519(unsigned char out[32], const unsigned char scalar[32], const u
  * @param srclen Length of the plaintext data in bytes.
  * @param ad Pointer to additional authenticated data (can be NULL).
  * @param ad_len Length of the additional data.
- * @param nonce 12-byte unique nonce.
+ * @param nonce 12-byte unique nonce (the RFC 8439 96-bit nonce, WireGuard puts 4 zero bytes before its counter).
  * @param key 32-byte encryption key.
  * @return 1 on success, 0 on failure.
  */
@@ -131,13 +131,55 @@ int chacha20poly1305Encrypt(unsigned char *dst, const unsigned char *src, size_t
  * @param srclen Length of the ciphertext in bytes.
  * @param ad Pointer to additional authenticated data (can be NULL).
  * @param ad_len Length of the additional data.
- * @param nonce 12-byte unique nonce.
+ * @param nonce 12-byte unique nonce, same layout as for chacha20poly1305Encrypt.
  * @param key 32-byte decryption key.
  * @return 1 on success (authentication valid), 0 on failure.
  */
 int chacha20poly1305Decrypt(unsigned char *dst, const unsigned char *src, size_t src_len, const unsigned char *ad,
                             size_t ad_len, const unsigned char *nonce, const unsigned char *key);
 
+/**
+ * @brief One message of a ChaCha20-Poly1305 batch.
+ *
+ * All the messages of a batch share the key, each has its own buffers and nonce.
+ */
+typedef struct wcrypto_aead_msg_s
+{
+    unsigned char       *dst;       ///< Output, src_len + 16 bytes for encryption, src_len - 16 for decryption.
+    const unsigned char *src;       ///< Input, may be equal to dst for in-place operation.
+    size_t               src_len;   ///< Length of src in bytes (ciphertext length includes the tag when decrypting).
+    const unsigned char *ad;        ///< Additional authenticated data (can be NULL).
+    size_t               ad_len;    ///< Length of the additional data.
+    unsigned char        nonce[12]; ///< 12-byte unique nonce, all 12 bytes are used like the single calls do.
+    int                  result;    ///< Set by the batch call, 0 on success and -1 on failure.
+} wcrypto_aead_msg_t;
+
+/**
+ * @brief Encrypt a burst of messages with ChaCha20-Poly1305 under one key.
+ *
+ * Same output as calling chacha20poly1305Encrypt for every message, the key setup is done once and the software
+ * backend computes the keystream blocks of several messages at a time.
+ *
+ * @param msgs Array of messages, the result field of each one is set.
+ * @param count Number of messages.
+ * @param key 32-byte encryption key.
+ * @return Number of messages that failed (0 on success).
+ */
+int chacha20poly1305EncryptBatch(wcrypto_aead_msg_t *msgs, size_t count, const unsigned char *key);
+
+/**
+ * @brief Decrypt and verify a burst of messages with ChaCha20-Poly1305 under one key.
+ *
+ * Same output as calling chacha20poly1305Decrypt for every message, a message that fails authentication gets
+ * result -1 and the content of its dst is unspecified; the other messages are not affected.
+ *
+ * @param msgs Array of messages, the result field of each one is set.
+ * @param count Number of messages.
+ * @param key 32-byte decryption key.
+ * @return Number of messages that failed (0 on success).
+ */
+int chacha20poly1305DecryptBatch(wcrypto_aead_msg_t *msgs, size_t count, const unsigned char *key);
+
 /**
  * @brief Encrypt using XChaCha20-Poly1305 AEAD.
  *
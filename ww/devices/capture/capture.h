@@ -3,6 +3,8 @@
 #include "wlibc.h"
 
 #include "buffer_pool.h"
+#include "device_backpressure.h"
+#include "global_state.h"
 #include "master_pool.h"
 #include "wloop.h"
 #include "worker.h"
@@ -39,7 +41,9 @@ typedef struct capture_device_s
     char           *bringdown_command;
     int             netfilter_queue_number;
     
-    atomic_int      packets_queued;
+    device_backpressure_t backpressure; // bounds what the reader thread queues on each worker
+
+    enum packet_distribution_policy_e distribution_policy; // how the reader thread picks the worker of a packet
     atomic_bool     running;
     atomic_bool     up;
 
@@ -49,7 +53,8 @@ bool caputredeviceBringUp(capture_device_t *cdev);
 bool caputredeviceBringDown(capture_device_t *cdev);
 bool caputredeviceWrite(capture_device_t *cdev, sbuf_t *buf);
 
-capture_device_t *caputredeviceCreate(const char *name, const char *capture_ip, void *userdata,
+// queue_limit bounds the packets the reader thread queues on each worker (kDeviceBackpressureDefaultLimit)
+capture_device_t *caputredeviceCreate(const char *name, const char *capture_ip, int queue_limit, void *userdata,
                                       CaptureReadEventHandle cb);
 
 void capturedeviceDestroy(capture_device_t *cdev);
@@ -56,16 +56,20 @@ static void localThreadEventReceived(wevent_t *ev)
     struct msg_event *msg = weventGetUserdata(ev);
     wid_t             tid = (wid_t) (wloopGetWid(weventGetLoop(ev)));
 
-    atomicSubExplicit(&(msg->cdev->packets_queued), 1, memory_order_release);
-
     msg->cdev->read_event_callback(msg->cdev, msg->cdev->userdata, msg->buf, tid);
+    devicebackpressureRelease(&(msg->cdev->backpressure), tid, 1);
 
     masterpoolReuseItems(msg->cdev->reader_message_pool, (void **) &msg, 1, msg->cdev);
 }
 
 static void distributePacketPayload(capture_device_t *cdev, wid_t target_wid, sbuf_t *buf)
 {
-    atomicAddExplicit(&(cdev->packets_queued), 1, memory_order_release);
+    // blocks while the target worker is saturated, the packet is dropped only when the device is going down
+    if (! devicebackpressureAcquire(&(cdev->backpressure), target_wid, 1, cdev->linux_pipe_fds[0]))
+    {
+        bufferpoolReuseBuffer(cdev->reader_buffer_pool, buf);
+        return;
+    }
 
     struct msg_event *msg;
     masterpoolGetItems(cdev->reader_message_pool, (const void **) &(msg), 1, cdev);
@@ -312,11 +316,6 @@ static WTHREAD_ROUTINE(routineReadFromCapture) // NOLINT
 
     while (atomicLoadExplicit(&(cdev->running), memory_order_relaxed))
     {
-        if (atomicLoadExplicit(&(cdev->packets_queued), memory_order_acquire) > 256)
-        {
-            ww_msleep(1);
-            continue;
-        }
         buf = bufferpoolGetSmallBuffer(cdev->reader_buffer_pool);
 
         buf     = sbufReserveSpace(buf, kReadPacketSize);
@@ -350,7 +349,9 @@ static WTHREAD_ROUTINE(routineReadFromCapture) // NOLINT
 
                 sbufSetLength(buf, nread);
 
-                distributePacketPayload(cdev, getNextDistributionWID(), buf);
+                distributePacketPayload(
+                    cdev, getPacketDistributionWID(cdev->distribution_policy, sbufGetRawPtr(buf), (uint32_t) nread),
+                    buf);
             }
         }
     }
@@ -477,7 +478,7 @@ bool caputredeviceBringDown(capture_device_t *cdev)
     return true;
 }
 
-capture_device_t *caputredeviceCreate(const char *name, const char *capture_ip, void *userdata,
+capture_device_t *caputredeviceCreate(const char *name, const char *capture_ip, int queue_limit, void *userdata,
                                       CaptureReadEventHandle cb)
 {
 
@@ -571,15 +572,31 @@ capture_device_t *caputredeviceCreate(const char *name, const char *capture_ip,
                             .read_event_callback = cb,
                             .userdata            = userdata,
                             .reader_message_pool = masterpoolCreateWithCapacity(kMasterMessagePoolsbufGetLeftCapacity),
-                            .packets_queued      = 0,
+                            .distribution_policy = kPacketDistributionFiveTuple,
                             .netfilter_queue_number = queue_number,
                             .bringup_command        = bringup_cmd,
                             .bringdown_command      = bringdown_cmd,
                             .reader_buffer_pool     = reader_bpool,
                             .writer_buffer_pool     = writer_bpool};
+
+    if (! devicebackpressureInit(&(cdev->backpressure), cdev->name, queue_limit))
+    {
+        LOGE("CaptureDevice: failed to initialize reader backpressure");
+        memoryFree(cdev->name);
+        memoryFree(cdev->bringup_command);
+        memoryFree(cdev->bringdown_command);
+        bufferpoolDestroy(cdev->reader_buffer_pool);
+        bufferpoolDestroy(cdev->writer_buffer_pool);
+        masterpoolDestroy(cdev->reader_message_pool);
+        close(cdev->handle);
+        memoryFree(cdev);
+        return NULL;
+    }
+
     if (pipe(cdev->linux_pipe_fds) != 0)
     {
         LOGE("CaptureDevice: failed to create pipe for linux_pipe_fds");
+        devicebackpressureDestroy(&(cdev->backpressure));
         memoryFree(cdev->name);
         memoryFree(cdev->bringup_command);
         memoryFree(cdev->bringdown_command);
@@ -609,6 +626,7 @@ void capturedeviceDestroy(capture_device_t *cdev)
     bufferpoolDestroy(cdev->writer_buffer_pool);
     masterpoolMakeEmpty(cdev->reader_message_pool,NULL);
     masterpoolDestroy(cdev->reader_message_pool);
+    devicebackpressureDestroy(&(cdev->backpressure));
     close(cdev->handle);
     memoryFree(cdev);
 }
@@ -0,0 +1,160 @@
+#include "device_backpressure.h"
+#include "global_state.h"
+#include "loggers/internal_logger.h"
+
+#include "wmutex.h"
+
+#include <poll.h>
+
+#if HAVE_EVENTFD
+#include <sys/eventfd.h>
+#endif
+
+static struct
+{
+    wmutex_t               mutex;
+    device_backpressure_t *head;
+
+} registry;
+
+static wonce_t registry_once = WONCE_INIT;
+
+static void initRegistry(void)
+{
+    mutexInit(&registry.mutex);
+}
+
+bool devicebackpressureInit(device_backpressure_t *bp, const char *name, int limit)
+{
+    *bp = (device_backpressure_t) {.limit = limit, .workers_count = getWorkersCount()};
+
+#if HAVE_EVENTFD
+    int efd = eventfd(0, EFD_NONBLOCK);
+    if (efd < 0)
+    {
+        LOGE("DeviceBackpressure: eventfd create failed");
+        return false;
+    }
+    bp->wakeup_fds[0] = bp->wakeup_fds[1] = efd;
+#else
+    if (pipe(bp->wakeup_fds) != 0)
+    {
+        LOGE("DeviceBackpressure: pipe create failed");
+        return false;
+    }
+    nonBlocking(bp->wakeup_fds[0]);
+    nonBlocking(bp->wakeup_fds[1]);
+#endif
+
+    bp->worker_queued = memoryAllocate(sizeof(atomic_int) * bp->workers_count);
+    for (wid_t i = 0; i < bp->workers_count; i++)
+    {
+        atomicStoreRelaxed(&(bp->worker_queued[i]), 0);
+    }
+    bp->name = stringDuplicate(name);
+
+    wonce(&registry_once, initRegistry);
+    mutexLock(&registry.mutex);
+    bp->next      = registry.head;
+    registry.head = bp;
+    mutexUnlock(&registry.mutex);
+
+    return true;
+}
+
+void devicebackpressureDestroy(device_backpressure_t *bp)
+{
+    mutexLock(&registry.mutex);
+    for (device_backpressure_t **it = &registry.head; *it; it = &(*it)->next)
+    {
+        if (*it == bp)
+        {
+            *it = bp->next;
+            break;
+        }
+    }
+    mutexUnlock(&registry.mutex);
+    memoryFree(bp->name);
+    bp->name = NULL;
+
+    close(bp->wakeup_fds[0]);
+#if ! HAVE_EVENTFD
+    close(bp->wakeup_fds[1]);
+#endif
+    memoryFree(bp->worker_queued);
+    bp->worker_queued = NULL;
+}
+
+static void drainWakeups(device_backpressure_t *bp)
+{
+    uint64_t drain[8];
+    while (read(bp->wakeup_fds[0], &drain, sizeof(drain)) > 0)
+    {
+    }
+}
+
+bool devicebackpressureAcquire(device_backpressure_t *bp, wid_t wid, uint32_t count, int stop_fd)
+{
+    atomic_int *queued = &(bp->worker_queued[wid]);
+
+    // a batch larger than the limit is still accepted into an empty queue, otherwise it would never fit
+    while (atomicLoadExplicit(queued, memory_order_acquire) > 0 &&
+           atomicLoadExplicit(queued, memory_order_acquire) + (int) count > bp->limit)
+    {
+        atomicStoreExplicit(&(bp->reader_waiting), true, memory_order_seq_cst);
+
+        // the worker may have drained between our check and the flag store, it checks the flag after releasing
+        int now = atomicLoadExplicit(queued, memory_order_seq_cst);
+        if (now == 0 || now + (int) count <= bp->limit)
+        {
+            atomicStoreRelaxed(&(bp->reader_waiting), false);
+            break;
+        }
+
+        atomicIncRelaxed(&(bp->stalls));
+
+        struct pollfd fds[2];
+        fds[0].fd     = bp->wakeup_fds[0];
+        fds[0].events = POLLIN;
+        fds[1].fd     = stop_fd;
+        fds[1].events = POLLIN;
+
+        int ret = poll(fds, 2, -1);
+        atomicStoreRelaxed(&(bp->reader_waiting), false);
+
+        if (ret > 0 && (fds[1].revents & POLLIN))
+        {
+            return false;
+        }
+        if (ret > 0 && (fds[0].revents & POLLIN))
+        {
+            drainWakeups(bp);
+        }
+    }
+
+    atomicAddExplicit(queued, (int) count, memory_order_release);
+    return true;
+}
+
+void devicebackpressureRelease(device_backpressure_t *bp, wid_t wid, uint32_t count)
+{
+    atomicSubExplicit(&(bp->worker_queued[wid]), (int) count, memory_order_seq_cst);
+
+    if (atomicLoadExplicit(&(bp->reader_waiting), memory_order_seq_cst))
+    {
+        uint64_t one = 1;
+        ssize_t  ret = write(bp->wakeup_fds[1], &one, sizeof(one));
+        discard ret;
+    }
+}
+
+void devicebackpressureForEach(DeviceBackpressureVisitor visitor, void *userdata)
+{
+    wonce(&registry_once, initRegistry);
+    mutexLock(&registry.mutex);
+    for (device_backpressure_t *bp = registry.head; bp; bp = bp->next)
+    {
+        visitor(bp, userdata);
+    }
+    mutexUnlock(&registry.mutex);
+}
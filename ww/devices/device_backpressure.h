@@ -0,0 +1,95 @@
+#pragma once
+
+#include "wlibc.h"
+
+#include "worker.h"
+
+/*
+    Backpressure between a device reader thread and the workers it feeds
+
+    every worker has a bounded inbound budget (in packets), the reader accounts what it posts and the worker
+    returns the budget once the packets are consumed. when the target worker is full the reader blocks on a
+    wakeup fd (eventfd when available) instead of sleeping, and the worker signals it as soon as it drains.
+
+    the wait also watches the device stop fd, so bringing the device down never hangs on a saturated worker
+
+    every initialized state is kept in a registry so the metrics manager can export the occupancy and the stalls
+    of each device
+*/
+
+enum
+{
+    kDeviceBackpressureDefaultLimit = 256
+};
+
+typedef struct device_backpressure_s
+{
+    atomic_int   *worker_queued;  // packets posted to each worker and not consumed yet
+    atomic_ullong stalls;         // how many times the reader had to wait for a worker
+    atomic_bool   reader_waiting; // set by the reader right before it blocks
+    int           wakeup_fds[2];  // eventfd (both indexes) or pipe
+    int           limit;          // per worker bound
+    wid_t         workers_count;
+    char         *name;           // of the device, for the metrics
+
+    struct device_backpressure_s *next; // registry link
+
+} device_backpressure_t;
+
+typedef void (*DeviceBackpressureVisitor)(device_backpressure_t *bp, void *userdata);
+
+/**
+ * @brief Initializes the backpressure state for all workers and adds it to the registry.
+ * @param bp The backpressure state.
+ * @param name The device name, copied.
+ * @param limit Max packets queued per worker.
+ * @return true on success.
+ */
+bool devicebackpressureInit(device_backpressure_t *bp, const char *name, int limit);
+
+/**
+ * @brief Removes the state from the registry and releases the wakeup fds and counters.
+ * @param bp The backpressure state.
+ */
+void devicebackpressureDestroy(device_backpressure_t *bp);
+
+/**
+ * @brief Calls visitor for every initialized state, no state is destroyed until it returns.
+ * @param visitor The callback.
+ * @param userdata Passed to the visitor.
+ */
+void devicebackpressureForEach(DeviceBackpressureVisitor visitor, void *userdata);
+
+/**
+ * @brief Reader side, blocks until the worker has room for count packets or stop_fd becomes readable.
+ * @param bp The backpressure state.
+ * @param wid The target worker.
+ * @param count Number of packets about to be posted.
+ * @param stop_fd The device stop fd.
+ * @return false if the reader must exit (stop_fd fired), true if the packets were accounted.
+ */
+bool devicebackpressureAcquire(device_backpressure_t *bp, wid_t wid, uint32_t count, int stop_fd);
+
+/**
+ * @brief Worker side, returns the budget of consumed packets and wakes the reader if it waits.
+ * @param bp The backpressure state.
+ * @param wid The worker that consumed the packets.
+ * @param count Number of consumed packets.
+ */
+void devicebackpressureRelease(device_backpressure_t *bp, wid_t wid, uint32_t count);
+
+/**
+ * @brief Current number of packets queued for a worker (occupancy metric).
+ */
+static inline int devicebackpressureGetOccupancy(device_backpressure_t *bp, wid_t wid)
+{
+    return atomicLoadRelaxed(&(bp->worker_queued[wid]));
+}
+
+/**
+ * @brief Number of times the reader was blocked by a saturated worker (metric).
+ */
+static inline unsigned long long devicebackpressureGetStalls(device_backpressure_t *bp)
+{
+    return atomicLoadRelaxed(&(bp->stalls));
+}
@@ -0,0 +1,39 @@
+#include "device_settings.h"
+#include "loggers/internal_logger.h"
+#include "utils/json_helpers.h"
+
+bool deviceParseQueueSettings(const cJSON *settings, const char *node_name, int default_limit, int *queue_limit,
+                              enum packet_distribution_policy_e *policy)
+{
+    getIntFromJsonObjectOrDefault(queue_limit, settings, "queue-limit", default_limit);
+
+    if (*queue_limit < 1)
+    {
+        LOGF("JSON Error: %s->settings->queue-limit (int field) : The value must be at least 1", node_name);
+        return false;
+    }
+
+    dynamic_value_t distribution_dv =
+        parseDynamicNumericValueFromJsonObject(settings, "distribution", 3, "five-tuple", "source-ip", "round-robin");
+
+    bool valid = true;
+
+    if (distribution_dv.status == kDvsEmpty && cJSON_GetObjectItemCaseSensitive(settings, "distribution") == NULL)
+    {
+        *policy = kPacketDistributionFiveTuple;
+    }
+    else if (distribution_dv.status >= kDvsFirstOption && distribution_dv.status < kDvsFirstOption + 3)
+    {
+        *policy = (enum packet_distribution_policy_e) (distribution_dv.status - kDvsFirstOption);
+    }
+    else
+    {
+        LOGF("JSON Error: %s->settings->distribution (string field) : must be one of five-tuple, source-ip "
+             "or round-robin",
+             node_name);
+        valid = false;
+    }
+    dynamicvalueDestroy(distribution_dv);
+
+    return valid;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "wlibc.h"
+
+#include "cJSON.h"
+#include "global_state.h"
+
+/*
+    Settings shared by the nodes that read packets from a device (TunDevice, RawSocket)
+
+    queue-limit  : max packets queued on a worker before the device reader blocks (backpressure)
+    distribution : which worker receives a packet read from the device
+*/
+
+/**
+ * @brief Parses the "queue-limit" and "distribution" fields of a device node.
+ * @param settings The node settings object.
+ * @param node_name Name of the node type, used in the error messages.
+ * @param default_limit Queue limit used when the field is missing.
+ * @param queue_limit Receives the queue limit.
+ * @param policy Receives the distribution policy.
+ * @return false if a field is invalid, the error is already logged.
+ */
+bool deviceParseQueueSettings(const cJSON *settings, const char *node_name, int default_limit, int *queue_limit,
+                              enum packet_distribution_policy_e *policy);
@@ -3,6 +3,7 @@
 #include "wlibc.h"
 
 #include "buffer_pool.h"
+#include "global_state.h"
 #include "master_pool.h"
 #include "wloop.h"
 #include "worker.h"
@@ -32,6 +33,8 @@ typedef struct raw_device_s
     RawReadEventHandle read_event_callback;
 
     struct wchan_s *writer_buffer_channel;
+
+    enum packet_distribution_policy_e distribution_policy; // how the reader thread picks the worker of a packet
     atomic_bool     running;
     atomic_bool     up;
 
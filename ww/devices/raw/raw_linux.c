@@ -107,7 +107,8 @@ static WTHREAD_ROUTINE(routineReadFromRaw) // NOLINT
 
         sbufSetLength(buf, nread);
 
-        distributePacketPayload(rdev, getNextDistributionWID(), buf);
+        distributePacketPayload(
+            rdev, getPacketDistributionWID(rdev->distribution_policy, sbufGetRawPtr(buf), (uint32_t) nread), buf);
     }
 
     return 0;
@@ -289,6 +290,7 @@ raw_device_t *rawdeviceCreate(const char *name, uint32_t mark, void *userdata, R
                             .read_event_callback   = cb,
                             .userdata              = userdata,
                             .writer_buffer_channel = NULL,
+                            .distribution_policy   = kPacketDistributionFiveTuple,
                             .reader_message_pool   = reader_message_pool,
                             .reader_buffer_pool    = reader_bpool,
                             .writer_buffer_pool    = writer_bpool};
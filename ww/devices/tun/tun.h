@@ -3,6 +3,7 @@
 #include "wlibc.h"
 
 #include "buffer_pool.h"
+#include "global_state.h"
 #include "master_pool.h"
 #include "wloop.h"
 #include "worker.h"
@@ -14,7 +15,8 @@
 #include <mstcpip.h>
 #include <winternl.h>
 #include <ws2ipdef.h>
-
+#else
+#include "device_backpressure.h"
 #endif
 
 #define TUN_LOG_EVERYTHING false
@@ -22,13 +24,17 @@
 struct tun_device_s;
 
 typedef void (*TunReadEventHandle)(struct tun_device_s *tdev, void *userdata, sbuf_t *buf, wid_t tid);
+typedef void (*TunBatchPostHandle)(struct tun_device_s *tdev, wid_t target_wid, sbuf_t **bufs, uint32_t count);
 
 enum
 {
     kReadPacketSize                       = 1500,
     kMasterMessagePoolsbufGetLeftCapacity = 8,
     kTunWriteChannelQueueMax              = 256,
-    kMaxReadQueueSize                     = 100
+    kMaxReadQueueSize                     = 100,
+    kTunDefaultReadBatchSize              = 32,
+    kTunDefaultQueueLimit                 = 256, // packets the reader thread may queue on one worker
+    kTunOffloadMaxSegments                = 64 // super-packets splitting into more segments are dropped
 };
 
 typedef struct tun_device_s
@@ -40,9 +46,15 @@ typedef struct tun_device_s
     HANDLE                   quit_event;
     MIB_UNICASTIPADDRESS_ROW address_row;
 #else
-    char *name;
-    int   handle;
-    int   linux_pipe_fds[2]; // used for signaling read thread to stop
+    char       *name;
+    int         handle;
+    int         linux_pipe_fds[2]; // used for signaling read thread to stop
+    atomic_int *queue_handles;     // multi-queue mode, one queue fd per worker, only used by it, -1 once down
+    wid_t       queue_count;       // 0 when the device runs a single queue with reader / writer threads
+    bool        offload;           // IFF_VNET_HDR with TSO/USO and checksum offload (linux only)
+    uint8_t    *offload_scratch;   // one 64KB frame area per reading thread, used when offload is enabled
+
+    device_backpressure_t backpressure; // bounds what the reader thread queues on each worker
 #endif
 
     void     *userdata;
@@ -59,7 +71,9 @@ typedef struct tun_device_s
     TunReadEventHandle read_event_callback;
 
     struct wchan_s *writer_buffer_channel;
-    atomic_int      packets_queued;
+    uint32_t        read_batch_size; // packets drained per reader wakeup, [1 - kMaxReadQueueSize]
+
+    enum packet_distribution_policy_e distribution_policy; // how the reader thread picks the worker of a packet
 
     atomic_bool running;
     bool        up;
@@ -68,9 +82,16 @@ typedef struct tun_device_s
 
 // Function prototypes
 tun_device_t *tundeviceCreate(const char *name, bool offload, void *userdata, TunReadEventHandle cb);
+#ifdef OS_LINUX
+tun_device_t *tundeviceCreateMultiQueue(const char *name, bool offload, void *userdata, TunReadEventHandle cb);
+#endif
 void          tundeviceDestroy(tun_device_t *tdev);
 bool          tundeviceBringUp(tun_device_t *tdev);
 bool          tundeviceBringDown(tun_device_t *tdev);
 bool          tundeviceAssignIP(tun_device_t *tdev, const char *ip_presentation, unsigned int subnet);
 bool          tundeviceUnAssignIP(tun_device_t *tdev, const char *ip_presentation, unsigned int subnet);
 bool          tundeviceWrite(tun_device_t *tdev, sbuf_t *buf);
+
+// shared by the platform reader threads, groups the batch per target worker (distribution_policy) and calls post
+// once per group, entries of bufs are consumed
+void tundeviceDistributeBatch(tun_device_t *tdev, sbuf_t **bufs, uint32_t count, TunBatchPostHandle post);
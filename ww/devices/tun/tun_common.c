@@ -0,0 +1,41 @@
+#include "tun.h"
+
+// Hand a batch to the workers, the flow hash is calculated here on the reader thread and packets are grouped
+// so each worker receives its whole share of the batch with a single post call
+void tundeviceDistributeBatch(tun_device_t *tdev, sbuf_t **bufs, uint32_t count, TunBatchPostHandle post)
+{
+    assert(count <= kMaxReadQueueSize);
+
+    if (tdev->distribution_policy == kPacketDistributionRoundRobin)
+    {
+        post(tdev, getNextDistributionWID(), bufs, count);
+        return;
+    }
+
+    wid_t   wids[kMaxReadQueueSize];
+    sbuf_t *group[kMaxReadQueueSize];
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        wids[i] = getPacketDistributionWID(tdev->distribution_policy, sbufGetRawPtr(bufs[i]), sbufGetLength(bufs[i]));
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (bufs[i] == NULL)
+        {
+            continue;
+        }
+        wid_t    target = wids[i];
+        uint32_t n      = 0;
+        for (uint32_t k = i; k < count; k++)
+        {
+            if (bufs[k] != NULL && wids[k] == target)
+            {
+                group[n++] = bufs[k];
+                bufs[k]    = NULL;
+            }
+        }
+        post(tdev, target, &group[0], n);
+    }
+}
@@ -16,15 +16,25 @@
 #include <linux/if.h>
 #include <linux/if_tun.h>
 #include <linux/ipv6.h>
+#include <linux/virtio_net.h>
+#include <sys/uio.h>
 #else // bsd
 #include <net/if.h>
 #include <net/if_tun.h>
 #endif
 
+#ifdef OS_LINUX
+enum
+{
+    kTunOffloadReadSize = 65535 + sizeof(struct virtio_net_hdr) // biggest frame a vnet_hdr queue hands us
+};
+#endif
+
 struct msg_event
 {
     tun_device_t *tdev;
-    sbuf_t       *buf;
+    sbuf_t       *bufs[kMaxReadQueueSize];
+    uint32_t      count;
 };
 
 // Allocate memory for message pool handle
@@ -43,27 +53,43 @@ static void destroyTunMsgPoolHandle(master_pool_t *pool, master_pool_item_t *ite
     memoryFree(item);
 }
 
-// Handle local thread event
+// Handle local thread event, the message carries a whole batch of packets
 static void localThreadEventReceived(wevent_t *ev)
 {
 
     struct msg_event *msg = weventGetUserdata(ev);
     wid_t             wid = (wid_t) (wloopGetWid(weventGetLoop(ev)));
-    atomicSubExplicit(&(msg->tdev->packets_queued), 1, memory_order_release);
 
-    msg->tdev->read_event_callback(msg->tdev, msg->tdev->userdata, msg->buf, wid);
+    for (uint32_t i = 0; i < msg->count; i++)
+    {
+        msg->tdev->read_event_callback(msg->tdev, msg->tdev->userdata, msg->bufs[i], wid);
+    }
+    devicebackpressureRelease(&(msg->tdev->backpressure), wid, msg->count);
     masterpoolReuseItems(msg->tdev->reader_message_pool, (void **) &msg, 1, msg->tdev);
 }
 
-// Distribute packet payload to the target thread
-static void distributePacketPayload(tun_device_t *tdev, wid_t target_wid, sbuf_t *buf)
+// Distribute a batch of packets to the target thread with a single event
+// blocks while the target worker is saturated, packets are dropped only when the device is going down
+static void distributePacketPayloads(tun_device_t *tdev, wid_t target_wid, sbuf_t **bufs, uint32_t count)
 {
-    atomicAddExplicit(&(tdev->packets_queued), 1, memory_order_release);
+    if (! devicebackpressureAcquire(&(tdev->backpressure), target_wid, count, tdev->linux_pipe_fds[0]))
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            bufferpoolReuseBuffer(tdev->reader_buffer_pool, bufs[i]);
+        }
+        return;
+    }
 
     struct msg_event *msg;
     masterpoolGetItems(tdev->reader_message_pool, (const void **) &(msg), 1, tdev);
 
-    *msg = (struct msg_event) {.tdev = tdev, .buf = buf};
+    msg->tdev  = tdev;
+    msg->count = count;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        msg->bufs[i] = bufs[i];
+    }
 
     wevent_t ev;
     memorySet(&ev, 0, sizeof(ev));
@@ -73,12 +99,292 @@ static void distributePacketPayload(tun_device_t *tdev, wid_t target_wid, sbuf_t
     wloopPostEvent(getWorkerLoop(target_wid), &ev);
 }
 
+#ifdef OS_LINUX
+// Ones complement sum over big endian 16 bit words, used to finish checksums the kernel left to us
+static uint32_t tunChecksumAdd(uint32_t sum, const uint8_t *data, uint32_t len)
+{
+    while (len > 1)
+    {
+        sum += (uint32_t) ((data[0] << 8) | data[1]);
+        data += 2;
+        len -= 2;
+    }
+    if (len)
+    {
+        sum += (uint32_t) (data[0] << 8);
+    }
+    return sum;
+}
+
+static uint16_t tunChecksumFinish(uint32_t sum)
+{
+    while (sum >> 16)
+    {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+    return (uint16_t) ~sum;
+}
+
+static void tunWriteBE16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t) (v >> 8);
+    p[1] = (uint8_t) v;
+}
+
+static uint16_t tunReadBE16(const uint8_t *p)
+{
+    return (uint16_t) ((p[0] << 8) | p[1]);
+}
+
+static sbuf_t *tunGetBufferFor(buffer_pool_t *pool, uint32_t len)
+{
+    sbuf_t *buf = bufferpoolGetSmallBuffer(pool);
+    if (sbufGetRightCapacity(buf) >= len)
+    {
+        return buf;
+    }
+    bufferpoolReuseBuffer(pool, buf);
+    buf = bufferpoolGetLargeBuffer(pool);
+    if (sbufGetRightCapacity(buf) >= len)
+    {
+        return buf;
+    }
+    bufferpoolReuseBuffer(pool, buf);
+    return NULL;
+}
+
+// Splits a TSO/USO super-packet into MTU sized IP packets, headers are rebuilt and checksummed per segment
+static int tunOffloadSegment(buffer_pool_t *pool, const struct virtio_net_hdr *vh, const uint8_t *pkt, uint32_t len,
+                             sbuf_t **out, uint32_t out_cap)
+{
+    const uint8_t gso_type  = vh->gso_type & (uint8_t) ~VIRTIO_NET_HDR_GSO_ECN;
+    const bool    is_v4     = (pkt[0] >> 4) == 4;
+    const bool    is_tcp    = gso_type == VIRTIO_NET_HDR_GSO_TCPV4 || gso_type == VIRTIO_NET_HDR_GSO_TCPV6;
+    const uint32_t l4_off   = vh->csum_start;
+    const uint32_t gso_size = vh->gso_size;
+
+    if (! (vh->flags & VIRTIO_NET_HDR_F_NEEDS_CSUM) || gso_size == 0 || l4_off + (is_tcp ? 20U : 8U) > len)
+    {
+        return -1;
+    }
+
+    const uint32_t l4_hlen  = is_tcp ? (uint32_t) (pkt[l4_off + 12] >> 4) * 4 : 8;
+    const uint32_t hdr_len  = l4_off + l4_hlen;
+    if (hdr_len > len)
+    {
+        return -1;
+    }
+    const uint32_t payload   = len - hdr_len;
+    const uint32_t seg_count = (payload + gso_size - 1) / gso_size;
+    if (seg_count == 0 || seg_count > out_cap)
+    {
+        LOGW("TunDevice: dropped a super-packet of %u segments, limit is %u", seg_count, out_cap);
+        return -1;
+    }
+
+    const uint16_t ip_id = is_v4 ? tunReadBE16(pkt + 4) : 0;
+    const uint32_t seq   = is_tcp ? ((uint32_t) tunReadBE16(pkt + l4_off + 4) << 16) | tunReadBE16(pkt + l4_off + 6)
+                                  : 0;
+
+    for (uint32_t i = 0; i < seg_count; i++)
+    {
+        const uint32_t seg_payload = (i == seg_count - 1) ? payload - (i * gso_size) : gso_size;
+        const uint32_t seg_len     = hdr_len + seg_payload;
+
+        sbuf_t *buf = tunGetBufferFor(pool, seg_len);
+        if (buf == NULL)
+        {
+            for (uint32_t k = 0; k < i; k++)
+            {
+                bufferpoolReuseBuffer(pool, out[k]);
+            }
+            return -1;
+        }
+        sbufSetLength(buf, seg_len);
+        uint8_t *seg = sbufGetMutablePtr(buf);
+        memoryCopy(seg, pkt, hdr_len);
+        memoryCopy(seg + hdr_len, pkt + hdr_len + (i * gso_size), seg_payload);
+
+        uint8_t *l4      = seg + l4_off;
+        uint32_t l4_len  = seg_len - l4_off;
+        uint32_t pseudo  = 0;
+
+        if (is_v4)
+        {
+            const uint32_t ihl = (uint32_t) (seg[0] & 0x0F) * 4;
+            tunWriteBE16(seg + 2, (uint16_t) seg_len);
+            tunWriteBE16(seg + 4, (uint16_t) (ip_id + i));
+            tunWriteBE16(seg + 10, 0);
+            tunWriteBE16(seg + 10, tunChecksumFinish(tunChecksumAdd(0, seg, ihl)));
+            pseudo = tunChecksumAdd(pseudo, seg + 12, 8);
+            pseudo += (uint32_t) seg[9];
+        }
+        else
+        {
+            tunWriteBE16(seg + 4, (uint16_t) (seg_len - 40));
+            pseudo = tunChecksumAdd(pseudo, seg + 8, 32);
+            pseudo += (uint32_t) (is_tcp ? IPPROTO_TCP : IPPROTO_UDP);
+        }
+        pseudo += l4_len;
+
+        if (is_tcp)
+        {
+            const uint32_t seg_seq = seq + (i * gso_size);
+            tunWriteBE16(l4 + 4, (uint16_t) (seg_seq >> 16));
+            tunWriteBE16(l4 + 6, (uint16_t) seg_seq);
+            if (i != seg_count - 1)
+            {
+                l4[13] &= (uint8_t) ~(0x01 | 0x08); // FIN and PSH belong to the last segment only
+            }
+            tunWriteBE16(l4 + 16, 0);
+            tunWriteBE16(l4 + 16, tunChecksumFinish(tunChecksumAdd(pseudo, l4, l4_len)));
+        }
+        else
+        {
+            tunWriteBE16(l4 + 4, (uint16_t) l4_len);
+            tunWriteBE16(l4 + 6, 0);
+            uint16_t csum = tunChecksumFinish(tunChecksumAdd(pseudo, l4, l4_len));
+            tunWriteBE16(l4 + 6, csum == 0 ? 0xFFFF : csum);
+        }
+
+        out[i] = buf;
+    }
+    return (int) seg_count;
+}
+
+// Turns one vnet_hdr frame into plain IP packets, returns how many were stored in out or -1 if it was dropped
+static int tunOffloadSplitFrame(buffer_pool_t *pool, const uint8_t *frame, uint32_t frame_len, sbuf_t **out,
+                                uint32_t out_cap)
+{
+    struct virtio_net_hdr vh;
+    if (frame_len <= sizeof(vh))
+    {
+        return -1;
+    }
+    memoryCopy(&vh, frame, sizeof(vh));
+
+    const uint8_t *pkt = frame + sizeof(vh);
+    uint32_t       len = frame_len - (uint32_t) sizeof(vh);
+
+    switch (vh.gso_type & (uint8_t) ~VIRTIO_NET_HDR_GSO_ECN)
+    {
+    case VIRTIO_NET_HDR_GSO_NONE: {
+        sbuf_t *buf = tunGetBufferFor(pool, len);
+        if (buf == NULL)
+        {
+            return -1;
+        }
+        sbufSetLength(buf, len);
+        uint8_t *p = sbufGetMutablePtr(buf);
+        memoryCopy(p, pkt, len);
+
+        if (vh.flags & VIRTIO_NET_HDR_F_NEEDS_CSUM)
+        {
+            // the checksum field already holds the pseudo header sum, fold the rest of the segment into it
+            if ((uint32_t) vh.csum_start + vh.csum_offset + 2 > len)
+            {
+                bufferpoolReuseBuffer(pool, buf);
+                return -1;
+            }
+            uint16_t csum = tunChecksumFinish(tunChecksumAdd(0, p + vh.csum_start, len - vh.csum_start));
+            tunWriteBE16(p + vh.csum_start + vh.csum_offset, csum);
+        }
+        out[0] = buf;
+        return 1;
+    }
+    case VIRTIO_NET_HDR_GSO_TCPV4:
+    case VIRTIO_NET_HDR_GSO_TCPV6:
+#ifdef VIRTIO_NET_HDR_GSO_UDP_L4
+    case VIRTIO_NET_HDR_GSO_UDP_L4:
+#endif
+        return tunOffloadSegment(pool, &vh, pkt, len, out, out_cap);
+
+    default:
+        return -1;
+    }
+}
+#endif
+
+// Reads one frame from a tun queue into bufs, with offload enabled a frame may carry many packets
+// returns the number of packets stored, 0 when the queue is drained and -1 on end of file or a critical error
+static int readTunQueue(tun_device_t *tdev, int fd, buffer_pool_t *pool, uint8_t *scratch, sbuf_t **bufs,
+                        uint32_t cap)
+{
+    while (true)
+    {
+        sbuf_t *buf = NULL;
+        int     nread;
+
+#ifdef OS_LINUX
+        if (tdev->offload)
+        {
+            nread = (int) read(fd, scratch, kTunOffloadReadSize);
+        }
+        else
+#endif
+        {
+            discard scratch;
+            buf = bufferpoolGetSmallBuffer(pool);
+            assert(sbufGetRightCapacity(buf) >= kReadPacketSize);
+            nread = (int) read(fd, sbufGetMutablePtr(buf), kReadPacketSize);
+        }
+
+        if (nread <= 0)
+        {
+            if (buf)
+            {
+                bufferpoolReuseBuffer(pool, buf);
+            }
+            if (nread == 0)
+            {
+                LOGW("TunDevice: End Of File on device %s", tdev->name);
+                return -1;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                // device queue is drained
+                return 0;
+            }
+            LOGE("TunDevice: reading a packet from TUN device failed, code: %d", nread);
+            if (errno == EINVAL || errno == EINTR)
+            {
+                return 0;
+            }
+            return -1;
+        }
+
+        if (TUN_LOG_EVERYTHING)
+        {
+            LOGD("TunDevice: read %d bytes from device %s", nread, tdev->name);
+        }
+
+#ifdef OS_LINUX
+        if (tdev->offload)
+        {
+            int count = tunOffloadSplitFrame(pool, scratch, (uint32_t) nread, bufs, cap);
+            if (count < 0)
+            {
+                LOGW("TunDevice: dropped a malformed or unsupported offload frame of %d bytes", nread);
+                continue;
+            }
+            return count;
+        }
+#endif
+        discard cap;
+        sbufSetLength(buf, (uint32_t) nread);
+        bufs[0] = buf;
+        return 1;
+    }
+}
+
 // Routine to read from TUN device
+// the device is non-blocking, after each poll wakeup we drain up to read_batch_size frames
 static WTHREAD_ROUTINE(routineReadFromTun)
 {
-    tun_device_t *tdev = userdata;
-    sbuf_t       *buf;
-    int           nread;
+    tun_device_t  *tdev = userdata;
+    sbuf_t        *bufs[kMaxReadQueueSize];
+    uint32_t       queued_count;
+    const uint32_t per_read_max = tdev->offload ? kTunOffloadMaxSegments : 1;
 
     struct pollfd fds[2];
     fds[0].fd     = tdev->handle;
@@ -96,62 +402,133 @@ static WTHREAD_ROUTINE(routineReadFromTun)
 
     while (atomicLoadExplicit(&(tdev->running), memory_order_relaxed))
     {
-        if (atomicLoadExplicit(&(tdev->packets_queued), memory_order_acquire) > 256)
+        int ret = poll(fds, 2, -1);
+        if (ret <= 0)
+        {
+            continue;
+        }
+        if (fds[1].revents & POLLIN)
+        {
+            LOGW("TunDevice: Exit read routine due to pipe event");
+            break;
+        }
+        if (! (fds[0].revents & POLLIN))
         {
-            ww_msleep(1);
             continue;
         }
 
-        buf = bufferpoolGetSmallBuffer(tdev->reader_buffer_pool);
-        assert(sbufGetRightCapacity(buf) >= kReadPacketSize);
-
-        int ret = poll(fds, 2, -1);
-        if (ret > 0)
+        queued_count = 0;
+        for (uint32_t r = 0; r < tdev->read_batch_size; r++)
         {
-            if (fds[1].revents & POLLIN)
+            // hand over what we have before a frame could overflow the batch
+            if (kMaxReadQueueSize - queued_count < per_read_max)
             {
-                bufferpoolReuseBuffer(tdev->reader_buffer_pool, buf);
+                tundeviceDistributeBatch(tdev, &bufs[0], queued_count, distributePacketPayloads);
+                queued_count = 0;
+            }
 
-                LOGW("TunDevice: Exit read routine due to pipe event");
+            int count = readTunQueue(tdev, tdev->handle, tdev->reader_buffer_pool, tdev->offload_scratch,
+                                     &bufs[queued_count], kMaxReadQueueSize - queued_count);
+            if (count == 0)
+            {
                 break;
             }
-            if (fds[0].revents & POLLIN)
+            if (count < 0)
             {
-
-                nread = (int) read(tdev->handle, sbufGetMutablePtr(buf), kReadPacketSize);
-
-                if (nread == 0)
+                if (queued_count > 0)
                 {
-                    bufferpoolReuseBuffer(tdev->reader_buffer_pool, buf);
-                    LOGW("TunDevice: Exit read routine due to End Of File");
-                    return 0;
+                    tundeviceDistributeBatch(tdev, &bufs[0], queued_count, distributePacketPayloads);
                 }
+                LOGE("TunDevice: Exit read routine");
+                return 0;
+            }
+            queued_count += (uint32_t) count;
+        }
 
-                if (nread < 0)
-                {
-                    bufferpoolReuseBuffer(tdev->reader_buffer_pool, buf);
-                    LOGE("TunDevice: reading a packet from TUN device failed, code: %d", nread);
-                    if (errno == EINVAL || errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
-                    {
-                        continue;
-                    }
-                    LOGE("TunDevice: Exit read routine due to critical error");
-                    return 0;
-                }
+        if (queued_count > 0)
+        {
+            tundeviceDistributeBatch(tdev, &bufs[0], queued_count, distributePacketPayloads);
+        }
+    }
 
-                sbufSetLength(buf, (uint32_t) nread);
+    return 0;
+}
 
-                if (TUN_LOG_EVERYTHING)
-                {
-                    LOGD("TunDevice: read %zd bytes from device %s", nread, tdev->name);
-                }
+#ifdef OS_LINUX
+// Multi-queue mode: the worker loop owning the queue reads it directly, packets never leave that worker
+static void onTunQueueReadable(wio_t *io)
+{
+    tun_device_t  *tdev    = wioGetContext(io);
+    wid_t          wid     = getWID();
+    buffer_pool_t *pool    = getWorkerBufferPool(wid);
+    uint8_t       *scratch = tdev->offload ? tdev->offload_scratch + ((size_t) wid * kTunOffloadReadSize) : NULL;
+    sbuf_t        *bufs[kTunOffloadMaxSegments];
 
-                distributePacketPayload(tdev, getNextDistributionWID(), buf);
-            }
+    for (uint32_t r = 0; r < tdev->read_batch_size; r++)
+    {
+        int count = readTunQueue(tdev, wioGetFD(io), pool, scratch, &bufs[0], kTunOffloadMaxSegments);
+        if (count == 0)
+        {
+            return;
+        }
+        if (count < 0)
+        {
+            LOGE("TunDevice: queue of worker %d is detached", wid);
+            wioDel(io, WW_READ);
+            return;
+        }
+        for (int i = 0; i < count; i++)
+        {
+            tdev->read_event_callback(tdev, tdev->userdata, bufs[i], wid);
         }
     }
+}
 
-    return 0;
+static void attachTunQueue(worker_t *worker, void *arg1, void *arg2, void *arg3)
+{
+    discard arg3;
+    tun_device_t *tdev = arg1;
+    int           fd   = (int) (intptr_t) arg2;
+
+    wio_t *io = wioGet(worker->loop, fd);
+    wioSetContext(io, tdev);
+    wioAdd(io, onTunQueueReadable, WW_READ);
+}
+
+// runs on the worker that owns the queue, so none of its writes can see the fd after it is closed (or reused)
+// the loop owns the queue io once attached, closing it also closes the fd
+static void closeTunQueue(worker_t *worker, void *arg1, void *arg2, void *arg3)
+{
+    discard arg3;
+    int  fd       = (int) (intptr_t) arg1;
+    bool attached = (bool) (intptr_t) arg2;
+
+    if (attached)
+    {
+        wioClose(wioGet(worker->loop, fd));
+    }
+    else
+    {
+        close(fd);
+    }
+}
+#endif
+
+// Writes one IP packet, with offload enabled every frame must start with a (here empty) vnet header
+static ssize_t writeTunQueue(tun_device_t *tdev, int fd, sbuf_t *buf)
+{
+#ifdef OS_LINUX
+    if (tdev->offload)
+    {
+        struct virtio_net_hdr vh;
+        memorySet(&vh, 0, sizeof(vh));
+
+        struct iovec iov[2] = {{.iov_base = &vh, .iov_len = sizeof(vh)},
+                               {.iov_base = sbufGetMutablePtr(buf), .iov_len = sbufGetLength(buf)}};
+        return writev(fd, iov, 2);
+    }
+#endif
+    return write(fd, sbufGetRawPtr(buf), sbufGetLength(buf));
 }
 
 // Routine to write to TUN device
@@ -169,7 +546,7 @@ static WTHREAD_ROUTINE(routineWriteToTun)
             return 0;
         }
 
-        nwrite = write(tdev->handle, sbufGetRawPtr(buf), sbufGetLength(buf));
+        nwrite = writeTunQueue(tdev, tdev->handle, buf);
         bufferpoolReuseBuffer(tdev->writer_buffer_pool, buf);
 
         if (nwrite == 0)
@@ -192,6 +569,39 @@ static WTHREAD_ROUTINE(routineWriteToTun)
     return 0;
 }
 
+#ifdef OS_LINUX
+// only the owner worker of a queue reads its handle, the handle is -1 once the device went down
+static bool writeOwnTunQueue(tun_device_t *tdev, sbuf_t *buf)
+{
+    int fd = atomicLoadRelaxed(&(tdev->queue_handles[getWID()]));
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    ssize_t nwrite = writeTunQueue(tdev, fd, buf);
+    if (nwrite <= 0)
+    {
+        LOGW("TunDevice: writing a packet to TUN queue failed, code: %d", (int) nwrite);
+        return false;
+    }
+    bufferpoolReuseBuffer(getWorkerBufferPool(getWID()), buf);
+    return true;
+}
+
+static void writeTunQueueOnOwner(worker_t *worker, void *arg1, void *arg2, void *arg3)
+{
+    discard arg3;
+    tun_device_t *tdev = arg1;
+    sbuf_t       *buf  = arg2;
+
+    if (! writeOwnTunQueue(tdev, buf))
+    {
+        bufferpoolReuseBuffer(getWorkerBufferPool(worker->wid), buf);
+    }
+}
+#endif
+
 // Write to TUN device
 bool tundeviceWrite(tun_device_t *tdev, sbuf_t *buf)
 {
@@ -204,6 +614,20 @@ bool tundeviceWrite(tun_device_t *tdev, sbuf_t *buf)
         return false;
     }
 
+#ifdef OS_LINUX
+    if (tdev->queue_count > 0)
+    {
+        // every queue accepts writes, but an fd is only used by its owner worker (see closeTunQueue)
+        // workers without a queue (the lwip worker) hand the packet to one that has
+        if (getWID() >= tdev->queue_count)
+        {
+            sendWorkerMessageForceQueue(getWID() % tdev->queue_count, writeTunQueueOnOwner, tdev, buf, NULL);
+            return true;
+        }
+        return writeOwnTunQueue(tdev, buf);
+    }
+#endif
+
     bool closed = false;
     if (! chanTrySend(tdev->writer_buffer_channel, (void *) &buf, &closed))
     {
@@ -281,10 +705,21 @@ bool tundeviceBringUp(tun_device_t *tdev)
                                        bufferpoolGetLargeBufferPadding(getWorkerBufferPool(getWID())),
                                        bufferpoolGetSmallBufferPadding(getWorkerBufferPool(getWID())));
 
+#ifdef OS_LINUX
+    if (tdev->queue_count > 0 && atomicLoadRelaxed(&(tdev->queue_handles[0])) < 0)
+    {
+        LOGE("TunDevice: queues of a multi-queue device can not be attached again");
+        return false;
+    }
+#endif
+
     tdev->up = true;
     atomicStoreRelaxed(&(tdev->running), true);
 
-    tdev->writer_buffer_channel = chanOpen(sizeof(void *), kTunWriteChannelQueueMax);
+    if (tdev->queue_count == 0)
+    {
+        tdev->writer_buffer_channel = chanOpen(sizeof(void *), kTunWriteChannelQueueMax);
+    }
 
     char command[128];
     snprintf(command, sizeof(command), "ip link set dev %s up", tdev->name);
@@ -295,6 +730,21 @@ bool tundeviceBringUp(tun_device_t *tdev)
     }
     LOGD("TunDevice: device %s is now up", tdev->name);
 
+#ifdef OS_LINUX
+    if (tdev->queue_count > 0)
+    {
+        if (tdev->read_event_callback != NULL)
+        {
+            for (wid_t wid = 0; wid < tdev->queue_count; wid++)
+            {
+                sendWorkerMessage(wid, attachTunQueue, tdev,
+                                  (void *) (intptr_t) atomicLoadRelaxed(&(tdev->queue_handles[wid])), NULL);
+            }
+        }
+        return true;
+    }
+#endif
+
     if (tdev->read_event_callback != NULL)
     {
         tdev->read_thread = threadCreate(tdev->routine_reader, tdev);
@@ -315,12 +765,15 @@ bool tundeviceBringDown(tun_device_t *tdev)
     atomicStoreRelaxed(&(tdev->running), false);
     tdev->up = false;
 
-    chanClose(tdev->writer_buffer_channel);
-    sbuf_t *buf;
-
-    while (chanRecv(tdev->writer_buffer_channel, (void **) &buf))
+    if (tdev->queue_count == 0)
     {
-        bufferpoolReuseBuffer(tdev->reader_buffer_pool, buf);
+        chanClose(tdev->writer_buffer_channel);
+        sbuf_t *buf;
+
+        while (chanRecv(tdev->writer_buffer_channel, (void **) &buf))
+        {
+            bufferpoolReuseBuffer(tdev->reader_buffer_pool, buf);
+        }
     }
 
     char command[128];
@@ -332,6 +785,21 @@ bool tundeviceBringDown(tun_device_t *tdev)
     }
     LOGD("TunDevice: device %s is now down", tdev->name);
 
+#ifdef OS_LINUX
+    if (tdev->queue_count > 0)
+    {
+        // each worker closes the queue it owns, its writes see -1 from here on and the fds are not ours anymore
+        for (wid_t wid = 0; wid < tdev->queue_count; wid++)
+        {
+            int fd = atomicExchangeExplicit(&(tdev->queue_handles[wid]), -1, memory_order_relaxed);
+            sendWorkerMessage(wid, closeTunQueue, (void *) (intptr_t) fd,
+                              (void *) (intptr_t) (tdev->read_event_callback != NULL), NULL);
+        }
+        tdev->handle = -1;
+        return true;
+    }
+#endif
+
     if (tdev->read_event_callback != NULL)
     {
         ssize_t _unused = write(tdev->linux_pipe_fds[1], "x", 1);
@@ -348,13 +816,120 @@ bool tundeviceBringDown(tun_device_t *tdev)
     return true;
 }
 
+// Allocate the device object and its pools around an already configured tun fd
+static tun_device_t *tundeviceAllocate(const char *ifname, int fd, bool offload, uint32_t reader_count, void *userdata,
+                                       TunReadEventHandle cb)
+{
+    buffer_pool_t *reader_bpool =
+        bufferpoolCreate(GSTATE.masterpool_buffer_pools_large, GSTATE.masterpool_buffer_pools_small, RAM_PROFILE,
+                         bufferpoolGetLargeBufferSize(getWorkerBufferPool(getWID())),
+                         bufferpoolGetSmallBufferSize(getWorkerBufferPool(getWID()))
+
+        );
+
+    buffer_pool_t *writer_bpool =
+        bufferpoolCreate(GSTATE.masterpool_buffer_pools_large, GSTATE.masterpool_buffer_pools_small, RAM_PROFILE,
+                         bufferpoolGetLargeBufferSize(getWorkerBufferPool(getWID())),
+                         bufferpoolGetSmallBufferSize(getWorkerBufferPool(getWID()))
+
+        );
+
+    tun_device_t *tdev = memoryAllocate(sizeof(tun_device_t));
+
+    *tdev = (tun_device_t) {.name                  = stringDuplicate(ifname),
+                            .running               = false,
+                            .up                    = false,
+                            .routine_reader        = routineReadFromTun,
+                            .routine_writer        = routineWriteToTun,
+                            .handle                = fd,
+                            .read_event_callback   = cb,
+                            .userdata              = userdata,
+                            .writer_buffer_channel = NULL,
+                            .reader_message_pool = masterpoolCreateWithCapacity(kMasterMessagePoolsbufGetLeftCapacity),
+                            .read_batch_size     = kTunDefaultReadBatchSize,
+                            .distribution_policy = kPacketDistributionFiveTuple,
+                            .reader_buffer_pool  = reader_bpool,
+                            .writer_buffer_pool  = writer_bpool};
+
+#ifdef OS_LINUX
+    if (offload)
+    {
+        tdev->offload         = true;
+        tdev->offload_scratch = memoryAllocate((size_t) reader_count * kTunOffloadReadSize);
+    }
+#else
+    discard offload;
+    discard reader_count;
+#endif
+
+    if (! devicebackpressureInit(&(tdev->backpressure), tdev->name, kTunDefaultQueueLimit))
+    {
+        LOGE("TunDevice: failed to create reader backpressure state");
+        goto fail;
+    }
+
+    if (pipe(tdev->linux_pipe_fds) != 0)
+    {
+        LOGE("TunDevice: failed to create pipe for linux_pipe_fds");
+        devicebackpressureDestroy(&(tdev->backpressure));
+        goto fail;
+    }
+    masterpoolInstallCallBacks(tdev->reader_message_pool, allocTunMsgPoolHandle, destroyTunMsgPoolHandle);
+
+    return tdev;
+
+fail:
+    memoryFree(tdev->name);
+    bufferpoolDestroy(tdev->reader_buffer_pool);
+    bufferpoolDestroy(tdev->writer_buffer_pool);
+    masterpoolDestroy(tdev->reader_message_pool);
+    if (tdev->offload_scratch)
+    {
+        memoryFree(tdev->offload_scratch);
+    }
+    memoryFree(tdev);
+    return NULL;
+}
+
+#ifdef OS_LINUX
+// The queue was opened with IFF_VNET_HDR, let the kernel hand us TSO/USO super-packets with partial checksums
+static bool enableTunOffload(int fd)
+{
+    int vnet_hdr_size = (int) sizeof(struct virtio_net_hdr);
+    if (ioctl(fd, TUNSETVNETHDRSZ, &vnet_hdr_size) < 0)
+    {
+        LOGE("TunDevice: ioctl(TUNSETVNETHDRSZ) failed");
+        return false;
+    }
+
+    unsigned int flags = TUN_F_CSUM | TUN_F_TSO4 | TUN_F_TSO6;
+#if defined(TUN_F_USO4) && defined(TUN_F_USO6)
+    if (ioctl(fd, TUNSETOFFLOAD, flags | TUN_F_USO4 | TUN_F_USO6) == 0)
+    {
+        return true;
+    }
+    LOGW("TunDevice: kernel refused UDP segmentation offload, continuing with TSO only");
+#endif
+    if (ioctl(fd, TUNSETOFFLOAD, flags) < 0)
+    {
+        LOGE("TunDevice: ioctl(TUNSETOFFLOAD) failed");
+        return false;
+    }
+    return true;
+}
+#endif
+
 // Create TUN device
 tun_device_t *tundeviceCreate(const char *name, bool offload, void *userdata, TunReadEventHandle cb)
 {
-    discard offload; // todo (send/receive offloading)
-
     struct ifreq ifr;
 #ifdef OS_BSD
+    if (offload)
+    {
+        LOGW("TunDevice: offloading is not supported on this platform, ignored");
+        offload = false;
+    }
+
     int fd = -1;
 
     // Open the TUN device
@@ -393,6 +968,10 @@ tun_device_t *tundeviceCreate(const char *name, bool offload, void *userdata, Tu
 
     memorySet(&ifr, 0, sizeof(ifr));
     ifr.ifr_flags = IFF_TUN | IFF_NO_PI; // TUN device, no packet information
+    if (offload)
+    {
+        ifr.ifr_flags |= IFF_VNET_HDR;
+    }
     if (*name)
     {
         stringCopyN(ifr.ifr_name, name, IFNAMSIZ);
@@ -406,53 +985,103 @@ tun_device_t *tundeviceCreate(const char *name, bool offload, void *userdata, Tu
         close(fd);
         return NULL;
     }
+
+    if (offload && ! enableTunOffload(fd))
+    {
+        close(fd);
+        return NULL;
+    }
 #endif
 
-    buffer_pool_t *reader_bpool =
-        bufferpoolCreate(GSTATE.masterpool_buffer_pools_large, GSTATE.masterpool_buffer_pools_small, RAM_PROFILE,
-                         bufferpoolGetLargeBufferSize(getWorkerBufferPool(getWID())),
-                         bufferpoolGetSmallBufferSize(getWorkerBufferPool(getWID()))
+    // reader drains the device in batches after each poll wakeup, so reads must not block
+    if (nonBlocking(fd) < 0)
+    {
+        LOGE("TunDevice: setting the device non-blocking failed");
+        close(fd);
+        return NULL;
+    }
 
-        );
+    tun_device_t *tdev = tundeviceAllocate(ifr.ifr_name, fd, offload, 1, userdata, cb);
+    if (tdev == NULL)
+    {
+        close(fd);
+    }
+    return tdev;
+}
 
-    buffer_pool_t *writer_bpool =
-        bufferpoolCreate(GSTATE.masterpool_buffer_pools_large, GSTATE.masterpool_buffer_pools_small, RAM_PROFILE,
-                         bufferpoolGetLargeBufferSize(getWorkerBufferPool(getWID())),
-                         bufferpoolGetSmallBufferSize(getWorkerBufferPool(getWID()))
+#ifdef OS_LINUX
+static void closeTunQueues(atomic_int *queue_handles, wid_t count)
+{
+    for (wid_t i = 0; i < count; i++)
+    {
+        close(atomicLoadRelaxed(&queue_handles[i]));
+    }
+    memoryFree(queue_handles);
+}
 
-        );
+// Create TUN device with IFF_MULTI_QUEUE, one queue per worker (lwip worker excluded) and no reader / writer threads
+tun_device_t *tundeviceCreateMultiQueue(const char *name, bool offload, void *userdata, TunReadEventHandle cb)
+{
+    wid_t        queue_count   = getWorkersCount() - WORKER_ADDITIONS;
+    atomic_int  *queue_handles = memoryAllocate(sizeof(atomic_int) * queue_count);
+    struct ifreq ifr;
 
-    tun_device_t *tdev = memoryAllocate(sizeof(tun_device_t));
+    memorySet(&ifr, 0, sizeof(ifr));
+    if (*name)
+    {
+        stringCopyN(ifr.ifr_name, name, IFNAMSIZ);
+        ifr.ifr_name[IFNAMSIZ - 1] = '\0';
+    }
 
-    *tdev = (tun_device_t) {.name                  = stringDuplicate(ifr.ifr_name),
-                            .running               = false,
-                            .up                    = false,
-                            .routine_reader        = routineReadFromTun,
-                            .routine_writer        = routineWriteToTun,
-                            .handle                = fd,
-                            .read_event_callback   = cb,
-                            .userdata              = userdata,
-                            .writer_buffer_channel = NULL,
-                            .reader_message_pool = masterpoolCreateWithCapacity(kMasterMessagePoolsbufGetLeftCapacity),
-                            .packets_queued      = 0,
-                            .reader_buffer_pool  = reader_bpool,
-                            .writer_buffer_pool  = writer_bpool};
+    for (wid_t i = 0; i < queue_count; i++)
+    {
+        int fd = open("/dev/net/tun", O_RDWR);
+        if (fd < 0)
+        {
+            LOGE("TunDevice: opening /dev/net/tun failed");
+            closeTunQueues(queue_handles, i);
+            return NULL;
+        }
+
+        // the first queue creates the device (and gets the kernel chosen name), the rest attach to it
+        ifr.ifr_flags = IFF_TUN | IFF_NO_PI | IFF_MULTI_QUEUE;
+        if (offload)
+        {
+            ifr.ifr_flags |= IFF_VNET_HDR;
+        }
+        if (ioctl(fd, TUNSETIFF, (void *) &ifr) < 0)
+        {
+            LOGE("TunDevice: ioctl(TUNSETIFF) failed for queue %d, kernel may not support IFF_MULTI_QUEUE", i);
+            close(fd);
+            closeTunQueues(queue_handles, i);
+            return NULL;
+        }
 
-     if (pipe(tdev->linux_pipe_fds) != 0)
+        if ((offload && ! enableTunOffload(fd)) || nonBlocking(fd) < 0)
+        {
+            LOGE("TunDevice: setting up queue %d failed", i);
+            close(fd);
+            closeTunQueues(queue_handles, i);
+            return NULL;
+        }
+        atomicStoreRelaxed(&queue_handles[i], fd);
+    }
+
+    tun_device_t *tdev = tundeviceAllocate(ifr.ifr_name, atomicLoadRelaxed(&queue_handles[0]), offload, queue_count,
+                                           userdata, cb);
+    if (tdev == NULL)
     {
-        LOGE("TunDevice: failed to create pipe for linux_pipe_fds");
-        memoryFree(tdev->name);
-        bufferpoolDestroy(tdev->reader_buffer_pool);
-        bufferpoolDestroy(tdev->writer_buffer_pool);
-        masterpoolDestroy(tdev->reader_message_pool);
-        close(tdev->handle);
-        memoryFree(tdev);
+        closeTunQueues(queue_handles, queue_count);
         return NULL;
     }
-    masterpoolInstallCallBacks(tdev->reader_message_pool, allocTunMsgPoolHandle, destroyTunMsgPoolHandle);
 
+    tdev->queue_handles = queue_handles;
+    tdev->queue_count   = queue_count;
+
+    LOGD("TunDevice: device %s created with %d queues", tdev->name, queue_count);
     return tdev;
 }
+#endif
 // Destroy TUN device
 void tundeviceDestroy(tun_device_t *tdev)
 {
@@ -465,8 +1094,32 @@ void tundeviceDestroy(tun_device_t *tdev)
     bufferpoolDestroy(tdev->writer_buffer_pool);
     masterpoolMakeEmpty(tdev->reader_message_pool,NULL);
     masterpoolDestroy(tdev->reader_message_pool);
+#ifdef OS_LINUX
+    if (tdev->queue_count > 0)
+    {
+        // handles are -1 when the queues were handed over to the worker loops
+        for (wid_t i = 0; i < tdev->queue_count; i++)
+        {
+            if (atomicLoadRelaxed(&(tdev->queue_handles[i])) >= 0)
+            {
+                close(atomicLoadRelaxed(&(tdev->queue_handles[i])));
+            }
+        }
+        memoryFree(tdev->queue_handles);
+    }
+    else
+    {
+        close(tdev->handle);
+    }
+#else
     close(tdev->handle);
+#endif
     close(tdev->linux_pipe_fds[0]);
     close(tdev->linux_pipe_fds[1]);
+    devicebackpressureDestroy(&(tdev->backpressure));
+    if (tdev->offload_scratch)
+    {
+        memoryFree(tdev->offload_scratch);
+    }
     memoryFree(tdev);
 }
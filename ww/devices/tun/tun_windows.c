@@ -160,14 +160,14 @@ static void localThreadEventReceived(wevent_t *ev)
  * @param target_wid Target thread ID
  * @param buf Buffer containing packet data
  */
-static void distributePacketPayloads(tun_device_t *tdev, wid_t target_wid, sbuf_t **buf, unsigned int queued_count)
+static void distributePacketPayloads(tun_device_t *tdev, wid_t target_wid, sbuf_t **buf, uint32_t queued_count)
 {
     struct msg_event *msg;
     masterpoolGetItems(tdev->reader_message_pool, (const void **) &(msg), 1, tdev);
 
     msg->tdev  = tdev;
     msg->count = queued_count;
-    for (unsigned int i = 0; i < queued_count; i++)
+    for (uint32_t i = 0; i < queued_count; i++)
     {
         msg->bufs[i] = buf[i];
     }
@@ -179,6 +179,7 @@ static void distributePacketPayloads(tun_device_t *tdev, wid_t target_wid, sbuf_
     weventSetUserData(&ev, msg);
     wloopPostEvent(getWorkerLoop(target_wid), &ev);
 }
+
 // {
 //     struct msg_event *msg;
 //     masterpoolGetItems(tdev->reader_message_pool, (const void **) &(msg), 1, tdev);
@@ -225,13 +226,14 @@ static WTHREAD_ROUTINE(routineReadFromTun)
                 // printPacket(Packet, PacketSize);
             }
 
-            if (queued_count < kMaxReadQueueSize - 1)
+            if (queued_count < tdev->read_batch_size - 1)
             {
                 queued_count++;
             }
             else
             {
-                distributePacketPayloads(tdev, getNextDistributionWID(), &buf[0], queued_count);
+                // buf[queued_count] holds the packet just read, so the full batch is queued_count + 1 packets
+                tundeviceDistributeBatch(tdev, &buf[0], queued_count + 1, distributePacketPayloads);
 
                 queued_count = 0;
             }
@@ -248,7 +250,7 @@ static WTHREAD_ROUTINE(routineReadFromTun)
             case ERROR_NO_MORE_ITEMS:
                 if (queued_count > 0)
                 {
-                    distributePacketPayloads(tdev, getNextDistributionWID(), &buf[0], queued_count);
+                    tundeviceDistributeBatch(tdev, &buf[0], queued_count, distributePacketPayloads);
 
                     queued_count = 0;
                     continue;
@@ -636,6 +638,8 @@ tun_device_t *tundeviceCreate(const char *name, bool offload, void *userdata, Tu
                             .userdata              = userdata,
                             .writer_buffer_channel = chanOpen(sizeof(void*),kTunWriteChannelQueueMax),
                             .reader_message_pool   = masterpoolCreateWithCapacity(kMasterMessagePoolsbufGetLeftCapacity),
+                            .read_batch_size       = kTunDefaultReadBatchSize,
+                            .distribution_policy   = kPacketDistributionFiveTuple,
                             .reader_buffer_pool    = reader_bpool,
                             .writer_buffer_pool    = writer_bpool,
                             .adapter_handle        = NULL,
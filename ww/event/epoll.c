@@ -1,6 +1,16 @@
 #include "iowatcher.h"
 
 #ifdef EVENT_EPOLL
+
+#ifdef EVENT_IO_URING
+// io_uring.c owns the iowatcher entry points and calls into these when io_uring is not usable
+#define iowatcherInit       epollwatcherInit
+#define iowatcherCleanUp    epollwatcherCleanUp
+#define iowatcherAddEvent   epollwatcherAddEvent
+#define iowatcherDelEvent   epollwatcherDelEvent
+#define iowatcherPollEvents epollwatcherPollEvents
+#endif
+
 #include "wplatform.h"
 #include "wdef.h"
 #include "wevent.h"
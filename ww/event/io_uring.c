@@ -0,0 +1,1065 @@
+#include "iowatcher.h"
+
+#ifdef EVENT_IO_URING
+#include "loggers/internal_logger.h"
+#include "wdef.h"
+#include "wevent.h"
+#include "wplatform.h"
+
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+/*
+    io_uring backend
+
+    plain fds (udp, tun, eventfd, connecting sockets ...) keep the readiness model of the other backends, a one-shot
+    POLL_ADD that is armed again at the next poll call after the handler ran, which behaves like level-triggered
+    epoll without any epoll_ctl syscall.
+
+    tcp sockets skip readiness:
+        - a listening socket runs one multishot ACCEPT
+        - a connected socket runs one multishot RECV that picks its buffers from a provided buffer ring, the ring is
+          filled with large buffers of the loop buffer_pool and the filled buffer goes to the read callback as is;
+          completions that arrive after reading was turned off are kept on the fd and handed over, in order, once
+          wioRead turns it back on, so a paused wio never sees a read callback
+        - once a wio has queued writes, its whole write_queue goes out with one SENDMSG (one iovec per sbuf), a send
+          that finds the socket buffer full waits for a one-shot POLLOUT before it is submitted again
+
+    changes are only recorded when wioAdd / wioDel happen, SQEs are built and submitted together with the wait in
+    iowatcherPollEvents, so a loop iteration costs a single io_uring_enter.
+
+    kernels without io_uring, or older than 6.0 (multishot recv), use the epoll backend. the decision is taken once.
+*/
+
+enum
+{
+    kUringSqEntries    = 256,
+    kUringCqEntries    = 4096,
+    kUringRecvBufCount = 64, // must be a power of 2
+    kUringRecvBufGroup = 1,
+    kUringMaxSendIov   = 64,
+    kUringFdsInitSize  = 1024
+};
+
+enum uring_op_e
+{
+    kUringOpPoll = 1,
+    kUringOpAccept,
+    kUringOpRecv,
+    kUringOpSend,
+    kUringOpCancel,
+    kUringOpMask = 0xF
+};
+
+enum uring_availability_e
+{
+    kUringUnknown = 0,
+    kUringAvailable,
+    kUringUnavailable
+};
+
+QUEUE_DECL(sbuf_t *, uring_stash)
+
+typedef struct uring_send_s
+{
+    struct msghdr msg;
+    struct iovec  iov[kUringMaxSendIov];
+    sbuf_t       *orphans[kUringMaxSendIov]; // buffers taken over when the wio closed with this send in flight
+    uint32_t      count;                     // sbufs at the front of the write_queue covered by iov
+    uint32_t      orphan_count;
+    uint32_t      id;
+    int           fd;
+    bool          in_use;
+} uring_send_t;
+
+typedef struct uring_fd_s
+{
+    uint64_t           poll_ud; // armed one-shot poll, 0 when none
+    uint64_t           read_ud; // armed multishot recv or accept, 0 when none
+    uring_send_t      *send;    // in flight sendmsg
+    struct uring_stash stash;   // received while reading was off
+    uint32_t           id;      // wio id the armed requests belong to
+    uint32_t           poll_mask;
+    uint8_t            gen;
+    bool               dirty;
+    bool               send_blocked; // last sendmsg hit EAGAIN, wait for POLLOUT before sending again
+    bool               stash_eof;    // the peer closed after the stashed data
+    bool               replay;       // queued on ctx->replay
+} uring_fd_t;
+
+ARRAY_DECL(int, uring_fd_list)
+ARRAY_DECL(uring_send_t *, uring_send_list)
+
+typedef struct uring_ctx_s
+{
+    int ring_fd;
+
+    void  *ring_map;
+    size_t ring_map_size;
+
+    unsigned            *sq_khead;
+    unsigned            *sq_ktail;
+    unsigned             sq_mask;
+    unsigned             sq_entries;
+    unsigned             sq_tail;
+    struct io_uring_sqe *sqes;
+    size_t               sqes_size;
+
+    unsigned            *cq_khead;
+    unsigned            *cq_ktail;
+    unsigned             cq_mask;
+    struct io_uring_cqe *cqes;
+
+    struct io_uring_buf_ring *buf_ring;
+    size_t                    buf_ring_size;
+    uint16_t                  buf_tail;
+    sbuf_t                   *recv_bufs[kUringRecvBufCount];
+
+    uring_fd_t *fds;
+    int         fds_size;
+
+    struct uring_fd_list   dirty;
+    struct uring_fd_list   replay;     // fds whose stash can be delivered, read is on again
+    struct uring_send_list sends;      // every send ever allocated, for cleanup
+    struct uring_send_list free_sends;
+
+    uint32_t inflight; // requests still owned by the kernel (final cqe not seen yet)
+} uring_ctx_t;
+
+static atomic_int uring_availability = kUringUnknown;
+
+static int uringSetupSys(unsigned entries, struct io_uring_params *p)
+{
+    return (int) syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int uringEnterSys(int fd, unsigned to_submit, unsigned min_complete, unsigned flags, void *arg, size_t argsz)
+{
+    return (int) syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, argsz);
+}
+
+static int uringRegisterSys(int fd, unsigned opcode, void *arg, unsigned nr_args)
+{
+    return (int) syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+static void uringUnmap(uring_ctx_t *ctx)
+{
+    if (ctx->buf_ring)
+    {
+        munmap(ctx->buf_ring, ctx->buf_ring_size);
+        ctx->buf_ring = NULL;
+    }
+    if (ctx->sqes)
+    {
+        munmap(ctx->sqes, ctx->sqes_size);
+        ctx->sqes = NULL;
+    }
+    if (ctx->ring_map)
+    {
+        munmap(ctx->ring_map, ctx->ring_map_size);
+        ctx->ring_map = NULL;
+    }
+    if (ctx->ring_fd >= 0)
+    {
+        close(ctx->ring_fd);
+        ctx->ring_fd = -1;
+    }
+}
+
+// multishot recv arrived with 6.0 together with IORING_OP_SEND_ZC, the opcode probe is how we tell
+static bool uringProbeOps(int ring_fd)
+{
+    size_t                  len   = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe *probe = memoryAllocate(len);
+    memorySet(probe, 0, len);
+
+    bool ok = false;
+    if (uringRegisterSys(ring_fd, IORING_REGISTER_PROBE, probe, 256) == 0)
+    {
+        static const uint8_t kRequired[] = {IORING_OP_POLL_ADD, IORING_OP_ACCEPT,       IORING_OP_RECV,
+                                            IORING_OP_SENDMSG,  IORING_OP_ASYNC_CANCEL, IORING_OP_SEND_ZC};
+        ok = true;
+        for (size_t i = 0; i < ARRAY_SIZE(kRequired); i++)
+        {
+            if (kRequired[i] > probe->last_op || ! (probe->ops[kRequired[i]].flags & IO_URING_OP_SUPPORTED))
+            {
+                ok = false;
+                break;
+            }
+        }
+    }
+    memoryFree(probe);
+    return ok;
+}
+
+static bool uringSetup(uring_ctx_t *ctx)
+{
+    struct io_uring_params p;
+    memorySet(&p, 0, sizeof(p));
+    p.flags      = IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP | IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN;
+    p.cq_entries = kUringCqEntries;
+
+    ctx->ring_fd = uringSetupSys(kUringSqEntries, &p);
+    if (ctx->ring_fd < 0)
+    {
+        return false;
+    }
+
+    const unsigned required = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+    if ((p.features & required) != required || ! uringProbeOps(ctx->ring_fd))
+    {
+        uringUnmap(ctx);
+        return false;
+    }
+
+    size_t sq_size     = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    size_t cq_size     = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    ctx->ring_map_size = max(sq_size, cq_size);
+    ctx->ring_map      = mmap(NULL, ctx->ring_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                              ctx->ring_fd, IORING_OFF_SQ_RING);
+    if (ctx->ring_map == MAP_FAILED)
+    {
+        ctx->ring_map = NULL;
+        uringUnmap(ctx);
+        return false;
+    }
+
+    ctx->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    ctx->sqes      = mmap(NULL, ctx->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ctx->ring_fd,
+                          IORING_OFF_SQES);
+    if (ctx->sqes == MAP_FAILED)
+    {
+        ctx->sqes = NULL;
+        uringUnmap(ctx);
+        return false;
+    }
+
+    uint8_t *ring   = ctx->ring_map;
+    ctx->sq_khead   = (unsigned *) (ring + p.sq_off.head);
+    ctx->sq_ktail   = (unsigned *) (ring + p.sq_off.tail);
+    ctx->sq_mask    = *(unsigned *) (ring + p.sq_off.ring_mask);
+    ctx->sq_entries = p.sq_entries;
+    ctx->sq_tail    = *ctx->sq_ktail;
+    ctx->cq_khead   = (unsigned *) (ring + p.cq_off.head);
+    ctx->cq_ktail   = (unsigned *) (ring + p.cq_off.tail);
+    ctx->cq_mask    = *(unsigned *) (ring + p.cq_off.ring_mask);
+    ctx->cqes       = (struct io_uring_cqe *) (ring + p.cq_off.cqes);
+
+    // sqe index i always sits in sq slot i
+    unsigned *sq_array = (unsigned *) (ring + p.sq_off.array);
+    for (unsigned i = 0; i < p.sq_entries; i++)
+    {
+        sq_array[i] = i;
+    }
+
+    ctx->buf_ring_size = kUringRecvBufCount * sizeof(struct io_uring_buf);
+    ctx->buf_ring = mmap(NULL, ctx->buf_ring_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ctx->buf_ring == MAP_FAILED)
+    {
+        ctx->buf_ring = NULL;
+        uringUnmap(ctx);
+        return false;
+    }
+
+    struct io_uring_buf_reg reg;
+    memorySet(&reg, 0, sizeof(reg));
+    reg.ring_addr    = (uint64_t) (uintptr_t) ctx->buf_ring;
+    reg.ring_entries = kUringRecvBufCount;
+    reg.bgid         = kUringRecvBufGroup;
+    if (uringRegisterSys(ctx->ring_fd, IORING_REGISTER_PBUF_RING, &reg, 1) != 0)
+    {
+        uringUnmap(ctx);
+        return false;
+    }
+    return true;
+}
+
+static bool uringUsable(void)
+{
+    return atomicLoadRelaxed(&uring_availability) == kUringAvailable;
+}
+
+bool iowatcherUsingUring(void)
+{
+    return uringUsable();
+}
+
+// decided once per process, a throwaway ring tells whether this kernel can run the backend
+static void uringDecide(void)
+{
+    if (atomicLoadRelaxed(&uring_availability) != kUringUnknown)
+    {
+        return;
+    }
+    uring_ctx_t probe;
+    memorySet(&probe, 0, sizeof(probe));
+    probe.ring_fd = -1;
+    if (uringSetup(&probe))
+    {
+        uringUnmap(&probe);
+        atomicStoreRelaxed(&uring_availability, kUringAvailable);
+    }
+    else
+    {
+        wlogw("io_uring is not usable on this kernel, falling back to epoll");
+        atomicStoreRelaxed(&uring_availability, kUringUnavailable);
+    }
+}
+
+//--------------------submission---------------------------
+
+static unsigned uringUnsubmitted(uring_ctx_t *ctx)
+{
+    return ctx->sq_tail - __atomic_load_n(ctx->sq_khead, __ATOMIC_ACQUIRE);
+}
+
+static void uringSubmitNow(uring_ctx_t *ctx)
+{
+    unsigned to_submit = uringUnsubmitted(ctx);
+    while (to_submit > 0)
+    {
+        int ret = uringEnterSys(ctx->ring_fd, to_submit, 0, 0, NULL, 0);
+        if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        {
+            printError("io_uring_enter");
+            return;
+        }
+        to_submit = uringUnsubmitted(ctx);
+    }
+}
+
+static struct io_uring_sqe *uringGetSqe(uring_ctx_t *ctx)
+{
+    if (uringUnsubmitted(ctx) >= ctx->sq_entries)
+    {
+        uringSubmitNow(ctx);
+    }
+    struct io_uring_sqe *sqe = &ctx->sqes[ctx->sq_tail & ctx->sq_mask];
+    memorySet(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+static void uringPushSqe(uring_ctx_t *ctx)
+{
+    ctx->sq_tail++;
+    __atomic_store_n(ctx->sq_ktail, ctx->sq_tail, __ATOMIC_RELEASE);
+    ctx->inflight++;
+}
+
+static uint64_t uringMakeUserData(uring_fd_t *st, int fd, enum uring_op_e op)
+{
+    st->gen = (uint8_t) ((st->gen + 1) & 0xF);
+    return ((uint64_t) st->id << 32) | ((uint64_t) (uint32_t) fd << 8) | ((uint64_t) st->gen << 4) | (uint64_t) op;
+}
+
+static void uringQueueCancel(uring_ctx_t *ctx, uint64_t target)
+{
+    struct io_uring_sqe *sqe = uringGetSqe(ctx);
+    sqe->opcode              = IORING_OP_ASYNC_CANCEL;
+    sqe->fd                  = -1;
+    sqe->addr                = target;
+    sqe->user_data           = kUringOpCancel;
+    uringPushSqe(ctx);
+}
+
+static void uringQueuePoll(uring_ctx_t *ctx, uring_fd_t *st, int fd, uint32_t mask)
+{
+    struct io_uring_sqe *sqe = uringGetSqe(ctx);
+    sqe->opcode              = IORING_OP_POLL_ADD;
+    sqe->fd                  = fd;
+    sqe->poll32_events       = mask;
+    sqe->user_data           = uringMakeUserData(st, fd, kUringOpPoll);
+    st->poll_ud              = sqe->user_data;
+    st->poll_mask            = mask;
+    uringPushSqe(ctx);
+}
+
+static void uringQueueAccept(uring_ctx_t *ctx, uring_fd_t *st, int fd)
+{
+    struct io_uring_sqe *sqe = uringGetSqe(ctx);
+    sqe->opcode              = IORING_OP_ACCEPT;
+    sqe->fd                  = fd;
+    sqe->ioprio              = IORING_ACCEPT_MULTISHOT;
+    sqe->user_data           = uringMakeUserData(st, fd, kUringOpAccept);
+    st->read_ud              = sqe->user_data;
+    uringPushSqe(ctx);
+}
+
+static void uringQueueRecv(uring_ctx_t *ctx, uring_fd_t *st, int fd)
+{
+    struct io_uring_sqe *sqe = uringGetSqe(ctx);
+    sqe->opcode              = IORING_OP_RECV;
+    sqe->fd                  = fd;
+    sqe->ioprio              = IORING_RECV_MULTISHOT;
+    sqe->flags               = IOSQE_BUFFER_SELECT;
+    sqe->buf_group           = kUringRecvBufGroup;
+    sqe->user_data           = uringMakeUserData(st, fd, kUringOpRecv);
+    st->read_ud              = sqe->user_data;
+    uringPushSqe(ctx);
+}
+
+static uring_send_t *uringSendAlloc(uring_ctx_t *ctx)
+{
+    uring_send_t *op = NULL;
+    if (! uring_send_list_empty(&ctx->free_sends))
+    {
+        op = *uring_send_list_back(&ctx->free_sends);
+        uring_send_list_pop_back(&ctx->free_sends);
+    }
+    else
+    {
+        EVENTLOOP_ALLOC_SIZEOF(op);
+        uring_send_list_push_back(&ctx->sends, &op);
+    }
+    op->in_use       = true;
+    op->count        = 0;
+    op->orphan_count = 0;
+    return op;
+}
+
+static void uringSendRelease(wloop_t *loop, uring_ctx_t *ctx, uring_send_t *op)
+{
+    for (uint32_t i = 0; i < op->orphan_count; i++)
+    {
+        bufferpoolReuseBuffer(loop->bufpool, op->orphans[i]);
+    }
+    op->orphan_count = 0;
+    op->in_use       = false;
+    uring_send_list_push_back(&ctx->free_sends, &op);
+}
+
+static void uringQueueSend(uring_ctx_t *ctx, uring_fd_t *st, wio_t *io)
+{
+    uring_send_t *op    = uringSendAlloc(ctx);
+    sbuf_t      **queue = write_queue_data(&io->write_queue);
+
+    op->count = (uint32_t) min(write_queue_size(&io->write_queue), kUringMaxSendIov);
+    for (uint32_t i = 0; i < op->count; i++)
+    {
+        op->iov[i].iov_base = sbufGetMutablePtr(queue[i]);
+        op->iov[i].iov_len  = sbufGetLength(queue[i]);
+    }
+    memorySet(&op->msg, 0, sizeof(op->msg));
+    op->msg.msg_iov    = op->iov;
+    op->msg.msg_iovlen = op->count;
+    op->id             = io->id;
+    op->fd             = io->fd;
+
+    struct io_uring_sqe *sqe = uringGetSqe(ctx);
+    sqe->opcode              = IORING_OP_SENDMSG;
+    sqe->fd                  = io->fd;
+    sqe->addr                = (uint64_t) (uintptr_t) &op->msg;
+    sqe->msg_flags           = MSG_NOSIGNAL;
+    sqe->user_data           = (uint64_t) (uintptr_t) op | kUringOpSend;
+    st->send                 = op;
+    uringPushSqe(ctx);
+}
+
+//--------------------bookkeeping---------------------------
+
+static uring_fd_t *uringGetFd(uring_ctx_t *ctx, int fd)
+{
+    if (fd >= ctx->fds_size)
+    {
+        int newsize = max(ctx->fds_size * 2, max(fd + 1, kUringFdsInitSize));
+        ctx->fds    = eventloopRealloc(ctx->fds, sizeof(uring_fd_t) * (size_t) newsize,
+                                       sizeof(uring_fd_t) * (size_t) ctx->fds_size);
+        ctx->fds_size = newsize;
+    }
+    return &ctx->fds[fd];
+}
+
+static void uringMarkDirty(uring_ctx_t *ctx, int fd)
+{
+    uring_fd_t *st = uringGetFd(ctx, fd);
+    if (! st->dirty)
+    {
+        st->dirty = true;
+        uring_fd_list_push_back(&ctx->dirty, &fd);
+    }
+}
+
+static void uringStashRelease(wloop_t *loop, uring_fd_t *st)
+{
+    while (! uring_stash_empty(&st->stash))
+    {
+        bufferpoolReuseBuffer(loop->bufpool, *uring_stash_front(&st->stash));
+        uring_stash_pop_front(&st->stash);
+    }
+    st->stash_eof = false;
+}
+
+static wio_t *uringLiveIO(wloop_t *loop, int fd, uint32_t id)
+{
+    if (fd < 0 || fd >= (int) loop->ios.maxsize)
+    {
+        return NULL;
+    }
+    wio_t *io = loop->ios.ptr[fd];
+    if (io == NULL || io->closed || ! io->ready || io->id != id)
+    {
+        return NULL;
+    }
+    return io;
+}
+
+static void uringProvideBuffer(uring_ctx_t *ctx, uint16_t bid, sbuf_t *buf)
+{
+    ctx->recv_bufs[bid]   = buf;
+    struct io_uring_buf *b = &ctx->buf_ring->bufs[ctx->buf_tail & (kUringRecvBufCount - 1)];
+    b->addr                = (uint64_t) (uintptr_t) sbufGetMutablePtr(buf);
+    b->len                 = sbufGetRightCapacity(buf);
+    b->bid                 = bid;
+    ctx->buf_tail++;
+    __atomic_store_n(&ctx->buf_ring->tail, ctx->buf_tail, __ATOMIC_RELEASE);
+}
+
+// the armed requests follow the current io->events, only the difference is submitted
+static void uringSyncFd(wloop_t *loop, uring_ctx_t *ctx, int fd)
+{
+    uring_fd_t *st = &ctx->fds[fd];
+    st->dirty      = false;
+
+    wio_t *io = (fd < (int) loop->ios.maxsize) ? loop->ios.ptr[fd] : NULL;
+    if (io == NULL || io->closed || ! io->ready || io->id != st->id)
+    {
+        // whatever is armed belongs to a wio that is gone
+        if (st->poll_ud != 0)
+        {
+            uringQueueCancel(ctx, st->poll_ud);
+        }
+        if (st->read_ud != 0)
+        {
+            uringQueueCancel(ctx, st->read_ud);
+        }
+        st->poll_ud      = 0;
+        st->read_ud      = 0;
+        st->poll_mask    = 0;
+        st->send_blocked = false;
+        uringStashRelease(loop, st);
+        if (io == NULL || io->closed || ! io->ready)
+        {
+            return;
+        }
+        st->id = io->id;
+    }
+
+    const bool stream     = io->io_type == WIO_TYPE_TCP;
+    const bool multi_read = stream && (io->events & WW_READ);
+
+    if (multi_read && st->read_ud == 0)
+    {
+        if (io->accept)
+        {
+            uringQueueAccept(ctx, st, fd);
+        }
+        else
+        {
+            uringQueueRecv(ctx, st, fd);
+        }
+    }
+    else if (! multi_read && st->read_ud != 0)
+    {
+        uringQueueCancel(ctx, st->read_ud);
+        st->read_ud = 0;
+    }
+    if (multi_read && ! st->replay && (! uring_stash_empty(&st->stash) || st->stash_eof))
+    {
+        st->replay = true;
+        uring_fd_list_push_back(&ctx->replay, &fd);
+    }
+
+    uint32_t mask = 0;
+    if ((io->events & WW_READ) && ! stream)
+    {
+        mask |= POLLIN;
+    }
+    if ((io->events & WW_WRITE) && (! stream || io->connect || st->send_blocked))
+    {
+        mask |= POLLOUT;
+    }
+    if (st->poll_ud != 0 && st->poll_mask != mask)
+    {
+        uringQueueCancel(ctx, st->poll_ud);
+        st->poll_ud   = 0;
+        st->poll_mask = 0;
+    }
+    if (st->poll_ud == 0 && mask != 0)
+    {
+        uringQueuePoll(ctx, st, fd, mask);
+    }
+
+    if (stream && (io->events & WW_WRITE) && ! io->connect && st->send == NULL && ! st->send_blocked &&
+        ! write_queue_empty(&io->write_queue))
+    {
+        uringQueueSend(ctx, st, io);
+    }
+}
+
+static void uringFlushChanges(wloop_t *loop, uring_ctx_t *ctx)
+{
+    // uringSyncFd never marks fds dirty, so the list is stable while we walk it
+    for (int i = 0; i < uring_fd_list_size(&ctx->dirty); i++)
+    {
+        uringSyncFd(loop, ctx, ctx->dirty.ptr[i]);
+    }
+    ctx->dirty.size = 0;
+}
+
+//--------------------completions---------------------------
+
+static void uringOnPoll(wio_t *io, int res)
+{
+    uint32_t revents = (uint32_t) res;
+    if (revents & (POLLIN | POLLHUP | POLLERR))
+    {
+        io->revents |= WW_READ;
+    }
+    if (revents & (POLLOUT | POLLHUP | POLLERR))
+    {
+        io->revents |= WW_WRITE;
+    }
+    EVENT_PENDING(io);
+}
+
+static void uringOnAccept(wio_t *io, int res)
+{
+    if (res < 0)
+    {
+        if (res != -ECANCELED && res != -EAGAIN && res != -EINTR)
+        {
+            io->error = -res;
+            wloge("listenfd=%d accept error: %s:%d", io->fd, socketStrError(io->error), io->error);
+        }
+        return;
+    }
+    wio_t *connio = wioGet(io->loop, res);
+    // NOTE: inherit from listenio
+    connio->accept_cb = io->accept_cb;
+    connio->userdata  = io->userdata;
+    wioAcceptCallBack(connio);
+}
+
+// a multishot recv is only cancelled when reading is turned off, the completions the kernel already produced still
+// arrive, they wait on the fd (behind anything waiting already) until wioRead turns reading back on
+static bool uringRecvHeld(uring_fd_t *st, wio_t *io)
+{
+    return ! (io->events & WW_READ) || ! uring_stash_empty(&st->stash) || st->stash_eof;
+}
+
+static void uringOnRecv(wloop_t *loop, uring_ctx_t *ctx, uring_fd_t *st, wio_t *io, const struct io_uring_cqe *cqe)
+{
+    sbuf_t *buf = NULL;
+    if (cqe->flags & IORING_CQE_F_BUFFER)
+    {
+        uint16_t bid = (uint16_t) (cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+        buf          = ctx->recv_bufs[bid];
+        uringProvideBuffer(ctx, bid, bufferpoolGetLargeBuffer(loop->bufpool));
+    }
+
+    if (cqe->res > 0 && buf != NULL && io != NULL)
+    {
+        sbufSetLength(buf, (uint32_t) cqe->res);
+        if (uringRecvHeld(st, io))
+        {
+            uring_stash_push_back(&st->stash, &buf);
+            return;
+        }
+        io->last_read_hrtime = loop->cur_hrtime;
+        wioHandleRead(io, buf);
+        return;
+    }
+    if (buf != NULL)
+    {
+        bufferpoolReuseBuffer(loop->bufpool, buf);
+    }
+    if (io == NULL)
+    {
+        return;
+    }
+    if (cqe->res == 0)
+    {
+        if (uringRecvHeld(st, io))
+        {
+            st->stash_eof = true;
+            return;
+        }
+        wioClose(io);
+    }
+    else if (cqe->res < 0 && cqe->res != -ECANCELED && cqe->res != -ENOBUFS && cqe->res != -EAGAIN &&
+             cqe->res != -EINTR)
+    {
+        io->error = -cqe->res;
+        wioClose(io);
+    }
+}
+
+static void uringOnSend(wloop_t *loop, uring_ctx_t *ctx, uring_send_t *op, int res)
+{
+    uring_fd_t *st = (op->fd < ctx->fds_size) ? &ctx->fds[op->fd] : NULL;
+    wio_t      *io = uringLiveIO(loop, op->fd, op->id);
+    if (st == NULL || st->send != op || io == NULL)
+    {
+        uringSendRelease(loop, ctx, op);
+        return;
+    }
+    st->send = NULL;
+    uringSendRelease(loop, ctx, op);
+
+    if (res < 0)
+    {
+        if (res == -EAGAIN)
+        {
+            // resubmitting right away would spin on a full socket buffer, the poll wakes us up instead
+            st->send_blocked = true;
+            uringMarkDirty(ctx, io->fd);
+            return;
+        }
+        if (res == -EINTR)
+        {
+            uringMarkDirty(ctx, io->fd);
+            return;
+        }
+        io->error = -res;
+        wioClose(io);
+        return;
+    }
+    if (res == 0)
+    {
+        wioClose(io);
+        return;
+    }
+
+    uint32_t sent = (uint32_t) res;
+    io->write_bufsize -= sent;
+    while (sent > 0 && ! write_queue_empty(&io->write_queue))
+    {
+        sbuf_t  *buf = *write_queue_front(&io->write_queue);
+        uint32_t len = sbufGetLength(buf);
+        if (sent < len)
+        {
+            sbufShiftRight(buf, sent);
+            break;
+        }
+        sent -= len;
+        bufferpoolReuseBuffer(loop->bufpool, buf);
+        write_queue_pop_front(&io->write_queue);
+    }
+
+    io->last_write_hrtime = loop->cur_hrtime;
+    wioWriteCallBack(io);
+    if (io->closed)
+    {
+        return;
+    }
+    if (write_queue_empty(&io->write_queue))
+    {
+        wioDel(io, WW_WRITE);
+        if (io->close)
+        {
+            io->close = 0;
+            wioClose(io);
+        }
+        return;
+    }
+    uringMarkDirty(ctx, io->fd);
+}
+
+static void uringDispatch(wloop_t *loop, uring_ctx_t *ctx, const struct io_uring_cqe *cqe)
+{
+    const uint64_t        ud    = cqe->user_data;
+    const enum uring_op_e op    = (enum uring_op_e) (ud & kUringOpMask);
+    const bool            final = ! (cqe->flags & IORING_CQE_F_MORE);
+
+    if (final)
+    {
+        ctx->inflight--;
+    }
+    if (op == kUringOpCancel)
+    {
+        return;
+    }
+    if (op == kUringOpSend)
+    {
+        uringOnSend(loop, ctx, (uring_send_t *) (uintptr_t) (ud & ~(uint64_t) kUringOpMask), cqe->res);
+        return;
+    }
+
+    const int      fd          = (int) ((ud >> 8) & 0xFFFFFF);
+    const uint32_t id          = (uint32_t) (ud >> 32);
+    bool           send_wakeup = false;
+    if (final && fd < ctx->fds_size)
+    {
+        // a finished request is armed again at the next flush if its wio still wants it
+        uring_fd_t *st = &ctx->fds[fd];
+        if (st->poll_ud == ud)
+        {
+            st->poll_ud   = 0;
+            st->poll_mask = 0;
+            if (st->send_blocked && cqe->res > 0)
+            {
+                // the socket is writable (or failed), the next flush sends again and sees the error if any
+                st->send_blocked = false;
+                send_wakeup      = true;
+            }
+            uringMarkDirty(ctx, fd);
+        }
+        else if (st->read_ud == ud)
+        {
+            st->read_ud = 0;
+            uringMarkDirty(ctx, fd);
+        }
+    }
+
+    wio_t *io = uringLiveIO(loop, fd, id);
+    switch (op)
+    {
+    case kUringOpPoll:
+        // a poll armed for a blocked send is ours, the wio did not ask for a writable event
+        if (io != NULL && cqe->res > 0 && ! (send_wakeup && io->io_type == WIO_TYPE_TCP && ! io->connect))
+        {
+            uringOnPoll(io, cqe->res);
+        }
+        break;
+    case kUringOpAccept:
+        if (io != NULL)
+        {
+            uringOnAccept(io, cqe->res);
+        }
+        else if (cqe->res >= 0)
+        {
+            close(cqe->res);
+        }
+        break;
+    case kUringOpRecv:
+        uringOnRecv(loop, ctx, io != NULL ? &ctx->fds[fd] : NULL, io, cqe);
+        break;
+    default:
+        break;
+    }
+}
+
+// hands the stashed buffers over now that reading is on again, stops as soon as the wio turns it off or closes
+static int uringReplay(wloop_t *loop, uring_ctx_t *ctx)
+{
+    int nevents = 0;
+    // the callbacks only mark fds dirty, the replay list is filled by the flush, so it is stable while we walk it
+    for (int i = 0; i < uring_fd_list_size(&ctx->replay); i++)
+    {
+        int         fd = ctx->replay.ptr[i];
+        uring_fd_t *st = &ctx->fds[fd];
+        st->replay     = false;
+
+        wio_t *io = uringLiveIO(loop, fd, st->id);
+        while (io != NULL && (io->events & WW_READ) && ! uring_stash_empty(&st->stash))
+        {
+            sbuf_t *buf = *uring_stash_front(&st->stash);
+            uring_stash_pop_front(&st->stash);
+            io->last_read_hrtime = loop->cur_hrtime;
+            wioHandleRead(io, buf);
+            ++nevents;
+            io = uringLiveIO(loop, fd, st->id);
+        }
+        if (io != NULL && (io->events & WW_READ) && uring_stash_empty(&st->stash) && st->stash_eof)
+        {
+            st->stash_eof = false;
+            wioClose(io);
+            ++nevents;
+        }
+    }
+    ctx->replay.size = 0;
+    return nevents;
+}
+
+static int uringReap(wloop_t *loop, uring_ctx_t *ctx)
+{
+    int nevents = 0;
+    for (;;)
+    {
+        unsigned head = *ctx->cq_khead;
+        if (head == __atomic_load_n(ctx->cq_ktail, __ATOMIC_ACQUIRE))
+        {
+            break;
+        }
+        // copy out and release the slot first, callbacks may submit and wait again
+        struct io_uring_cqe cqe = ctx->cqes[head & ctx->cq_mask];
+        __atomic_store_n(ctx->cq_khead, head + 1, __ATOMIC_RELEASE);
+        uringDispatch(loop, ctx, &cqe);
+        ++nevents;
+    }
+    return nevents;
+}
+
+//--------------------iowatcher---------------------------
+
+int iowatcherInit(wloop_t *loop)
+{
+    uringDecide();
+    if (! uringUsable())
+    {
+        return epollwatcherInit(loop);
+    }
+    if (loop->iowatcher)
+    {
+        return 0;
+    }
+    uring_ctx_t *ctx;
+    EVENTLOOP_ALLOC_SIZEOF(ctx);
+    ctx->ring_fd = -1;
+    if (! uringSetup(ctx))
+    {
+        // the probe passed, so this is resource exhaustion rather than a missing feature
+        printError("io_uring_setup");
+        EVENTLOOP_FREE(ctx);
+        return -1;
+    }
+    for (uint16_t i = 0; i < kUringRecvBufCount; i++)
+    {
+        uringProvideBuffer(ctx, i, bufferpoolGetLargeBuffer(loop->bufpool));
+    }
+    uring_fd_list_init(&ctx->dirty, ARRAY_INIT_SIZE);
+    uring_fd_list_init(&ctx->replay, ARRAY_INIT_SIZE);
+    uring_send_list_init(&ctx->sends, ARRAY_INIT_SIZE);
+    uring_send_list_init(&ctx->free_sends, ARRAY_INIT_SIZE);
+    loop->iowatcher = ctx;
+    return 0;
+}
+
+int iowatcherCleanUp(wloop_t *loop)
+{
+    if (! uringUsable())
+    {
+        return epollwatcherCleanUp(loop);
+    }
+    if (loop->iowatcher == NULL)
+    {
+        return 0;
+    }
+    uring_ctx_t *ctx = (uring_ctx_t *) loop->iowatcher;
+    // closing the ring cancels everything still owned by the kernel
+    uringUnmap(ctx);
+    for (int i = 0; i < kUringRecvBufCount; i++)
+    {
+        bufferpoolReuseBuffer(loop->bufpool, ctx->recv_bufs[i]);
+    }
+    for (int i = 0; i < uring_send_list_size(&ctx->sends); i++)
+    {
+        uring_send_t *op = ctx->sends.ptr[i];
+        if (op->in_use)
+        {
+            for (uint32_t b = 0; b < op->orphan_count; b++)
+            {
+                bufferpoolReuseBuffer(loop->bufpool, op->orphans[b]);
+            }
+        }
+        EVENTLOOP_FREE(op);
+    }
+    uring_send_list_cleanup(&ctx->sends);
+    uring_send_list_cleanup(&ctx->free_sends);
+    uring_fd_list_cleanup(&ctx->dirty);
+    uring_fd_list_cleanup(&ctx->replay);
+    for (int i = 0; i < ctx->fds_size; i++)
+    {
+        uringStashRelease(loop, &ctx->fds[i]);
+        uring_stash_cleanup(&ctx->fds[i].stash);
+    }
+    EVENTLOOP_FREE(ctx->fds);
+    EVENTLOOP_FREE(loop->iowatcher);
+    return 0;
+}
+
+int iowatcherAddEvent(wloop_t *loop, int fd, int events)
+{
+    if (loop->iowatcher == NULL && iowatcherInit(loop) != 0)
+    {
+        return -1;
+    }
+    if (! uringUsable())
+    {
+        return epollwatcherAddEvent(loop, fd, events);
+    }
+    discard events;
+    uringMarkDirty((uring_ctx_t *) loop->iowatcher, fd);
+    return 0;
+}
+
+int iowatcherDelEvent(wloop_t *loop, int fd, int events)
+{
+    if (! uringUsable())
+    {
+        return epollwatcherDelEvent(loop, fd, events);
+    }
+    uring_ctx_t *ctx = (uring_ctx_t *) loop->iowatcher;
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+    uring_fd_t *st = uringGetFd(ctx, fd);
+    wio_t      *io = loop->ios.ptr[fd];
+    if ((events & WW_WRITE) && st->send != NULL && io != NULL)
+    {
+        // the wio drops its write_queue right after this (wioDone), the sbufs the kernel still reads from move to
+        // the send request and are recycled when its completion arrives
+        uring_send_t *op = st->send;
+        for (uint32_t i = 0; i < op->count && ! write_queue_empty(&io->write_queue); i++)
+        {
+            op->orphans[op->orphan_count++] = *write_queue_front(&io->write_queue);
+            write_queue_pop_front(&io->write_queue);
+        }
+        uringQueueCancel(ctx, (uint64_t) (uintptr_t) op | kUringOpSend);
+        st->send = NULL;
+    }
+    uringMarkDirty(ctx, fd);
+    return 0;
+}
+
+int iowatcherPollEvents(wloop_t *loop, int timeout)
+{
+    if (! uringUsable())
+    {
+        return epollwatcherPollEvents(loop, timeout);
+    }
+    uring_ctx_t *ctx = (uring_ctx_t *) loop->iowatcher;
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+    uringFlushChanges(loop, ctx);
+    int replayed = uringReplay(loop, ctx);
+    if (ctx->inflight == 0)
+    {
+        return replayed;
+    }
+    if (replayed > 0)
+    {
+        // the callbacks may have queued changes, they are flushed on the next round without waiting
+        timeout = 0;
+    }
+
+    struct __kernel_timespec        ts;
+    struct io_uring_getevents_arg   arg;
+    memorySet(&arg, 0, sizeof(arg));
+    arg.sigmask_sz = _NSIG / 8;
+    if (timeout >= 0)
+    {
+        ts.tv_sec  = timeout / 1000;
+        ts.tv_nsec = (long long) (timeout % 1000) * 1000000;
+        arg.ts     = (uint64_t) (uintptr_t) &ts;
+    }
+
+    // no wait when completions are already there, the enter still submits and runs deferred task work
+    unsigned wait_nr = (timeout == 0 || *ctx->cq_khead != __atomic_load_n(ctx->cq_ktail, __ATOMIC_ACQUIRE)) ? 0 : 1;
+    int ret = uringEnterSys(ctx->ring_fd, uringUnsubmitted(ctx), wait_nr,
+                            IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+    if (ret < 0 && errno != ETIME && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+    {
+        printError("io_uring_enter");
+        return ret;
+    }
+    return replayed + uringReap(loop, ctx);
+}
+#endif
@@ -19,6 +19,9 @@
   #endif
 #elif defined(OS_LINUX)
 #define EVENT_EPOLL
+  #if WITH_IO_URING
+    #define EVENT_IO_URING // io_uring, epoll stays compiled as the runtime fallback
+  #endif
 #elif defined(OS_MAC)
 #define EVENT_KQUEUE
 #elif defined(OS_BSD)
@@ -36,4 +39,16 @@ int iowatcherAddEvent(wloop_t* loop, int fd, int events);
 int iowatcherDelEvent(wloop_t* loop, int fd, int events);
 int iowatcherPollEvents(wloop_t* loop, int timeout);
 
+#ifdef EVENT_IO_URING
+// true once the running kernel proved to support the io_uring backend, otherwise every loop runs on epoll
+bool iowatcherUsingUring(void);
+
+// the epoll backend under its own names, io_uring.c forwards to these when it has to fall back
+int epollwatcherInit(wloop_t* loop);
+int epollwatcherCleanUp(wloop_t* loop);
+int epollwatcherAddEvent(wloop_t* loop, int fd, int events);
+int epollwatcherDelEvent(wloop_t* loop, int fd, int events);
+int epollwatcherPollEvents(wloop_t* loop, int timeout);
+#endif
+
 #endif
@@ -2,11 +2,16 @@
 #include "worker.h"
 #ifndef EVENT_IOCP
 #include "loggers/internal_logger.h"
+#include "sbuf_chain.h"
 #include "werr.h"
 #include "wevent.h"
 #include "wsocket.h"
 #include "wthread.h"
 
+#ifdef OS_LINUX
+#include <netinet/udp.h>
+#endif
+
 static void __connect_timeout_cb(wtimer_t *timer)
 {
     wio_t *io = (wio_t *) timer->privdata;
@@ -53,6 +58,17 @@ static void __read_cb(wio_t *io, sbuf_t *buf)
     wioHandleRead(io, buf);
 }
 
+static void __read_batch_cb(wio_t *io, wio_datagram_t *datagrams, unsigned int count)
+{
+    io->last_read_hrtime = io->loop->cur_hrtime;
+    // keep wioGetPeerAddr meaningful for callers that still look at it
+    if (io->peeraddr_u != NULL)
+    {
+        memoryCopy(io->peeraddr_u, &datagrams[count - 1].peer, sizeof(sockaddr_u));
+    }
+    wioReadBatchCallBack(io, datagrams, count);
+}
+
 static void __write_cb(wio_t *io)
 {
     // printd("< %.*s\n", writebytes, buf);
@@ -165,12 +181,6 @@ static int __nio_read(wio_t *io, void *buf, unsigned int len)
     {
 
     case WIO_TYPE_TCP:
-
-        // #if defined(OS_LINUX) && defined(HAVE_PIPE)
-        //         if(io->pfd_w){
-        //             nread = splice(io->fd, NULL,io->pfd_w,0, len, SPLICE_F_NONBLOCK);
-        //         }else
-        // #endif
         nread = recv(io->fd, buf, (size_t) len, 0);
         break;
     case WIO_TYPE_UDP: // udp can also be more than 1472 bytes
@@ -193,12 +203,6 @@ static int __nio_write(wio_t *io, const void *buf, int len)
     switch (io->io_type)
     {
     case WIO_TYPE_TCP: {
-        // #if defined(OS_LINUX) && defined(HAVE_PIPE)
-        //     if(io->pfd_r){
-        //         nwrite = splice(io->pfd_r, NULL,io->fd,0, len, SPLICE_F_NONBLOCK);
-        //         break;
-        //     }
-        // #endif
         int flag = 0;
 #ifdef MSG_NOSIGNAL
         flag |= MSG_NOSIGNAL;
@@ -218,6 +222,807 @@ static int __nio_write(wio_t *io, const void *buf, int len)
     return nwrite;
 }
 
+#ifdef OS_LINUX
+
+/*
+    Datagram batching (linux)
+
+    reads are drained with one recvmmsg per readiness event instead of one recvfrom per datagram, when the
+    kernel supports UDP_GRO the socket is switched to it and coalesced super-packets are split back into
+    datagrams here (the callback never sees a super-packet).
+
+    wioWriteTo queues datagrams on the io, the loop flushes every queued io once per iteration right before
+    polling (or earlier when the queue is full) with one sendmmsg, runs of datagrams to the same peer with the
+    same size are sent as a single UDP_SEGMENT (gso) message.
+*/
+
+enum
+{
+    kDatagramReadBatch      = 32,    // recvmmsg slots, also the max datagrams handed to the callback at once
+    kDatagramGroSlots       = 8,     // recvmmsg slots in gro mode, each one may carry a coalesced super-packet
+    kDatagramGroSlotSize    = 65535, // max size of one gro super-packet
+    kDatagramWriteBatch     = 64,    // queued datagrams before wioWriteTo forces a flush
+    kDatagramGsoMaxSegments = 64,    // kernel limit (UDP_MAX_SEGMENTS)
+    kDatagramGsoMaxBytes    = 65000  // stays under the ip payload limit for both families
+};
+
+typedef struct wio_datagram_state_s
+{
+    // read
+    struct mmsghdr rmsgs[kDatagramReadBatch];
+    struct iovec   riovs[kDatagramReadBatch];
+    sockaddr_u     raddrs[kDatagramReadBatch];
+    char           rcontrol[kDatagramGroSlots][CMSG_SPACE(sizeof(int))];
+    sbuf_t        *rbufs[kDatagramReadBatch]; // pool buffers the kernel writes into directly, refilled lazily
+    uint8_t       *gro_area;                  // kDatagramGroSlots * kDatagramGroSlotSize, only in gro mode
+    wio_datagram_t delivered[kDatagramReadBatch];
+    // write
+    wio_datagram_t queue[kDatagramWriteBatch];
+    struct mmsghdr wmsgs[kDatagramWriteBatch];
+    struct iovec   wiovs[kDatagramWriteBatch];
+    char           wcontrol[kDatagramWriteBatch][CMSG_SPACE(sizeof(uint16_t))];
+    unsigned int   queued;
+
+    bool initialized;
+    bool gro_decided;
+    bool gro;
+    bool gso;
+    bool flush_listed;
+
+} wio_datagram_state_t;
+
+static wio_datagram_state_t *wioDatagramState(wio_t *io)
+{
+    if (io->dgram == NULL)
+    {
+        EVENTLOOP_ALLOC(io->dgram, sizeof(wio_datagram_state_t));
+    }
+    wio_datagram_state_t *ds = io->dgram;
+    if (! ds->initialized)
+    {
+        // decided per socket, wioDatagramsDone resets it since the io struct is reused for the next fd
+        ds->initialized = true;
+#if defined(UDP_SEGMENT)
+        ds->gso = (io->io_type == WIO_TYPE_UDP);
+#endif
+    }
+    return ds;
+}
+
+static inline bool datagramSamePeer(const sockaddr_u *a, const sockaddr_u *b)
+{
+    // sin_port and sin6_port share the offset
+    return a->sin.sin_port == b->sin.sin_port && sockaddrCmpIP(a, b);
+}
+
+static void datagramDeliver(wio_t *io, wio_datagram_state_t *ds, unsigned int count)
+{
+    if (count > 0)
+    {
+        __read_batch_cb(io, ds->delivered, count);
+    }
+}
+
+static bool nio_read_datagrams_failed(wio_t *io, int nread)
+{
+    if (nread > 0)
+    {
+        return false;
+    }
+    if (nread < 0)
+    {
+        int err = socketERRNO();
+        if (err != EAGAIN && err != EINTR && err != EMSGSIZE)
+        {
+            io->error = err;
+        }
+    }
+    return true;
+}
+
+static void nio_read_datagrams_gro(wio_t *io, wio_datagram_state_t *ds)
+{
+    buffer_pool_t *pool = io->loop->bufpool;
+
+    for (unsigned int i = 0; i < kDatagramGroSlots; ++i)
+    {
+        ds->riovs[i].iov_base = ds->gro_area + ((size_t) i * kDatagramGroSlotSize);
+        ds->riovs[i].iov_len  = kDatagramGroSlotSize;
+        ds->rmsgs[i].msg_hdr  = (struct msghdr) {.msg_name       = &ds->raddrs[i],
+                                                 .msg_namelen    = sizeof(sockaddr_u),
+                                                 .msg_iov        = &ds->riovs[i],
+                                                 .msg_iovlen     = 1,
+                                                 .msg_control    = ds->rcontrol[i],
+                                                 .msg_controllen = sizeof(ds->rcontrol[i])};
+    }
+
+    int nread = recvmmsg(io->fd, ds->rmsgs, kDatagramGroSlots, MSG_DONTWAIT, NULL);
+    if (nio_read_datagrams_failed(io, nread))
+    {
+        return;
+    }
+
+    unsigned int count = 0;
+    for (int i = 0; i < nread; ++i)
+    {
+        uint32_t       len  = ds->rmsgs[i].msg_len;
+        uint32_t       seg  = 0;
+        const uint8_t *data = ds->riovs[i].iov_base;
+
+        for (struct cmsghdr *cm = CMSG_FIRSTHDR(&ds->rmsgs[i].msg_hdr); cm != NULL;
+             cm                 = CMSG_NXTHDR(&ds->rmsgs[i].msg_hdr, cm))
+        {
+            if (cm->cmsg_level == IPPROTO_UDP && cm->cmsg_type == UDP_GRO)
+            {
+                int gso_size;
+                memoryCopy(&gso_size, CMSG_DATA(cm), sizeof(gso_size));
+                seg = (uint32_t) gso_size;
+            }
+        }
+        if (seg == 0 || seg > len)
+        {
+            seg = len;
+        }
+
+        for (uint32_t offset = 0; offset < len; offset += seg)
+        {
+            uint32_t part = min(seg, len - offset);
+            sbuf_t  *buf  = part <= bufferpoolGetSmallBufferSize(pool) ? bufferpoolGetSmallBuffer(pool)
+                                                                      : bufferpoolGetLargeBuffer(pool);
+            if (sbufGetRightCapacity(buf) < part)
+            {
+                bufferpoolReuseBuffer(pool, buf);
+                continue;
+            }
+            sbufSetLength(buf, part);
+            sbufWrite(buf, data + offset, part);
+
+            ds->delivered[count].buf  = buf;
+            ds->delivered[count].peer = ds->raddrs[i];
+            if (++count == kDatagramReadBatch)
+            {
+                datagramDeliver(io, ds, count);
+                count = 0;
+                if (io->closed)
+                {
+                    return;
+                }
+            }
+        }
+    }
+    datagramDeliver(io, ds, count);
+}
+
+static void nio_read_datagrams(wio_t *io)
+{
+    wio_datagram_state_t *ds = wioDatagramState(io);
+    if (! ds->gro_decided)
+    {
+        ds->gro_decided = true;
+#if defined(UDP_GRO)
+        int on = 1;
+        if (io->io_type == WIO_TYPE_UDP && setsockopt(io->fd, IPPROTO_UDP, UDP_GRO, &on, sizeof(on)) == 0)
+        {
+            if (ds->gro_area == NULL)
+            {
+                EVENTLOOP_ALLOC(ds->gro_area, (size_t) kDatagramGroSlots * kDatagramGroSlotSize);
+            }
+            ds->gro = true;
+        }
+#endif
+    }
+    if (ds->gro)
+    {
+        nio_read_datagrams_gro(io, ds);
+        return;
+    }
+
+    buffer_pool_t *pool = io->loop->bufpool;
+
+    for (unsigned int i = 0; i < kDatagramReadBatch; ++i)
+    {
+        if (ds->rbufs[i] == NULL)
+        {
+            ds->rbufs[i] = bufferpoolGetSmallBuffer(pool);
+        }
+        ds->riovs[i].iov_base = sbufGetMutablePtr(ds->rbufs[i]);
+        ds->riovs[i].iov_len  = sbufGetRightCapacity(ds->rbufs[i]);
+        ds->rmsgs[i].msg_hdr  = (struct msghdr) {
+             .msg_name = &ds->raddrs[i], .msg_namelen = sizeof(sockaddr_u), .msg_iov = &ds->riovs[i], .msg_iovlen = 1};
+    }
+
+    int nread = recvmmsg(io->fd, ds->rmsgs, kDatagramReadBatch, MSG_DONTWAIT, NULL);
+    if (nio_read_datagrams_failed(io, nread))
+    {
+        return;
+    }
+
+    for (int i = 0; i < nread; ++i)
+    {
+        sbufSetLength(ds->rbufs[i], min((uint32_t) ds->riovs[i].iov_len, ds->rmsgs[i].msg_len));
+        ds->delivered[i].buf  = ds->rbufs[i];
+        ds->delivered[i].peer = ds->raddrs[i];
+        ds->rbufs[i]          = NULL;
+    }
+    datagramDeliver(io, ds, (unsigned int) nread);
+}
+
+static void datagramSendOneByOne(wio_t *io, struct msghdr *msg)
+{
+    for (size_t i = 0; i < msg->msg_iovlen; ++i)
+    {
+        if (sendto(io->fd, msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len, 0, msg->msg_name, msg->msg_namelen) <
+            0)
+        {
+            io->error = socketERRNO();
+        }
+    }
+}
+
+static void nio_flush_datagrams(wio_t *io, wio_datagram_state_t *ds)
+{
+    unsigned int nmsgs = 0;
+
+    for (unsigned int i = 0; i < ds->queued;)
+    {
+        const sockaddr_u *peer = &ds->queue[i].peer;
+        uint32_t          seg  = sbufGetLength(ds->queue[i].buf);
+        unsigned int      run  = 1;
+
+        if (ds->gso)
+        {
+            // same peer, same size, only the last segment of a run may be shorter
+            uint32_t total = seg;
+            while (i + run < ds->queued && run < kDatagramGsoMaxSegments)
+            {
+                uint32_t len = sbufGetLength(ds->queue[i + run].buf);
+                if (len > seg || total + len > kDatagramGsoMaxBytes || ! datagramSamePeer(peer, &ds->queue[i + run].peer))
+                {
+                    break;
+                }
+                total += len;
+                run++;
+                if (len < seg)
+                {
+                    break;
+                }
+            }
+        }
+
+        for (unsigned int k = 0; k < run; ++k)
+        {
+            ds->wiovs[i + k].iov_base = sbufGetMutablePtr(ds->queue[i + k].buf);
+            ds->wiovs[i + k].iov_len  = sbufGetLength(ds->queue[i + k].buf);
+        }
+
+        struct msghdr *msg = &ds->wmsgs[nmsgs].msg_hdr;
+        *msg = (struct msghdr) {.msg_name    = (void *) peer,
+                                .msg_namelen = (socklen_t) SOCKADDR_LEN(peer),
+                                .msg_iov     = &ds->wiovs[i],
+                                .msg_iovlen  = run};
+#if defined(UDP_SEGMENT)
+        if (run > 1)
+        {
+            msg->msg_control    = ds->wcontrol[nmsgs];
+            msg->msg_controllen = sizeof(ds->wcontrol[nmsgs]);
+            struct cmsghdr *cm  = CMSG_FIRSTHDR(msg);
+            cm->cmsg_level      = IPPROTO_UDP;
+            cm->cmsg_type       = UDP_SEGMENT;
+            cm->cmsg_len        = CMSG_LEN(sizeof(uint16_t));
+            uint16_t gso_size   = (uint16_t) seg;
+            memoryCopy(CMSG_DATA(cm), &gso_size, sizeof(gso_size));
+        }
+#endif
+        nmsgs++;
+        i += run;
+    }
+
+    unsigned int sent = 0;
+    while (sent < nmsgs)
+    {
+        int ret = sendmmsg(io->fd, ds->wmsgs + sent, nmsgs - sent, 0);
+        if (ret > 0)
+        {
+            sent += (unsigned int) ret;
+            continue;
+        }
+        int err = socketERRNO();
+        if (err == EINTR)
+        {
+            continue;
+        }
+        if (err == EAGAIN)
+        {
+            // nonblocking socket with a full send buffer, datagrams are droppable
+            break;
+        }
+        if (ds->wmsgs[sent].msg_hdr.msg_iovlen > 1 && (err == EIO || err == EINVAL || err == ENOPROTOOPT))
+        {
+            // no gso on this path (old kernel, device without checksum offload), stop trying on this socket
+            wlogw("udp gso disabled on fd[%d], errno=%d", io->fd, err);
+            ds->gso = false;
+            datagramSendOneByOne(io, &ds->wmsgs[sent].msg_hdr);
+        }
+        else
+        {
+            io->error = err;
+        }
+        // the failed message is skipped, the rest is retried
+        sent++;
+    }
+
+    for (unsigned int i = 0; i < ds->queued; ++i)
+    {
+        bufferpoolReuseBuffer(io->loop->bufpool, ds->queue[i].buf);
+    }
+    ds->queued            = 0;
+    io->last_write_hrtime = io->loop->cur_hrtime;
+}
+
+int wioWriteTo(wio_t *io, sbuf_t *buf, const sockaddr_u *peer)
+{
+    if (io->closed)
+    {
+        wloge("wioWriteTo called but fd[%d] already closed!", io->fd);
+        bufferpoolReuseBuffer(io->loop->bufpool, buf);
+        return -1;
+    }
+    wio_datagram_state_t *ds = wioDatagramState(io);
+    if (ds->queued == kDatagramWriteBatch)
+    {
+        nio_flush_datagrams(io, ds);
+    }
+    int len                   = (int) sbufGetLength(buf);
+    ds->queue[ds->queued].buf  = buf;
+    ds->queue[ds->queued].peer = *peer;
+    ds->queued++;
+    if (! ds->flush_listed)
+    {
+        ds->flush_listed = true;
+        io_array_push_back(&io->loop->datagram_flush_ios, &io);
+    }
+    return len;
+}
+
+void wloopFlushDatagrams(wloop_t *loop)
+{
+    struct io_array *ios = &loop->datagram_flush_ios;
+    for (size_t i = 0; i < ios->size; ++i)
+    {
+        wio_t *io                = ios->ptr[i];
+        io->dgram->flush_listed = false;
+        nio_flush_datagrams(io, io->dgram);
+    }
+    ios->size = 0;
+}
+
+void wioDatagramsDone(wio_t *io)
+{
+    wio_datagram_state_t *ds = io->dgram;
+    if (ds == NULL)
+    {
+        return;
+    }
+    if (ds->queued > 0)
+    {
+        nio_flush_datagrams(io, ds);
+    }
+    if (ds->flush_listed)
+    {
+        struct io_array *ios = &io->loop->datagram_flush_ios;
+        for (size_t i = 0; i < ios->size; ++i)
+        {
+            if (ios->ptr[i] == io)
+            {
+                io_array_del_nomove(ios, (int) i);
+                break;
+            }
+        }
+        ds->flush_listed = false;
+    }
+    for (unsigned int i = 0; i < kDatagramReadBatch; ++i)
+    {
+        if (ds->rbufs[i] != NULL)
+        {
+            bufferpoolReuseBuffer(io->loop->bufpool, ds->rbufs[i]);
+            ds->rbufs[i] = NULL;
+        }
+    }
+    // the struct (and the gro area) is kept for the next socket on this io, wioFree releases it
+    ds->initialized = false;
+    ds->gro_decided = false;
+    ds->gro         = false;
+    ds->gso         = false;
+}
+
+void wioDatagramsFree(wio_t *io)
+{
+    if (io->dgram != NULL)
+    {
+        EVENTLOOP_FREE(io->dgram->gro_area);
+        EVENTLOOP_FREE(io->dgram);
+    }
+}
+
+#else
+
+int wioWriteTo(wio_t *io, sbuf_t *buf, const sockaddr_u *peer)
+{
+    memoryCopy(io->peeraddr_u, peer, sizeof(sockaddr_u));
+    return wioWrite(io, buf);
+}
+
+void wloopFlushDatagrams(wloop_t *loop)
+{
+    discard loop;
+}
+
+void wioDatagramsDone(wio_t *io)
+{
+    discard io;
+}
+
+void wioDatagramsFree(wio_t *io)
+{
+    discard io;
+}
+
+#endif
+
+#ifdef OS_LINUX
+
+/*
+    Splice (linux)
+
+    a tcp io with a splice callback reads with splice(2) from its socket into its own pipe and hands the read end
+    to the callback, which moves the bytes on to another socket with wioSpliceWrite (pipe -> socket, splice again)
+    or takes them out as a buffer with wioSpliceTakeBuffer; on the first path the bytes never reach user space.
+    buffers are taken from the pool one large buffer at a time, the rest is offered to the callback again
+
+    when the destination socket can not take everything, the rest stays in the pipe of the source and is counted as
+    queued bytes of the destination (splice_pending), it is written before anything that is written after it; the
+    source stops reading until then, like it does for a full write queue
+
+    closing the destination copies what is still pending into its write queue, after that the source pipe is not
+    referenced anymore and the source may close (its pipe is closed with the socket)
+*/
+
+enum
+{
+    kSplicePipeSize = 1 << 18 // asked with F_SETPIPE_SZ, the default pipe size (64K) stays if it is refused
+};
+
+static void wio_handle_events(wio_t *io);
+
+static bool wioSpliceCreatePipe(wio_t *io)
+{
+    if (pipe2(io->splice_pipe, O_NONBLOCK | O_CLOEXEC) != 0)
+    {
+        io->splice_pipe[0] = io->splice_pipe[1] = -1;
+        return false;
+    }
+    fcntl(io->splice_pipe[1], F_SETPIPE_SZ, kSplicePipeSize);
+    return true;
+}
+
+bool wioSetCallBackSplice(wio_t *io, wsplice_cb splice_cb)
+{
+    if (splice_cb == NULL)
+    {
+        io->splice_cb = NULL;
+        return true;
+    }
+    if (io->io_type != WIO_TYPE_TCP)
+    {
+        return false;
+    }
+#ifdef EVENT_IO_URING
+    // tcp sockets of the io_uring backend receive into provided buffers and send their write_queue, never nio_*
+    if (iowatcherUsingUring())
+    {
+        return false;
+    }
+#endif
+    if (io->splice_pipe[0] < 0 && ! wioSpliceCreatePipe(io))
+    {
+        wlogw("splice pipe creation failed: %s", strerror(errno));
+        return false;
+    }
+    io->splice_cb = splice_cb;
+    return true;
+}
+
+// reads up to one large buffer of the len bytes waiting in the pipe
+static sbuf_t *wioSpliceReadChunk(wio_t *io, int pipe_fd, uint32_t len)
+{
+    buffer_pool_t *pool = io->loop->bufpool;
+    sbuf_t        *buf  = bufferpoolGetLargeBuffer(pool);
+
+    len = min(len, bufferpoolGetLargeBufferSize(pool));
+
+    uint32_t taken = 0;
+    while (taken < len)
+    {
+        ssize_t nread = read(pipe_fd, sbufGetMutablePtr(buf) + taken, len - taken);
+        if (nread <= 0)
+        {
+            if (nread < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            // the bytes were counted when they entered the pipe, this only happens if the pipe is broken
+            wloge("splice pipe read failed after %u of %u bytes: %s", (unsigned int) taken, (unsigned int) len,
+                  nread < 0 ? strerror(errno) : "pipe is empty");
+            break;
+        }
+        taken += (uint32_t) nread;
+    }
+    sbufSetLength(buf, taken);
+    return buf;
+}
+
+sbuf_t *wioSpliceTakeBuffer(wio_t *io, int pipe_fd, uint32_t len)
+{
+    wloop_t *loop = io->loop;
+    sbuf_t  *buf  = wioSpliceReadChunk(io, pipe_fd, len);
+
+    // what does not fit stays in the pipe, nio_read_splice hands it to the callback again (a broken pipe is not retried)
+    if (sbufGetLength(buf) == bufferpoolGetLargeBufferSize(loop->bufpool) && loop->splice_io != NULL &&
+        pipe_fd == loop->splice_io->splice_pipe[0])
+    {
+        loop->splice_left += len - sbufGetLength(buf);
+    }
+    return buf;
+}
+
+// bytes this socket can not take now stay in the pipe they are in
+static void wioSpliceKeepPending(wio_t *io, int pipe_fd, uint32_t len)
+{
+    io->splice_pending_fd = pipe_fd;
+    io->splice_pending += len;
+    io->write_bufsize += len;
+    wioAdd(io, wio_handle_events, WW_WRITE);
+}
+
+// moves the pending bytes to the write queue, so the source pipe is no longer needed
+static void wioSpliceSettle(wio_t *io)
+{
+    if (io->splice_pending == 0)
+    {
+        return;
+    }
+    int      pipe_fd = io->splice_pending_fd;
+    uint32_t left    = io->splice_pending;
+
+    io->write_bufsize -= io->splice_pending;
+    io->splice_pending    = 0;
+    io->splice_pending_fd = -1;
+
+    if (io->write_queue.maxsize == 0)
+    {
+        write_queue_init(&io->write_queue, 4);
+    }
+    // the pending bytes are older than anything queued, so they go to the front, in order
+    size_t front = 0;
+    while (left > 0)
+    {
+        sbuf_t  *buf   = wioSpliceReadChunk(io, pipe_fd, left);
+        uint32_t taken = sbufGetLength(buf);
+        if (taken == 0)
+        {
+            bufferpoolReuseBuffer(io->loop->bufpool, buf);
+            break;
+        }
+        write_queue_push_back(&io->write_queue, &buf);
+        sbuf_t **queued = write_queue_data(&io->write_queue);
+        memoryMove(queued + front + 1, queued + front,
+                   sizeof(sbuf_t *) * (write_queue_size(&io->write_queue) - 1 - front));
+        queued[front++] = buf;
+        io->write_bufsize += taken;
+        left -= taken;
+    }
+}
+
+// moves len bytes of the pipe out in large buffers, to the write queue or (write is false) to the pool
+static void wioSpliceDrain(wio_t *io, int pipe_fd, uint32_t len, bool write)
+{
+    while (len > 0)
+    {
+        sbuf_t  *buf   = wioSpliceReadChunk(io, pipe_fd, len);
+        uint32_t taken = sbufGetLength(buf);
+        if (! write || taken == 0)
+        {
+            bufferpoolReuseBuffer(io->loop->bufpool, buf);
+        }
+        else
+        {
+            wioWrite(io, buf);
+        }
+        if (taken == 0)
+        {
+            break;
+        }
+        len -= taken;
+    }
+}
+
+static void wioSpliceClosePipe(wio_t *io)
+{
+    if (io->splice_pipe[0] >= 0)
+    {
+        close(io->splice_pipe[0]);
+        close(io->splice_pipe[1]);
+        io->splice_pipe[0] = io->splice_pipe[1] = -1;
+    }
+    io->splice_cb = NULL;
+}
+
+// @return false on a socket error (io->error is set), moved holds the bytes that left the pipe either way
+static bool nio_splice_to_socket(wio_t *io, int pipe_fd, uint32_t len, uint32_t *moved)
+{
+    bool ok = true;
+    *moved  = 0;
+    while (*moved < len)
+    {
+        ssize_t nwrite = splice(pipe_fd, NULL, io->fd, NULL, len - *moved, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        if (nwrite < 0)
+        {
+            int err = socketERRNO();
+            if (err == EINTR)
+            {
+                continue;
+            }
+            if (err == EAGAIN)
+            {
+                break;
+            }
+            io->error = err;
+            ok        = false;
+            break;
+        }
+        if (nwrite == 0)
+        {
+            io->error = EPIPE;
+            ok        = false;
+            break;
+        }
+        *moved += (uint32_t) nwrite;
+    }
+    if (*moved > 0)
+    {
+        io->last_write_hrtime = io->loop->cur_hrtime;
+    }
+    return ok;
+}
+
+int wioSpliceWrite(wio_t *io, int pipe_fd, uint32_t len)
+{
+    if (io->closed)
+    {
+        wloge("wioSpliceWrite called but fd[%d] already closed!", io->fd);
+        return -1;
+    }
+    if (io->splice_pending > 0 && io->splice_pending_fd == pipe_fd)
+    {
+        wioSpliceKeepPending(io, pipe_fd, len);
+        return 0;
+    }
+    if (io->splice_pending > 0 || ! write_queue_empty(&io->write_queue))
+    {
+        // older bytes are still waiting, these go behind them through the write queue
+        wioSpliceDrain(io, pipe_fd, len, true);
+        return io->closed ? -1 : 0;
+    }
+
+    uint32_t nwrite = 0;
+    if (! nio_splice_to_socket(io, pipe_fd, len, &nwrite))
+    {
+        // the rest is dropped from the pipe, the source must not find it there with its next read
+        wioSpliceDrain(io, pipe_fd, len - nwrite, false);
+        wioCloseAsync(io);
+        return -1;
+    }
+    if (nwrite < len)
+    {
+        wioSpliceKeepPending(io, pipe_fd, len - nwrite);
+    }
+    if (nwrite > 0)
+    {
+        __write_cb(io);
+    }
+    return (int) nwrite;
+}
+
+static void nio_read_splice(wio_t *io)
+{
+    ssize_t nread = splice(io->fd, NULL, io->splice_pipe[1], NULL, kSplicePipeSize, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (nread < 0)
+    {
+        int err = socketERRNO();
+        if (err == EAGAIN || err == EINTR)
+        {
+            return;
+        }
+        io->error = err;
+        wioClose(io);
+        return;
+    }
+    if (nread == 0)
+    {
+        wioClose(io);
+        return;
+    }
+    io->last_read_hrtime = io->loop->cur_hrtime;
+
+    wloop_t *loop       = io->loop;
+    wio_t   *outer_io   = loop->splice_io;
+    uint32_t outer_left = loop->splice_left;
+    int      pipe_fd    = io->splice_pipe[0];
+
+    loop->splice_io   = io;
+    loop->splice_left = 0;
+    io->splice_cb(io, pipe_fd, (uint32_t) nread);
+
+    // wioSpliceTakeBuffer hands out one large buffer per call, the rest is offered again until the pipe is empty
+    while (loop->splice_left > 0 && ! io->closed)
+    {
+        uint32_t left     = loop->splice_left;
+        loop->splice_left = 0;
+        if (io->splice_cb != NULL)
+        {
+            io->splice_cb(io, pipe_fd, left);
+        }
+        else
+        {
+            __read_cb(io, wioSpliceTakeBuffer(io, pipe_fd, left));
+        }
+    }
+    loop->splice_io   = outer_io;
+    loop->splice_left = outer_left;
+}
+
+// @return false if the socket failed, true otherwise (bytes may still be pending)
+static bool nio_write_splice_pending(wio_t *io)
+{
+    uint32_t nwrite = 0;
+    bool     ok     = nio_splice_to_socket(io, io->splice_pending_fd, io->splice_pending, &nwrite);
+
+    // accounted on failure too, closing the io settles only the bytes that are still in the pipe
+    io->splice_pending -= nwrite;
+    io->write_bufsize -= nwrite;
+    if (io->splice_pending == 0)
+    {
+        io->splice_pending_fd = -1;
+    }
+    return ok;
+}
+
+#else
+
+bool wioSetCallBackSplice(wio_t *io, wsplice_cb splice_cb)
+{
+    discard io;
+    return splice_cb == NULL;
+}
+
+int wioSpliceWrite(wio_t *io, int pipe_fd, uint32_t len)
+{
+    discard io;
+    discard pipe_fd;
+    discard len;
+    return -1;
+}
+
+sbuf_t *wioSpliceTakeBuffer(wio_t *io, int pipe_fd, uint32_t len)
+{
+    discard io;
+    discard pipe_fd;
+    discard len;
+    return NULL;
+}
+
+#endif
+
 static void nio_read(wio_t *io)
 {
     // printd("nio_read fd=%d\n", io->fd);
@@ -225,11 +1030,18 @@ static void nio_read(wio_t *io)
     int err   = 0;
     //  read:;
 
-    // #if defined(OS_LINUX) && defined(HAVE_PIPE)
-    //     if(io->pfd_w){
-    //         len = (1U << 20); // 1 MB
-    //     }else
-    // #endif
+#ifdef OS_LINUX
+    if (io->splice_cb != NULL)
+    {
+        nio_read_splice(io);
+        return;
+    }
+    if (io->read_batch_cb != NULL && (io->io_type & (WIO_TYPE_SOCK_DGRAM | WIO_TYPE_SOCK_RAW)))
+    {
+        nio_read_datagrams(io);
+        return;
+    }
+#endif
     sbuf_t *buf;
 
     switch (io->io_type)
@@ -279,20 +1091,14 @@ static void nio_read(wio_t *io)
         goto disconnect;
     }
     // printf("%d \n",nread);
-    // #if defined(OS_LINUX) && defined(HAVE_PIPE)
-    //     if(io->pfd_w == 0x0 && nread < len){
-    //         // NOTE: make string friendly
-    //         ((char*)buf)[nread] = '\0';
-    //     }
-    // #else
-
-    // if (nread < len) {
-    //     // NOTE: make string friendly
-    //     ((char*)buf)[nread] = '\0';
-    // }
-    // #endif
 
     sbufSetLength(buf, min(available, (uint32_t)nread));
+    if (io->read_batch_cb != NULL && (io->io_type & (WIO_TYPE_SOCK_DGRAM | WIO_TYPE_SOCK_RAW)))
+    {
+        wio_datagram_t datagram = {.buf = buf, .peer = *io->peeraddr_u};
+        __read_batch_cb(io, &datagram, 1);
+        return;
+    }
     __read_cb(io, buf);
     // user consumed buffer
     return;
@@ -309,6 +1115,20 @@ static void nio_write(wio_t *io)
     // printd("nio_write fd=%d\n", io->fd);
     int nwrite = 0, err = 0;
     //
+#ifdef OS_LINUX
+    if (io->splice_pending > 0)
+    {
+        if (! nio_write_splice_pending(io))
+        {
+            goto write_error;
+        }
+        __write_cb(io);
+        if (io->splice_pending > 0 || io->closed)
+        {
+            return;
+        }
+    }
+#endif
 write:
     if (write_queue_empty(&io->write_queue))
     {
@@ -350,12 +1170,7 @@ write:
     {
         // NOTE: after write_cb, pbuf maybe invalid.
         // EVENTLOOP_FREE(pbuf->base);
-        // #if defined(OS_LINUX) && defined(HAVE_PIPE)
-        //     if(io->pfd_w == 0)
-        //         EVENTLOOP_FREE(base);
-        // #else
         bufferpoolReuseBuffer(io->loop->bufpool, buf);
-        // #endif
         write_queue_pop_front(&io->write_queue);
         __write_cb(io);
 
@@ -396,9 +1211,9 @@ static void wio_handle_events(wio_t *io)
 
     if ((io->events & WW_WRITE) && (io->revents & WW_WRITE))
     {
-        // NOTE: del WW_WRITE, if write_queue empty
+        // NOTE: del WW_WRITE, if write_queue empty and no spliced bytes are pending
         //
-        if (write_queue_empty(&io->write_queue))
+        if (write_queue_empty(&io->write_queue) && io->splice_pending == 0)
         {
             wioDel(io, WW_WRITE);
         }
@@ -447,9 +1262,10 @@ int wioConnect(wio_t *io)
         nio_connect_async(io);
         return 0;
     }
-    int timeout                 = io->connect_timeout ? io->connect_timeout : WIO_DEFAULT_CONNECT_TIMEOUT;
-    io->connect_timer           = wtimerAdd(io->loop, __connect_timeout_cb, (uint32_t)timeout, 1);
-    io->connect_timer->privdata = io;
+    wio_timers_t *timers            = wioGetTimers(io);
+    int           timeout           = timers->connect_timeout ? timers->connect_timeout : WIO_DEFAULT_CONNECT_TIMEOUT;
+    timers->connect_timer           = wtimerAdd(io->loop, __connect_timeout_cb, (uint32_t)timeout, 1);
+    timers->connect_timer->privdata = io;
     io->connect                 = 1;
     return wioAdd(io, wio_handle_events, WW_WRITE);
 }
@@ -466,6 +1282,93 @@ int wioRead(wio_t *io)
     return 0;
 }
 
+#ifndef OS_WIN
+
+enum
+{
+    kChainWriteMaxIov = 64
+};
+
+/*
+    a chained buffer goes out with one sendmsg (one iovec per segment) when nothing is queued before it, the bytes
+    the socket did not take are linearized for the write queue, so the queue (and the io_uring sends) only ever hold
+    contiguous buffers
+*/
+int wioWriteChain(wio_t *io, sbuf_t *buf)
+{
+    buffer_pool_t *pool = io->loop->bufpool;
+    uint32_t       len  = sbufGetLength(buf);
+
+    if (io->closed || io->io_type != WIO_TYPE_TCP || len == 0 || ! write_queue_empty(&io->write_queue) ||
+        io->splice_pending != 0)
+    {
+        return wioWrite(io, sbufchainLinearize(buf, pool));
+    }
+
+    struct iovec iov[kChainWriteMaxIov];
+    uint32_t     count = min(sbufchainGetSegmentCount(buf), (uint32_t) kChainWriteMaxIov);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t seg_len;
+        iov[i].iov_base = (void *) sbufchainGetSegment(buf, i, &seg_len);
+        iov[i].iov_len  = seg_len;
+    }
+    struct msghdr msg  = {.msg_iov = iov, .msg_iovlen = count};
+    int           flag = 0;
+#ifdef MSG_NOSIGNAL
+    flag |= MSG_NOSIGNAL;
+#endif
+    int nwrite = (int) sendmsg(io->fd, &msg, flag);
+    if (nwrite < 0)
+    {
+        int err = socketERRNO();
+        if (err != EAGAIN && err != EINTR)
+        {
+            io->error = err;
+            goto write_error;
+        }
+        nwrite = 0;
+    }
+    else if (nwrite == 0)
+    {
+        goto write_error;
+    }
+
+    if ((uint32_t) nwrite == len)
+    {
+        bufferpoolReuseBuffer(pool, buf);
+        __write_cb(io);
+        return nwrite;
+    }
+
+    // more segments than iovecs, or a full socket buffer, wioWrite sends or queues the rest
+    sbufchainConsume(buf, (uint32_t) nwrite, pool);
+    int rest = wioWrite(io, sbufchainLinearize(buf, pool));
+    if (rest < 0)
+    {
+        return rest;
+    }
+    if (rest == 0 && nwrite > 0)
+    {
+        __write_cb(io);
+    }
+    return nwrite + rest;
+
+write_error:
+    bufferpoolReuseBuffer(pool, buf);
+    wioCloseAsync(io);
+    return -1;
+}
+
+#else
+
+int wioWriteChain(wio_t *io, sbuf_t *buf)
+{
+    return wioWrite(io, sbufchainLinearize(buf, io->loop->bufpool));
+}
+
+#endif
+
 int wioWrite(wio_t *io, sbuf_t *buf)
 {
     if (io->closed)
@@ -477,7 +1380,7 @@ int wioWrite(wio_t *io, sbuf_t *buf)
     int nwrite = 0, err = 0;
     //
     int len = (int) sbufGetLength(buf);
-    if (write_queue_empty(&io->write_queue))
+    if (write_queue_empty(&io->write_queue) && io->splice_pending == 0)
     {
         //    try_write:
         nwrite = __nio_write(io, sbufGetMutablePtr(buf), len);
@@ -519,23 +1422,7 @@ int wioWrite(wio_t *io, sbuf_t *buf)
             goto write_error;
         }
         sbufShiftRight(buf, (uint32_t)nwrite);
-        // #if defined(OS_LINUX) && defined(HAVE_PIPE)
-        //         if(io->pfd_w != 0){
-        //             remain.base = 0X0; // skips memoryFree()
-
-        //         }else
-        //         {
-        //             // NOTE: free in nio_write
-        //             EVENTLOOP_ALLOC(remain.base, remain.len);
-        //             memoryCopy(remain.base, ((char*)buf) + nwrite, remain.len);
-        //         }
-        // #else
         // NOTE: free in nio_write
-
-        // EVENTLOOP_ALLOC(remain.base, remain.len);
-        // memoryCopy(remain.base, ((char*)buf) + nwrite, remain.len);
-
-        // #endif
         if (io->write_queue.maxsize == 0)
         {
             write_queue_init(&io->write_queue, 4);
@@ -589,20 +1476,27 @@ int wioClose(wio_t *io)
 
         return 0;
     }
+#ifdef OS_LINUX
+    wioSpliceSettle(io);
+#endif
     if (! write_queue_empty(&io->write_queue) && io->error == 0 && io->close == 0 && io->destroy == 0)
     {
         io->close = 1;
 
         wlogd("write_queue not empty, close later.");
-        int timeout_ms            = io->close_timeout ? io->close_timeout : WIO_DEFAULT_CLOSE_TIMEOUT;
-        io->close_timer           = wtimerAdd(io->loop, __close_timeout_cb, (uint32_t)timeout_ms, 1);
-        io->close_timer->privdata = io;
+        wio_timers_t *timers          = wioGetTimers(io);
+        int           timeout_ms      = timers->close_timeout ? timers->close_timeout : WIO_DEFAULT_CLOSE_TIMEOUT;
+        timers->close_timer           = wtimerAdd(io->loop, __close_timeout_cb, (uint32_t)timeout_ms, 1);
+        timers->close_timer->privdata = io;
         return 0;
     }
     io->closed = 1;
 
     wioDone(io);
     __close_cb(io);
+#ifdef OS_LINUX
+    wioSpliceClosePipe(io);
+#endif
     // SAFE_FREE(io->hostname);
     if (io->io_type & WIO_TYPE_SOCKET)
     {
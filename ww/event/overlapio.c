@@ -3,6 +3,7 @@
 
 #ifdef EVENT_IOCP
 #include "overlapio.h"
+#include "sbuf_chain.h"
 #include "wevent.h"
 
 #define ACCEPTEX_NUM    10
@@ -296,6 +297,11 @@ int wioRead (wio_t* io) {
     return wioAdd(io, wio_handle_events, WW_READ);
 }
 
+int wioWriteChain(wio_t* io, sbuf_t* buf) {
+    // overlapped sends take one buffer
+    return wioWrite(io, sbufchainLinearize(buf, io->loop->bufpool));
+}
+
 int wioWrite(wio_t* io, sbuf_t* buf) {
     int nwrite = 0;
 try_send:
@@ -379,6 +385,44 @@ disconnect:
     return 0;
 }
 
+// no datagram batching on overlapped io
+int wioWriteTo(wio_t* io, sbuf_t* buf, const sockaddr_u* peer) {
+    memoryCopy(io->peeraddr_u, peer, sizeof(sockaddr_u));
+    return wioWrite(io, buf);
+}
+
+void wloopFlushDatagrams(wloop_t* loop) {
+    discard loop;
+}
+
+void wioDatagramsDone(wio_t* io) {
+    discard io;
+}
+
+void wioDatagramsFree(wio_t* io) {
+    discard io;
+}
+
+// no splice on overlapped io, the tunnels keep reading into buffers
+bool wioSetCallBackSplice(wio_t* io, wsplice_cb splice_cb) {
+    discard io;
+    return splice_cb == NULL;
+}
+
+int wioSpliceWrite(wio_t* io, int pipe_fd, uint32_t len) {
+    discard io;
+    discard pipe_fd;
+    discard len;
+    return -1;
+}
+
+sbuf_t* wioSpliceTakeBuffer(wio_t* io, int pipe_fd, uint32_t len) {
+    discard io;
+    discard pipe_fd;
+    discard len;
+    return NULL;
+}
+
 int wioClose (wio_t* io) {
     if (io->closed) return 0;
     io->closed = 1;
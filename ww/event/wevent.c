@@ -145,20 +145,17 @@ void wioReady(wio_t *io)
     io->close_cb   = NULL;
     io->accept_cb  = NULL;
     io->connect_cb = NULL;
+    io->read_batch_cb = NULL;
+    io->splice_cb     = NULL;
     // timers
-    io->connect_timeout    = 0;
-    io->connect_timer      = NULL;
-    io->close_timeout      = 0;
-    io->close_timer        = NULL;
-    io->read_timeout       = 0;
-    io->read_timer         = NULL;
-    io->write_timeout      = 0;
-    io->write_timer        = NULL;
-    io->keepalive_timeout  = 0;
-    io->keepalive_timer    = NULL;
-    io->heartbeat_interval = 0;
-    io->heartbeat_fn       = NULL;
-    io->heartbeat_timer    = NULL;
+    if (io->timers)
+    {
+        memorySet(io->timers, 0, sizeof(wio_timers_t));
+    }
+    // splice
+    io->splice_pipe[0] = io->splice_pipe[1] = -1;
+    io->splice_pending_fd                   = -1;
+    io->splice_pending                      = 0;
 
     // private:
 #if defined(EVENT_POLL) || defined(EVENT_KQUEUE)
@@ -185,6 +182,8 @@ void wioDone(wio_t *io)
 
     wioDel(io, WW_RDWR);
 
+    wioDatagramsDone(io);
+
     // write_queue
     sbuf_t *buf = NULL;
     //
@@ -204,6 +203,8 @@ void wioFree(wio_t *io)
         return;
     io->destroy = 1;
     wioClose(io);
+    wioDatagramsFree(io);
+    EVENTLOOP_FREE(io->timers);
     EVENTLOOP_FREE(io->localaddr);
     EVENTLOOP_FREE(io->peeraddr);
     EVENTLOOP_FREE(io);
@@ -295,6 +296,11 @@ wread_cb wioGetCallBackRead(wio_t *io)
     return io->read_cb;
 }
 
+wread_batch_cb wioGetCallBackReadBatch(wio_t *io)
+{
+    return io->read_batch_cb;
+}
+
 wwrite_cb wioGetCallBackWrite(wio_t *io)
 {
     return io->write_cb;
@@ -320,6 +326,11 @@ void wioSetCallBackRead(wio_t *io, wread_cb read_cb)
     io->read_cb = read_cb;
 }
 
+void wioSetCallBackReadBatch(wio_t *io, wread_batch_cb read_batch_cb)
+{
+    io->read_batch_cb = read_batch_cb;
+}
+
 void wioSetCallBackWrite(wio_t *io, wwrite_cb write_cb)
 {
     io->write_cb = write_cb;
@@ -387,6 +398,17 @@ void wioReadCallBack(wio_t *io, sbuf_t *buf)
     }
 }
 
+void wioReadBatchCallBack(wio_t *io, wio_datagram_t *datagrams, unsigned int count)
+{
+    if (io->read_flags & WIO_READ_ONCE)
+    {
+        io->read_flags &= ~(uint32_t) WIO_READ_ONCE;
+        wioReadStop(io);
+    }
+
+    io->read_batch_cb(io, datagrams, count);
+}
+
 void wioWriteCallBack(wio_t *io)
 {
     if (io->write_cb)
@@ -432,84 +454,99 @@ void wioSetPeerAddr(wio_t *io, struct sockaddr *addr, int addrlen)
     memoryCopy(io->peeraddr, addr, (size_t) addrlen);
 }
 
+wio_timers_t *wioGetTimers(wio_t *io)
+{
+    if (io->timers == NULL)
+    {
+        EVENTLOOP_ALLOC_SIZEOF(io->timers);
+    }
+    return io->timers;
+}
+
 void wioDelConnectTimer(wio_t *io)
 {
-    if (io->connect_timer)
+    wio_timers_t *timers = io->timers;
+    if (timers != NULL && timers->connect_timer)
     {
-        wtimerDelete(io->connect_timer);
-        io->connect_timer   = NULL;
-        io->connect_timeout = 0;
+        wtimerDelete(timers->connect_timer);
+        timers->connect_timer   = NULL;
+        timers->connect_timeout = 0;
     }
 }
 
 void wioDelCloseTimer(wio_t *io)
 {
-    if (io->close_timer)
+    wio_timers_t *timers = io->timers;
+    if (timers != NULL && timers->close_timer)
     {
-        wtimerDelete(io->close_timer);
-        io->close_timer   = NULL;
-        io->close_timeout = 0;
+        wtimerDelete(timers->close_timer);
+        timers->close_timer   = NULL;
+        timers->close_timeout = 0;
     }
 }
 
 void wioDelReadTimer(wio_t *io)
 {
-    if (io->read_timer)
+    wio_timers_t *timers = io->timers;
+    if (timers != NULL && timers->read_timer)
     {
-        wtimerDelete(io->read_timer);
-        io->read_timer   = NULL;
-        io->read_timeout = 0;
+        wtimerDelete(timers->read_timer);
+        timers->read_timer   = NULL;
+        timers->read_timeout = 0;
     }
 }
 
 void wioDelWriteTimer(wio_t *io)
 {
-    if (io->write_timer)
+    wio_timers_t *timers = io->timers;
+    if (timers != NULL && timers->write_timer)
     {
-        wtimerDelete(io->write_timer);
-        io->write_timer   = NULL;
-        io->write_timeout = 0;
+        wtimerDelete(timers->write_timer);
+        timers->write_timer   = NULL;
+        timers->write_timeout = 0;
     }
 }
 
 void wioDelKeepaliveTimer(wio_t *io)
 {
-    if (io->keepalive_timer)
+    wio_timers_t *timers = io->timers;
+    if (timers != NULL && timers->keepalive_timer)
     {
-        wtimerDelete(io->keepalive_timer);
-        io->keepalive_timer   = NULL;
-        io->keepalive_timeout = 0;
+        wtimerDelete(timers->keepalive_timer);
+        timers->keepalive_timer   = NULL;
+        timers->keepalive_timeout = 0;
     }
 }
 
 void wioDelHeartBeatTimer(wio_t *io)
 {
-    if (io->heartbeat_timer)
+    wio_timers_t *timers = io->timers;
+    if (timers != NULL && timers->heartbeat_timer)
     {
-        wtimerDelete(io->heartbeat_timer);
-        io->heartbeat_timer    = NULL;
-        io->heartbeat_interval = 0;
-        io->heartbeat_fn       = NULL;
+        wtimerDelete(timers->heartbeat_timer);
+        timers->heartbeat_timer    = NULL;
+        timers->heartbeat_interval = 0;
+        timers->heartbeat_fn       = NULL;
     }
 }
 
 void wioSetConnectTimeout(wio_t *io, int timeout_ms)
 {
-    io->connect_timeout = timeout_ms;
+    wioGetTimers(io)->connect_timeout = timeout_ms;
 }
 
 void wioSetCloseTimeout(wio_t *io, int timeout_ms)
 {
-    io->close_timeout = timeout_ms;
+    wioGetTimers(io)->close_timeout = timeout_ms;
 }
 
 static void __read_timeout_cb(wtimer_t *timer)
 {
     wio_t   *io          = (wio_t *) timer->privdata;
     uint64_t inactive_ms = (io->loop->cur_hrtime - io->last_read_hrtime) / 1000;
-    if (inactive_ms + 100 < (uint64_t) io->read_timeout)
+    if (inactive_ms + 100 < (uint64_t) io->timers->read_timeout)
     {
-        wtimerReset(io->read_timer, (uint32_t) ((uint64_t) io->read_timeout - inactive_ms));
+        wtimerReset(io->timers->read_timer, (uint32_t) ((uint64_t) io->timers->read_timeout - inactive_ms));
     }
     else
     {
@@ -533,28 +570,29 @@ void wioSetReadTimeout(wio_t *io, int timeout_ms)
         wioDelReadTimer(io);
         return;
     }
+    wio_timers_t *timers = wioGetTimers(io);
 
-    if (io->read_timer)
+    if (timers->read_timer)
     {
         // reset
-        wtimerReset(io->read_timer, (uint32_t) timeout_ms);
+        wtimerReset(timers->read_timer, (uint32_t) timeout_ms);
     }
     else
     {
         // add
-        io->read_timer           = wtimerAdd(io->loop, __read_timeout_cb, (uint32_t) timeout_ms, 1);
-        io->read_timer->privdata = io;
+        timers->read_timer           = wtimerAdd(io->loop, __read_timeout_cb, (uint32_t) timeout_ms, 1);
+        timers->read_timer->privdata = io;
     }
-    io->read_timeout = timeout_ms;
+    timers->read_timeout = timeout_ms;
 }
 
 static void __write_timeout_cb(wtimer_t *timer)
 {
     wio_t   *io          = (wio_t *) timer->privdata;
     uint64_t inactive_ms = (io->loop->cur_hrtime - io->last_write_hrtime) / 1000;
-    if (inactive_ms + 100 < (uint64_t) io->write_timeout)
+    if (inactive_ms + 100 < (uint64_t) io->timers->write_timeout)
     {
-        wtimerReset(io->write_timer, (uint32_t) ((uint64_t) io->write_timeout - inactive_ms));
+        wtimerReset(io->timers->write_timer, (uint32_t) ((uint64_t) io->timers->write_timeout - inactive_ms));
     }
     else
     {
@@ -578,19 +616,20 @@ void wiosSetWriteTimeout(wio_t *io, int timeout_ms)
         wioDelWriteTimer(io);
         return;
     }
+    wio_timers_t *timers = wioGetTimers(io);
 
-    if (io->write_timer)
+    if (timers->write_timer)
     {
         // reset
-        wtimerReset(io->write_timer, (uint32_t) timeout_ms);
+        wtimerReset(timers->write_timer, (uint32_t) timeout_ms);
     }
     else
     {
         // add
-        io->write_timer           = wtimerAdd(io->loop, __write_timeout_cb, (uint32_t) timeout_ms, 1);
-        io->write_timer->privdata = io;
+        timers->write_timer           = wtimerAdd(io->loop, __write_timeout_cb, (uint32_t) timeout_ms, 1);
+        timers->write_timer->privdata = io;
     }
-    io->write_timeout = timeout_ms;
+    timers->write_timeout = timeout_ms;
 }
 
 static void __keepalive_timeout_cb(wtimer_t *timer)
@@ -598,9 +637,9 @@ static void __keepalive_timeout_cb(wtimer_t *timer)
     wio_t   *io             = (wio_t *) timer->privdata;
     uint64_t last_rw_hrtime = max(io->last_read_hrtime, io->last_write_hrtime);
     uint64_t inactive_ms    = (io->loop->cur_hrtime - last_rw_hrtime) / 1000;
-    if (inactive_ms + 100 < (uint64_t) io->keepalive_timeout)
+    if (inactive_ms + 100 < (uint64_t) io->timers->keepalive_timeout)
     {
-        wtimerReset(io->keepalive_timer, (uint32_t) ((uint64_t) io->keepalive_timeout - inactive_ms));
+        wtimerReset(io->timers->keepalive_timer, (uint32_t) ((uint64_t) io->timers->keepalive_timeout - inactive_ms));
     }
     else
     {
@@ -624,27 +663,28 @@ void wioSetKeepaliveTimeout(wio_t *io, int timeout_ms)
         wioDelKeepaliveTimer(io);
         return;
     }
+    wio_timers_t *timers = wioGetTimers(io);
 
-    if (io->keepalive_timer)
+    if (timers->keepalive_timer)
     {
         // reset
-        wtimerReset(io->keepalive_timer, (uint32_t) timeout_ms);
+        wtimerReset(timers->keepalive_timer, (uint32_t) timeout_ms);
     }
     else
     {
         // add
-        io->keepalive_timer           = wtimerAdd(io->loop, __keepalive_timeout_cb, (uint32_t) timeout_ms, 1);
-        io->keepalive_timer->privdata = io;
+        timers->keepalive_timer           = wtimerAdd(io->loop, __keepalive_timeout_cb, (uint32_t) timeout_ms, 1);
+        timers->keepalive_timer->privdata = io;
     }
-    io->keepalive_timeout = timeout_ms;
+    timers->keepalive_timeout = timeout_ms;
 }
 
 static void __heartbeat_timer_cb(wtimer_t *timer)
 {
     wio_t *io = (wio_t *) timer->privdata;
-    if (io && io->heartbeat_fn)
+    if (io && io->timers->heartbeat_fn)
     {
-        io->heartbeat_fn(io);
+        io->timers->heartbeat_fn(io);
     }
 }
 
@@ -656,20 +696,21 @@ void wioSetHeartBeat(wio_t *io, int interval_ms, wio_send_heartbeat_fn fn)
         wioDelHeartBeatTimer(io);
         return;
     }
+    wio_timers_t *timers = wioGetTimers(io);
 
-    if (io->heartbeat_timer)
+    if (timers->heartbeat_timer)
     {
         // reset
-        wtimerReset(io->heartbeat_timer, (uint32_t) interval_ms);
+        wtimerReset(timers->heartbeat_timer, (uint32_t) interval_ms);
     }
     else
     {
         // add
-        io->heartbeat_timer           = wtimerAdd(io->loop, __heartbeat_timer_cb, (uint32_t) interval_ms, INFINITE);
-        io->heartbeat_timer->privdata = io;
+        timers->heartbeat_timer           = wtimerAdd(io->loop, __heartbeat_timer_cb, (uint32_t) interval_ms, INFINITE);
+        timers->heartbeat_timer->privdata = io;
     }
-    io->heartbeat_interval = interval_ms;
-    io->heartbeat_fn       = fn;
+    timers->heartbeat_interval = interval_ms;
+    timers->heartbeat_fn       = fn;
 }
 
 //-----------------iobuf---------------------------------------------
@@ -718,49 +759,6 @@ int wioReadOnce(wio_t *io)
 //         }
 //     }
 // }
-// #if defined(OS_LINUX) && defined(HAVE_PIPE)
-
-// void wio_close_upstream(wio_t* io) {
-//     wio_t* upstream_io = io->upstream_io;
-//     if(io->pfd_w != 0x0){
-//         close(io->pfd_w);
-//         close(io->pfd_r);
-//     }
-//     if (upstream_io) {
-//         wioClose(upstream_io);
-//     }
-// }
-
-// static bool wio_setup_pipe(wio_t* io) {
-//     int fds[2];
-//     int r = pipe(fds);
-//     if (r != 0)
-//         return false;
-//     io->pfd_r = fds[0];
-//     io->pfd_w = fds[1];
-//     return true;
-
-// }
-
-// void wio_setup_upstream_splice(wio_t* restrict io1, wio_t* restrict io2) {
-//     io1->upstream_io = io2;
-//     io2->upstream_io = io1;
-//     assert (io1->io_type == WIO_TYPE_TCP && io2->io_type == WIO_TYPE_TCP);
-//     if (!wio_setup_pipe(io1))
-//         return;
-
-//     if (!wio_setup_pipe(io2)){
-//         close(io1->pfd_w);
-//         close(io1->pfd_r);
-//         io1->pfd_w = io1->pfd_r = 0;
-//         return;
-//     }
-//     const int tmp_fd = io1->pfd_w;
-//     io1->pfd_w = io2->pfd_w;
-//     io2->pfd_w = tmp_fd;
-// }
-// #else
-
 // void wio_close_upstream(wio_t* io) {
 //     wio_t* upstream_io = io->upstream_io;
 //     if (upstream_io) {
@@ -768,8 +766,6 @@ int wioReadOnce(wio_t *io)
 //     }
 // }
 
-// #endif
-
 // void wio_setup_upstream(wio_t* restrict io1, wio_t* restrict io2) {
 //     io1->upstream_io = io2;
 //     io2->upstream_io = io1;
@@ -782,11 +778,7 @@ int wioReadOnce(wio_t *io)
 // wio_t* wio_setup_tcp_upstream(wio_t* io, const char* host, int port) {
 //     wio_t* upstream_io = wioCreateSocket(io->loop, host, port, WIO_TYPE_TCP, WIO_CLIENT_SIDE);
 //     if (upstream_io == NULL) return NULL;
-//     // #if defined(OS_LINUX) && defined(HAVE_PIPE)
-//     //     wio_setup_upstream_splice(io, upstream_io);
-//     // #else
 //     wio_setup_upstream(io, upstream_io);
-//     // #endif
 
 //     wioSetCallBackRead(io, wio_write_upstream);
 //     wioSetCallBackRead(upstream_io, wio_write_upstream);
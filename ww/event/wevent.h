@@ -27,6 +27,14 @@
 ARRAY_DECL(wio_t*, io_array)
 QUEUE_DECL(wevent_t, event_queue)
 
+// power of 2, the cells are indexed with a mask
+#define CUSTOM_EVENTS_RING_SIZE (1U << 12)
+
+typedef struct custom_event_cell_s {
+    atomic_size_t   seq;
+    wevent_t        ev;
+} custom_event_cell_t;
+
 struct wloop_s {
     uint32_t                    flags;
     wloop_status_e              status;
@@ -58,10 +66,24 @@ struct wloop_s {
     // one loop per thread, so one readbuf per loop is OK. operates on large mode by default.
     buffer_pool_t*              bufpool;
     void*                       iowatcher;
-    // custom_events
+    // custom_events: bounded mpsc ring, events that do not fit go to the overflow queue under the mutex
     int                         eventfds[2];
+    custom_event_cell_t*        custom_events_ring;
+    atomic_size_t               custom_events_tail;       // next cell a producer claims
+    size_t                      custom_events_head;       // next cell the loop reads, loop thread only
+    atomic_bool                 custom_events_signaled;   // the eventfd was written and the loop has not woken yet
+    atomic_bool                 custom_events_overflowed; // posts go to the overflow queue until the loop takes it
     event_queue                 custom_events;
     wmutex_t                    custom_events_mutex;
+    // datagram ios with queued wioWriteTo datagrams, flushed before polling
+    struct io_array             datagram_flush_ios;
+    // the io whose splice_cb runs now and the bytes wioSpliceTakeBuffer left in its pipe
+    wio_t*                      splice_io;
+    uint32_t                    splice_left;
+    // iteration stats, only the loop thread writes them
+    atomic_ullong               stat_iterations;
+    atomic_ullong               stat_busy_us;
+    atomic_ullong               stat_busy_buckets[kWloopBusyBuckets];
 };
 
 uint64_t wloopGetNextEventID(void);
@@ -99,10 +121,32 @@ struct hperiod_s {
 
 QUEUE_DECL(sbuf_t*, write_queue)
 
-// sizeof(struct wio_s)=416 on linux-x64
+// timeouts and timers of an io, allocated by the first wioSet*Timeout / wioSetHeartBeat (or a connect / delayed
+// close) and kept for the next socket on the same io; udp, tun and pipe ios never need them, but TcpListener and
+// TcpConnector set a read / keepalive timeout on every socket, so a tcp connection still pays for this block
+// (80 bytes on x64 plus the allocation) and saves only about 64 bytes against the old inline layout
+typedef struct wio_timers_s {
+    int         connect_timeout;    // ms
+    int         close_timeout;      // ms
+    int         read_timeout;       // ms
+    int         write_timeout;      // ms
+    int         keepalive_timeout;  // ms
+    int         heartbeat_interval; // ms
+    wio_send_heartbeat_fn heartbeat_fn;
+    wtimer_t*   connect_timer;
+    wtimer_t*   close_timer;
+    wtimer_t*   read_timer;
+    wtimer_t*   write_timer;
+    wtimer_t*   keepalive_timer;
+    wtimer_t*   heartbeat_timer;
+} wio_timers_t;
+
+// the fields used by every read / write come first, so wio_handle_events and nio_read / nio_write stay within the
+// first three cache lines; the rest is only touched when a connection starts, ends or has a timer
+// sizeof(struct wio_s)=256 on linux-x64
 struct wio_s {
     WEVENT_FIELDS
-    // flags
+    // flags (share the word of the event flags)
     unsigned    ready       :1;
     unsigned    connected   :1;
     unsigned    closed      :1;
@@ -118,52 +162,43 @@ struct wio_s {
     wio_type_e  io_type;
     uint32_t    id; // fd cannot be used as unique identifier, so we provide an id
     int         fd;
-// #if defined(OS_LINUX) && defined(HAVE_PIPE)
-//     int         pfd_r; // pipe read file descriptor for splice, (empty by default)
-//     int         pfd_w; // pipe read file descriptor for splice, (empty by default)
-// #endif
     int         error;
     int         events;
     int         revents;
-
-    union{
-        struct sockaddr*   localaddr;
-        sockaddr_u* localaddr_u;
-    };
-    union{
-        struct sockaddr*   peeraddr;
-        sockaddr_u* peeraddr_u;
-    };
-    
-    uint64_t            last_read_hrtime;
-    uint64_t            last_write_hrtime;
     // read
     unsigned int        read_flags;
     // write
-    struct write_queue  write_queue;
-    // wrecursive_mutex_t  write_mutex; // lock write and write_queue
     uint32_t            write_bufsize;
     uint32_t            max_write_bufsize;
+    uint32_t            splice_pending;     // bytes left in splice_pending_fd, also counted in write_bufsize
+    int                 splice_pending_fd;  // pipe of the splice source that still holds bytes for this socket
+    struct write_queue  write_queue;
+    // wrecursive_mutex_t  write_mutex; // lock write and write_queue
+    uint64_t            last_read_hrtime;
+    uint64_t            last_write_hrtime;
     // callbacks
     wread_cb    read_cb;
     wwrite_cb   write_cb;
+    wsplice_cb  splice_cb;
+    wread_batch_cb read_batch_cb;
     wclose_cb   close_cb;
     waccept_cb  accept_cb;
     wconnect_cb connect_cb;
-    // timers
-    int         connect_timeout;    // ms
-    int         close_timeout;      // ms
-    int         read_timeout;       // ms
-    int         write_timeout;      // ms
-    int         keepalive_timeout;  // ms
-    int         heartbeat_interval; // ms
-    wio_send_heartbeat_fn heartbeat_fn;
-    wtimer_t*   connect_timer;
-    wtimer_t*   close_timer;
-    wtimer_t*   read_timer;
-    wtimer_t*   write_timer;
-    wtimer_t*   keepalive_timer;
-    wtimer_t*   heartbeat_timer;
+
+    union{
+        struct sockaddr*   localaddr;
+        sockaddr_u* localaddr_u;
+    };
+    union{
+        struct sockaddr*   peeraddr;
+        sockaddr_u* peeraddr_u;
+    };
+    // recvmmsg / sendmmsg state, allocated by the datagram batch apis (linux)
+    struct wio_datagram_state_s* dgram;
+    // read pipe of this socket for splice (linux), -1 until wioSetCallBackSplice enables it
+    int         splice_pipe[2];
+    // NULL until a timeout or a timer is set, see wio_timers_t
+    wio_timers_t* timers;
 
 // private:
 #if defined(EVENT_POLL) || defined(EVENT_KQUEUE)
@@ -193,13 +228,21 @@ void wioDone(wio_t* io);
 void wioFree(wio_t* io);
 uint32_t wioSetNextID(void);
 
+// wioWriteTo queue (see nio.c), flushed by the loop before every poll
+void wloopFlushDatagrams(wloop_t* loop);
+void wioDatagramsDone(wio_t* io);
+void wioDatagramsFree(wio_t* io);
+
 void wioAcceptCallBack(wio_t* io);
 void wioConnectCallBack(wio_t* io);
 void wioHandleRead(wio_t* io,sbuf_t* buf);
 void wioReadCallBack(wio_t* io, sbuf_t* buf);
+void wioReadBatchCallBack(wio_t* io, wio_datagram_t* datagrams, unsigned int count);
 void wioWriteCallBack(wio_t* io);
 void wioCloseCallBack(wio_t* io);
 
+// allocates the timers of the io on first use
+wio_timers_t* wioGetTimers(wio_t* io);
 void wioDelConnectTimer(wio_t* io);
 void wioDelCloseTimer(wio_t* io);
 void wioDelReadTimer(wio_t* io);
@@ -162,12 +162,31 @@ static int wloopProcessPendings(wloop_t *loop)
     return ncbs;
 }
 
+static void wloopRecordBusyTime(wloop_t *loop, uint64_t busy_us)
+{
+    unsigned int bucket = 0;
+    for (uint64_t bound = 100; bucket < kWloopBusyBuckets - 1 && busy_us > bound; bound *= 10)
+    {
+        bucket++;
+    }
+    atomicAddSingleWriter(&loop->stat_iterations, 1);
+    atomicAddSingleWriter(&loop->stat_busy_us, busy_us);
+    atomicAddSingleWriter(&loop->stat_busy_buckets[bucket], 1);
+}
+
 // wloopProcessIOS -> wloopProcessTimers -> wloopProcessIdles -> wloopProcessPendings
 int wloopProcessEvents(wloop_t *loop, int timeout_ms)
 {
     // ios -> timers -> idles
     int nios, ntimers, nidles;
     nios = ntimers = nidles = 0;
+    uint64_t busy_begin;
+
+    // datagrams queued by the callbacks of the previous iteration
+    if (loop->datagram_flush_ios.size > 0)
+    {
+        wloopFlushDatagrams(loop);
+    }
 
     // calc blocktime
     int32_t blocktime_ms = timeout_ms;
@@ -207,6 +226,8 @@ int wloopProcessEvents(wloop_t *loop, int timeout_ms)
     }
 
 process_timers:
+    // both paths to here updated the time after the wait
+    busy_begin = loop->cur_hrtime;
     if (loop->ntimers)
     {
         ntimers = wloopProcessTimers(loop);
@@ -221,6 +242,7 @@ process_timers:
         }
     }
     int ncbs = wloopProcessPendings(loop);
+    wloopRecordBusyTime(loop, getHRTimeUs() - busy_begin);
     printd("blocktime=%d nios=%d/%u ntimers=%d/%u nidles=%d/%u nactives=%d npendings=%d ncbs=%d\n", blocktime, nios,
            loop->nios, ntimers, loop->ntimers, nidles, loop->nidles, loop->nactives, npendings, ncbs);
     discard nios;
@@ -236,43 +258,67 @@ static void wloopStatTimerCallBack(wtimer_t *timer)
           loop->nactives, loop->nios, loop->ntimers, loop->nidles);
 }
 
-static void eventFDReadCB(wio_t *io, sbuf_t *buf)
+static void wloopRunOverflowEvents(wloop_t *loop)
 {
-    wloop_t  *loop = io->loop;
-    wevent_t *pev  = NULL;
-    wevent_t  ev;
-    uint64_t  count = sbufGetLength(buf);
-#if defined(OS_UNIX) && HAVE_EVENTFD
-    assert(sbufGetLength(buf) == sizeof(count));
-    sbufReadUnAlignedUI64(buf, &count);
-#endif
-    discard count;
-    for (uint64_t i = 0; i < count; ++i)
+    mutexLock(&loop->custom_events_mutex);
+    event_queue events  = loop->custom_events;
+    loop->custom_events = (event_queue){0};
+    atomicStoreExplicit(&loop->custom_events_overflowed, false, memory_order_release);
+    mutexUnlock(&loop->custom_events_mutex);
+
+    for (size_t i = 0; i < events.size; ++i)
     {
-        mutexLock(&loop->custom_events_mutex);
-        if (event_queue_empty(&loop->custom_events))
+        wevent_t ev = events.ptr[events._offset + i];
+        if (ev.cb)
         {
-            goto unlock;
+            ev.cb(&ev);
         }
-        pev = event_queue_front(&loop->custom_events);
-        if (pev == NULL)
+    }
+    event_queue_cleanup(&events);
+}
+
+static void wloopRunCustomEvents(wloop_t *loop)
+{
+    // events posted by the callbacks of this batch wait for the next wakeup, so io is not starved
+    size_t end = atomicLoadExplicit(&loop->custom_events_tail, memory_order_acquire);
+
+    while (loop->custom_events_head != end)
+    {
+        size_t               pos  = loop->custom_events_head;
+        custom_event_cell_t *cell = &loop->custom_events_ring[pos & (CUSTOM_EVENTS_RING_SIZE - 1)];
+
+        if (atomicLoadExplicit(&cell->seq, memory_order_acquire) != pos + 1)
         {
-            goto unlock;
+            // claimed but not written yet, the producer rings the doorbell after writing it
+            return;
         }
-        ev = *pev;
-        event_queue_pop_front(&loop->custom_events);
-        // NOTE: unlock before cb, avoid deadlock if wloopPostEvent called in cb.
-        mutexUnlock(&loop->custom_events_mutex);
+        wevent_t ev = cell->ev;
+        atomicStoreExplicit(&cell->seq, pos + CUSTOM_EVENTS_RING_SIZE, memory_order_release);
+        loop->custom_events_head = pos + 1;
+
         if (ev.cb)
         {
             ev.cb(&ev);
         }
     }
-    bufferpoolReuseBuffer(io->loop->bufpool, buf);
-    return;
-unlock:
-    mutexUnlock(&loop->custom_events_mutex);
-    bufferpoolReuseBuffer(io->loop->bufpool, buf);
+
+    // overflowed events were posted after everything in the ring, they only run once the ring is empty
+    if (atomicLoadExplicit(&loop->custom_events_overflowed, memory_order_acquire) &&
+        atomicLoadExplicit(&loop->custom_events_tail, memory_order_acquire) == loop->custom_events_head)
+    {
+        wloopRunOverflowEvents(loop);
+    }
+}
+
+static void eventFDReadCB(wio_t *io, sbuf_t *buf)
+{
+    wloop_t *loop = io->loop;
+    bufferpoolReuseBuffer(loop->bufpool, buf);
+
+    // re-arm the doorbell before draining, any post that is not seen by this batch writes the eventfd again
+    atomicExchangeExplicit(&loop->custom_events_signaled, false, memory_order_seq_cst);
+
+    wloopRunCustomEvents(loop);
 }
 
 static int wloopCreateEventFDS(wloop_t *loop)
@@ -320,24 +366,55 @@ static void wloopDestroyEventFDS(wloop_t *loop)
     loop->eventfds[0] = loop->eventfds[1] = -1;
 }
 
-void wloopPostEvent(wloop_t *loop, wevent_t *ev)
+static bool wloopPushRingEvent(wloop_t *loop, wevent_t *ev)
 {
-    if(atomicLoadExplicit(&GSTATE.application_stopping_flag, memory_order_acquire))
-    {
-        return;
-    }
+    size_t pos = atomicLoadExplicit(&loop->custom_events_tail, memory_order_relaxed);
 
-    if (ev->loop == NULL)
+    for (;;)
     {
-        ev->loop = loop;
+        custom_event_cell_t *cell = &loop->custom_events_ring[pos & (CUSTOM_EVENTS_RING_SIZE - 1)];
+        intptr_t diff = (intptr_t) atomicLoadExplicit(&cell->seq, memory_order_acquire) - (intptr_t) pos;
+
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&loop->custom_events_tail, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                cell->ev = *ev;
+                atomicStoreExplicit(&cell->seq, pos + 1, memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // the loop has not read this cell since the last lap, the ring is full
+            return false;
+        }
+        else
+        {
+            pos = atomicLoadExplicit(&loop->custom_events_tail, memory_order_relaxed);
+        }
     }
-    if (ev->event_type == 0)
+}
+
+static void wloopPushOverflowEvent(wloop_t *loop, wevent_t *ev)
+{
+    mutexLock(&loop->custom_events_mutex);
+    if (loop->custom_events.maxsize == 0)
     {
-        ev->event_type = WEVENT_TYPE_CUSTOM;
+        event_queue_init(&loop->custom_events, CUSTOM_EVENT_QUEUE_INIT_SIZE);
     }
-    if (ev->event_id == 0)
+    event_queue_push_back(&loop->custom_events, ev);
+    atomicStoreExplicit(&loop->custom_events_overflowed, true, memory_order_release);
+    mutexUnlock(&loop->custom_events_mutex);
+}
+
+static void wloopRingDoorbell(wloop_t *loop)
+{
+    // only the post that finds the doorbell quiet pays for the syscall, the loop re-arms it when it wakes up
+    if (atomicExchangeExplicit(&loop->custom_events_signaled, true, memory_order_seq_cst))
     {
-        ev->event_id = wloopGetNextEventID();
+        return;
     }
 
     int nwrite = 0;
@@ -357,18 +434,42 @@ void wloopPostEvent(wloop_t *loop, wevent_t *ev)
 #else
     nwrite = send(loop->eventfds[EVENTFDS_WRITE_INDEX], "e", 1, 0);
 #endif
+unlock:
+    mutexUnlock(&loop->custom_events_mutex);
     if (nwrite <= 0)
     {
         wloge("wloopPostEvent failed!");
-        goto unlock;
+        // let the next post try again
+        atomicStoreExplicit(&loop->custom_events_signaled, false, memory_order_seq_cst);
     }
-    if (loop->custom_events.maxsize == 0)
+}
+
+void wloopPostEvent(wloop_t *loop, wevent_t *ev)
+{
+    if(atomicLoadExplicit(&GSTATE.application_stopping_flag, memory_order_acquire))
     {
-        event_queue_init(&loop->custom_events, CUSTOM_EVENT_QUEUE_INIT_SIZE);
+        return;
     }
-    event_queue_push_back(&loop->custom_events, ev);
-unlock:
-    mutexUnlock(&loop->custom_events_mutex);
+
+    if (ev->loop == NULL)
+    {
+        ev->loop = loop;
+    }
+    if (ev->event_type == 0)
+    {
+        ev->event_type = WEVENT_TYPE_CUSTOM;
+    }
+    if (ev->event_id == 0)
+    {
+        ev->event_id = wloopGetNextEventID();
+    }
+
+    // once an event overflowed, the later ones queue behind it until the loop takes the overflow queue
+    if (atomicLoadExplicit(&loop->custom_events_overflowed, memory_order_acquire) || ! wloopPushRingEvent(loop, ev))
+    {
+        wloopPushOverflowEvent(loop, ev);
+    }
+    wloopRingDoorbell(loop);
 }
 
 static void wloopInit(wloop_t *loop)
@@ -401,6 +502,14 @@ static void wloopInit(wloop_t *loop)
 
     // custom_events
     mutexInit(&loop->custom_events_mutex);
+    EVENTLOOP_ALLOC(loop->custom_events_ring, sizeof(custom_event_cell_t) * CUSTOM_EVENTS_RING_SIZE);
+    for (size_t i = 0; i < CUSTOM_EVENTS_RING_SIZE; ++i)
+    {
+        atomic_init(&loop->custom_events_ring[i].seq, i);
+    }
+    atomic_init(&loop->custom_events_tail, 0);
+    atomic_init(&loop->custom_events_signaled, false);
+    atomic_init(&loop->custom_events_overflowed, false);
     // NOTE: wloopCreateEventFDS when wloopPostEvent or wloopRun
     loop->eventfds[0] = loop->eventfds[1] = -1;
 
@@ -429,6 +538,7 @@ static void wloopCleanup(wloop_t *loop)
         }
     }
     io_array_cleanup(&loop->ios);
+    io_array_cleanup(&loop->datagram_flush_ios);
 
     // idles
     printd("cleanup idles...\n");
@@ -469,6 +579,7 @@ static void wloopCleanup(wloop_t *loop)
     event_queue_cleanup(&loop->custom_events);
     mutexUnlock(&loop->custom_events_mutex);
     mutexDestroy(&loop->custom_events_mutex);
+    EVENTLOOP_FREE(loop->custom_events_ring);
 }
 
 wloop_t *wloopCreate(int flags, buffer_pool_t *swimmingpool, long wid)
@@ -682,6 +793,16 @@ uint32_t wloopNActives(wloop_t *loop)
     return loop->nactives;
 }
 
+void wloopGetStats(wloop_t *loop, wloop_stats_t *stats)
+{
+    stats->iterations = atomicLoadRelaxed(&loop->stat_iterations);
+    stats->busy_us    = atomicLoadRelaxed(&loop->stat_busy_us);
+    for (unsigned int i = 0; i < kWloopBusyBuckets; i++)
+    {
+        stats->busy_buckets[i] = atomicLoadRelaxed(&loop->stat_busy_buckets[i]);
+    }
+}
+
 buffer_pool_t *wloopGetBufferPool(wloop_t *loop)
 {
     return loop->bufpool;
@@ -843,6 +964,8 @@ const char *wioGetEngine(void)
     return "select";
 #elif defined(EVENT_POLL)
     return "poll";
+#elif defined(EVENT_IO_URING)
+    return iowatcherUsingUring() ? "io_uring" : "epoll";
 #elif defined(EVENT_EPOLL)
     return "epoll";
 #elif defined(EVENT_KQUEUE)
@@ -30,6 +30,16 @@ typedef void (*wread_cb)(wio_t* io, sbuf_t* buf);
 typedef void (*wwrite_cb)(wio_t* io);
 typedef void (*wclose_cb)(wio_t* io);
 
+// one received datagram of a batch, the callback owns buf
+typedef struct wio_datagram_s {
+    sbuf_t*     buf;
+    sockaddr_u  peer;
+} wio_datagram_t;
+typedef void (*wread_batch_cb)(wio_t* io, wio_datagram_t* datagrams, unsigned int count);
+// len bytes were read into pipe_fd, they must be moved out (wioSpliceWrite / wioSpliceTakeBuffer) before returning
+// or before the next read of this io, wioSpliceTakeBuffer may leave some for another call of this callback
+typedef void (*wsplice_cb)(wio_t* io, int pipe_fd, uint32_t len);
+
 typedef enum { WLOOP_STATUS_STOP, WLOOP_STATUS_RUNNING, WLOOP_STATUS_PAUSE, WLOOP_STATUS_DESTROY } wloop_status_e;
 
 typedef enum {
@@ -164,6 +174,16 @@ WW_EXPORT uint32_t wloopNIdles(wloop_t* loop);
 // @return number of active events
 WW_EXPORT uint32_t wloopNActives(wloop_t* loop);
 
+// busy time of the iterations (poll returned -> callbacks done), buckets end at 100us, 1ms, 10ms, 100ms and +Inf
+enum { kWloopBusyBuckets = 5 };
+typedef struct wloop_stats_s {
+    uint64_t iterations;
+    uint64_t busy_us;
+    uint64_t busy_buckets[kWloopBusyBuckets]; // not cumulative
+} wloop_stats_t;
+// reads the iteration stats, can be called from any thread
+WW_EXPORT void wloopGetStats(wloop_t* loop, wloop_stats_t* stats);
+
 // @return the loop threadlocal buffer pool
 WW_EXPORT buffer_pool_t* wloopGetBufferPool(wloop_t* loop);
 
@@ -184,6 +204,7 @@ WW_EXPORT void* wloopGetUserData(wloop_t* loop);
  * wloopPostEvent(loop, &ev);
  */
 // NOTE: wloopPostEvent is thread-safe, used to post event from other thread to loop thread.
+// NOTE: events go through a lock-free ring, the eventfd is only written when the loop is not already woken up.
 WW_EXPORT void wloopPostEvent(wloop_t* loop, wevent_t* ev);
 
 // idle
@@ -302,12 +323,15 @@ WW_EXPORT void wioSetCallBackConnect(wio_t* io, wconnect_cb connect_cb);
 WW_EXPORT void wioSetCallBackRead(wio_t* io, wread_cb read_cb);
 WW_EXPORT void wioSetCallBackWrite(wio_t* io, wwrite_cb write_cb);
 WW_EXPORT void wioSetCallBackClose(wio_t* io, wclose_cb close_cb);
+// datagram sockets only, replaces wread_cb; on linux reads are drained with recvmmsg (and UDP_GRO when available)
+WW_EXPORT void wioSetCallBackReadBatch(wio_t* io, wread_batch_cb read_batch_cb);
 // get callbacks
 WW_EXPORT waccept_cb wioGetCallBackAccept(wio_t* io);
 WW_EXPORT wconnect_cb wioGetCallBackConnect(wio_t* io);
 WW_EXPORT wread_cb wioGetCallBackRead(wio_t* io);
 WW_EXPORT wwrite_cb wioGetCallBackWrite(wio_t* io);
 WW_EXPORT wclose_cb wioGetCallBackClose(wio_t* io);
+WW_EXPORT wread_batch_cb wioGetCallBackReadBatch(wio_t* io);
 
 // connect timeout => wclose_cb
 WW_EXPORT void wioSetConnectTimeout(wio_t* io, int timeout_ms DEFAULT(WIO_DEFAULT_CONNECT_TIMEOUT));
@@ -359,6 +383,33 @@ WW_EXPORT int wioReadRemain(wio_t* io);
 // wio_try_write => wioAdd(io, WW_WRITE) => write => wwrite_cb
 WW_EXPORT int wioWrite(wio_t* io, sbuf_t* buf);
 
+// like wioWrite for a chained buffer (sbuf_chain.h), the segments go out with one sendmsg when nothing is queued,
+// the rest is linearized into the write queue (windows linearizes all of it). wioWrite only takes plain buffers.
+WW_EXPORT int wioWriteChain(wio_t* io, sbuf_t* buf);
+
+// datagram sockets only, sends buf to peer without touching the io peer address.
+// on linux datagrams are queued and flushed once per loop iteration with sendmmsg (and UDP_SEGMENT when
+// consecutive datagrams share a peer and size), elsewhere this is a plain sendto.
+// NOTE: must be called from the thread of the io loop.
+WW_EXPORT int wioWriteTo(wio_t* io, sbuf_t* buf, const sockaddr_u* peer);
+
+// tcp sockets only (linux), reads are spliced from the socket into a pipe of this io and handed to splice_cb
+// instead of wread_cb, so bytes that go to another socket never enter user space.
+// returns false (and nothing changes) when splice is not available, NULL switches back to wread_cb.
+WW_EXPORT bool wioSetCallBackSplice(wio_t* io, wsplice_cb splice_cb);
+
+// moves len bytes from the pipe of a splice_cb to this socket, what the socket can not take stays in that pipe and
+// is written before anything written later (it is counted in wioGetWriteBufSize), the source io should stop reading
+// until the write callback reports it is done.
+// wioClose of this io copies bytes still left in the pipe to its write queue, the source io must stay open until then.
+// @return bytes written now, -1 on error (the io is closed async like wioWrite does)
+WW_EXPORT int wioSpliceWrite(wio_t* io, int pipe_fd, uint32_t len);
+
+// reads the bytes of a splice_cb pipe into a buffer from the pool, for when a node needs to see them. at most one
+// large buffer (bufferpoolGetLargeBufferSize) is taken per call, the rest of len stays in the pipe and is passed to
+// the splice_cb again right after it returns (or to wread_cb, if the splice_cb was removed)
+WW_EXPORT sbuf_t* wioSpliceTakeBuffer(wio_t* io, int pipe_fd, uint32_t len);
+
 // NOTE: wioClose is thread-safe, wioCloseAsync will be called actually in other thread.
 // wioDel(io, WW_RDWR) => close => wclose_cb
 WW_EXPORT int wioClose(wio_t* io);
@@ -6,6 +6,7 @@
 #include "loggers/dns_logger.h"
 #include "loggers/internal_logger.h"
 #include "loggers/network_logger.h"
+#include "managers/metrics_manager.h"
 #include "managers/node_manager.h"
 #include "managers/signal_manager.h"
 #include "managers/socket_manager.h"
@@ -100,6 +101,9 @@ static void exitHandle(void *userdata, int signum)
     discard userdata;
     atomicStoreExplicit(&GSTATE.application_stopping_flag, true, memory_order_release);
 
+    // the endpoint reads the pools and loops of the workers, it stops before they are destroyed
+    metricsmanagerDestroy();
+
     for (unsigned int wid = 0; wid < WORKERS_COUNT; ++wid)
     {
         workerExitJoin(getWorker(wid));
@@ -391,6 +395,7 @@ WW_EXPORT void destroyGlobalState(void)
 
     memoryFree((void *) GSTATE.shortcut_loops);
 
+    metricsmanagerDestroy();
     nodemanagerDestroy();
     socketmanagerDestroy();
     signalmanagerDestroy();
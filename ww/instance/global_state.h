@@ -163,6 +163,90 @@ static inline wid_t getNextDistributionWID(void)
     return wid;
 }
 
+/*!
+ * @brief How devices that read raw ip packets spread them over the workers.
+ */
+enum packet_distribution_policy_e
+{
+    kPacketDistributionFiveTuple = 0, // addresses, protocol and ports, every packet of a flow lands on one worker
+    kPacketDistributionSourceIp,      // source address only, all flows of a host land on one worker
+    kPacketDistributionRoundRobin     // next worker for every packet (or batch), flows get reordered
+};
+
+/*!
+ * @brief Hash the flow key of an ip packet according to the distribution policy.
+ *
+ * Fragments and unknown protocols fall back to the address pair, so all fragments of a datagram stay together.
+ *
+ * @param policy The distribution policy, must not be round robin.
+ * @param packet Pointer to the ip header.
+ * @param len Length of the packet.
+ * @return The flow hash.
+ */
+static inline hash_t calcPacketDistributionHash(enum packet_distribution_policy_e policy, const uint8_t *packet,
+                                                uint32_t len)
+{
+    uint8_t  key[16 + 16 + 1 + 4];
+    uint32_t key_len = 0;
+
+    if (len >= 20 && (packet[0] >> 4) == 4)
+    {
+        const uint32_t ihl        = (uint32_t) (packet[0] & 0x0F) * 4;
+        const bool     fragmented = ((packet[6] & 0x3F) | packet[7]) != 0;
+
+        memoryCopy(key, packet + 12, policy == kPacketDistributionSourceIp ? 4 : 8);
+        key_len = policy == kPacketDistributionSourceIp ? 4 : 8;
+
+        if (policy == kPacketDistributionFiveTuple && ! fragmented && (packet[9] == 6 || packet[9] == 17) &&
+            len >= ihl + 4)
+        {
+            key[key_len++] = packet[9];
+            memoryCopy(key + key_len, packet + ihl, 4);
+            key_len += 4;
+        }
+    }
+    else if (len >= 40 && (packet[0] >> 4) == 6)
+    {
+        memoryCopy(key, packet + 8, policy == kPacketDistributionSourceIp ? 16 : 32);
+        key_len = policy == kPacketDistributionSourceIp ? 16 : 32;
+
+        // extension headers are not walked, such packets are keyed by their addresses only
+        if (policy == kPacketDistributionFiveTuple && (packet[6] == 6 || packet[6] == 17) && len >= 40 + 4)
+        {
+            key[key_len++] = packet[6];
+            memoryCopy(key + key_len, packet + 40, 4);
+            key_len += 4;
+        }
+    }
+    else
+    {
+        return 0;
+    }
+
+    return calcHashBytes(key, key_len);
+}
+
+/*!
+ * @brief Pick the worker that receives an ip packet read by a device.
+ *
+ * The hash is meant to be calculated once on the device reader thread, workers never move packets between each other.
+ *
+ * @param policy The distribution policy.
+ * @param packet Pointer to the ip header.
+ * @param len Length of the packet.
+ * @return The worker ID (never the lwip worker).
+ */
+static inline wid_t getPacketDistributionWID(enum packet_distribution_policy_e policy, const uint8_t *packet,
+                                             uint32_t len)
+{
+    if (policy == kPacketDistributionRoundRobin)
+    {
+        return getNextDistributionWID();
+    }
+    // we dont consider lwip thread
+    return (wid_t) (calcPacketDistributionHash(policy, packet, len) % (hash_t) (getWorkersCount() - WORKER_ADDITIONS));
+}
+
 /*!
  * @brief Send a worker message.
  *
@@ -1,5 +1,6 @@
 #include "worker.h"
 #include "context.h"
+#include "dns_resolver.h"
 #include "global_state.h"
 #include "managers/signal_manager.h"
 #include "pipe_tunnel.h"
@@ -28,6 +29,10 @@ void workerExitJoin(worker_t *worker)
         {
             wloopDestroy(&worker->loop);
         }
+        if (worker->dns_resolver)
+        {
+            dnsresolverDestroy(worker->dns_resolver);
+        }
 
         genericpoolDestroy(worker->context_pool);
         genericpoolDestroy(worker->pipetunnel_msg_pool);
@@ -50,6 +55,7 @@ void workerExitJoin(worker_t *worker)
         }
     }
     worker->loop                = NULL;
+    worker->dns_resolver        = NULL;
     worker->context_pool        = NULL;
     worker->pipetunnel_msg_pool = NULL;
     worker->buffer_pool         = NULL;
@@ -119,11 +125,18 @@ void workerRun(worker_t *worker)
 
     wloopRun(worker->loop);
 
+    // the loop freed itself (WLOOP_FLAG_AUTO_FREE), the resolver sockets and timers went with it
+    if (worker->dns_resolver)
+    {
+        dnsresolverDestroy(worker->dns_resolver);
+    }
+
     genericpoolDestroy(worker->context_pool);
     genericpoolDestroy(worker->pipetunnel_msg_pool);
     bufferpoolDestroy(worker->buffer_pool);
 
     worker->loop                = NULL;
+    worker->dns_resolver        = NULL;
     worker->context_pool        = NULL;
     worker->pipetunnel_msg_pool = NULL;
     worker->buffer_pool         = NULL;
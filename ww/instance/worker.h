@@ -14,13 +14,15 @@ typedef _Atomic(wid_t) atomic_wid_t;
  */
 typedef struct worker_s
 {
-    wloop_t        *loop;                // Event loop associated with the worker.
-    buffer_pool_t  *buffer_pool;         // Buffer pool for managing memory buffers.
-    generic_pool_t *context_pool;        // Generic pool for managing context objects.
-    generic_pool_t *pipetunnel_msg_pool; // Generic pool for managing pipe tunnel messages.
-    wthread_t       thread;              // Thread associated with the worker.
-    tid_t           tid;                 // Os Thread Id
-    wid_t           wid;                 // Worker ID.
+    wloop_t               *loop;                // Event loop associated with the worker.
+    buffer_pool_t         *buffer_pool;         // Buffer pool for managing memory buffers.
+    generic_pool_t        *context_pool;        // Generic pool for managing context objects.
+    generic_pool_t        *pipetunnel_msg_pool; // Generic pool for managing pipe tunnel messages.
+    struct dns_resolver_s *dns_resolver;        // Asynchronous dns resolver, created on first use.
+    wthread_t              thread;              // Thread associated with the worker.
+    tid_t                  tid;                 // Os Thread Id
+    wid_t                  wid;                 // Worker ID.
+    atomic_llong           queued_buffers;      // Buffers in buffer queues, only this worker writes it (metrics).
 
 } worker_t;
 
@@ -180,5 +180,7 @@ static inline int atomic_compare_exchange_strong(intptr_t *object, intptr_t *exp
 #define atomicIncRelaxed(x) atomicIncExplicit((x), memory_order_relaxed)
 #define atomicDecRelaxed(x) atomicDecExplicit((x), memory_order_relaxed)
 #define atomicExchangeExplicit(x,y,z) atomic_exchange_explicit(x,y,z) 
+// counters that only one thread writes (others may read), a relaxed load and store without a locked instruction
+#define atomicAddSingleWriter(x, y) atomicStoreRelaxed((x), atomicLoadRelaxed(x) + (y))
 
 #endif // WW_ATOMIC_H_
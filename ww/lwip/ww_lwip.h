@@ -55,6 +55,7 @@ typedef struct
 #define ipAddrIsV4              IP_IS_V4              // Check if IP address is IPv4
 #define ipAddrIsV6              IP_IS_V6              // Check if IP address is IPv6
 #define ipAddrNetworkToAaddress ipaddr_ntoa           // Convert IP address to string
+#define ipAddrNetworkToAaddressR ipaddr_ntoa_r       // Convert IP address to string (caller buffer)
 
 // ------------------------------------------------------------------------
 // IPv4 Specific Function Macros
@@ -8,323 +8,404 @@
     
 */
 
-const char *iran_ip_ranges[] = {
-    "103.130.144.0/24", "103.130.146.0/24", "103.215.220.0/22", "103.216.60.0/22",  "103.231.136.0/22",
-    "109.107.131.0/24", "109.108.160.0/19", "109.109.32.0/19",  "109.110.160.0/19", "109.122.193.0/24",
-    "109.122.217.0/24", "109.122.222.0/24", "109.122.224.0/20", "109.122.240.0/21", "109.122.250.0/23",
-    "109.122.252.0/23", "109.125.128.0/18", "109.162.128.0/17", "109.201.0.0/19",   "109.203.128.0/18",
-    "109.206.252.0/22", "109.225.128.0/18", "109.230.192.0/23", "109.230.200.0/24", "109.230.204.0/22",
-    "109.230.221.0/24", "109.230.223.0/24", "109.230.242.0/24", "109.230.246.0/23", "109.230.251.0/24",
-    "109.230.64.0/19",  "109.232.0.0/21",   "109.238.176.0/20", "109.239.0.0/20",   "109.70.237.0/24",
-    "109.72.192.0/20",  "109.74.232.0/21",  "109.94.164.0/22",  "109.95.60.0/22",   "109.95.64.0/21",
-    "113.203.0.0/17",   "128.65.160.0/19",  "130.185.72.0/21",  "130.193.77.0/24",  "130.255.192.0/18",
-    "134.255.196.0/23", "134.255.200.0/21", "134.255.245.0/24", "134.255.246.0/24", "134.255.248.0/23",
-    "141.11.42.0/24",   "146.19.104.0/24",  "146.19.217.0/24",  "146.66.128.0/21",  "151.232.0.0/14",
-    "151.238.0.0/15",   "151.240.0.0/13",   "152.89.12.0/22",   "152.89.44.0/22",   "157.119.188.0/22",
-    "158.255.74.0/24",  "158.255.78.0/24",  "158.58.0.0/17",    "158.58.184.0/21",  "159.20.96.0/20",
-    "164.138.128.0/18", "164.138.16.0/21",  "164.215.128.0/17", "164.215.56.0/21",  "171.22.24.0/22",
-    "172.80.128.0/17",  "176.101.32.0/20",  "176.101.48.0/21",  "176.102.224.0/19", "176.105.245.0/24",
-    "176.116.7.0/24",   "176.12.64.0/20",   "176.122.210.0/23", "176.123.64.0/18",  "176.124.64.0/22",
-    "176.126.120.0/24", "176.221.16.0/20",  "176.221.64.0/21",  "176.223.80.0/21",  "176.46.128.0/19",
-    "176.56.144.0/20",  "176.62.144.0/21",  "176.65.160.0/19",  "176.65.192.0/18",  "176.67.64.0/20",
-    "176.97.218.0/24",  "176.97.220.0/24",  "178.131.0.0/16",   "178.157.0.0/23",   "178.169.0.0/19",
-    "178.173.128.0/18", "178.173.192.0/19", "178.21.160.0/21",  "178.21.40.0/21",   "178.211.145.0/24",
-    "178.215.0.0/18",   "178.216.248.0/21", "178.219.224.0/20", "178.22.120.0/21",  "178.22.72.0/21",
-    "178.236.32.0/22",  "178.236.96.0/20",  "178.238.192.0/20", "178.239.144.0/20", "178.248.40.0/21",
-    "178.251.208.0/21", "178.252.128.0/18", "178.253.16.0/24",  "178.253.26.0/23",  "178.253.31.0/24",
-    "178.253.38.0/23",  "178.253.44.0/23",  "178.253.55.0/24",  "185.1.77.0/24",    "185.10.71.0/24",
-    "185.10.72.0/22",   "185.100.44.0/22",  "185.101.228.0/22", "185.103.128.0/22", "185.103.244.0/22",
-    "185.103.248.0/22", "185.103.84.0/22",  "185.104.192.0/24", "185.104.228.0/22", "185.104.232.0/22",
-    "185.104.240.0/22", "185.105.100.0/22", "185.105.120.0/22", "185.105.184.0/22", "185.105.236.0/22",
-    "185.106.136.0/22", "185.106.144.0/22", "185.106.200.0/22", "185.106.228.0/22", "185.107.244.0/22",
-    "185.107.248.0/22", "185.107.28.0/22",  "185.107.32.0/23",  "185.108.164.0/22", "185.108.96.0/22",
-    "185.109.128.0/22", "185.109.244.0/22", "185.109.248.0/22", "185.109.60.0/22",  "185.109.72.0/22",
-    "185.109.80.0/22",  "185.11.176.0/22",  "185.11.68.0/22",   "185.11.88.0/22",   "185.110.191.0/24",
-    "185.110.216.0/22", "185.110.228.0/22", "185.110.236.0/22", "185.110.244.0/22", "185.110.252.0/22",
-    "185.110.28.0/22",  "185.111.136.0/22", "185.111.64.0/22",  "185.111.8.0/21",   "185.111.80.0/22",
-    "185.112.130.0/23", "185.112.148.0/22", "185.112.168.0/22", "185.112.32.0/21",  "185.113.112.0/22",
-    "185.113.56.0/22",  "185.114.188.0/22", "185.115.148.0/22", "185.115.168.0/22", "185.115.76.0/22",
-    "185.116.160.0/22", "185.116.20.0/22",  "185.116.24.0/22",  "185.116.44.0/22",  "185.117.136.0/22",
-    "185.117.204.0/23", "185.117.48.0/22",  "185.118.12.0/22",  "185.118.136.0/22", "185.118.152.0/22",
-    "185.119.164.0/22", "185.119.240.0/22", "185.119.4.0/22",   "185.12.100.0/23",  "185.12.102.0/24",
-    "185.12.60.0/22",   "185.120.120.0/22", "185.120.136.0/22", "185.120.160.0/22", "185.120.168.0/22",
-    "185.120.192.0/21", "185.120.200.0/22", "185.120.208.0/20", "185.120.224.0/20", "185.120.240.0/21",
-    "185.120.248.0/22", "185.121.128.0/22", "185.121.56.0/22",  "185.122.80.0/22",  "185.123.208.0/22",
-    "185.123.68.0/22",  "185.124.112.0/22", "185.124.156.0/22", "185.124.172.0/22", "185.125.20.0/22",
-    "185.125.244.0/22", "185.125.248.0/21", "185.126.0.0/20",   "185.126.16.0/22",  "185.126.132.0/23",
-    "185.126.200.0/22", "185.126.40.0/22",  "185.127.232.0/22", "185.128.136.0/22", "185.128.152.0/22",
-    "185.128.164.0/22", "185.128.40.0/24",  "185.128.48.0/22",  "185.128.80.0/22",  "185.129.168.0/22",
-    "185.129.184.0/21", "185.129.196.0/22", "185.129.200.0/22", "185.129.212.0/22", "185.129.216.0/22",
-    "185.129.228.0/22", "185.129.232.0/21", "185.129.240.0/22", "185.129.80.0/22",  "185.13.228.0/22",
-    "185.130.76.0/22",  "185.131.100.0/22", "185.131.108.0/22", "185.131.112.0/21", "185.131.124.0/22",
-    "185.131.128.0/22", "185.131.136.0/21", "185.131.148.0/22", "185.131.152.0/21", "185.131.164.0/22",
-    "185.131.168.0/22", "185.131.28.0/22",  "185.131.84.0/22",  "185.131.88.0/21",  "185.132.212.0/22",
-    "185.132.80.0/22",  "185.133.152.0/22", "185.133.164.0/22", "185.133.244.0/23", "185.133.246.0/24",
-    "185.134.96.0/22",  "185.135.228.0/22", "185.135.28.0/22",  "185.136.100.0/22", "185.136.172.0/22",
-    "185.136.180.0/22", "185.136.192.0/22", "185.136.220.0/22", "185.137.108.0/23", "185.137.110.0/24",
-    "185.137.24.0/22",  "185.137.60.0/22",  "185.139.64.0/22",  "185.14.160.0/22",  "185.14.80.0/22",
-    "185.140.232.0/22", "185.140.240.0/22", "185.140.4.0/22",   "185.140.56.0/22",  "185.141.104.0/22",
-    "185.141.132.0/22", "185.141.168.0/22", "185.141.212.0/22", "185.141.244.0/22", "185.141.36.0/22",
-    "185.141.48.0/22",  "185.142.124.0/22", "185.142.156.0/22", "185.142.232.0/22", "185.142.92.0/22",
-    "185.143.204.0/22", "185.143.232.0/22", "185.143.72.0/22",  "185.144.64.0/22",  "185.145.184.0/22",
-    "185.145.8.0/22",   "185.147.160.0/22", "185.147.176.0/22", "185.147.40.0/22",  "185.147.84.0/22",
-    "185.150.108.0/22", "185.153.184.0/22", "185.153.208.0/22", "185.154.184.0/22", "185.155.236.0/22",
-    "185.155.72.0/22",  "185.155.8.0/21",   "185.157.8.0/22",   "185.158.172.0/22", "185.159.152.0/22",
-    "185.159.176.0/22", "185.16.232.0/22",  "185.160.104.0/22", "185.160.176.0/22", "185.161.112.0/22",
-    "185.161.36.0/22",  "185.162.216.0/22", "185.162.40.0/22",  "185.163.88.0/22",  "185.164.252.0/22",
-    "185.164.73.0/24",  "185.164.74.0/23",  "185.165.100.0/22", "185.165.116.0/22", "185.165.204.0/22",
-    "185.165.28.0/22",  "185.165.40.0/22",  "185.166.104.0/22", "185.166.112.0/22", "185.166.60.0/22",
-    "185.167.100.0/22", "185.167.124.0/22", "185.167.72.0/22",  "185.168.28.0/22",  "185.169.20.0/22",
-    "185.169.36.0/22",  "185.169.6.0/24",   "185.170.236.0/22", "185.170.8.0/24",   "185.171.52.0/22",
-    "185.172.0.0/22",   "185.172.212.0/22", "185.172.68.0/22",  "185.173.104.0/22", "185.173.129.0/24",
-    "185.173.130.0/24", "185.173.168.0/22", "185.174.132.0/24", "185.174.134.0/24", "185.174.200.0/22",
-    "185.174.248.0/22", "185.175.240.0/22", "185.175.76.0/22",  "185.176.32.0/22",  "185.176.56.0/22",
-    "185.177.156.0/22", "185.177.232.0/22", "185.178.104.0/22", "185.178.220.0/22", "185.179.168.0/22",
-    "185.179.220.0/22", "185.179.90.0/24",  "185.18.156.0/22",  "185.18.212.0/22",  "185.180.128.0/22",
-    "185.180.52.0/22",  "185.181.180.0/22", "185.182.220.0/22", "185.182.248.0/22", "185.184.32.0/22",
-    "185.184.48.0/22",  "185.185.16.0/22",  "185.185.240.0/22", "185.186.240.0/22", "185.186.48.0/22",
-    "185.187.48.0/22",  "185.187.84.0/22",  "185.188.104.0/22", "185.188.112.0/22", "185.189.120.0/22",
-    "185.19.201.0/24",  "185.190.20.0/22",  "185.190.39.0/24",  "185.191.76.0/22",  "185.192.112.0/22",
-    "185.192.8.0/22",   "185.193.208.0/22", "185.193.47.0/24",  "185.194.244.0/22", "185.194.76.0/22",
-    "185.195.72.0/22",  "185.196.148.0/22", "185.197.112.0/22", "185.197.68.0/22",  "185.198.160.0/22",
-    "185.199.208.0/22", "185.199.64.0/22",  "185.2.12.0/22",    "185.20.160.0/22",  "185.201.48.0/22",
-    "185.202.56.0/22",  "185.203.160.0/22", "185.204.168.0/22", "185.204.180.0/22", "185.204.197.0/24",
-    "185.205.203.0/24", "185.205.220.0/22", "185.206.229.0/24", "185.206.231.0/24", "185.206.236.0/22",
-    "185.206.92.0/22",  "185.207.52.0/22",  "185.207.72.0/22",  "185.208.148.0/22", "185.208.174.0/23",
-    "185.208.180.0/22", "185.208.76.0/22",  "185.209.188.0/22", "185.21.68.0/22",   "185.21.76.0/22",
-    "185.210.200.0/22", "185.211.56.0/22",  "185.211.84.0/22",  "185.211.88.0/22",  "185.212.192.0/22",
-    "185.212.48.0/22",  "185.213.164.0/22", "185.213.195.0/24", "185.213.8.0/22",   "185.214.36.0/22",
-    "185.215.124.0/22", "185.215.152.0/22", "185.215.228.0/22", "185.219.112.0/22", "185.22.28.0/22",
-    "185.220.224.0/22", "185.221.112.0/22", "185.221.192.0/22", "185.221.239.0/24", "185.222.120.0/22",
-    "185.222.180.0/22", "185.222.184.0/22", "185.222.210.0/24", "185.223.160.0/24", "185.224.176.0/22",
-    "185.225.180.0/22", "185.225.240.0/22", "185.225.80.0/22",  "185.226.116.0/22", "185.226.132.0/22",
-    "185.226.140.0/22", "185.226.97.0/24",  "185.227.116.0/22", "185.227.64.0/22",  "185.228.236.0/22",
-    "185.229.0.0/22",   "185.229.204.0/24", "185.229.28.0/22",  "185.23.128.0/22",  "185.231.112.0/24",
-    "185.231.114.0/23", "185.231.180.0/22", "185.231.65.0/24",  "185.232.152.0/22", "185.232.176.0/22",
-    "185.233.12.0/22",  "185.233.131.0/24", "185.233.84.0/22",  "185.234.14.0/24",  "185.234.192.0/22",
-    "185.235.136.0/22", "185.235.245.0/24", "185.235.42.0/24",  "185.236.36.0/22",  "185.236.45.0/24",
-    "185.236.88.0/22",  "185.237.8.0/22",   "185.237.84.0/22",  "185.238.140.0/24", "185.238.143.0/24",
-    "185.238.20.0/22",  "185.238.44.0/22",  "185.238.92.0/22",  "185.239.0.0/22",   "185.239.104.0/22",
-    "185.24.136.0/22",  "185.24.148.0/22",  "185.24.228.0/22",  "185.24.252.0/23",  "185.24.254.0/24",
-    "185.240.148.0/22", "185.240.56.0/22",  "185.243.48.0/22",  "185.244.52.0/22",  "185.246.4.0/22",
-    "185.248.32.0/24",  "185.25.172.0/22",  "185.251.76.0/22",  "185.252.200.0/24", "185.252.28.0/22",
-    "185.254.165.0/24", "185.254.166.0/24", "185.255.208.0/22", "185.255.68.0/22",  "185.255.88.0/22",
-    "185.26.232.0/22",  "185.26.32.0/22",   "185.29.220.0/22",  "185.3.124.0/22",   "185.3.200.0/22",
-    "185.3.212.0/22",   "185.30.4.0/22",    "185.30.76.0/22",   "185.31.124.0/22",  "185.32.128.0/22",
-    "185.34.160.0/22",  "185.36.228.0/24",  "185.36.231.0/24",  "185.37.52.0/22",   "185.39.180.0/22",
-    "185.4.0.0/22",     "185.4.104.0/22",   "185.4.16.0/22",    "185.4.220.0/22",   "185.4.28.0/22",
-    "185.40.16.0/24",   "185.40.240.0/22",  "185.41.0.0/22",    "185.41.220.0/22",  "185.42.212.0/22",
-    "185.42.224.0/22",  "185.42.24.0/24",   "185.44.100.0/22",  "185.44.112.0/22",  "185.44.36.0/22",
-    "185.45.188.0/22",  "185.46.0.0/22",    "185.46.108.0/22",  "185.46.216.0/22",  "185.47.48.0/22",
-    "185.49.104.0/22",  "185.49.231.0/24",  "185.49.84.0/22",   "185.49.96.0/22",   "185.5.156.0/22",
-    "185.50.36.0/22",   "185.51.200.0/22",  "185.51.40.0/22",   "185.53.140.0/22",  "185.55.224.0/22",
-    "185.56.92.0/22",   "185.56.96.0/22",   "185.57.132.0/22",  "185.57.164.0/22",  "185.57.200.0/22",
-    "185.58.240.0/22",  "185.59.112.0/23",  "185.60.136.0/22",  "185.60.32.0/22",   "185.62.232.0/22",
-    "185.63.113.0/24",  "185.63.114.0/24",  "185.63.236.0/22",  "185.64.176.0/22",  "185.66.224.0/21",
-    "185.67.100.0/22",  "185.67.12.0/22",   "185.67.156.0/22",  "185.67.212.0/22",  "185.69.108.0/22",
-    "185.7.212.0/24",   "185.70.60.0/22",   "185.71.152.0/22",  "185.71.192.0/22",  "185.72.24.0/22",
-    "185.72.80.0/22",   "185.73.0.0/22",    "185.73.112.0/24",  "185.73.114.0/24",  "185.73.226.0/24",
-    "185.73.76.0/22",   "185.74.164.0/22",  "185.75.196.0/22",  "185.75.204.0/22",  "185.76.248.0/22",
-    "185.78.20.0/22",   "185.79.156.0/22",  "185.79.60.0/22",   "185.79.96.0/22",   "185.8.172.0/22",
-    "185.80.100.0/22",  "185.80.197.0/24",  "185.80.198.0/23",  "185.81.40.0/22",   "185.81.96.0/23",
-    "185.81.99.0/24",   "185.82.136.0/22",  "185.82.164.0/22",  "185.82.180.0/22",  "185.82.28.0/22",
-    "185.82.64.0/22",   "185.83.112.0/24",  "185.83.114.0/23",  "185.83.180.0/23",  "185.83.183.0/24",
-    "185.83.184.0/22",  "185.83.196.0/22",  "185.83.208.0/22",  "185.83.28.0/22",   "185.83.76.0/22",
-    "185.83.80.0/22",   "185.83.88.0/22",   "185.84.220.0/22",  "185.85.136.0/22",  "185.85.68.0/22",
-    "185.86.180.0/22",  "185.86.36.0/22",   "185.88.152.0/22",  "185.88.176.0/22",  "185.88.252.0/22",
-    "185.88.48.0/22",   "185.89.112.0/22",  "185.92.4.0/22",    "185.92.8.0/22",    "185.92.40.0/22",
-    "185.94.96.0/22",   "185.95.152.0/22",  "185.95.180.0/22",  "185.95.60.0/22",   "185.96.240.0/22",
-    "185.97.116.0/22",  "185.98.112.0/22",  "185.99.212.0/22",  "188.0.240.0/20",   "188.118.64.0/18",
-    "188.121.96.0/19",  "188.121.128.0/19", "188.122.96.0/19",  "188.136.128.0/18", "188.136.192.0/19",
-    "188.158.0.0/15",   "188.191.176.0/21", "188.208.144.0/20", "188.208.160.0/19", "188.208.200.0/22",
-    "188.208.208.0/21", "188.208.224.0/19", "188.209.0.0/19",   "188.209.32.0/20",  "188.208.56.0/21",
-    "188.208.64.0/19",  "188.209.116.0/22", "188.209.152.0/23", "188.209.192.0/20", "188.209.64.0/20",
-    "188.210.232.0/22", "188.210.64.0/20",  "188.210.80.0/21",  "188.210.96.0/19",  "188.210.128.0/18",
-    "188.210.192.0/20", "188.211.0.0/20",   "188.211.176.0/20", "188.211.192.0/19", "188.211.32.0/19",
-    "188.211.64.0/18",  "188.211.128.0/19", "188.212.144.0/21", "188.212.160.0/19", "188.212.200.0/21",
-    "188.212.208.0/20", "188.212.224.0/20", "188.212.240.0/21", "188.212.22.0/24",  "188.212.48.0/20",
-    "188.212.64.0/19",  "188.212.96.0/22",  "188.213.144.0/20", "188.213.176.0/20", "188.213.192.0/21",
-    "188.213.208.0/22", "188.213.64.0/20",  "188.213.96.0/19",  "188.214.120.0/23", "188.214.160.0/19",
-    "188.214.216.0/21", "188.214.4.0/22",   "188.214.84.0/22",  "188.214.96.0/22",  "188.215.128.0/20",
-    "188.215.160.0/19", "188.215.192.0/19", "188.215.24.0/22",  "188.215.240.0/22", "188.215.88.0/22",
-    "188.229.0.0/17",   "188.240.196.0/24", "188.240.212.0/24", "188.240.248.0/21", "188.253.2.0/23",
-    "188.253.4.0/22",   "188.253.8.0/21",   "188.253.16.0/20",  "188.253.32.0/19",  "188.253.64.0/18",
-    "188.75.64.0/18",   "188.94.188.0/24",  "188.95.89.0/24",   "192.15.0.0/16",    "193.0.156.0/24",
-    "193.104.212.0/24", "193.104.22.0/24",  "193.104.29.0/24",  "193.105.2.0/24",   "193.105.234.0/24",
-    "193.105.6.0/24",   "193.106.190.0/24", "193.108.242.0/23", "193.111.234.0/23", "193.134.100.0/23",
-    "193.141.126.0/23", "193.141.64.0/23",  "193.142.232.0/23", "193.142.254.0/23", "193.142.30.0/24",
-    "193.148.64.0/22",  "193.150.66.0/24",  "193.151.128.0/19", "193.162.129.0/24", "193.176.240.0/22",
-    "193.178.200.0/22", "193.186.32.0/24",  "193.189.122.0/23", "193.19.144.0/23",  "193.200.102.0/23",
-    "193.200.148.0/24", "193.201.192.0/22", "193.201.72.0/23",  "193.22.20.0/24",   "193.222.51.0/24",
-    "193.228.136.0/24", "193.228.90.0/23",  "193.242.194.0/23", "193.242.208.0/23", "193.246.160.0/23",
-    "193.246.164.0/23", "193.246.174.0/23", "193.246.200.0/23", "193.28.181.0/24",  "193.29.24.0/24",
-    "193.29.26.0/24",   "193.3.182.0/24",   "193.3.231.0/24",   "193.3.255.0/24",   "193.3.31.0/24",
-    "193.32.80.0/23",   "193.34.244.0/22",  "193.35.62.0/24",   "193.38.247.0/24",  "193.39.9.0/24",
-    "193.56.107.0/24",  "193.56.118.0/24",  "193.56.59.0/24",   "193.56.61.0/24",   "193.8.139.0/24",
-    "194.143.140.0/23", "194.146.148.0/22", "194.146.239.0/24", "194.147.164.0/22", "194.150.68.0/22",
-    "194.156.140.0/22", "194.180.224.0/24", "194.225.0.0/16",   "194.26.117.0/24",  "194.26.2.0/23",
-    "194.26.20.0/23",   "194.31.194.0/24",  "194.33.104.0/22",  "194.33.122.0/23",  "194.33.124.0/22",
-    "194.34.163.0/24",  "194.36.0.0/24",    "194.36.174.0/24",  "194.39.36.0/22",   "194.41.48.0/22",
-    "194.5.175.0/24",   "194.5.176.0/22",   "194.5.188.0/24",   "194.5.192.0/24",   "194.5.195.0/24",
-    "194.5.205.0/24",   "194.5.40.0/22",    "194.50.204.0/24",  "194.50.209.0/24",  "194.50.216.0/24",
-    "194.50.218.0/24",  "194.53.118.0/23",  "194.53.122.0/23",  "194.56.148.0/24",  "194.59.170.0/23",
-    "194.59.214.0/23",  "194.60.208.0/22",  "194.60.228.0/22",  "194.62.17.0/24",   "194.62.43.0/24",
-    "194.87.23.0/24",   "194.9.56.0/23",    "194.9.80.0/23",    "195.110.38.0/23",  "195.114.4.0/23",
-    "195.114.8.0/23",   "195.146.32.0/19",  "195.181.0.0/17",   "195.182.38.0/24",  "195.190.130.0/24",
-    "195.190.139.0/24", "195.190.144.0/24", "195.191.22.0/23",  "195.191.44.0/23",  "195.191.74.0/23",
-    "195.2.234.0/24",   "195.20.136.0/24",  "195.211.44.0/22",  "195.219.71.0/24",  "195.225.232.0/24",
-    "195.226.223.0/24", "195.230.105.0/24", "195.230.107.0/24", "195.230.124.0/24", "195.230.97.0/24",
-    "195.234.191.0/24", "195.238.231.0/24", "195.238.240.0/24", "195.238.247.0/24", "195.245.70.0/23",
-    "195.28.10.0/23",   "195.28.168.0/23",  "195.8.102.0/24",   "195.8.110.0/24",   "195.8.112.0/24",
-    "195.8.114.0/24",   "195.88.188.0/23",  "195.96.128.0/24",  "195.96.153.0/24",  "196.3.91.0/24",
-    "2.144.0.0/14",     "2.176.0.0/12",     "204.18.0.0/16",    "210.5.198.0/24",   "210.5.208.0/23",
-    "210.5.218.0/24",   "210.5.232.0/23",   "212.1.192.0/21",   "212.120.192.0/19", "212.16.64.0/19",
-    "212.18.108.0/24",  "212.23.201.0/24",  "212.23.214.0/24",  "212.23.216.0/24",  "212.33.192.0/19",
-    "212.46.45.0/24",   "212.80.0.0/19",    "212.86.64.0/19",   "213.108.240.0/22", "213.109.199.0/24",
-    "213.109.240.0/20", "213.176.0.0/20",   "213.176.16.0/21",  "213.176.64.0/18",  "213.195.0.0/20",
-    "213.195.16.0/21",  "213.195.32.0/19",  "213.207.192.0/18", "213.217.32.0/19",  "213.232.124.0/22",
-    "213.233.160.0/19", "217.11.16.0/20",   "217.114.40.0/24",  "217.144.104.0/22", "217.146.208.0/20",
-    "217.161.16.0/24",  "217.170.240.0/20", "217.171.145.0/24", "217.171.148.0/22", "217.172.102.0/23",
-    "217.172.104.0/21", "217.172.112.0/22", "217.172.116.0/23", "217.172.118.0/24", "217.172.120.0/21",
-    "217.172.98.0/23",  "217.174.16.0/20",  "217.198.190.0/24", "217.218.0.0/15",   "217.24.144.0/20",
-    "217.25.48.0/20",   "217.60.0.0/16",    "217.66.192.0/19",  "217.77.112.0/20",  "31.130.176.0/20",
-    "31.14.112.0/20",   "31.14.144.0/20",   "31.14.80.0/20",    "31.170.48.0/20",   "31.171.216.0/21",
-    "31.184.128.0/18",  "31.193.112.0/21",  "31.2.128.0/17",    "31.214.132.0/23",  "31.214.146.0/23",
-    "31.214.154.0/24",  "31.214.168.0/21",  "31.214.200.0/23",  "31.214.228.0/22",  "31.214.248.0/21",
-    "31.216.62.0/24",   "31.217.208.0/21",  "31.24.200.0/21",   "31.24.232.0/21",   "31.25.104.0/21",
-    "31.25.128.0/21",   "31.25.232.0/23",   "31.25.90.0/23",    "31.25.92.0/22",    "31.40.0.0/23",
-    "31.40.2.0/24",     "31.41.35.0/24",    "31.47.32.0/19",    "31.56.0.0/14",     "31.7.64.0/21",
-    "31.7.72.0/22",     "31.7.76.0/23",     "31.7.88.0/22",     "31.7.96.0/19",     "31.7.128.0/20",
-    "37.10.109.0/24",   "37.10.117.0/24",   "37.10.64.0/22",    "37.114.192.0/18",  "37.128.240.0/20",
-    "37.129.0.0/16",    "37.130.200.0/21",  "37.137.0.0/16",    "37.143.144.0/21",  "37.148.0.0/17",
-    "37.148.248.0/22",  "37.152.160.0/19",  "37.153.128.0/22",  "37.153.176.0/20",  "37.156.0.0/22",
-    "37.156.100.0/22",  "37.156.112.0/20",  "37.156.128.0/20",  "37.156.144.0/22",  "37.156.152.0/21",
-    "37.156.160.0/21",  "37.156.176.0/22",  "37.156.212.0/22",  "37.156.232.0/21",  "37.156.240.0/22",
-    "37.156.248.0/22",  "37.156.48.0/20",   "37.156.8.0/21",    "37.156.16.0/20",   "37.19.80.0/20",
-    "37.191.64.0/19",   "37.202.128.0/17",  "37.221.0.0/18",    "37.228.131.0/24",  "37.228.133.0/24",
-    "37.228.135.0/24",  "37.228.136.0/22",  "37.235.16.0/20",   "37.254.0.0/15",    "37.32.0.0/19",
-    "37.32.32.0/20",    "37.32.112.0/20",   "37.44.56.0/21",    "37.49.144.0/21",   "37.63.128.0/17",
-    "37.75.240.0/21",   "37.9.248.0/21",    "37.98.0.0/17",     "45.128.140.0/22",  "45.129.116.0/22",
-    "45.129.36.0/22",   "45.132.168.0/21",  "45.132.32.0/24",   "45.135.240.0/22",  "45.138.132.0/22",
-    "45.139.100.0/22",  "45.139.9.0/24",    "45.139.10.0/23",   "45.140.224.0/21",  "45.140.28.0/22",
-    "45.142.188.0/22",  "45.144.124.0/22",  "45.144.16.0/22",   "45.147.76.0/22",   "45.148.248.0/22",
-    "45.149.76.0/22",   "45.15.200.0/22",   "45.15.248.0/22",   "45.150.88.0/22",   "45.155.192.0/22",
-    "45.156.180.0/22",  "45.156.184.0/22",  "45.156.192.0/21",  "45.156.200.0/22",  "45.157.244.0/22",
-    "45.158.120.0/22",  "45.159.112.0/22",  "45.159.148.0/22",  "45.159.196.0/22",  "45.8.160.0/22",
-    "45.81.16.0/22",    "45.82.136.0/22",   "45.84.156.0/22",   "45.84.248.0/22",   "45.86.196.0/22",
-    "45.86.4.0/22",     "45.86.87.0/24",    "45.87.4.0/22",     "45.89.136.0/22",   "45.89.200.0/22",
-    "45.89.236.0/22",   "45.9.144.0/22",    "45.9.252.0/22",    "45.90.72.0/22",    "45.91.152.0/22",
-    "45.92.92.0/22",    "45.93.168.0/22",   "45.94.212.0/22",   "45.94.252.0/22",   "46.100.0.0/16",
-    "46.102.120.0/21",  "46.102.128.0/20",  "46.102.184.0/22",  "46.143.0.0/17",    "46.143.204.0/22",
-    "46.143.208.0/21",  "46.143.244.0/22",  "46.143.248.0/22",  "46.148.32.0/20",   "46.164.64.0/18",
-    "46.167.128.0/19",  "46.18.248.0/21",   "46.182.32.0/21",   "46.209.0.0/16",    "46.21.80.0/20",
-    "46.224.0.0/15",    "46.235.76.0/23",   "46.245.0.0/17",    "46.248.32.0/19",   "46.249.120.0/21",
-    "46.249.96.0/24",   "46.251.224.0/24",  "46.251.226.0/24",  "46.251.237.0/24",  "46.255.216.0/21",
-    "46.28.72.0/21",    "46.32.0.0/19",     "46.34.160.0/19",   "46.34.96.0/19",    "46.36.96.0/20",
-    "46.38.128.0/19",   "46.41.192.0/18",   "46.51.0.0/17",     "46.62.128.0/17",   "5.1.43.0/24",
-    "5.104.208.0/21",   "5.106.0.0/16",     "5.112.0.0/12",     "5.134.128.0/18",   "5.134.192.0/21",
-    "5.144.128.0/21",   "5.145.112.0/22",   "5.145.116.0/24",   "5.159.48.0/21",    "5.160.0.0/16",
-    "5.182.44.0/22",    "5.190.0.0/16",     "5.198.160.0/19",   "5.200.64.0/18",    "5.200.128.0/17",
-    "5.201.128.0/17",   "5.202.0.0/16",     "5.208.0.0/12",     "5.22.0.0/17",      "5.22.192.0/21",
-    "5.22.200.0/22",    "5.23.112.0/21",    "5.232.0.0/14",     "5.236.0.0/17",     "5.236.128.0/20",
-    "5.236.144.0/21",   "5.236.156.0/22",   "5.236.160.0/19",   "5.236.192.0/18",   "5.237.0.0/16",
-    "5.238.0.0/15",     "5.250.0.0/17",     "5.252.216.0/22",   "5.253.225.0/24",   "5.253.24.0/22",
-    "5.253.96.0/22",    "5.34.208.0/20",    "5.42.223.0/24",    "5.52.0.0/16",      "5.53.32.0/19",
-    "5.56.128.0/22",    "5.56.132.0/24",    "5.56.134.0/23",    "5.57.32.0/21",     "5.61.24.0/23",
-    "5.61.26.0/24",     "5.61.28.0/22",     "5.62.160.0/19",    "5.62.192.0/18",    "5.63.8.0/21",
-    "5.72.0.0/15",      "5.74.0.0/16",      "5.75.0.0/17",      "62.102.128.0/20",  "62.133.46.0/24",
-    "62.193.0.0/19",    "62.204.61.0/24",   "62.220.96.0/19",   "62.3.14.0/24",     "62.3.41.0/24",
-    "62.3.42.0/24",     "62.32.50.0/24",    "62.32.53.0/24",    "62.60.128.0/20",   "62.60.144.0/23",
-    "62.60.160.0/22",   "62.60.196.0/22",   "62.60.200.0/21",   "62.60.232.0/21",   "62.60.240.0/21",
-    "62.60.252.0/22",   "63.243.185.0/24",  "66.79.96.0/19",    "69.194.64.0/18",   "77.104.64.0/18",
-    "77.237.160.0/19",  "77.237.64.0/19",   "77.238.104.0/21",  "77.238.112.0/20",  "77.245.224.0/20",
-    "77.36.128.0/17",   "77.42.0.0/17",     "77.77.64.0/18",    "77.81.128.0/21",   "77.81.144.0/20",
-    "77.81.192.0/19",   "77.81.32.0/20",    "77.81.76.0/24",    "77.81.78.0/24",    "77.81.82.0/23",
-    "77.95.220.0/24",   "78.109.192.0/20",  "78.110.112.0/20",  "78.111.0.0/20",    "78.154.32.0/19",
-    "78.157.32.0/19",   "78.158.160.0/19",  "78.31.232.0/22",   "78.38.0.0/15",     "79.127.0.0/17",
-    "79.132.192.0/23",  "79.132.200.0/21",  "79.132.208.0/20",  "79.143.84.0/23",   "79.143.86.0/24",
-    "79.174.160.0/21",  "79.175.128.0/18",  "80.191.0.0/16",    "80.210.0.0/18",    "80.210.128.0/17",
-    "80.242.0.0/20",    "80.249.112.0/22",  "80.250.192.0/20",  "80.253.128.0/19",  "80.66.176.0/20",
-    "80.71.112.0/20",   "80.71.149.0/24",   "80.75.0.0/20",     "80.91.208.0/24",   "81.12.0.0/17",
-    "81.16.112.0/20",   "81.163.0.0/21",    "81.28.32.0/19",    "81.29.240.0/20",   "81.31.160.0/19",
-    "81.31.224.0/22",   "81.31.228.0/23",   "81.31.230.0/24",   "81.31.233.0/24",   "81.31.234.0/23",
-    "81.31.236.0/22",   "81.31.240.0/22",   "81.31.248.0/22",   "81.90.144.0/20",   "81.91.128.0/19",
-    "81.92.216.0/24",   "82.138.140.0/24",  "82.180.192.0/18",  "82.97.240.0/20",   "82.99.192.0/18",
-    "83.120.0.0/14",    "83.147.192.0/23",  "83.147.194.0/24",  "83.147.240.0/22",  "83.147.252.0/24",
-    "83.147.254.0/24",  "83.150.192.0/22",  "84.241.0.0/18",    "84.47.192.0/18",   "85.133.128.0/19",
-    "85.133.160.0/22",  "85.133.164.0/24",  "85.133.166.0/23",  "85.133.168.0/21",  "85.133.176.0/20",
-    "85.133.192.0/23",  "85.133.195.0/24",  "85.133.196.0/22",  "85.133.200.0/21",  "85.133.208.0/21",
-    "85.133.216.0/24",  "85.133.218.0/23",  "85.133.220.0/22",  "85.133.224.0/21",  "85.133.232.0/22",
-    "85.133.237.0/24",  "85.133.239.0/24",  "85.133.240.0/21",  "85.133.248.0/22",  "85.133.252.0/24",
-    "85.133.254.0/23",  "85.15.0.0/18",     "85.185.0.0/16",    "85.198.0.0/19",    "85.198.48.0/20",
-    "85.204.104.0/23",  "85.204.128.0/22",  "85.204.208.0/20",  "85.204.30.0/23",   "85.204.76.0/23",
-    "85.204.80.0/20",   "85.208.252.0/22",  "85.239.192.0/19",  "85.9.64.0/18",     "86.104.232.0/21",
-    "86.104.240.0/21",  "86.104.32.0/20",   "86.104.80.0/20",   "86.104.96.0/20",   "86.105.128.0/20",
-    "86.105.40.0/21",   "86.106.142.0/24",  "86.106.192.0/21",  "86.107.0.0/20",    "86.107.144.0/20",
-    "86.107.172.0/22",  "86.107.208.0/20",  "86.107.80.0/20",   "86.109.32.0/19",   "86.55.0.0/16",
-    "86.57.0.0/17",     "87.107.0.0/16",    "87.236.210.0/23",  "87.236.213.0/24",  "87.236.214.0/24",
-    "87.247.168.0/21",  "87.247.176.0/20",  "87.248.128.0/24",  "87.248.139.0/24",  "87.248.140.0/23",
-    "87.248.142.0/24",  "87.248.147.0/24",  "87.248.150.0/24",  "87.248.152.0/23",  "87.248.154.0/24",
-    "87.248.159.0/24",  "87.251.128.0/19",  "88.135.32.0/20",   "88.135.68.0/24",   "89.144.128.0/18",
-    "89.165.0.0/17",    "89.196.0.0/16",    "89.198.0.0/15",    "89.219.192.0/18",  "89.219.64.0/18",
-    "89.221.80.0/20",   "89.235.64.0/18",   "89.32.0.0/19",     "89.32.196.0/23",   "89.32.248.0/22",
-    "89.32.96.0/20",    "89.33.100.0/22",   "89.33.128.0/23",   "89.33.18.0/23",    "89.33.204.0/23",
-    "89.33.234.0/23",   "89.33.240.0/23",   "89.34.128.0/19",   "89.34.168.0/23",   "89.34.176.0/23",
-    "89.34.20.0/23",    "89.34.200.0/23",   "89.34.248.0/21",   "89.34.32.0/19",    "89.34.88.0/23",
-    "89.34.94.0/23",    "89.35.120.0/22",   "89.35.132.0/23",   "89.35.156.0/23",   "89.35.176.0/23",
-    "89.35.180.0/22",   "89.35.194.0/23",   "89.35.58.0/23",    "89.35.68.0/22",    "89.36.16.0/23",
-    "89.36.176.0/20",   "89.36.194.0/23",   "89.36.226.0/23",   "89.36.252.0/23",   "89.36.48.0/20",
-    "89.36.96.0/20",    "89.37.0.0/20",     "89.37.102.0/23",   "89.37.144.0/21",   "89.37.152.0/22",
-    "89.37.168.0/22",   "89.37.198.0/23",   "89.37.208.0/22",   "89.37.218.0/23",   "89.37.240.0/20",
-    "89.37.30.0/23",    "89.37.42.0/23",    "89.38.102.0/23",   "89.38.184.0/21",   "89.38.192.0/21",
-    "89.38.212.0/22",   "89.38.24.0/23",    "89.38.242.0/23",   "89.38.244.0/22",   "89.38.80.0/20",
-    "89.39.186.0/23",   "89.39.208.0/24",   "89.39.8.0/22",     "89.40.106.0/23",   "89.40.110.0/23",
-    "89.40.128.0/23",   "89.40.152.0/21",   "89.40.240.0/20",   "89.40.78.0/23",    "89.41.184.0/22",
-    "89.41.192.0/19",   "89.41.240.0/21",   "89.41.32.0/23",    "89.41.40.0/22",    "89.41.58.0/23",
-    "89.41.8.0/21",     "89.41.16.0/21",    "89.42.136.0/22",   "89.42.150.0/23",   "89.42.184.0/21",
-    "89.42.196.0/22",   "89.42.208.0/22",   "89.42.228.0/23",   "89.42.32.0/23",    "89.42.44.0/22",
-    "89.42.56.0/23",    "89.42.68.0/23",    "89.42.96.0/21",    "89.43.0.0/20",     "89.43.144.0/21",
-    "89.43.182.0/23",   "89.43.188.0/23",   "89.43.204.0/23",   "89.43.216.0/21",   "89.43.224.0/21",
-    "89.43.36.0/23",    "89.43.70.0/23",    "89.43.88.0/21",    "89.43.96.0/21",    "89.44.112.0/23",
-    "89.44.118.0/23",   "89.44.128.0/21",   "89.44.146.0/23",   "89.44.176.0/21",   "89.44.190.0/23",
-    "89.44.202.0/23",   "89.44.240.0/22",   "89.45.112.0/21",   "89.45.126.0/23",   "89.45.152.0/21",
-    "89.45.230.0/23",   "89.45.48.0/20",    "89.45.68.0/23",    "89.45.80.0/23",    "89.45.89.0/24",
-    "89.46.184.0/21",   "89.46.216.0/22",   "89.46.44.0/23",    "89.46.60.0/23",    "89.46.94.0/23",
-    "89.47.128.0/19",   "89.47.196.0/22",   "89.47.200.0/22",   "89.47.64.0/20",    "91.106.64.0/19",
-    "91.108.128.0/19",  "91.109.104.0/21",  "91.133.128.0/17",  "91.147.64.0/20",   "91.184.64.0/19",
-    "91.185.128.0/19",  "91.186.192.0/23",  "91.186.201.0/24",  "91.186.216.0/23",  "91.186.218.0/24",
-    "91.190.88.0/21",   "91.194.6.0/24",    "91.199.18.0/24",   "91.199.27.0/24",   "91.199.30.0/24",
-    "91.199.9.0/24",    "91.207.138.0/23",  "91.207.205.0/24",  "91.208.165.0/24",  "91.209.179.0/24",
-    "91.209.183.0/24",  "91.209.184.0/24",  "91.209.186.0/24",  "91.209.242.0/24",  "91.209.96.0/24",
-    "91.212.16.0/24",   "91.212.252.0/24",  "91.213.151.0/24",  "91.213.157.0/24",  "91.213.167.0/24",
-    "91.213.172.0/24",  "91.216.4.0/24",    "91.217.64.0/23",   "91.220.113.0/24",  "91.220.243.0/24",
-    "91.220.79.0/24",   "91.221.240.0/23",  "91.222.196.0/22",  "91.222.204.0/22",  "91.224.110.0/23",
-    "91.224.176.0/23",  "91.224.20.0/23",   "91.225.52.0/22",   "91.226.225.0/24",  "91.227.246.0/23",
-    "91.227.84.0/22",   "91.228.132.0/23",  "91.228.189.0/24",  "91.228.22.0/23",   "91.229.214.0/23",
-    "91.229.46.0/23",   "91.230.32.0/24",   "91.232.64.0/22",   "91.232.68.0/23",   "91.232.72.0/22",
-    "91.233.56.0/22",   "91.236.168.0/23",  "91.237.254.0/23",  "91.238.0.0/24",    "91.239.108.0/22",
-    "91.239.14.0/24",   "91.239.214.0/24",  "91.240.180.0/22",  "91.240.60.0/22",   "91.241.20.0/23",
-    "91.241.92.0/24",   "91.242.44.0/23",   "91.243.126.0/23",  "91.243.160.0/20",  "91.244.120.0/22",
-    "91.245.228.0/22",  "91.246.44.0/24",   "91.247.171.0/24",  "91.247.174.0/24",  "91.247.66.0/23",
-    "91.250.224.0/20",  "91.251.0.0/16",    "91.92.104.0/24",   "91.92.114.0/24",   "91.92.121.0/24",
-    "91.92.122.0/23",   "91.92.124.0/22",   "91.92.129.0/24",   "91.92.130.0/23",   "91.92.132.0/22",
-    "91.92.145.0/24",   "91.92.146.0/23",   "91.92.148.0/22",   "91.92.156.0/22",   "91.92.164.0/22",
-    "91.92.172.0/22",   "91.92.180.0/22",   "91.92.184.0/21",   "91.92.192.0/23",   "91.92.204.0/22",
-    "91.92.208.0/21",   "91.92.220.0/22",   "91.92.228.0/23",   "91.92.231.0/24",   "91.92.236.0/22",
-    "91.98.0.0/15",     "92.114.16.0/20",   "92.114.48.0/22",   "92.114.64.0/20",   "92.119.57.0/24",
-    "92.119.58.0/24",   "92.119.68.0/22",   "92.242.192.0/19",  "92.246.144.0/22",  "92.246.156.0/22",
-    "92.249.56.0/22",   "92.42.48.0/21",    "92.43.160.0/22",   "92.61.176.0/20",   "93.110.0.0/16",
-    "93.113.224.0/20",  "93.114.104.0/21",  "93.114.16.0/20",   "93.115.120.0/21",  "93.115.144.0/21",
-    "93.115.216.0/21",  "93.115.224.0/20",  "93.117.0.0/19",    "93.117.32.0/20",   "93.117.176.0/20",
-    "93.117.96.0/19",   "93.118.180.0/22",  "93.118.184.0/22",  "93.118.96.0/19",   "93.118.128.0/19",
-    "93.118.160.0/20",  "93.119.208.0/20",  "93.119.32.0/19",   "93.119.64.0/19",   "93.126.0.0/18",
-    "93.190.24.0/21",   "93.88.64.0/21",    "93.88.72.0/23",    "93.93.204.0/24",   "94.101.128.0/20",
-    "94.101.176.0/20",  "94.101.240.0/20",  "94.139.160.0/19",  "94.176.32.0/21",   "94.176.8.0/21",
-    "94.177.72.0/21",   "94.182.0.0/15",    "94.184.0.0/16",    "94.199.136.0/22",  "94.232.168.0/21",
-    "94.24.0.0/20",     "94.24.16.0/21",    "94.24.80.0/20",    "94.24.96.0/21",    "94.241.164.0/22",
-    "94.74.128.0/18",   "95.130.225.0/24",  "95.130.240.0/21",  "95.130.56.0/21",   "95.142.224.0/20",
-    "95.156.222.0/23",  "95.156.233.0/24",  "95.156.234.0/23",  "95.156.236.0/23",  "95.156.248.0/23",
-    "95.156.252.0/22",  "95.162.0.0/16",    "95.215.160.0/22",  "95.215.173.0/24",  "95.215.59.0/24",
-    "95.38.0.0/16",     "95.64.0.0/17",     "95.80.128.0/18",   "95.81.64.0/18",    "95.82.0.0/18"};
+const cidr4_t iran_ip_ranges4[] = {
+    CIDR4(103, 130, 144, 0, 24), CIDR4(103, 130, 146, 0, 24), CIDR4(103, 215, 220, 0, 22), CIDR4(103, 216, 60, 0, 22),
+    CIDR4(103, 231, 136, 0, 22), CIDR4(109, 107, 131, 0, 24), CIDR4(109, 108, 160, 0, 19), CIDR4(109, 109, 32, 0, 19),
+    CIDR4(109, 110, 160, 0, 19), CIDR4(109, 122, 193, 0, 24), CIDR4(109, 122, 217, 0, 24), CIDR4(109, 122, 222, 0, 24),
+    CIDR4(109, 122, 224, 0, 20), CIDR4(109, 122, 240, 0, 21), CIDR4(109, 122, 250, 0, 23), CIDR4(109, 122, 252, 0, 23),
+    CIDR4(109, 125, 128, 0, 18), CIDR4(109, 162, 128, 0, 17), CIDR4(109, 201, 0, 0, 19),   CIDR4(109, 203, 128, 0, 18),
+    CIDR4(109, 206, 252, 0, 22), CIDR4(109, 225, 128, 0, 18), CIDR4(109, 230, 192, 0, 23), CIDR4(109, 230, 200, 0, 24),
+    CIDR4(109, 230, 204, 0, 22), CIDR4(109, 230, 221, 0, 24), CIDR4(109, 230, 223, 0, 24), CIDR4(109, 230, 242, 0, 24),
+    CIDR4(109, 230, 246, 0, 23), CIDR4(109, 230, 251, 0, 24), CIDR4(109, 230, 64, 0, 19),  CIDR4(109, 232, 0, 0, 21),
+    CIDR4(109, 238, 176, 0, 20), CIDR4(109, 239, 0, 0, 20),   CIDR4(109, 70, 237, 0, 24),  CIDR4(109, 72, 192, 0, 20),
+    CIDR4(109, 74, 232, 0, 21),  CIDR4(109, 94, 164, 0, 22),  CIDR4(109, 95, 60, 0, 22),   CIDR4(109, 95, 64, 0, 21),
+    CIDR4(113, 203, 0, 0, 17),   CIDR4(128, 65, 160, 0, 19),  CIDR4(130, 185, 72, 0, 21),  CIDR4(130, 193, 77, 0, 24),
+    CIDR4(130, 255, 192, 0, 18), CIDR4(134, 255, 196, 0, 23), CIDR4(134, 255, 200, 0, 21), CIDR4(134, 255, 245, 0, 24),
+    CIDR4(134, 255, 246, 0, 24), CIDR4(134, 255, 248, 0, 23), CIDR4(141, 11, 42, 0, 24),   CIDR4(146, 19, 104, 0, 24),
+    CIDR4(146, 19, 217, 0, 24),  CIDR4(146, 66, 128, 0, 21),  CIDR4(151, 232, 0, 0, 14),   CIDR4(151, 238, 0, 0, 15),
+    CIDR4(151, 240, 0, 0, 13),   CIDR4(152, 89, 12, 0, 22),   CIDR4(152, 89, 44, 0, 22),   CIDR4(157, 119, 188, 0, 22),
+    CIDR4(158, 255, 74, 0, 24),  CIDR4(158, 255, 78, 0, 24),  CIDR4(158, 58, 0, 0, 17),    CIDR4(158, 58, 184, 0, 21),
+    CIDR4(159, 20, 96, 0, 20),   CIDR4(164, 138, 128, 0, 18), CIDR4(164, 138, 16, 0, 21),  CIDR4(164, 215, 128, 0, 17),
+    CIDR4(164, 215, 56, 0, 21),  CIDR4(171, 22, 24, 0, 22),   CIDR4(172, 80, 128, 0, 17),  CIDR4(176, 101, 32, 0, 20),
+    CIDR4(176, 101, 48, 0, 21),  CIDR4(176, 102, 224, 0, 19), CIDR4(176, 105, 245, 0, 24), CIDR4(176, 116, 7, 0, 24),
+    CIDR4(176, 12, 64, 0, 20),   CIDR4(176, 122, 210, 0, 23), CIDR4(176, 123, 64, 0, 18),  CIDR4(176, 124, 64, 0, 22),
+    CIDR4(176, 126, 120, 0, 24), CIDR4(176, 221, 16, 0, 20),  CIDR4(176, 221, 64, 0, 21),  CIDR4(176, 223, 80, 0, 21),
+    CIDR4(176, 46, 128, 0, 19),  CIDR4(176, 56, 144, 0, 20),  CIDR4(176, 62, 144, 0, 21),  CIDR4(176, 65, 160, 0, 19),
+    CIDR4(176, 65, 192, 0, 18),  CIDR4(176, 67, 64, 0, 20),   CIDR4(176, 97, 218, 0, 24),  CIDR4(176, 97, 220, 0, 24),
+    CIDR4(178, 131, 0, 0, 16),   CIDR4(178, 157, 0, 0, 23),   CIDR4(178, 169, 0, 0, 19),   CIDR4(178, 173, 128, 0, 18),
+    CIDR4(178, 173, 192, 0, 19), CIDR4(178, 21, 160, 0, 21),  CIDR4(178, 21, 40, 0, 21),   CIDR4(178, 211, 145, 0, 24),
+    CIDR4(178, 215, 0, 0, 18),   CIDR4(178, 216, 248, 0, 21), CIDR4(178, 219, 224, 0, 20), CIDR4(178, 22, 120, 0, 21),
+    CIDR4(178, 22, 72, 0, 21),   CIDR4(178, 236, 32, 0, 22),  CIDR4(178, 236, 96, 0, 20),  CIDR4(178, 238, 192, 0, 20),
+    CIDR4(178, 239, 144, 0, 20), CIDR4(178, 248, 40, 0, 21),  CIDR4(178, 251, 208, 0, 21), CIDR4(178, 252, 128, 0, 18),
+    CIDR4(178, 253, 16, 0, 24),  CIDR4(178, 253, 26, 0, 23),  CIDR4(178, 253, 31, 0, 24),  CIDR4(178, 253, 38, 0, 23),
+    CIDR4(178, 253, 44, 0, 23),  CIDR4(178, 253, 55, 0, 24),  CIDR4(185, 1, 77, 0, 24),    CIDR4(185, 10, 71, 0, 24),
+    CIDR4(185, 10, 72, 0, 22),   CIDR4(185, 100, 44, 0, 22),  CIDR4(185, 101, 228, 0, 22), CIDR4(185, 103, 128, 0, 22),
+    CIDR4(185, 103, 244, 0, 22), CIDR4(185, 103, 248, 0, 22), CIDR4(185, 103, 84, 0, 22),  CIDR4(185, 104, 192, 0, 24),
+    CIDR4(185, 104, 228, 0, 22), CIDR4(185, 104, 232, 0, 22), CIDR4(185, 104, 240, 0, 22), CIDR4(185, 105, 100, 0, 22),
+    CIDR4(185, 105, 120, 0, 22), CIDR4(185, 105, 184, 0, 22), CIDR4(185, 105, 236, 0, 22), CIDR4(185, 106, 136, 0, 22),
+    CIDR4(185, 106, 144, 0, 22), CIDR4(185, 106, 200, 0, 22), CIDR4(185, 106, 228, 0, 22), CIDR4(185, 107, 244, 0, 22),
+    CIDR4(185, 107, 248, 0, 22), CIDR4(185, 107, 28, 0, 22),  CIDR4(185, 107, 32, 0, 23),  CIDR4(185, 108, 164, 0, 22),
+    CIDR4(185, 108, 96, 0, 22),  CIDR4(185, 109, 128, 0, 22), CIDR4(185, 109, 244, 0, 22), CIDR4(185, 109, 248, 0, 22),
+    CIDR4(185, 109, 60, 0, 22),  CIDR4(185, 109, 72, 0, 22),  CIDR4(185, 109, 80, 0, 22),  CIDR4(185, 11, 176, 0, 22),
+    CIDR4(185, 11, 68, 0, 22),   CIDR4(185, 11, 88, 0, 22),   CIDR4(185, 110, 191, 0, 24), CIDR4(185, 110, 216, 0, 22),
+    CIDR4(185, 110, 228, 0, 22), CIDR4(185, 110, 236, 0, 22), CIDR4(185, 110, 244, 0, 22), CIDR4(185, 110, 252, 0, 22),
+    CIDR4(185, 110, 28, 0, 22),  CIDR4(185, 111, 136, 0, 22), CIDR4(185, 111, 64, 0, 22),  CIDR4(185, 111, 8, 0, 21),
+    CIDR4(185, 111, 80, 0, 22),  CIDR4(185, 112, 130, 0, 23), CIDR4(185, 112, 148, 0, 22), CIDR4(185, 112, 168, 0, 22),
+    CIDR4(185, 112, 32, 0, 21),  CIDR4(185, 113, 112, 0, 22), CIDR4(185, 113, 56, 0, 22),  CIDR4(185, 114, 188, 0, 22),
+    CIDR4(185, 115, 148, 0, 22), CIDR4(185, 115, 168, 0, 22), CIDR4(185, 115, 76, 0, 22),  CIDR4(185, 116, 160, 0, 22),
+    CIDR4(185, 116, 20, 0, 22),  CIDR4(185, 116, 24, 0, 22),  CIDR4(185, 116, 44, 0, 22),  CIDR4(185, 117, 136, 0, 22),
+    CIDR4(185, 117, 204, 0, 23), CIDR4(185, 117, 48, 0, 22),  CIDR4(185, 118, 12, 0, 22),  CIDR4(185, 118, 136, 0, 22),
+    CIDR4(185, 118, 152, 0, 22), CIDR4(185, 119, 164, 0, 22), CIDR4(185, 119, 240, 0, 22), CIDR4(185, 119, 4, 0, 22),
+    CIDR4(185, 12, 100, 0, 23),  CIDR4(185, 12, 102, 0, 24),  CIDR4(185, 12, 60, 0, 22),   CIDR4(185, 120, 120, 0, 22),
+    CIDR4(185, 120, 136, 0, 22), CIDR4(185, 120, 160, 0, 22), CIDR4(185, 120, 168, 0, 22), CIDR4(185, 120, 192, 0, 21),
+    CIDR4(185, 120, 200, 0, 22), CIDR4(185, 120, 208, 0, 20), CIDR4(185, 120, 224, 0, 20), CIDR4(185, 120, 240, 0, 21),
+    CIDR4(185, 120, 248, 0, 22), CIDR4(185, 121, 128, 0, 22), CIDR4(185, 121, 56, 0, 22),  CIDR4(185, 122, 80, 0, 22),
+    CIDR4(185, 123, 208, 0, 22), CIDR4(185, 123, 68, 0, 22),  CIDR4(185, 124, 112, 0, 22), CIDR4(185, 124, 156, 0, 22),
+    CIDR4(185, 124, 172, 0, 22), CIDR4(185, 125, 20, 0, 22),  CIDR4(185, 125, 244, 0, 22), CIDR4(185, 125, 248, 0, 21),
+    CIDR4(185, 126, 0, 0, 20),   CIDR4(185, 126, 16, 0, 22),  CIDR4(185, 126, 132, 0, 23), CIDR4(185, 126, 200, 0, 22),
+    CIDR4(185, 126, 40, 0, 22),  CIDR4(185, 127, 232, 0, 22), CIDR4(185, 128, 136, 0, 22), CIDR4(185, 128, 152, 0, 22),
+    CIDR4(185, 128, 164, 0, 22), CIDR4(185, 128, 40, 0, 24),  CIDR4(185, 128, 48, 0, 22),  CIDR4(185, 128, 80, 0, 22),
+    CIDR4(185, 129, 168, 0, 22), CIDR4(185, 129, 184, 0, 21), CIDR4(185, 129, 196, 0, 22), CIDR4(185, 129, 200, 0, 22),
+    CIDR4(185, 129, 212, 0, 22), CIDR4(185, 129, 216, 0, 22), CIDR4(185, 129, 228, 0, 22), CIDR4(185, 129, 232, 0, 21),
+    CIDR4(185, 129, 240, 0, 22), CIDR4(185, 129, 80, 0, 22),  CIDR4(185, 13, 228, 0, 22),  CIDR4(185, 130, 76, 0, 22),
+    CIDR4(185, 131, 100, 0, 22), CIDR4(185, 131, 108, 0, 22), CIDR4(185, 131, 112, 0, 21), CIDR4(185, 131, 124, 0, 22),
+    CIDR4(185, 131, 128, 0, 22), CIDR4(185, 131, 136, 0, 21), CIDR4(185, 131, 148, 0, 22), CIDR4(185, 131, 152, 0, 21),
+    CIDR4(185, 131, 164, 0, 22), CIDR4(185, 131, 168, 0, 22), CIDR4(185, 131, 28, 0, 22),  CIDR4(185, 131, 84, 0, 22),
+    CIDR4(185, 131, 88, 0, 21),  CIDR4(185, 132, 212, 0, 22), CIDR4(185, 132, 80, 0, 22),  CIDR4(185, 133, 152, 0, 22),
+    CIDR4(185, 133, 164, 0, 22), CIDR4(185, 133, 244, 0, 23), CIDR4(185, 133, 246, 0, 24), CIDR4(185, 134, 96, 0, 22),
+    CIDR4(185, 135, 228, 0, 22), CIDR4(185, 135, 28, 0, 22),  CIDR4(185, 136, 100, 0, 22), CIDR4(185, 136, 172, 0, 22),
+    CIDR4(185, 136, 180, 0, 22), CIDR4(185, 136, 192, 0, 22), CIDR4(185, 136, 220, 0, 22), CIDR4(185, 137, 108, 0, 23),
+    CIDR4(185, 137, 110, 0, 24), CIDR4(185, 137, 24, 0, 22),  CIDR4(185, 137, 60, 0, 22),  CIDR4(185, 139, 64, 0, 22),
+    CIDR4(185, 14, 160, 0, 22),  CIDR4(185, 14, 80, 0, 22),   CIDR4(185, 140, 232, 0, 22), CIDR4(185, 140, 240, 0, 22),
+    CIDR4(185, 140, 4, 0, 22),   CIDR4(185, 140, 56, 0, 22),  CIDR4(185, 141, 104, 0, 22), CIDR4(185, 141, 132, 0, 22),
+    CIDR4(185, 141, 168, 0, 22), CIDR4(185, 141, 212, 0, 22), CIDR4(185, 141, 244, 0, 22), CIDR4(185, 141, 36, 0, 22),
+    CIDR4(185, 141, 48, 0, 22),  CIDR4(185, 142, 124, 0, 22), CIDR4(185, 142, 156, 0, 22), CIDR4(185, 142, 232, 0, 22),
+    CIDR4(185, 142, 92, 0, 22),  CIDR4(185, 143, 204, 0, 22), CIDR4(185, 143, 232, 0, 22), CIDR4(185, 143, 72, 0, 22),
+    CIDR4(185, 144, 64, 0, 22),  CIDR4(185, 145, 184, 0, 22), CIDR4(185, 145, 8, 0, 22),   CIDR4(185, 147, 160, 0, 22),
+    CIDR4(185, 147, 176, 0, 22), CIDR4(185, 147, 40, 0, 22),  CIDR4(185, 147, 84, 0, 22),  CIDR4(185, 150, 108, 0, 22),
+    CIDR4(185, 153, 184, 0, 22), CIDR4(185, 153, 208, 0, 22), CIDR4(185, 154, 184, 0, 22), CIDR4(185, 155, 236, 0, 22),
+    CIDR4(185, 155, 72, 0, 22),  CIDR4(185, 155, 8, 0, 21),   CIDR4(185, 157, 8, 0, 22),   CIDR4(185, 158, 172, 0, 22),
+    CIDR4(185, 159, 152, 0, 22), CIDR4(185, 159, 176, 0, 22), CIDR4(185, 16, 232, 0, 22),  CIDR4(185, 160, 104, 0, 22),
+    CIDR4(185, 160, 176, 0, 22), CIDR4(185, 161, 112, 0, 22), CIDR4(185, 161, 36, 0, 22),  CIDR4(185, 162, 216, 0, 22),
+    CIDR4(185, 162, 40, 0, 22),  CIDR4(185, 163, 88, 0, 22),  CIDR4(185, 164, 252, 0, 22), CIDR4(185, 164, 73, 0, 24),
+    CIDR4(185, 164, 74, 0, 23),  CIDR4(185, 165, 100, 0, 22), CIDR4(185, 165, 116, 0, 22), CIDR4(185, 165, 204, 0, 22),
+    CIDR4(185, 165, 28, 0, 22),  CIDR4(185, 165, 40, 0, 22),  CIDR4(185, 166, 104, 0, 22), CIDR4(185, 166, 112, 0, 22),
+    CIDR4(185, 166, 60, 0, 22),  CIDR4(185, 167, 100, 0, 22), CIDR4(185, 167, 124, 0, 22), CIDR4(185, 167, 72, 0, 22),
+    CIDR4(185, 168, 28, 0, 22),  CIDR4(185, 169, 20, 0, 22),  CIDR4(185, 169, 36, 0, 22),  CIDR4(185, 169, 6, 0, 24),
+    CIDR4(185, 170, 236, 0, 22), CIDR4(185, 170, 8, 0, 24),   CIDR4(185, 171, 52, 0, 22),  CIDR4(185, 172, 0, 0, 22),
+    CIDR4(185, 172, 212, 0, 22), CIDR4(185, 172, 68, 0, 22),  CIDR4(185, 173, 104, 0, 22), CIDR4(185, 173, 129, 0, 24),
+    CIDR4(185, 173, 130, 0, 24), CIDR4(185, 173, 168, 0, 22), CIDR4(185, 174, 132, 0, 24), CIDR4(185, 174, 134, 0, 24),
+    CIDR4(185, 174, 200, 0, 22), CIDR4(185, 174, 248, 0, 22), CIDR4(185, 175, 240, 0, 22), CIDR4(185, 175, 76, 0, 22),
+    CIDR4(185, 176, 32, 0, 22),  CIDR4(185, 176, 56, 0, 22),  CIDR4(185, 177, 156, 0, 22), CIDR4(185, 177, 232, 0, 22),
+    CIDR4(185, 178, 104, 0, 22), CIDR4(185, 178, 220, 0, 22), CIDR4(185, 179, 168, 0, 22), CIDR4(185, 179, 220, 0, 22),
+    CIDR4(185, 179, 90, 0, 24),  CIDR4(185, 18, 156, 0, 22),  CIDR4(185, 18, 212, 0, 22),  CIDR4(185, 180, 128, 0, 22),
+    CIDR4(185, 180, 52, 0, 22),  CIDR4(185, 181, 180, 0, 22), CIDR4(185, 182, 220, 0, 22), CIDR4(185, 182, 248, 0, 22),
+    CIDR4(185, 184, 32, 0, 22),  CIDR4(185, 184, 48, 0, 22),  CIDR4(185, 185, 16, 0, 22),  CIDR4(185, 185, 240, 0, 22),
+    CIDR4(185, 186, 240, 0, 22), CIDR4(185, 186, 48, 0, 22),  CIDR4(185, 187, 48, 0, 22),  CIDR4(185, 187, 84, 0, 22),
+    CIDR4(185, 188, 104, 0, 22), CIDR4(185, 188, 112, 0, 22), CIDR4(185, 189, 120, 0, 22), CIDR4(185, 19, 201, 0, 24),
+    CIDR4(185, 190, 20, 0, 22),  CIDR4(185, 190, 39, 0, 24),  CIDR4(185, 191, 76, 0, 22),  CIDR4(185, 192, 112, 0, 22),
+    CIDR4(185, 192, 8, 0, 22),   CIDR4(185, 193, 208, 0, 22), CIDR4(185, 193, 47, 0, 24),  CIDR4(185, 194, 244, 0, 22),
+    CIDR4(185, 194, 76, 0, 22),  CIDR4(185, 195, 72, 0, 22),  CIDR4(185, 196, 148, 0, 22), CIDR4(185, 197, 112, 0, 22),
+    CIDR4(185, 197, 68, 0, 22),  CIDR4(185, 198, 160, 0, 22), CIDR4(185, 199, 208, 0, 22), CIDR4(185, 199, 64, 0, 22),
+    CIDR4(185, 2, 12, 0, 22),    CIDR4(185, 20, 160, 0, 22),  CIDR4(185, 201, 48, 0, 22),  CIDR4(185, 202, 56, 0, 22),
+    CIDR4(185, 203, 160, 0, 22), CIDR4(185, 204, 168, 0, 22), CIDR4(185, 204, 180, 0, 22), CIDR4(185, 204, 197, 0, 24),
+    CIDR4(185, 205, 203, 0, 24), CIDR4(185, 205, 220, 0, 22), CIDR4(185, 206, 229, 0, 24), CIDR4(185, 206, 231, 0, 24),
+    CIDR4(185, 206, 236, 0, 22), CIDR4(185, 206, 92, 0, 22),  CIDR4(185, 207, 52, 0, 22),  CIDR4(185, 207, 72, 0, 22),
+    CIDR4(185, 208, 148, 0, 22), CIDR4(185, 208, 174, 0, 23), CIDR4(185, 208, 180, 0, 22), CIDR4(185, 208, 76, 0, 22),
+    CIDR4(185, 209, 188, 0, 22), CIDR4(185, 21, 68, 0, 22),   CIDR4(185, 21, 76, 0, 22),   CIDR4(185, 210, 200, 0, 22),
+    CIDR4(185, 211, 56, 0, 22),  CIDR4(185, 211, 84, 0, 22),  CIDR4(185, 211, 88, 0, 22),  CIDR4(185, 212, 192, 0, 22),
+    CIDR4(185, 212, 48, 0, 22),  CIDR4(185, 213, 164, 0, 22), CIDR4(185, 213, 195, 0, 24), CIDR4(185, 213, 8, 0, 22),
+    CIDR4(185, 214, 36, 0, 22),  CIDR4(185, 215, 124, 0, 22), CIDR4(185, 215, 152, 0, 22), CIDR4(185, 215, 228, 0, 22),
+    CIDR4(185, 219, 112, 0, 22), CIDR4(185, 22, 28, 0, 22),   CIDR4(185, 220, 224, 0, 22), CIDR4(185, 221, 112, 0, 22),
+    CIDR4(185, 221, 192, 0, 22), CIDR4(185, 221, 239, 0, 24), CIDR4(185, 222, 120, 0, 22), CIDR4(185, 222, 180, 0, 22),
+    CIDR4(185, 222, 184, 0, 22), CIDR4(185, 222, 210, 0, 24), CIDR4(185, 223, 160, 0, 24), CIDR4(185, 224, 176, 0, 22),
+    CIDR4(185, 225, 180, 0, 22), CIDR4(185, 225, 240, 0, 22), CIDR4(185, 225, 80, 0, 22),  CIDR4(185, 226, 116, 0, 22),
+    CIDR4(185, 226, 132, 0, 22), CIDR4(185, 226, 140, 0, 22), CIDR4(185, 226, 97, 0, 24),  CIDR4(185, 227, 116, 0, 22),
+    CIDR4(185, 227, 64, 0, 22),  CIDR4(185, 228, 236, 0, 22), CIDR4(185, 229, 0, 0, 22),   CIDR4(185, 229, 204, 0, 24),
+    CIDR4(185, 229, 28, 0, 22),  CIDR4(185, 23, 128, 0, 22),  CIDR4(185, 231, 112, 0, 24), CIDR4(185, 231, 114, 0, 23),
+    CIDR4(185, 231, 180, 0, 22), CIDR4(185, 231, 65, 0, 24),  CIDR4(185, 232, 152, 0, 22), CIDR4(185, 232, 176, 0, 22),
+    CIDR4(185, 233, 12, 0, 22),  CIDR4(185, 233, 131, 0, 24), CIDR4(185, 233, 84, 0, 22),  CIDR4(185, 234, 14, 0, 24),
+    CIDR4(185, 234, 192, 0, 22), CIDR4(185, 235, 136, 0, 22), CIDR4(185, 235, 245, 0, 24), CIDR4(185, 235, 42, 0, 24),
+    CIDR4(185, 236, 36, 0, 22),  CIDR4(185, 236, 45, 0, 24),  CIDR4(185, 236, 88, 0, 22),  CIDR4(185, 237, 8, 0, 22),
+    CIDR4(185, 237, 84, 0, 22),  CIDR4(185, 238, 140, 0, 24), CIDR4(185, 238, 143, 0, 24), CIDR4(185, 238, 20, 0, 22),
+    CIDR4(185, 238, 44, 0, 22),  CIDR4(185, 238, 92, 0, 22),  CIDR4(185, 239, 0, 0, 22),   CIDR4(185, 239, 104, 0, 22),
+    CIDR4(185, 24, 136, 0, 22),  CIDR4(185, 24, 148, 0, 22),  CIDR4(185, 24, 228, 0, 22),  CIDR4(185, 24, 252, 0, 23),
+    CIDR4(185, 24, 254, 0, 24),  CIDR4(185, 240, 148, 0, 22), CIDR4(185, 240, 56, 0, 22),  CIDR4(185, 243, 48, 0, 22),
+    CIDR4(185, 244, 52, 0, 22),  CIDR4(185, 246, 4, 0, 22),   CIDR4(185, 248, 32, 0, 24),  CIDR4(185, 25, 172, 0, 22),
+    CIDR4(185, 251, 76, 0, 22),  CIDR4(185, 252, 200, 0, 24), CIDR4(185, 252, 28, 0, 22),  CIDR4(185, 254, 165, 0, 24),
+    CIDR4(185, 254, 166, 0, 24), CIDR4(185, 255, 208, 0, 22), CIDR4(185, 255, 68, 0, 22),  CIDR4(185, 255, 88, 0, 22),
+    CIDR4(185, 26, 232, 0, 22),  CIDR4(185, 26, 32, 0, 22),   CIDR4(185, 29, 220, 0, 22),  CIDR4(185, 3, 124, 0, 22),
+    CIDR4(185, 3, 200, 0, 22),   CIDR4(185, 3, 212, 0, 22),   CIDR4(185, 30, 4, 0, 22),    CIDR4(185, 30, 76, 0, 22),
+    CIDR4(185, 31, 124, 0, 22),  CIDR4(185, 32, 128, 0, 22),  CIDR4(185, 34, 160, 0, 22),  CIDR4(185, 36, 228, 0, 24),
+    CIDR4(185, 36, 231, 0, 24),  CIDR4(185, 37, 52, 0, 22),   CIDR4(185, 39, 180, 0, 22),  CIDR4(185, 4, 0, 0, 22),
+    CIDR4(185, 4, 104, 0, 22),   CIDR4(185, 4, 16, 0, 22),    CIDR4(185, 4, 220, 0, 22),   CIDR4(185, 4, 28, 0, 22),
+    CIDR4(185, 40, 16, 0, 24),   CIDR4(185, 40, 240, 0, 22),  CIDR4(185, 41, 0, 0, 22),    CIDR4(185, 41, 220, 0, 22),
+    CIDR4(185, 42, 212, 0, 22),  CIDR4(185, 42, 224, 0, 22),  CIDR4(185, 42, 24, 0, 24),   CIDR4(185, 44, 100, 0, 22),
+    CIDR4(185, 44, 112, 0, 22),  CIDR4(185, 44, 36, 0, 22),   CIDR4(185, 45, 188, 0, 22),  CIDR4(185, 46, 0, 0, 22),
+    CIDR4(185, 46, 108, 0, 22),  CIDR4(185, 46, 216, 0, 22),  CIDR4(185, 47, 48, 0, 22),   CIDR4(185, 49, 104, 0, 22),
+    CIDR4(185, 49, 231, 0, 24),  CIDR4(185, 49, 84, 0, 22),   CIDR4(185, 49, 96, 0, 22),   CIDR4(185, 5, 156, 0, 22),
+    CIDR4(185, 50, 36, 0, 22),   CIDR4(185, 51, 200, 0, 22),  CIDR4(185, 51, 40, 0, 22),   CIDR4(185, 53, 140, 0, 22),
+    CIDR4(185, 55, 224, 0, 22),  CIDR4(185, 56, 92, 0, 22),   CIDR4(185, 56, 96, 0, 22),   CIDR4(185, 57, 132, 0, 22),
+    CIDR4(185, 57, 164, 0, 22),  CIDR4(185, 57, 200, 0, 22),  CIDR4(185, 58, 240, 0, 22),  CIDR4(185, 59, 112, 0, 23),
+    CIDR4(185, 60, 136, 0, 22),  CIDR4(185, 60, 32, 0, 22),   CIDR4(185, 62, 232, 0, 22),  CIDR4(185, 63, 113, 0, 24),
+    CIDR4(185, 63, 114, 0, 24),  CIDR4(185, 63, 236, 0, 22),  CIDR4(185, 64, 176, 0, 22),  CIDR4(185, 66, 224, 0, 21),
+    CIDR4(185, 67, 100, 0, 22),  CIDR4(185, 67, 12, 0, 22),   CIDR4(185, 67, 156, 0, 22),  CIDR4(185, 67, 212, 0, 22),
+    CIDR4(185, 69, 108, 0, 22),  CIDR4(185, 7, 212, 0, 24),   CIDR4(185, 70, 60, 0, 22),   CIDR4(185, 71, 152, 0, 22),
+    CIDR4(185, 71, 192, 0, 22),  CIDR4(185, 72, 24, 0, 22),   CIDR4(185, 72, 80, 0, 22),   CIDR4(185, 73, 0, 0, 22),
+    CIDR4(185, 73, 112, 0, 24),  CIDR4(185, 73, 114, 0, 24),  CIDR4(185, 73, 226, 0, 24),  CIDR4(185, 73, 76, 0, 22),
+    CIDR4(185, 74, 164, 0, 22),  CIDR4(185, 75, 196, 0, 22),  CIDR4(185, 75, 204, 0, 22),  CIDR4(185, 76, 248, 0, 22),
+    CIDR4(185, 78, 20, 0, 22),   CIDR4(185, 79, 156, 0, 22),  CIDR4(185, 79, 60, 0, 22),   CIDR4(185, 79, 96, 0, 22),
+    CIDR4(185, 8, 172, 0, 22),   CIDR4(185, 80, 100, 0, 22),  CIDR4(185, 80, 197, 0, 24),  CIDR4(185, 80, 198, 0, 23),
+    CIDR4(185, 81, 40, 0, 22),   CIDR4(185, 81, 96, 0, 23),   CIDR4(185, 81, 99, 0, 24),   CIDR4(185, 82, 136, 0, 22),
+    CIDR4(185, 82, 164, 0, 22),  CIDR4(185, 82, 180, 0, 22),  CIDR4(185, 82, 28, 0, 22),   CIDR4(185, 82, 64, 0, 22),
+    CIDR4(185, 83, 112, 0, 24),  CIDR4(185, 83, 114, 0, 23),  CIDR4(185, 83, 180, 0, 23),  CIDR4(185, 83, 183, 0, 24),
+    CIDR4(185, 83, 184, 0, 22),  CIDR4(185, 83, 196, 0, 22),  CIDR4(185, 83, 208, 0, 22),  CIDR4(185, 83, 28, 0, 22),
+    CIDR4(185, 83, 76, 0, 22),   CIDR4(185, 83, 80, 0, 22),   CIDR4(185, 83, 88, 0, 22),   CIDR4(185, 84, 220, 0, 22),
+    CIDR4(185, 85, 136, 0, 22),  CIDR4(185, 85, 68, 0, 22),   CIDR4(185, 86, 180, 0, 22),  CIDR4(185, 86, 36, 0, 22),
+    CIDR4(185, 88, 152, 0, 22),  CIDR4(185, 88, 176, 0, 22),  CIDR4(185, 88, 252, 0, 22),  CIDR4(185, 88, 48, 0, 22),
+    CIDR4(185, 89, 112, 0, 22),  CIDR4(185, 92, 4, 0, 22),    CIDR4(185, 92, 8, 0, 22),    CIDR4(185, 92, 40, 0, 22),
+    CIDR4(185, 94, 96, 0, 22),   CIDR4(185, 95, 152, 0, 22),  CIDR4(185, 95, 180, 0, 22),  CIDR4(185, 95, 60, 0, 22),
+    CIDR4(185, 96, 240, 0, 22),  CIDR4(185, 97, 116, 0, 22),  CIDR4(185, 98, 112, 0, 22),  CIDR4(185, 99, 212, 0, 22),
+    CIDR4(188, 0, 240, 0, 20),   CIDR4(188, 118, 64, 0, 18),  CIDR4(188, 121, 96, 0, 19),  CIDR4(188, 121, 128, 0, 19),
+    CIDR4(188, 122, 96, 0, 19),  CIDR4(188, 136, 128, 0, 18), CIDR4(188, 136, 192, 0, 19), CIDR4(188, 158, 0, 0, 15),
+    CIDR4(188, 191, 176, 0, 21), CIDR4(188, 208, 144, 0, 20), CIDR4(188, 208, 160, 0, 19), CIDR4(188, 208, 200, 0, 22),
+    CIDR4(188, 208, 208, 0, 21), CIDR4(188, 208, 224, 0, 19), CIDR4(188, 209, 0, 0, 19),   CIDR4(188, 209, 32, 0, 20),
+    CIDR4(188, 208, 56, 0, 21),  CIDR4(188, 208, 64, 0, 19),  CIDR4(188, 209, 116, 0, 22), CIDR4(188, 209, 152, 0, 23),
+    CIDR4(188, 209, 192, 0, 20), CIDR4(188, 209, 64, 0, 20),  CIDR4(188, 210, 232, 0, 22), CIDR4(188, 210, 64, 0, 20),
+    CIDR4(188, 210, 80, 0, 21),  CIDR4(188, 210, 96, 0, 19),  CIDR4(188, 210, 128, 0, 18), CIDR4(188, 210, 192, 0, 20),
+    CIDR4(188, 211, 0, 0, 20),   CIDR4(188, 211, 176, 0, 20), CIDR4(188, 211, 192, 0, 19), CIDR4(188, 211, 32, 0, 19),
+    CIDR4(188, 211, 64, 0, 18),  CIDR4(188, 211, 128, 0, 19), CIDR4(188, 212, 144, 0, 21), CIDR4(188, 212, 160, 0, 19),
+    CIDR4(188, 212, 200, 0, 21), CIDR4(188, 212, 208, 0, 20), CIDR4(188, 212, 224, 0, 20), CIDR4(188, 212, 240, 0, 21),
+    CIDR4(188, 212, 22, 0, 24),  CIDR4(188, 212, 48, 0, 20),  CIDR4(188, 212, 64, 0, 19),  CIDR4(188, 212, 96, 0, 22),
+    CIDR4(188, 213, 144, 0, 20), CIDR4(188, 213, 176, 0, 20), CIDR4(188, 213, 192, 0, 21), CIDR4(188, 213, 208, 0, 22),
+    CIDR4(188, 213, 64, 0, 20),  CIDR4(188, 213, 96, 0, 19),  CIDR4(188, 214, 120, 0, 23), CIDR4(188, 214, 160, 0, 19),
+    CIDR4(188, 214, 216, 0, 21), CIDR4(188, 214, 4, 0, 22),   CIDR4(188, 214, 84, 0, 22),  CIDR4(188, 214, 96, 0, 22),
+    CIDR4(188, 215, 128, 0, 20), CIDR4(188, 215, 160, 0, 19), CIDR4(188, 215, 192, 0, 19), CIDR4(188, 215, 24, 0, 22),
+    CIDR4(188, 215, 240, 0, 22), CIDR4(188, 215, 88, 0, 22),  CIDR4(188, 229, 0, 0, 17),   CIDR4(188, 240, 196, 0, 24),
+    CIDR4(188, 240, 212, 0, 24), CIDR4(188, 240, 248, 0, 21), CIDR4(188, 253, 2, 0, 23),   CIDR4(188, 253, 4, 0, 22),
+    CIDR4(188, 253, 8, 0, 21),   CIDR4(188, 253, 16, 0, 20),  CIDR4(188, 253, 32, 0, 19),  CIDR4(188, 253, 64, 0, 18),
+    CIDR4(188, 75, 64, 0, 18),   CIDR4(188, 94, 188, 0, 24),  CIDR4(188, 95, 89, 0, 24),   CIDR4(192, 15, 0, 0, 16),
+    CIDR4(193, 0, 156, 0, 24),   CIDR4(193, 104, 212, 0, 24), CIDR4(193, 104, 22, 0, 24),  CIDR4(193, 104, 29, 0, 24),
+    CIDR4(193, 105, 2, 0, 24),   CIDR4(193, 105, 234, 0, 24), CIDR4(193, 105, 6, 0, 24),   CIDR4(193, 106, 190, 0, 24),
+    CIDR4(193, 108, 242, 0, 23), CIDR4(193, 111, 234, 0, 23), CIDR4(193, 134, 100, 0, 23), CIDR4(193, 141, 126, 0, 23),
+    CIDR4(193, 141, 64, 0, 23),  CIDR4(193, 142, 232, 0, 23), CIDR4(193, 142, 254, 0, 23), CIDR4(193, 142, 30, 0, 24),
+    CIDR4(193, 148, 64, 0, 22),  CIDR4(193, 150, 66, 0, 24),  CIDR4(193, 151, 128, 0, 19), CIDR4(193, 162, 129, 0, 24),
+    CIDR4(193, 176, 240, 0, 22), CIDR4(193, 178, 200, 0, 22), CIDR4(193, 186, 32, 0, 24),  CIDR4(193, 189, 122, 0, 23),
+    CIDR4(193, 19, 144, 0, 23),  CIDR4(193, 200, 102, 0, 23), CIDR4(193, 200, 148, 0, 24), CIDR4(193, 201, 192, 0, 22),
+    CIDR4(193, 201, 72, 0, 23),  CIDR4(193, 22, 20, 0, 24),   CIDR4(193, 222, 51, 0, 24),  CIDR4(193, 228, 136, 0, 24),
+    CIDR4(193, 228, 90, 0, 23),  CIDR4(193, 242, 194, 0, 23), CIDR4(193, 242, 208, 0, 23), CIDR4(193, 246, 160, 0, 23),
+    CIDR4(193, 246, 164, 0, 23), CIDR4(193, 246, 174, 0, 23), CIDR4(193, 246, 200, 0, 23), CIDR4(193, 28, 181, 0, 24),
+    CIDR4(193, 29, 24, 0, 24),   CIDR4(193, 29, 26, 0, 24),   CIDR4(193, 3, 182, 0, 24),   CIDR4(193, 3, 231, 0, 24),
+    CIDR4(193, 3, 255, 0, 24),   CIDR4(193, 3, 31, 0, 24),    CIDR4(193, 32, 80, 0, 23),   CIDR4(193, 34, 244, 0, 22),
+    CIDR4(193, 35, 62, 0, 24),   CIDR4(193, 38, 247, 0, 24),  CIDR4(193, 39, 9, 0, 24),    CIDR4(193, 56, 107, 0, 24),
+    CIDR4(193, 56, 118, 0, 24),  CIDR4(193, 56, 59, 0, 24),   CIDR4(193, 56, 61, 0, 24),   CIDR4(193, 8, 139, 0, 24),
+    CIDR4(194, 143, 140, 0, 23), CIDR4(194, 146, 148, 0, 22), CIDR4(194, 146, 239, 0, 24), CIDR4(194, 147, 164, 0, 22),
+    CIDR4(194, 150, 68, 0, 22),  CIDR4(194, 156, 140, 0, 22), CIDR4(194, 180, 224, 0, 24), CIDR4(194, 225, 0, 0, 16),
+    CIDR4(194, 26, 117, 0, 24),  CIDR4(194, 26, 2, 0, 23),    CIDR4(194, 26, 20, 0, 23),   CIDR4(194, 31, 194, 0, 24),
+    CIDR4(194, 33, 104, 0, 22),  CIDR4(194, 33, 122, 0, 23),  CIDR4(194, 33, 124, 0, 22),  CIDR4(194, 34, 163, 0, 24),
+    CIDR4(194, 36, 0, 0, 24),    CIDR4(194, 36, 174, 0, 24),  CIDR4(194, 39, 36, 0, 22),   CIDR4(194, 41, 48, 0, 22),
+    CIDR4(194, 5, 175, 0, 24),   CIDR4(194, 5, 176, 0, 22),   CIDR4(194, 5, 188, 0, 24),   CIDR4(194, 5, 192, 0, 24),
+    CIDR4(194, 5, 195, 0, 24),   CIDR4(194, 5, 205, 0, 24),   CIDR4(194, 5, 40, 0, 22),    CIDR4(194, 50, 204, 0, 24),
+    CIDR4(194, 50, 209, 0, 24),  CIDR4(194, 50, 216, 0, 24),  CIDR4(194, 50, 218, 0, 24),  CIDR4(194, 53, 118, 0, 23),
+    CIDR4(194, 53, 122, 0, 23),  CIDR4(194, 56, 148, 0, 24),  CIDR4(194, 59, 170, 0, 23),  CIDR4(194, 59, 214, 0, 23),
+    CIDR4(194, 60, 208, 0, 22),  CIDR4(194, 60, 228, 0, 22),  CIDR4(194, 62, 17, 0, 24),   CIDR4(194, 62, 43, 0, 24),
+    CIDR4(194, 87, 23, 0, 24),   CIDR4(194, 9, 56, 0, 23),    CIDR4(194, 9, 80, 0, 23),    CIDR4(195, 110, 38, 0, 23),
+    CIDR4(195, 114, 4, 0, 23),   CIDR4(195, 114, 8, 0, 23),   CIDR4(195, 146, 32, 0, 19),  CIDR4(195, 181, 0, 0, 17),
+    CIDR4(195, 182, 38, 0, 24),  CIDR4(195, 190, 130, 0, 24), CIDR4(195, 190, 139, 0, 24), CIDR4(195, 190, 144, 0, 24),
+    CIDR4(195, 191, 22, 0, 23),  CIDR4(195, 191, 44, 0, 23),  CIDR4(195, 191, 74, 0, 23),  CIDR4(195, 2, 234, 0, 24),
+    CIDR4(195, 20, 136, 0, 24),  CIDR4(195, 211, 44, 0, 22),  CIDR4(195, 219, 71, 0, 24),  CIDR4(195, 225, 232, 0, 24),
+    CIDR4(195, 226, 223, 0, 24), CIDR4(195, 230, 105, 0, 24), CIDR4(195, 230, 107, 0, 24), CIDR4(195, 230, 124, 0, 24),
+    CIDR4(195, 230, 97, 0, 24),  CIDR4(195, 234, 191, 0, 24), CIDR4(195, 238, 231, 0, 24), CIDR4(195, 238, 240, 0, 24),
+    CIDR4(195, 238, 247, 0, 24), CIDR4(195, 245, 70, 0, 23),  CIDR4(195, 28, 10, 0, 23),   CIDR4(195, 28, 168, 0, 23),
+    CIDR4(195, 8, 102, 0, 24),   CIDR4(195, 8, 110, 0, 24),   CIDR4(195, 8, 112, 0, 24),   CIDR4(195, 8, 114, 0, 24),
+    CIDR4(195, 88, 188, 0, 23),  CIDR4(195, 96, 128, 0, 24),  CIDR4(195, 96, 153, 0, 24),  CIDR4(196, 3, 91, 0, 24),
+    CIDR4(2, 144, 0, 0, 14),     CIDR4(2, 176, 0, 0, 12),     CIDR4(204, 18, 0, 0, 16),    CIDR4(210, 5, 198, 0, 24),
+    CIDR4(210, 5, 208, 0, 23),   CIDR4(210, 5, 218, 0, 24),   CIDR4(210, 5, 232, 0, 23),   CIDR4(212, 1, 192, 0, 21),
+    CIDR4(212, 120, 192, 0, 19), CIDR4(212, 16, 64, 0, 19),   CIDR4(212, 18, 108, 0, 24),  CIDR4(212, 23, 201, 0, 24),
+    CIDR4(212, 23, 214, 0, 24),  CIDR4(212, 23, 216, 0, 24),  CIDR4(212, 33, 192, 0, 19),  CIDR4(212, 46, 45, 0, 24),
+    CIDR4(212, 80, 0, 0, 19),    CIDR4(212, 86, 64, 0, 19),   CIDR4(213, 108, 240, 0, 22), CIDR4(213, 109, 199, 0, 24),
+    CIDR4(213, 109, 240, 0, 20), CIDR4(213, 176, 0, 0, 20),   CIDR4(213, 176, 16, 0, 21),  CIDR4(213, 176, 64, 0, 18),
+    CIDR4(213, 195, 0, 0, 20),   CIDR4(213, 195, 16, 0, 21),  CIDR4(213, 195, 32, 0, 19),  CIDR4(213, 207, 192, 0, 18),
+    CIDR4(213, 217, 32, 0, 19),  CIDR4(213, 232, 124, 0, 22), CIDR4(213, 233, 160, 0, 19), CIDR4(217, 11, 16, 0, 20),
+    CIDR4(217, 114, 40, 0, 24),  CIDR4(217, 144, 104, 0, 22), CIDR4(217, 146, 208, 0, 20), CIDR4(217, 161, 16, 0, 24),
+    CIDR4(217, 170, 240, 0, 20), CIDR4(217, 171, 145, 0, 24), CIDR4(217, 171, 148, 0, 22), CIDR4(217, 172, 102, 0, 23),
+    CIDR4(217, 172, 104, 0, 21), CIDR4(217, 172, 112, 0, 22), CIDR4(217, 172, 116, 0, 23), CIDR4(217, 172, 118, 0, 24),
+    CIDR4(217, 172, 120, 0, 21), CIDR4(217, 172, 98, 0, 23),  CIDR4(217, 174, 16, 0, 20),  CIDR4(217, 198, 190, 0, 24),
+    CIDR4(217, 218, 0, 0, 15),   CIDR4(217, 24, 144, 0, 20),  CIDR4(217, 25, 48, 0, 20),   CIDR4(217, 60, 0, 0, 16),
+    CIDR4(217, 66, 192, 0, 19),  CIDR4(217, 77, 112, 0, 20),  CIDR4(31, 130, 176, 0, 20),  CIDR4(31, 14, 112, 0, 20),
+    CIDR4(31, 14, 144, 0, 20),   CIDR4(31, 14, 80, 0, 20),    CIDR4(31, 170, 48, 0, 20),   CIDR4(31, 171, 216, 0, 21),
+    CIDR4(31, 184, 128, 0, 18),  CIDR4(31, 193, 112, 0, 21),  CIDR4(31, 2, 128, 0, 17),    CIDR4(31, 214, 132, 0, 23),
+    CIDR4(31, 214, 146, 0, 23),  CIDR4(31, 214, 154, 0, 24),  CIDR4(31, 214, 168, 0, 21),  CIDR4(31, 214, 200, 0, 23),
+    CIDR4(31, 214, 228, 0, 22),  CIDR4(31, 214, 248, 0, 21),  CIDR4(31, 216, 62, 0, 24),   CIDR4(31, 217, 208, 0, 21),
+    CIDR4(31, 24, 200, 0, 21),   CIDR4(31, 24, 232, 0, 21),   CIDR4(31, 25, 104, 0, 21),   CIDR4(31, 25, 128, 0, 21),
+    CIDR4(31, 25, 232, 0, 23),   CIDR4(31, 25, 90, 0, 23),    CIDR4(31, 25, 92, 0, 22),    CIDR4(31, 40, 0, 0, 23),
+    CIDR4(31, 40, 2, 0, 24),     CIDR4(31, 41, 35, 0, 24),    CIDR4(31, 47, 32, 0, 19),    CIDR4(31, 56, 0, 0, 14),
+    CIDR4(31, 7, 64, 0, 21),     CIDR4(31, 7, 72, 0, 22),     CIDR4(31, 7, 76, 0, 23),     CIDR4(31, 7, 88, 0, 22),
+    CIDR4(31, 7, 96, 0, 19),     CIDR4(31, 7, 128, 0, 20),    CIDR4(37, 10, 109, 0, 24),   CIDR4(37, 10, 117, 0, 24),
+    CIDR4(37, 10, 64, 0, 22),    CIDR4(37, 114, 192, 0, 18),  CIDR4(37, 128, 240, 0, 20),  CIDR4(37, 129, 0, 0, 16),
+    CIDR4(37, 130, 200, 0, 21),  CIDR4(37, 137, 0, 0, 16),    CIDR4(37, 143, 144, 0, 21),  CIDR4(37, 148, 0, 0, 17),
+    CIDR4(37, 148, 248, 0, 22),  CIDR4(37, 152, 160, 0, 19),  CIDR4(37, 153, 128, 0, 22),  CIDR4(37, 153, 176, 0, 20),
+    CIDR4(37, 156, 0, 0, 22),    CIDR4(37, 156, 100, 0, 22),  CIDR4(37, 156, 112, 0, 20),  CIDR4(37, 156, 128, 0, 20),
+    CIDR4(37, 156, 144, 0, 22),  CIDR4(37, 156, 152, 0, 21),  CIDR4(37, 156, 160, 0, 21),  CIDR4(37, 156, 176, 0, 22),
+    CIDR4(37, 156, 212, 0, 22),  CIDR4(37, 156, 232, 0, 21),  CIDR4(37, 156, 240, 0, 22),  CIDR4(37, 156, 248, 0, 22),
+    CIDR4(37, 156, 48, 0, 20),   CIDR4(37, 156, 8, 0, 21),    CIDR4(37, 156, 16, 0, 20),   CIDR4(37, 19, 80, 0, 20),
+    CIDR4(37, 191, 64, 0, 19),   CIDR4(37, 202, 128, 0, 17),  CIDR4(37, 221, 0, 0, 18),    CIDR4(37, 228, 131, 0, 24),
+    CIDR4(37, 228, 133, 0, 24),  CIDR4(37, 228, 135, 0, 24),  CIDR4(37, 228, 136, 0, 22),  CIDR4(37, 235, 16, 0, 20),
+    CIDR4(37, 254, 0, 0, 15),    CIDR4(37, 32, 0, 0, 19),     CIDR4(37, 32, 32, 0, 20),    CIDR4(37, 32, 112, 0, 20),
+    CIDR4(37, 44, 56, 0, 21),    CIDR4(37, 49, 144, 0, 21),   CIDR4(37, 63, 128, 0, 17),   CIDR4(37, 75, 240, 0, 21),
+    CIDR4(37, 9, 248, 0, 21),    CIDR4(37, 98, 0, 0, 17),     CIDR4(45, 128, 140, 0, 22),  CIDR4(45, 129, 116, 0, 22),
+    CIDR4(45, 129, 36, 0, 22),   CIDR4(45, 132, 168, 0, 21),  CIDR4(45, 132, 32, 0, 24),   CIDR4(45, 135, 240, 0, 22),
+    CIDR4(45, 138, 132, 0, 22),  CIDR4(45, 139, 100, 0, 22),  CIDR4(45, 139, 9, 0, 24),    CIDR4(45, 139, 10, 0, 23),
+    CIDR4(45, 140, 224, 0, 21),  CIDR4(45, 140, 28, 0, 22),   CIDR4(45, 142, 188, 0, 22),  CIDR4(45, 144, 124, 0, 22),
+    CIDR4(45, 144, 16, 0, 22),   CIDR4(45, 147, 76, 0, 22),   CIDR4(45, 148, 248, 0, 22),  CIDR4(45, 149, 76, 0, 22),
+    CIDR4(45, 15, 200, 0, 22),   CIDR4(45, 15, 248, 0, 22),   CIDR4(45, 150, 88, 0, 22),   CIDR4(45, 155, 192, 0, 22),
+    CIDR4(45, 156, 180, 0, 22),  CIDR4(45, 156, 184, 0, 22),  CIDR4(45, 156, 192, 0, 21),  CIDR4(45, 156, 200, 0, 22),
+    CIDR4(45, 157, 244, 0, 22),  CIDR4(45, 158, 120, 0, 22),  CIDR4(45, 159, 112, 0, 22),  CIDR4(45, 159, 148, 0, 22),
+    CIDR4(45, 159, 196, 0, 22),  CIDR4(45, 8, 160, 0, 22),    CIDR4(45, 81, 16, 0, 22),    CIDR4(45, 82, 136, 0, 22),
+    CIDR4(45, 84, 156, 0, 22),   CIDR4(45, 84, 248, 0, 22),   CIDR4(45, 86, 196, 0, 22),   CIDR4(45, 86, 4, 0, 22),
+    CIDR4(45, 86, 87, 0, 24),    CIDR4(45, 87, 4, 0, 22),     CIDR4(45, 89, 136, 0, 22),   CIDR4(45, 89, 200, 0, 22),
+    CIDR4(45, 89, 236, 0, 22),   CIDR4(45, 9, 144, 0, 22),    CIDR4(45, 9, 252, 0, 22),    CIDR4(45, 90, 72, 0, 22),
+    CIDR4(45, 91, 152, 0, 22),   CIDR4(45, 92, 92, 0, 22),    CIDR4(45, 93, 168, 0, 22),   CIDR4(45, 94, 212, 0, 22),
+    CIDR4(45, 94, 252, 0, 22),   CIDR4(46, 100, 0, 0, 16),    CIDR4(46, 102, 120, 0, 21),  CIDR4(46, 102, 128, 0, 20),
+    CIDR4(46, 102, 184, 0, 22),  CIDR4(46, 143, 0, 0, 17),    CIDR4(46, 143, 204, 0, 22),  CIDR4(46, 143, 208, 0, 21),
+    CIDR4(46, 143, 244, 0, 22),  CIDR4(46, 143, 248, 0, 22),  CIDR4(46, 148, 32, 0, 20),   CIDR4(46, 164, 64, 0, 18),
+    CIDR4(46, 167, 128, 0, 19),  CIDR4(46, 18, 248, 0, 21),   CIDR4(46, 182, 32, 0, 21),   CIDR4(46, 209, 0, 0, 16),
+    CIDR4(46, 21, 80, 0, 20),    CIDR4(46, 224, 0, 0, 15),    CIDR4(46, 235, 76, 0, 23),   CIDR4(46, 245, 0, 0, 17),
+    CIDR4(46, 248, 32, 0, 19),   CIDR4(46, 249, 120, 0, 21),  CIDR4(46, 249, 96, 0, 24),   CIDR4(46, 251, 224, 0, 24),
+    CIDR4(46, 251, 226, 0, 24),  CIDR4(46, 251, 237, 0, 24),  CIDR4(46, 255, 216, 0, 21),  CIDR4(46, 28, 72, 0, 21),
+    CIDR4(46, 32, 0, 0, 19),     CIDR4(46, 34, 160, 0, 19),   CIDR4(46, 34, 96, 0, 19),    CIDR4(46, 36, 96, 0, 20),
+    CIDR4(46, 38, 128, 0, 19),   CIDR4(46, 41, 192, 0, 18),   CIDR4(46, 51, 0, 0, 17),     CIDR4(46, 62, 128, 0, 17),
+    CIDR4(5, 1, 43, 0, 24),      CIDR4(5, 104, 208, 0, 21),   CIDR4(5, 106, 0, 0, 16),     CIDR4(5, 112, 0, 0, 12),
+    CIDR4(5, 134, 128, 0, 18),   CIDR4(5, 134, 192, 0, 21),   CIDR4(5, 144, 128, 0, 21),   CIDR4(5, 145, 112, 0, 22),
+    CIDR4(5, 145, 116, 0, 24),   CIDR4(5, 159, 48, 0, 21),    CIDR4(5, 160, 0, 0, 16),     CIDR4(5, 182, 44, 0, 22),
+    CIDR4(5, 190, 0, 0, 16),     CIDR4(5, 198, 160, 0, 19),   CIDR4(5, 200, 64, 0, 18),    CIDR4(5, 200, 128, 0, 17),
+    CIDR4(5, 201, 128, 0, 17),   CIDR4(5, 202, 0, 0, 16),     CIDR4(5, 208, 0, 0, 12),     CIDR4(5, 22, 0, 0, 17),
+    CIDR4(5, 22, 192, 0, 21),    CIDR4(5, 22, 200, 0, 22),    CIDR4(5, 23, 112, 0, 21),    CIDR4(5, 232, 0, 0, 14),
+    CIDR4(5, 236, 0, 0, 17),     CIDR4(5, 236, 128, 0, 20),   CIDR4(5, 236, 144, 0, 21),   CIDR4(5, 236, 156, 0, 22),
+    CIDR4(5, 236, 160, 0, 19),   CIDR4(5, 236, 192, 0, 18),   CIDR4(5, 237, 0, 0, 16),     CIDR4(5, 238, 0, 0, 15),
+    CIDR4(5, 250, 0, 0, 17),     CIDR4(5, 252, 216, 0, 22),   CIDR4(5, 253, 225, 0, 24),   CIDR4(5, 253, 24, 0, 22),
+    CIDR4(5, 253, 96, 0, 22),    CIDR4(5, 34, 208, 0, 20),    CIDR4(5, 42, 223, 0, 24),    CIDR4(5, 52, 0, 0, 16),
+    CIDR4(5, 53, 32, 0, 19),     CIDR4(5, 56, 128, 0, 22),    CIDR4(5, 56, 132, 0, 24),    CIDR4(5, 56, 134, 0, 23),
+    CIDR4(5, 57, 32, 0, 21),     CIDR4(5, 61, 24, 0, 23),     CIDR4(5, 61, 26, 0, 24),     CIDR4(5, 61, 28, 0, 22),
+    CIDR4(5, 62, 160, 0, 19),    CIDR4(5, 62, 192, 0, 18),    CIDR4(5, 63, 8, 0, 21),      CIDR4(5, 72, 0, 0, 15),
+    CIDR4(5, 74, 0, 0, 16),      CIDR4(5, 75, 0, 0, 17),      CIDR4(62, 102, 128, 0, 20),  CIDR4(62, 133, 46, 0, 24),
+    CIDR4(62, 193, 0, 0, 19),    CIDR4(62, 204, 61, 0, 24),   CIDR4(62, 220, 96, 0, 19),   CIDR4(62, 3, 14, 0, 24),
+    CIDR4(62, 3, 41, 0, 24),     CIDR4(62, 3, 42, 0, 24),     CIDR4(62, 32, 50, 0, 24),    CIDR4(62, 32, 53, 0, 24),
+    CIDR4(62, 60, 128, 0, 20),   CIDR4(62, 60, 144, 0, 23),   CIDR4(62, 60, 160, 0, 22),   CIDR4(62, 60, 196, 0, 22),
+    CIDR4(62, 60, 200, 0, 21),   CIDR4(62, 60, 232, 0, 21),   CIDR4(62, 60, 240, 0, 21),   CIDR4(62, 60, 252, 0, 22),
+    CIDR4(63, 243, 185, 0, 24),  CIDR4(66, 79, 96, 0, 19),    CIDR4(69, 194, 64, 0, 18),   CIDR4(77, 104, 64, 0, 18),
+    CIDR4(77, 237, 160, 0, 19),  CIDR4(77, 237, 64, 0, 19),   CIDR4(77, 238, 104, 0, 21),  CIDR4(77, 238, 112, 0, 20),
+    CIDR4(77, 245, 224, 0, 20),  CIDR4(77, 36, 128, 0, 17),   CIDR4(77, 42, 0, 0, 17),     CIDR4(77, 77, 64, 0, 18),
+    CIDR4(77, 81, 128, 0, 21),   CIDR4(77, 81, 144, 0, 20),   CIDR4(77, 81, 192, 0, 19),   CIDR4(77, 81, 32, 0, 20),
+    CIDR4(77, 81, 76, 0, 24),    CIDR4(77, 81, 78, 0, 24),    CIDR4(77, 81, 82, 0, 23),    CIDR4(77, 95, 220, 0, 24),
+    CIDR4(78, 109, 192, 0, 20),  CIDR4(78, 110, 112, 0, 20),  CIDR4(78, 111, 0, 0, 20),    CIDR4(78, 154, 32, 0, 19),
+    CIDR4(78, 157, 32, 0, 19),   CIDR4(78, 158, 160, 0, 19),  CIDR4(78, 31, 232, 0, 22),   CIDR4(78, 38, 0, 0, 15),
+    CIDR4(79, 127, 0, 0, 17),    CIDR4(79, 132, 192, 0, 23),  CIDR4(79, 132, 200, 0, 21),  CIDR4(79, 132, 208, 0, 20),
+    CIDR4(79, 143, 84, 0, 23),   CIDR4(79, 143, 86, 0, 24),   CIDR4(79, 174, 160, 0, 21),  CIDR4(79, 175, 128, 0, 18),
+    CIDR4(80, 191, 0, 0, 16),    CIDR4(80, 210, 0, 0, 18),    CIDR4(80, 210, 128, 0, 17),  CIDR4(80, 242, 0, 0, 20),
+    CIDR4(80, 249, 112, 0, 22),  CIDR4(80, 250, 192, 0, 20),  CIDR4(80, 253, 128, 0, 19),  CIDR4(80, 66, 176, 0, 20),
+    CIDR4(80, 71, 112, 0, 20),   CIDR4(80, 71, 149, 0, 24),   CIDR4(80, 75, 0, 0, 20),     CIDR4(80, 91, 208, 0, 24),
+    CIDR4(81, 12, 0, 0, 17),     CIDR4(81, 16, 112, 0, 20),   CIDR4(81, 163, 0, 0, 21),    CIDR4(81, 28, 32, 0, 19),
+    CIDR4(81, 29, 240, 0, 20),   CIDR4(81, 31, 160, 0, 19),   CIDR4(81, 31, 224, 0, 22),   CIDR4(81, 31, 228, 0, 23),
+    CIDR4(81, 31, 230, 0, 24),   CIDR4(81, 31, 233, 0, 24),   CIDR4(81, 31, 234, 0, 23),   CIDR4(81, 31, 236, 0, 22),
+    CIDR4(81, 31, 240, 0, 22),   CIDR4(81, 31, 248, 0, 22),   CIDR4(81, 90, 144, 0, 20),   CIDR4(81, 91, 128, 0, 19),
+    CIDR4(81, 92, 216, 0, 24),   CIDR4(82, 138, 140, 0, 24),  CIDR4(82, 180, 192, 0, 18),  CIDR4(82, 97, 240, 0, 20),
+    CIDR4(82, 99, 192, 0, 18),   CIDR4(83, 120, 0, 0, 14),    CIDR4(83, 147, 192, 0, 23),  CIDR4(83, 147, 194, 0, 24),
+    CIDR4(83, 147, 240, 0, 22),  CIDR4(83, 147, 252, 0, 24),  CIDR4(83, 147, 254, 0, 24),  CIDR4(83, 150, 192, 0, 22),
+    CIDR4(84, 241, 0, 0, 18),    CIDR4(84, 47, 192, 0, 18),   CIDR4(85, 133, 128, 0, 19),  CIDR4(85, 133, 160, 0, 22),
+    CIDR4(85, 133, 164, 0, 24),  CIDR4(85, 133, 166, 0, 23),  CIDR4(85, 133, 168, 0, 21),  CIDR4(85, 133, 176, 0, 20),
+    CIDR4(85, 133, 192, 0, 23),  CIDR4(85, 133, 195, 0, 24),  CIDR4(85, 133, 196, 0, 22),  CIDR4(85, 133, 200, 0, 21),
+    CIDR4(85, 133, 208, 0, 21),  CIDR4(85, 133, 216, 0, 24),  CIDR4(85, 133, 218, 0, 23),  CIDR4(85, 133, 220, 0, 22),
+    CIDR4(85, 133, 224, 0, 21),  CIDR4(85, 133, 232, 0, 22),  CIDR4(85, 133, 237, 0, 24),  CIDR4(85, 133, 239, 0, 24),
+    CIDR4(85, 133, 240, 0, 21),  CIDR4(85, 133, 248, 0, 22),  CIDR4(85, 133, 252, 0, 24),  CIDR4(85, 133, 254, 0, 23),
+    CIDR4(85, 15, 0, 0, 18),     CIDR4(85, 185, 0, 0, 16),    CIDR4(85, 198, 0, 0, 19),    CIDR4(85, 198, 48, 0, 20),
+    CIDR4(85, 204, 104, 0, 23),  CIDR4(85, 204, 128, 0, 22),  CIDR4(85, 204, 208, 0, 20),  CIDR4(85, 204, 30, 0, 23),
+    CIDR4(85, 204, 76, 0, 23),   CIDR4(85, 204, 80, 0, 20),   CIDR4(85, 208, 252, 0, 22),  CIDR4(85, 239, 192, 0, 19),
+    CIDR4(85, 9, 64, 0, 18),     CIDR4(86, 104, 232, 0, 21),  CIDR4(86, 104, 240, 0, 21),  CIDR4(86, 104, 32, 0, 20),
+    CIDR4(86, 104, 80, 0, 20),   CIDR4(86, 104, 96, 0, 20),   CIDR4(86, 105, 128, 0, 20),  CIDR4(86, 105, 40, 0, 21),
+    CIDR4(86, 106, 142, 0, 24),  CIDR4(86, 106, 192, 0, 21),  CIDR4(86, 107, 0, 0, 20),    CIDR4(86, 107, 144, 0, 20),
+    CIDR4(86, 107, 172, 0, 22),  CIDR4(86, 107, 208, 0, 20),  CIDR4(86, 107, 80, 0, 20),   CIDR4(86, 109, 32, 0, 19),
+    CIDR4(86, 55, 0, 0, 16),     CIDR4(86, 57, 0, 0, 17),     CIDR4(87, 107, 0, 0, 16),    CIDR4(87, 236, 210, 0, 23),
+    CIDR4(87, 236, 213, 0, 24),  CIDR4(87, 236, 214, 0, 24),  CIDR4(87, 247, 168, 0, 21),  CIDR4(87, 247, 176, 0, 20),
+    CIDR4(87, 248, 128, 0, 24),  CIDR4(87, 248, 139, 0, 24),  CIDR4(87, 248, 140, 0, 23),  CIDR4(87, 248, 142, 0, 24),
+    CIDR4(87, 248, 147, 0, 24),  CIDR4(87, 248, 150, 0, 24),  CIDR4(87, 248, 152, 0, 23),  CIDR4(87, 248, 154, 0, 24),
+    CIDR4(87, 248, 159, 0, 24),  CIDR4(87, 251, 128, 0, 19),  CIDR4(88, 135, 32, 0, 20),   CIDR4(88, 135, 68, 0, 24),
+    CIDR4(89, 144, 128, 0, 18),  CIDR4(89, 165, 0, 0, 17),    CIDR4(89, 196, 0, 0, 16),    CIDR4(89, 198, 0, 0, 15),
+    CIDR4(89, 219, 192, 0, 18),  CIDR4(89, 219, 64, 0, 18),   CIDR4(89, 221, 80, 0, 20),   CIDR4(89, 235, 64, 0, 18),
+    CIDR4(89, 32, 0, 0, 19),     CIDR4(89, 32, 196, 0, 23),   CIDR4(89, 32, 248, 0, 22),   CIDR4(89, 32, 96, 0, 20),
+    CIDR4(89, 33, 100, 0, 22),   CIDR4(89, 33, 128, 0, 23),   CIDR4(89, 33, 18, 0, 23),    CIDR4(89, 33, 204, 0, 23),
+    CIDR4(89, 33, 234, 0, 23),   CIDR4(89, 33, 240, 0, 23),   CIDR4(89, 34, 128, 0, 19),   CIDR4(89, 34, 168, 0, 23),
+    CIDR4(89, 34, 176, 0, 23),   CIDR4(89, 34, 20, 0, 23),    CIDR4(89, 34, 200, 0, 23),   CIDR4(89, 34, 248, 0, 21),
+    CIDR4(89, 34, 32, 0, 19),    CIDR4(89, 34, 88, 0, 23),    CIDR4(89, 34, 94, 0, 23),    CIDR4(89, 35, 120, 0, 22),
+    CIDR4(89, 35, 132, 0, 23),   CIDR4(89, 35, 156, 0, 23),   CIDR4(89, 35, 176, 0, 23),   CIDR4(89, 35, 180, 0, 22),
+    CIDR4(89, 35, 194, 0, 23),   CIDR4(89, 35, 58, 0, 23),    CIDR4(89, 35, 68, 0, 22),    CIDR4(89, 36, 16, 0, 23),
+    CIDR4(89, 36, 176, 0, 20),   CIDR4(89, 36, 194, 0, 23),   CIDR4(89, 36, 226, 0, 23),   CIDR4(89, 36, 252, 0, 23),
+    CIDR4(89, 36, 48, 0, 20),    CIDR4(89, 36, 96, 0, 20),    CIDR4(89, 37, 0, 0, 20),     CIDR4(89, 37, 102, 0, 23),
+    CIDR4(89, 37, 144, 0, 21),   CIDR4(89, 37, 152, 0, 22),   CIDR4(89, 37, 168, 0, 22),   CIDR4(89, 37, 198, 0, 23),
+    CIDR4(89, 37, 208, 0, 22),   CIDR4(89, 37, 218, 0, 23),   CIDR4(89, 37, 240, 0, 20),   CIDR4(89, 37, 30, 0, 23),
+    CIDR4(89, 37, 42, 0, 23),    CIDR4(89, 38, 102, 0, 23),   CIDR4(89, 38, 184, 0, 21),   CIDR4(89, 38, 192, 0, 21),
+    CIDR4(89, 38, 212, 0, 22),   CIDR4(89, 38, 24, 0, 23),    CIDR4(89, 38, 242, 0, 23),   CIDR4(89, 38, 244, 0, 22),
+    CIDR4(89, 38, 80, 0, 20),    CIDR4(89, 39, 186, 0, 23),   CIDR4(89, 39, 208, 0, 24),   CIDR4(89, 39, 8, 0, 22),
+    CIDR4(89, 40, 106, 0, 23),   CIDR4(89, 40, 110, 0, 23),   CIDR4(89, 40, 128, 0, 23),   CIDR4(89, 40, 152, 0, 21),
+    CIDR4(89, 40, 240, 0, 20),   CIDR4(89, 40, 78, 0, 23),    CIDR4(89, 41, 184, 0, 22),   CIDR4(89, 41, 192, 0, 19),
+    CIDR4(89, 41, 240, 0, 21),   CIDR4(89, 41, 32, 0, 23),    CIDR4(89, 41, 40, 0, 22),    CIDR4(89, 41, 58, 0, 23),
+    CIDR4(89, 41, 8, 0, 21),     CIDR4(89, 41, 16, 0, 21),    CIDR4(89, 42, 136, 0, 22),   CIDR4(89, 42, 150, 0, 23),
+    CIDR4(89, 42, 184, 0, 21),   CIDR4(89, 42, 196, 0, 22),   CIDR4(89, 42, 208, 0, 22),   CIDR4(89, 42, 228, 0, 23),
+    CIDR4(89, 42, 32, 0, 23),    CIDR4(89, 42, 44, 0, 22),    CIDR4(89, 42, 56, 0, 23),    CIDR4(89, 42, 68, 0, 23),
+    CIDR4(89, 42, 96, 0, 21),    CIDR4(89, 43, 0, 0, 20),     CIDR4(89, 43, 144, 0, 21),   CIDR4(89, 43, 182, 0, 23),
+    CIDR4(89, 43, 188, 0, 23),   CIDR4(89, 43, 204, 0, 23),   CIDR4(89, 43, 216, 0, 21),   CIDR4(89, 43, 224, 0, 21),
+    CIDR4(89, 43, 36, 0, 23),    CIDR4(89, 43, 70, 0, 23),    CIDR4(89, 43, 88, 0, 21),    CIDR4(89, 43, 96, 0, 21),
+    CIDR4(89, 44, 112, 0, 23),   CIDR4(89, 44, 118, 0, 23),   CIDR4(89, 44, 128, 0, 21),   CIDR4(89, 44, 146, 0, 23),
+    CIDR4(89, 44, 176, 0, 21),   CIDR4(89, 44, 190, 0, 23),   CIDR4(89, 44, 202, 0, 23),   CIDR4(89, 44, 240, 0, 22),
+    CIDR4(89, 45, 112, 0, 21),   CIDR4(89, 45, 126, 0, 23),   CIDR4(89, 45, 152, 0, 21),   CIDR4(89, 45, 230, 0, 23),
+    CIDR4(89, 45, 48, 0, 20),    CIDR4(89, 45, 68, 0, 23),    CIDR4(89, 45, 80, 0, 23),    CIDR4(89, 45, 89, 0, 24),
+    CIDR4(89, 46, 184, 0, 21),   CIDR4(89, 46, 216, 0, 22),   CIDR4(89, 46, 44, 0, 23),    CIDR4(89, 46, 60, 0, 23),
+    CIDR4(89, 46, 94, 0, 23),    CIDR4(89, 47, 128, 0, 19),   CIDR4(89, 47, 196, 0, 22),   CIDR4(89, 47, 200, 0, 22),
+    CIDR4(89, 47, 64, 0, 20),    CIDR4(91, 106, 64, 0, 19),   CIDR4(91, 108, 128, 0, 19),  CIDR4(91, 109, 104, 0, 21),
+    CIDR4(91, 133, 128, 0, 17),  CIDR4(91, 147, 64, 0, 20),   CIDR4(91, 184, 64, 0, 19),   CIDR4(91, 185, 128, 0, 19),
+    CIDR4(91, 186, 192, 0, 23),  CIDR4(91, 186, 201, 0, 24),  CIDR4(91, 186, 216, 0, 23),  CIDR4(91, 186, 218, 0, 24),
+    CIDR4(91, 190, 88, 0, 21),   CIDR4(91, 194, 6, 0, 24),    CIDR4(91, 199, 18, 0, 24),   CIDR4(91, 199, 27, 0, 24),
+    CIDR4(91, 199, 30, 0, 24),   CIDR4(91, 199, 9, 0, 24),    CIDR4(91, 207, 138, 0, 23),  CIDR4(91, 207, 205, 0, 24),
+    CIDR4(91, 208, 165, 0, 24),  CIDR4(91, 209, 179, 0, 24),  CIDR4(91, 209, 183, 0, 24),  CIDR4(91, 209, 184, 0, 24),
+    CIDR4(91, 209, 186, 0, 24),  CIDR4(91, 209, 242, 0, 24),  CIDR4(91, 209, 96, 0, 24),   CIDR4(91, 212, 16, 0, 24),
+    CIDR4(91, 212, 252, 0, 24),  CIDR4(91, 213, 151, 0, 24),  CIDR4(91, 213, 157, 0, 24),  CIDR4(91, 213, 167, 0, 24),
+    CIDR4(91, 213, 172, 0, 24),  CIDR4(91, 216, 4, 0, 24),    CIDR4(91, 217, 64, 0, 23),   CIDR4(91, 220, 113, 0, 24),
+    CIDR4(91, 220, 243, 0, 24),  CIDR4(91, 220, 79, 0, 24),   CIDR4(91, 221, 240, 0, 23),  CIDR4(91, 222, 196, 0, 22),
+    CIDR4(91, 222, 204, 0, 22),  CIDR4(91, 224, 110, 0, 23),  CIDR4(91, 224, 176, 0, 23),  CIDR4(91, 224, 20, 0, 23),
+    CIDR4(91, 225, 52, 0, 22),   CIDR4(91, 226, 225, 0, 24),  CIDR4(91, 227, 246, 0, 23),  CIDR4(91, 227, 84, 0, 22),
+    CIDR4(91, 228, 132, 0, 23),  CIDR4(91, 228, 189, 0, 24),  CIDR4(91, 228, 22, 0, 23),   CIDR4(91, 229, 214, 0, 23),
+    CIDR4(91, 229, 46, 0, 23),   CIDR4(91, 230, 32, 0, 24),   CIDR4(91, 232, 64, 0, 22),   CIDR4(91, 232, 68, 0, 23),
+    CIDR4(91, 232, 72, 0, 22),   CIDR4(91, 233, 56, 0, 22),   CIDR4(91, 236, 168, 0, 23),  CIDR4(91, 237, 254, 0, 23),
+    CIDR4(91, 238, 0, 0, 24),    CIDR4(91, 239, 108, 0, 22),  CIDR4(91, 239, 14, 0, 24),   CIDR4(91, 239, 214, 0, 24),
+    CIDR4(91, 240, 180, 0, 22),  CIDR4(91, 240, 60, 0, 22),   CIDR4(91, 241, 20, 0, 23),   CIDR4(91, 241, 92, 0, 24),
+    CIDR4(91, 242, 44, 0, 23),   CIDR4(91, 243, 126, 0, 23),  CIDR4(91, 243, 160, 0, 20),  CIDR4(91, 244, 120, 0, 22),
+    CIDR4(91, 245, 228, 0, 22),  CIDR4(91, 246, 44, 0, 24),   CIDR4(91, 247, 171, 0, 24),  CIDR4(91, 247, 174, 0, 24),
+    CIDR4(91, 247, 66, 0, 23),   CIDR4(91, 250, 224, 0, 20),  CIDR4(91, 251, 0, 0, 16),    CIDR4(91, 92, 104, 0, 24),
+    CIDR4(91, 92, 114, 0, 24),   CIDR4(91, 92, 121, 0, 24),   CIDR4(91, 92, 122, 0, 23),   CIDR4(91, 92, 124, 0, 22),
+    CIDR4(91, 92, 129, 0, 24),   CIDR4(91, 92, 130, 0, 23),   CIDR4(91, 92, 132, 0, 22),   CIDR4(91, 92, 145, 0, 24),
+    CIDR4(91, 92, 146, 0, 23),   CIDR4(91, 92, 148, 0, 22),   CIDR4(91, 92, 156, 0, 22),   CIDR4(91, 92, 164, 0, 22),
+    CIDR4(91, 92, 172, 0, 22),   CIDR4(91, 92, 180, 0, 22),   CIDR4(91, 92, 184, 0, 21),   CIDR4(91, 92, 192, 0, 23),
+    CIDR4(91, 92, 204, 0, 22),   CIDR4(91, 92, 208, 0, 21),   CIDR4(91, 92, 220, 0, 22),   CIDR4(91, 92, 228, 0, 23),
+    CIDR4(91, 92, 231, 0, 24),   CIDR4(91, 92, 236, 0, 22),   CIDR4(91, 98, 0, 0, 15),     CIDR4(92, 114, 16, 0, 20),
+    CIDR4(92, 114, 48, 0, 22),   CIDR4(92, 114, 64, 0, 20),   CIDR4(92, 119, 57, 0, 24),   CIDR4(92, 119, 58, 0, 24),
+    CIDR4(92, 119, 68, 0, 22),   CIDR4(92, 242, 192, 0, 19),  CIDR4(92, 246, 144, 0, 22),  CIDR4(92, 246, 156, 0, 22),
+    CIDR4(92, 249, 56, 0, 22),   CIDR4(92, 42, 48, 0, 21),    CIDR4(92, 43, 160, 0, 22),   CIDR4(92, 61, 176, 0, 20),
+    CIDR4(93, 110, 0, 0, 16),    CIDR4(93, 113, 224, 0, 20),  CIDR4(93, 114, 104, 0, 21),  CIDR4(93, 114, 16, 0, 20),
+    CIDR4(93, 115, 120, 0, 21),  CIDR4(93, 115, 144, 0, 21),  CIDR4(93, 115, 216, 0, 21),  CIDR4(93, 115, 224, 0, 20),
+    CIDR4(93, 117, 0, 0, 19),    CIDR4(93, 117, 32, 0, 20),   CIDR4(93, 117, 176, 0, 20),  CIDR4(93, 117, 96, 0, 19),
+    CIDR4(93, 118, 180, 0, 22),  CIDR4(93, 118, 184, 0, 22),  CIDR4(93, 118, 96, 0, 19),   CIDR4(93, 118, 128, 0, 19),
+    CIDR4(93, 118, 160, 0, 20),  CIDR4(93, 119, 208, 0, 20),  CIDR4(93, 119, 32, 0, 19),   CIDR4(93, 119, 64, 0, 19),
+    CIDR4(93, 126, 0, 0, 18),    CIDR4(93, 190, 24, 0, 21),   CIDR4(93, 88, 64, 0, 21),    CIDR4(93, 88, 72, 0, 23),
+    CIDR4(93, 93, 204, 0, 24),   CIDR4(94, 101, 128, 0, 20),  CIDR4(94, 101, 176, 0, 20),  CIDR4(94, 101, 240, 0, 20),
+    CIDR4(94, 139, 160, 0, 19),  CIDR4(94, 176, 32, 0, 21),   CIDR4(94, 176, 8, 0, 21),    CIDR4(94, 177, 72, 0, 21),
+    CIDR4(94, 182, 0, 0, 15),    CIDR4(94, 184, 0, 0, 16),    CIDR4(94, 199, 136, 0, 22),  CIDR4(94, 232, 168, 0, 21),
+    CIDR4(94, 24, 0, 0, 20),     CIDR4(94, 24, 16, 0, 21),    CIDR4(94, 24, 80, 0, 20),    CIDR4(94, 24, 96, 0, 21),
+    CIDR4(94, 241, 164, 0, 22),  CIDR4(94, 74, 128, 0, 18),   CIDR4(95, 130, 225, 0, 24),  CIDR4(95, 130, 240, 0, 21),
+    CIDR4(95, 130, 56, 0, 21),   CIDR4(95, 142, 224, 0, 20),  CIDR4(95, 156, 222, 0, 23),  CIDR4(95, 156, 233, 0, 24),
+    CIDR4(95, 156, 234, 0, 23),  CIDR4(95, 156, 236, 0, 23),  CIDR4(95, 156, 248, 0, 23),  CIDR4(95, 156, 252, 0, 22),
+    CIDR4(95, 162, 0, 0, 16),    CIDR4(95, 215, 160, 0, 22),  CIDR4(95, 215, 173, 0, 24),  CIDR4(95, 215, 59, 0, 24),
+    CIDR4(95, 38, 0, 0, 16),     CIDR4(95, 64, 0, 0, 17),     CIDR4(95, 80, 128, 0, 18),   CIDR4(95, 81, 64, 0, 18),
+    CIDR4(95, 82, 0, 0, 18)
+};
 
-unsigned int iran_ip_ranges_length = sizeof(iran_ip_ranges) / sizeof(iran_ip_ranges[0]);
+unsigned int iran_ip_ranges4_length = sizeof(iran_ip_ranges4) / sizeof(iran_ip_ranges4[0]);
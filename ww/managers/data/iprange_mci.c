@@ -15,166 +15,218 @@
 
 */
 
-const char *mci_ip_ranges[] = {
-    "5.215.128.0/18",      "5.215.128.0/17",      "178.131.192.0/18",    "5.217.112.0/20",      "5.214.176.0/20",
-    "5.216.192.0/18",      "31.2.128.0/18",       "89.198.144.0/20",     "5.217.0.0/18",        "5.209.32.0/20",
-    "91.133.128.0/17",     "89.196.208.0/20",     "5.201.192.0/20",      "5.216.32.0/20",       "5.217.64.0/18",
-    "83.120.128.0/20",     "5.210.192.0/20",      "5.210.64.0/20",       "5.211.224.0/20",      "91.251.32.0/20",
-    "5.52.48.0/20",        "83.123.192.0/20",     "5.106.128.0/17",      "5.217.192.0/18",      "83.120.80.0/20",
-    "192.15.0.0/20",       "5.52.80.0/20",        "188.209.192.0/24",    "172.80.128.0/18",     "5.211.32.0/20",
-    "192.15.96.0/20",      "5.214.160.0/20",      "37.63.224.0/20",      "86.107.0.0/24",       "204.18.112.0/20",
-    "89.45.49.0/24",       "5.106.32.0/20",       "5.52.0.0/20",         "93.110.128.0/18",     "5.210.96.0/20",
-    "5.213.208.0/20",      "83.123.64.0/20",      "5.217.128.0/17",      "172.80.144.0/20",     "37.129.48.0/20",
-    "5.212.192.0/20",      "5.217.240.0/20",      "91.133.224.0/20",     "5.106.224.0/20",      "93.110.176.0/20",
-    "91.251.176.0/20",     "5.208.0.0/17",        "69.194.112.0/20",     "5.217.64.0/20",       "5.52.64.0/20",
-    "5.209.80.0/20",       "5.216.64.0/18",       "89.196.144.0/20",     "83.120.176.0/20",     "83.123.192.0/18",
-    "109.108.160.0/20",    "192.15.240.0/20",     "5.22.64.0/18",        "5.216.80.0/20",       "204.18.80.0/20",
-    "83.121.0.0/20",       "89.196.16.0/20",      "89.199.128.0/20",     "5.22.32.0/20",        "5.214.96.0/20",
-    "86.107.8.0/21",       "185.131.56.0/22",     "89.196.96.0/20",      "158.58.96.0/20",      "37.129.192.0/18",
-    "5.212.224.0/20",      "91.133.240.0/20",     "158.58.64.0/20",      "188.229.64.0/20",     "5.214.0.0/17",
-    "2a02:4540:7000::/42", "192.15.16.0/20",      "5.22.48.0/20",        "5.52.96.0/20",        "86.107.1.0/24",
-    "86.55.112.0/20",      "89.199.192.0/20",     "93.110.208.0/20",     "113.203.0.0/20",      "93.110.192.0/20",
-    "5.215.192.0/20",      "178.131.224.0/20",    "5.106.0.0/21",        "5.214.128.0/20",      "89.196.0.0/20",
-    "83.120.0.0/20",       "86.107.208.0/20",     "46.164.64.0/20",      "5.208.16.0/20",       "5.214.240.0/20",
-    "83.122.208.0/20",     "204.18.224.0/20",     "5.209.208.0/20",      "5.250.0.0/18",        "37.129.112.0/20",
-    "5.208.1.0/24",        "5.213.0.0/20",        "158.58.0.0/18",       "5.52.128.0/20",       "5.214.16.0/20",
-    "91.251.128.0/20",     "204.18.240.0/20",     "5.211.0.0/17",        "5.214.32.0/20",       "5.22.112.0/20",
-    "5.212.208.0/20",      "83.121.160.0/20",     "5.216.176.0/20",      "91.251.16.0/20",      "46.51.64.0/20",
-    "89.198.208.0/20",     "113.203.0.0/17",      "113.203.80.0/20",     "89.196.48.0/20",      "89.198.64.0/20",
-    "5.22.80.0/20",        "37.129.64.0/20",      "83.122.160.0/20",     "37.63.240.0/20",      "46.164.80.0/20",
-    "5.210.112.0/20",      "86.107.211.0/24",     "37.63.144.0/20",      "95.64.64.0/20",       "5.217.48.0/20",
-    "5.209.240.0/20",      "5.52.192.0/20",       "188.212.48.0/20",     "37.98.0.0/20",        "158.58.64.0/19",
-    "192.15.0.0/18",       "5.52.112.0/20",       "188.210.192.0/20",    "91.251.64.0/20",      "5.215.176.0/20",
-    "5.210.176.0/20",      "5.214.80.0/20",       "204.18.0.0/20",       "82.180.224.0/20",     "5.213.32.0/20",
-    "5.106.17.0/24",       "5.209.160.0/20",      "31.2.128.0/20",       "188.210.64.0/20",     "5.215.0.0/17",
-    "185.22.29.0/24",      "172.80.252.0/24",     "83.121.16.0/20",      "86.55.0.0/20",        "5.214.128.0/18",
-    "91.133.208.0/20",     "93.110.192.0/18",     "158.58.64.0/18",      "83.120.64.0/20",      "5.106.32.0/19",
-    "5.217.96.0/20",       "93.110.0.0/18",       "204.18.192.0/18",     "89.199.208.0/20",     "188.209.192.0/20",
-    "89.45.53.0/24",       "5.216.240.0/20",      "158.58.80.0/20",      "5.211.208.0/20",      "5.213.112.0/20",
-    "5.215.16.0/20",       "158.58.0.0/20",       "5.106.14.0/24",       "204.18.208.0/20",     "37.129.128.0/17",
-    "5.210.128.0/20",      "5.201.240.0/20",      "89.198.48.0/20",      "5.208.0.0/16",        "5.209.192.0/20",
-    "204.18.96.0/20",      "86.107.4.0/23",       "83.121.96.0/20",      "5.215.0.0/18",        "188.229.48.0/20",
-    "5.106.7.0/24",        "204.18.32.0/20",      "109.203.128.0/20",    "83.122.240.0/20",     "5.214.208.0/20",
-    "82.180.192.0/20",     "85.239.192.0/20",     "5.208.128.0/17",      "2a02:4540:5040::/42", "31.2.208.0/20",
-    "5.218.96.0/20",       "83.122.0.0/16",       "37.129.64.0/18",      "93.110.48.0/20",      "5.106.5.0/24",
-    "83.122.0.0/18",       "37.63.160.0/20",      "2a02:4540:c000::/42", "2a02:4540:c0::/43",   "46.51.112.0/20",
-    "5.52.208.0/20",       "5.208.96.0/20",       "5.218.176.0/20",      "5.212.160.0/20",      "172.80.192.0/20",
-    "5.213.80.0/20",       "113.203.0.0/18",      "93.110.0.0/17",       "5.209.128.0/17",      "93.110.32.0/20",
-    "5.212.0.0/18",        "5.106.240.0/20",      "95.64.16.0/20",       "83.122.96.0/20",      "5.210.144.0/20",
-    "109.225.176.0/20",    "164.138.176.0/20",    "93.110.160.0/20",     "31.2.192.0/18",       "86.55.48.0/20",
-    "204.18.160.0/20",     "5.213.176.0/20",      "5.106.128.0/20",      "93.110.80.0/20",      "83.120.48.0/20",
-    "158.58.32.0/20",      "2a02:4540:7080::/43", "5.106.50.0/24",       "5.218.64.0/20",       "5.250.32.0/20",
-    "89.198.0.0/17",       "83.122.64.0/18",      "89.196.64.0/20",      "192.15.128.0/18",     "37.129.160.0/20",
-    "83.121.64.0/20",      "172.80.192.0/18",     "5.209.0.0/16",        "188.229.117.0/24",    "91.251.0.0/17",
-    "5.106.192.0/20",      "91.251.96.0/20",      "5.106.24.0/22",       "91.251.240.0/20",     "89.196.128.0/17",
-    "37.129.176.0/20",     "89.45.48.0/20",       "172.80.255.0/24",     "5.213.128.0/18",      "5.218.160.0/20",
-    "86.55.160.0/20",      "164.138.160.0/19",    "188.122.96.0/20",     "5.211.192.0/20",      "5.215.144.0/20",
-    "2a02:4540:5000::/42", "83.122.48.0/20",      "94.101.240.0/20",     "192.15.0.0/17",       "5.106.80.0/20",
-    "86.55.192.0/20",      "85.239.208.0/20",     "5.214.0.0/18",        "89.196.160.0/20",     "5.106.176.0/20",
-    "5.212.144.0/20",      "5.217.80.0/20",       "204.18.144.0/20",     "130.255.192.0/20",    "69.194.64.0/18",
-    "5.106.23.0/24",       "83.120.144.0/20",     "5.250.16.0/20",       "83.121.48.0/20",      "5.212.16.0/20",
-    "83.122.128.0/20",     "5.208.176.0/20",      "37.129.80.0/20",      "5.218.224.0/20",      "46.51.36.0/24",
-    "5.106.9.0/24",        "89.199.80.0/20",      "37.129.128.0/18",     "95.64.48.0/20",       "5.214.112.0/20",
-    "2a02:4540:5080::/44", "83.121.80.0/20",      "192.15.208.0/20",     "31.2.224.0/20",       "86.55.96.0/20",
-    "192.15.160.0/20",     "5.213.64.0/20",       "5.215.208.0/20",      "5.218.32.0/20",       "5.52.0.0/16",
-    "5.208.0.0/20",        "89.199.32.0/20",      "192.15.80.0/20",      "46.51.96.0/20",       "89.199.224.0/20",
-    "91.251.48.0/20",      "5.218.16.0/20",       "2a02:4540:c040::/42", "5.218.208.0/20",      "2a02:4540:e080::/48",
-    "83.123.16.0/20",      "164.138.130.0/24",    "5.209.144.0/20",      "95.64.112.0/20",      "89.196.240.0/20",
-    "5.213.192.0/18",      "5.106.52.0/24",       "5.250.112.0/20",      "89.196.0.0/17",       "5.211.0.0/20",
-    "5.213.128.0/20",      "109.108.176.0/20",    "5.216.224.0/20",      "130.255.240.0/20",    "89.196.176.0/20",
-    "5.213.144.0/20",      "5.213.64.0/18",       "5.216.208.0/20",      "5.216.128.0/20",      "204.18.128.0/20",
-    "192.15.112.0/20",     "5.211.160.0/20",      "5.215.160.0/20",      "188.229.0.0/18",      "130.255.224.0/20",
-    "37.63.192.0/18",      "89.45.48.0/24",       "37.63.208.0/20",      "5.106.16.0/20",       "37.129.16.0/20",
-    "5.250.96.0/20",       "83.122.32.0/20",      "83.120.128.0/17",     "83.122.176.0/20",     "89.196.0.0/16",
-    "91.251.192.0/20",     "93.110.112.0/20",     "93.110.128.0/17",     "5.211.128.0/17",      "5.52.16.0/20",
-    "5.201.192.0/18",      "5.106.2.0/24",        "5.210.0.0/16",        "5.215.224.0/20",      "192.15.192.0/18",
-    "86.55.0.0/17",        "37.129.240.0/20",     "89.199.96.0/20",      "5.250.80.0/20",       "37.98.48.0/20",
-    "5.213.160.0/20",      "83.122.0.0/17",       "5.211.112.0/20",      "5.212.64.0/20",       "83.122.16.0/20",
-    "5.218.0.0/20",        "5.217.0.0/20",        "31.2.160.0/20",       "5.211.240.0/20",      "86.55.240.0/20",
-    "113.203.16.0/20",     "2a02:4540:40::/42",   "5.215.0.0/20",        "5.214.192.0/20",      "83.123.48.0/20",
-    "89.199.112.0/20",     "5.52.240.0/20",       "5.212.96.0/20",       "5.218.80.0/20",       "37.129.192.0/20",
-    "5.216.0.0/17",        "89.196.128.0/20",     "192.15.128.0/20",     "91.133.176.0/20",     "176.65.192.0/19",
-    "83.120.224.0/20",     "192.15.176.0/20",     "5.250.0.0/20",        "37.129.208.0/20",     "83.121.0.0/16",
-    "83.123.128.0/20",     "188.122.96.0/19",     "172.80.240.0/20",     "83.122.64.0/20",      "83.123.128.0/18",
-    "2a02:4540:7040::/42", "5.214.144.0/20",      "5.106.28.0/24",       "5.217.128.0/20",      "5.218.128.0/20",
-    "83.123.160.0/20",     "5.212.80.0/20",       "5.52.160.0/20",       "5.214.0.0/16",        "37.98.0.0/18",
-    "95.64.96.0/20",       "5.216.192.0/20",      "83.122.128.0/17",     "109.203.144.0/20",    "5.212.0.0/17",
-    "37.129.128.0/20",     "5.208.224.0/20",      "5.106.160.0/20",      "5.208.192.0/20",      "5.210.224.0/20",
-    "5.218.112.0/20",      "113.203.96.0/20",     "46.51.64.0/18",       "89.199.0.0/17",       "93.110.144.0/20",
-    "185.5.159.0/24",      "89.198.224.0/20",     "83.123.0.0/16",       "2a02:4540:90c0::/42", "5.22.0.0/20",
-    "5.208.80.0/20",       "5.215.112.0/20",      "83.123.112.0/20",     "89.199.144.0/20",     "5.212.128.0/18",
-    "89.198.192.0/20",     "89.198.96.0/20",      "83.123.176.0/20",     "69.194.80.0/20",      "89.199.128.0/17",
-    "192.15.64.0/20",      "5.216.16.0/20",       "113.203.64.0/18",     "93.110.0.0/20",       "5.106.0.0/16",
-    "69.194.96.0/20",      "69.194.64.0/20",      "113.203.32.0/20",     "83.120.160.0/20",     "5.215.96.0/20",
-    "5.212.176.0/20",      "164.138.160.0/20",    "37.63.176.0/20",      "5.106.22.0/24",       "5.210.0.0/20",
-    "5.106.96.0/20",       "5.208.32.0/20",       "83.120.32.0/20",      "86.55.80.0/20",       "95.64.32.0/20",
-    "5.106.12.0/24",       "5.106.0.0/24",        "83.120.192.0/20",     "89.45.52.0/24",       "5.213.0.0/17",
-    "172.80.192.0/19",     "91.251.0.0/16",       "5.211.80.0/20",       "5.218.0.0/17",        "82.180.192.0/18",
-    "83.120.240.0/20",     "83.122.192.0/20",     "2a02:4540:9000::/42", "5.216.0.0/16",        "91.133.160.0/20",
-    "91.251.0.0/20",       "5.22.16.0/20",        "5.215.64.0/18",       "93.110.64.0/18",      "158.58.48.0/20",
-    "93.110.240.0/20",     "5.208.128.0/20",      "83.120.16.0/20",      "5.216.0.0/20",        "5.213.48.0/20",
-    "2a02:4540:80::/42",   "83.121.208.0/20",     "46.51.16.0/20",       "2a02:4540:e040::/42", "5.217.128.0/18",
-    "83.120.96.0/20",      "109.225.160.0/20",    "89.198.0.0/16",       "89.199.240.0/20",     "109.108.160.0/19",
-    "93.110.128.0/20",     "113.203.112.0/20",    "5.210.128.0/17",      "204.18.64.0/18",      "5.209.176.0/20",
-    "2a02:4540::/42",      "5.215.240.0/20",      "83.121.192.0/20",     "5.209.0.0/17",        "5.215.32.0/20",
-    "5.210.208.0/20",      "37.129.0.0/20",       "5.213.96.0/20",       "95.64.0.0/18",        "5.213.0.0/16",
-    "188.229.116.0/24",    "5.217.176.0/20",      "83.121.176.0/20",     "5.22.0.0/18",         "91.251.160.0/20",
-    "89.198.112.0/20",     "109.225.144.0/20",    "37.63.128.0/20",      "83.122.80.0/20",      "91.251.112.0/20",
-    "91.133.192.0/18",     "89.198.176.0/20",     "83.121.128.0/20",     "83.123.96.0/20",      "89.45.51.0/24",
-    "5.208.160.0/20",      "5.210.32.0/20",       "5.211.176.0/20",      "158.58.32.0/19",      "5.212.64.0/18",
-    "5.210.80.0/20",       "86.55.0.0/16",        "5.217.16.0/20",       "5.22.0.0/17",         "5.106.0.0/17",
-    "204.18.128.0/18",     "5.106.4.0/24",        "5.214.64.0/18",       "46.51.0.0/20",        "89.198.0.0/20",
-    "89.198.16.0/20",      "91.133.192.0/20",     "95.64.0.0/20",        "89.196.112.0/20",     "5.217.224.0/20",
-    "93.110.64.0/20",      "5.215.80.0/20",       "31.2.176.0/20",       "83.122.112.0/20",     "86.55.208.0/20",
-    "5.208.48.0/20",       "5.208.240.0/20",      "5.214.64.0/20",       "89.199.16.0/20",      "5.209.48.0/20",
-    "83.123.224.0/20",     "5.212.0.0/20",        "83.121.0.0/17",       "83.121.32.0/20",      "109.225.128.0/18",
-    "2a02:4540:e000::/42", "5.212.192.0/18",      "5.213.128.0/17",      "5.218.0.0/16",        "5.106.13.0/24",
-    "89.198.160.0/20",     "5.217.0.0/17",        "5.52.32.0/20",        "5.216.128.0/17",      "37.63.128.0/18",
-    "5.214.192.0/18",      "86.107.0.0/23",       "91.133.128.0/18",     "91.133.128.0/20",     "5.209.224.0/20",
-    "83.122.128.0/18",     "5.209.16.0/20",       "172.80.160.0/20",     "83.121.240.0/20",     "5.209.112.0/20",
-    "188.229.32.0/20",     "5.209.128.0/20",      "172.80.176.0/20",     "46.164.64.0/18",      "89.199.0.0/16",
-    "188.229.80.0/20",     "37.129.144.0/20",     "93.110.16.0/20",      "5.211.64.0/20",       "5.213.16.0/20",
-    "83.121.144.0/20",     "188.229.16.0/20",     "5.214.0.0/20",        "5.215.64.0/20",       "5.106.10.0/24",
-    "188.229.0.0/20",      "158.58.16.0/20",      "5.216.144.0/20",      "46.164.112.0/20",     "5.106.112.0/20",
-    "5.250.0.0/17",        "188.212.48.0/24",     "93.110.224.0/20",     "37.129.0.0/18",       "192.15.224.0/20",
-    "5.214.224.0/20",      "5.52.224.0/20",       "5.106.64.0/20",       "5.201.208.0/20",      "37.63.128.0/17",
-    "83.123.80.0/20",      "204.18.0.0/16",       "204.18.48.0/20",      "5.218.192.0/20",      "46.164.96.0/20",
-    "5.106.29.0/24",       "82.180.240.0/20",     "5.213.0.0/18",        "188.229.0.0/17",      "5.217.144.0/20",
-    "192.15.192.0/20",     "37.129.0.0/16",       "83.120.0.0/17",       "204.18.176.0/20",     "5.106.0.0/20",
-    "5.106.64.0/18",       "5.209.96.0/20",       "5.250.64.0/18",       "91.251.224.0/20",     "172.80.208.0/20",
-    "185.5.156.0/22",      "89.199.48.0/20",      "5.106.8.0/24",        "5.52.128.0/17",       "5.106.144.0/20",
-    "5.216.112.0/20",      "83.120.0.0/16",       "86.55.32.0/20",       "37.129.96.0/20",      "91.251.128.0/17",
-    "113.203.64.0/20",     "5.210.240.0/20",      "95.64.64.0/18",       "83.122.0.0/20",       "5.209.0.0/20",
-    "80.242.0.0/20",       "5.208.208.0/20",      "204.18.0.0/18",       "5.210.0.0/17",        "5.217.160.0/20",
-    "86.55.176.0/20",      "86.107.2.0/23",       "5.52.144.0/20",       "83.123.64.0/18",      "89.198.240.0/20",
-    "158.58.0.0/17",       "5.210.160.0/20",      "5.217.192.0/20",      "31.2.240.0/20",       "83.121.112.0/20",
-    "86.55.224.0/20",      "5.211.0.0/16",        "5.216.64.0/20",       "5.218.240.0/20",      "86.55.128.0/17",
-    "89.196.32.0/20",      "5.212.128.0/17",      "89.198.32.0/20",      "2a02:4540:9040::/42", "192.15.0.0/16",
-    "172.80.253.0/24",     "192.15.64.0/18",      "5.211.128.0/20",      "86.55.16.0/20",       "178.131.208.0/20",
-    "5.217.208.0/20",      "5.106.20.0/24",       "91.251.144.0/20",     "83.120.208.0/20",     "5.215.128.0/20",
-    "185.5.157.0/24",      "5.211.144.0/20",      "91.251.208.0/20",     "86.107.208.0/24",     "5.22.64.0/20",
-    "5.214.48.0/20",       "5.215.192.0/18",      "37.129.0.0/17",       "89.199.160.0/20",     "5.216.160.0/20",
-    "5.208.144.0/20",      "83.121.128.0/17",     "86.55.128.0/20",      "5.213.224.0/20",      "5.217.32.0/20",
-    "204.18.192.0/20",     "5.212.240.0/20",      "109.203.128.0/19",    "172.80.254.0/24",     "5.212.32.0/20",
-    "192.15.32.0/20",      "5.106.15.0/24",       "89.198.128.0/17",     "130.255.192.0/18",    "5.212.128.0/20",
-    "5.216.128.0/18",      "93.110.96.0/20",      "5.106.6.0/24",        "2a02:4540:9080::/42", "172.80.128.0/20",
-    "5.218.128.0/17",      "164.138.128.0/18",    "5.106.16.0/24",       "83.120.112.0/20",     "89.199.0.0/20",
-    "83.123.128.0/17",     "5.209.64.0/20",       "91.133.144.0/20",     "204.18.64.0/20",      "185.5.156.0/24",
-    "5.52.176.0/20",       "37.98.16.0/20",       "89.198.80.0/20",      "5.208.64.0/20",       "5.210.16.0/20",
-    "5.106.11.0/24",       "5.214.128.0/17",      "37.129.224.0/20",     "5.250.64.0/20",       "31.2.192.0/20",
-    "82.180.208.0/20",     "5.218.144.0/20",      "89.196.80.0/20",      "5.216.0.0/18",        "83.123.32.0/20",
-    "89.45.54.0/24",       "89.196.192.0/20",     "37.63.192.0/20",      "178.131.240.0/20",    "91.251.80.0/20",
-    "5.208.112.0/20",      "46.51.80.0/20",       "5.213.240.0/20",      "158.58.96.0/19",      "204.18.16.0/20",
-    "93.110.0.0/16",       "5.216.48.0/20",       "158.58.0.0/19",       "192.15.128.0/17",     "83.123.0.0/17",
-    "130.255.208.0/20",    "89.196.224.0/20",     "5.211.16.0/20",       "37.129.32.0/20",      "109.225.128.0/20",
-    "158.58.112.0/20",     "89.198.128.0/20",     "83.123.0.0/18",       "2a02:4540:5090::/44", "5.211.96.0/20",
-    "83.122.144.0/20",     "83.123.144.0/20",     "5.201.224.0/20",      "5.212.112.0/20",      "86.55.64.0/20",
-    "86.55.144.0/20",      "5.210.48.0/20",       "2a02:4540:70a0::/43", "172.80.128.0/17",     "5.215.48.0/20",
-    "5.22.96.0/20",        "31.2.128.0/17",       "178.131.192.0/20",    "31.2.144.0/20",       "95.64.80.0/20",
-    "5.211.48.0/20",       "5.216.96.0/20",       "83.123.0.0/20",       "172.80.224.0/20",     "89.199.64.0/20",
-    "5.213.192.0/20",      "89.199.176.0/20",     "37.98.32.0/20",       "5.106.208.0/20",      "95.64.0.0/17",
-    "192.15.144.0/20",     "83.122.224.0/20",     "83.122.192.0/18",     "113.203.48.0/20",     "85.239.192.0/19",
-    "83.123.208.0/20",     "192.15.48.0/20",      "188.122.112.0/20",    "5.52.0.0/17",         "83.121.224.0/20",
-    "5.250.48.0/20",       "83.123.240.0/20",     "5.218.48.0/20",       "5.212.48.0/20"};
+const cidr4_t mci_ip_ranges4[] = {
+    CIDR4(5, 215, 128, 0, 18),   CIDR4(5, 215, 128, 0, 17),   CIDR4(178, 131, 192, 0, 18), CIDR4(5, 217, 112, 0, 20),
+    CIDR4(5, 214, 176, 0, 20),   CIDR4(5, 216, 192, 0, 18),   CIDR4(31, 2, 128, 0, 18),    CIDR4(89, 198, 144, 0, 20),
+    CIDR4(5, 217, 0, 0, 18),     CIDR4(5, 209, 32, 0, 20),    CIDR4(91, 133, 128, 0, 17),  CIDR4(89, 196, 208, 0, 20),
+    CIDR4(5, 201, 192, 0, 20),   CIDR4(5, 216, 32, 0, 20),    CIDR4(5, 217, 64, 0, 18),    CIDR4(83, 120, 128, 0, 20),
+    CIDR4(5, 210, 192, 0, 20),   CIDR4(5, 210, 64, 0, 20),    CIDR4(5, 211, 224, 0, 20),   CIDR4(91, 251, 32, 0, 20),
+    CIDR4(5, 52, 48, 0, 20),     CIDR4(83, 123, 192, 0, 20),  CIDR4(5, 106, 128, 0, 17),   CIDR4(5, 217, 192, 0, 18),
+    CIDR4(83, 120, 80, 0, 20),   CIDR4(192, 15, 0, 0, 20),    CIDR4(5, 52, 80, 0, 20),     CIDR4(188, 209, 192, 0, 24),
+    CIDR4(172, 80, 128, 0, 18),  CIDR4(5, 211, 32, 0, 20),    CIDR4(192, 15, 96, 0, 20),   CIDR4(5, 214, 160, 0, 20),
+    CIDR4(37, 63, 224, 0, 20),   CIDR4(86, 107, 0, 0, 24),    CIDR4(204, 18, 112, 0, 20),  CIDR4(89, 45, 49, 0, 24),
+    CIDR4(5, 106, 32, 0, 20),    CIDR4(5, 52, 0, 0, 20),      CIDR4(93, 110, 128, 0, 18),  CIDR4(5, 210, 96, 0, 20),
+    CIDR4(5, 213, 208, 0, 20),   CIDR4(83, 123, 64, 0, 20),   CIDR4(5, 217, 128, 0, 17),   CIDR4(172, 80, 144, 0, 20),
+    CIDR4(37, 129, 48, 0, 20),   CIDR4(5, 212, 192, 0, 20),   CIDR4(5, 217, 240, 0, 20),   CIDR4(91, 133, 224, 0, 20),
+    CIDR4(5, 106, 224, 0, 20),   CIDR4(93, 110, 176, 0, 20),  CIDR4(91, 251, 176, 0, 20),  CIDR4(5, 208, 0, 0, 17),
+    CIDR4(69, 194, 112, 0, 20),  CIDR4(5, 217, 64, 0, 20),    CIDR4(5, 52, 64, 0, 20),     CIDR4(5, 209, 80, 0, 20),
+    CIDR4(5, 216, 64, 0, 18),    CIDR4(89, 196, 144, 0, 20),  CIDR4(83, 120, 176, 0, 20),  CIDR4(83, 123, 192, 0, 18),
+    CIDR4(109, 108, 160, 0, 20), CIDR4(192, 15, 240, 0, 20),  CIDR4(5, 22, 64, 0, 18),     CIDR4(5, 216, 80, 0, 20),
+    CIDR4(204, 18, 80, 0, 20),   CIDR4(83, 121, 0, 0, 20),    CIDR4(89, 196, 16, 0, 20),   CIDR4(89, 199, 128, 0, 20),
+    CIDR4(5, 22, 32, 0, 20),     CIDR4(5, 214, 96, 0, 20),    CIDR4(86, 107, 8, 0, 21),    CIDR4(185, 131, 56, 0, 22),
+    CIDR4(89, 196, 96, 0, 20),   CIDR4(158, 58, 96, 0, 20),   CIDR4(37, 129, 192, 0, 18),  CIDR4(5, 212, 224, 0, 20),
+    CIDR4(91, 133, 240, 0, 20),  CIDR4(158, 58, 64, 0, 20),   CIDR4(188, 229, 64, 0, 20),  CIDR4(5, 214, 0, 0, 17),
+    CIDR4(192, 15, 16, 0, 20),   CIDR4(5, 22, 48, 0, 20),     CIDR4(5, 52, 96, 0, 20),     CIDR4(86, 107, 1, 0, 24),
+    CIDR4(86, 55, 112, 0, 20),   CIDR4(89, 199, 192, 0, 20),  CIDR4(93, 110, 208, 0, 20),  CIDR4(113, 203, 0, 0, 20),
+    CIDR4(93, 110, 192, 0, 20),  CIDR4(5, 215, 192, 0, 20),   CIDR4(178, 131, 224, 0, 20), CIDR4(5, 106, 0, 0, 21),
+    CIDR4(5, 214, 128, 0, 20),   CIDR4(89, 196, 0, 0, 20),    CIDR4(83, 120, 0, 0, 20),    CIDR4(86, 107, 208, 0, 20),
+    CIDR4(46, 164, 64, 0, 20),   CIDR4(5, 208, 16, 0, 20),    CIDR4(5, 214, 240, 0, 20),   CIDR4(83, 122, 208, 0, 20),
+    CIDR4(204, 18, 224, 0, 20),  CIDR4(5, 209, 208, 0, 20),   CIDR4(5, 250, 0, 0, 18),     CIDR4(37, 129, 112, 0, 20),
+    CIDR4(5, 208, 1, 0, 24),     CIDR4(5, 213, 0, 0, 20),     CIDR4(158, 58, 0, 0, 18),    CIDR4(5, 52, 128, 0, 20),
+    CIDR4(5, 214, 16, 0, 20),    CIDR4(91, 251, 128, 0, 20),  CIDR4(204, 18, 240, 0, 20),  CIDR4(5, 211, 0, 0, 17),
+    CIDR4(5, 214, 32, 0, 20),    CIDR4(5, 22, 112, 0, 20),    CIDR4(5, 212, 208, 0, 20),   CIDR4(83, 121, 160, 0, 20),
+    CIDR4(5, 216, 176, 0, 20),   CIDR4(91, 251, 16, 0, 20),   CIDR4(46, 51, 64, 0, 20),    CIDR4(89, 198, 208, 0, 20),
+    CIDR4(113, 203, 0, 0, 17),   CIDR4(113, 203, 80, 0, 20),  CIDR4(89, 196, 48, 0, 20),   CIDR4(89, 198, 64, 0, 20),
+    CIDR4(5, 22, 80, 0, 20),     CIDR4(37, 129, 64, 0, 20),   CIDR4(83, 122, 160, 0, 20),  CIDR4(37, 63, 240, 0, 20),
+    CIDR4(46, 164, 80, 0, 20),   CIDR4(5, 210, 112, 0, 20),   CIDR4(86, 107, 211, 0, 24),  CIDR4(37, 63, 144, 0, 20),
+    CIDR4(95, 64, 64, 0, 20),    CIDR4(5, 217, 48, 0, 20),    CIDR4(5, 209, 240, 0, 20),   CIDR4(5, 52, 192, 0, 20),
+    CIDR4(188, 212, 48, 0, 20),  CIDR4(37, 98, 0, 0, 20),     CIDR4(158, 58, 64, 0, 19),   CIDR4(192, 15, 0, 0, 18),
+    CIDR4(5, 52, 112, 0, 20),    CIDR4(188, 210, 192, 0, 20), CIDR4(91, 251, 64, 0, 20),   CIDR4(5, 215, 176, 0, 20),
+    CIDR4(5, 210, 176, 0, 20),   CIDR4(5, 214, 80, 0, 20),    CIDR4(204, 18, 0, 0, 20),    CIDR4(82, 180, 224, 0, 20),
+    CIDR4(5, 213, 32, 0, 20),    CIDR4(5, 106, 17, 0, 24),    CIDR4(5, 209, 160, 0, 20),   CIDR4(31, 2, 128, 0, 20),
+    CIDR4(188, 210, 64, 0, 20),  CIDR4(5, 215, 0, 0, 17),     CIDR4(185, 22, 29, 0, 24),   CIDR4(172, 80, 252, 0, 24),
+    CIDR4(83, 121, 16, 0, 20),   CIDR4(86, 55, 0, 0, 20),     CIDR4(5, 214, 128, 0, 18),   CIDR4(91, 133, 208, 0, 20),
+    CIDR4(93, 110, 192, 0, 18),  CIDR4(158, 58, 64, 0, 18),   CIDR4(83, 120, 64, 0, 20),   CIDR4(5, 106, 32, 0, 19),
+    CIDR4(5, 217, 96, 0, 20),    CIDR4(93, 110, 0, 0, 18),    CIDR4(204, 18, 192, 0, 18),  CIDR4(89, 199, 208, 0, 20),
+    CIDR4(188, 209, 192, 0, 20), CIDR4(89, 45, 53, 0, 24),    CIDR4(5, 216, 240, 0, 20),   CIDR4(158, 58, 80, 0, 20),
+    CIDR4(5, 211, 208, 0, 20),   CIDR4(5, 213, 112, 0, 20),   CIDR4(5, 215, 16, 0, 20),    CIDR4(158, 58, 0, 0, 20),
+    CIDR4(5, 106, 14, 0, 24),    CIDR4(204, 18, 208, 0, 20),  CIDR4(37, 129, 128, 0, 17),  CIDR4(5, 210, 128, 0, 20),
+    CIDR4(5, 201, 240, 0, 20),   CIDR4(89, 198, 48, 0, 20),   CIDR4(5, 208, 0, 0, 16),     CIDR4(5, 209, 192, 0, 20),
+    CIDR4(204, 18, 96, 0, 20),   CIDR4(86, 107, 4, 0, 23),    CIDR4(83, 121, 96, 0, 20),   CIDR4(5, 215, 0, 0, 18),
+    CIDR4(188, 229, 48, 0, 20),  CIDR4(5, 106, 7, 0, 24),     CIDR4(204, 18, 32, 0, 20),   CIDR4(109, 203, 128, 0, 20),
+    CIDR4(83, 122, 240, 0, 20),  CIDR4(5, 214, 208, 0, 20),   CIDR4(82, 180, 192, 0, 20),  CIDR4(85, 239, 192, 0, 20),
+    CIDR4(5, 208, 128, 0, 17),   CIDR4(31, 2, 208, 0, 20),    CIDR4(5, 218, 96, 0, 20),    CIDR4(83, 122, 0, 0, 16),
+    CIDR4(37, 129, 64, 0, 18),   CIDR4(93, 110, 48, 0, 20),   CIDR4(5, 106, 5, 0, 24),     CIDR4(83, 122, 0, 0, 18),
+    CIDR4(37, 63, 160, 0, 20),   CIDR4(46, 51, 112, 0, 20),   CIDR4(5, 52, 208, 0, 20),    CIDR4(5, 208, 96, 0, 20),
+    CIDR4(5, 218, 176, 0, 20),   CIDR4(5, 212, 160, 0, 20),   CIDR4(172, 80, 192, 0, 20),  CIDR4(5, 213, 80, 0, 20),
+    CIDR4(113, 203, 0, 0, 18),   CIDR4(93, 110, 0, 0, 17),    CIDR4(5, 209, 128, 0, 17),   CIDR4(93, 110, 32, 0, 20),
+    CIDR4(5, 212, 0, 0, 18),     CIDR4(5, 106, 240, 0, 20),   CIDR4(95, 64, 16, 0, 20),    CIDR4(83, 122, 96, 0, 20),
+    CIDR4(5, 210, 144, 0, 20),   CIDR4(109, 225, 176, 0, 20), CIDR4(164, 138, 176, 0, 20), CIDR4(93, 110, 160, 0, 20),
+    CIDR4(31, 2, 192, 0, 18),    CIDR4(86, 55, 48, 0, 20),    CIDR4(204, 18, 160, 0, 20),  CIDR4(5, 213, 176, 0, 20),
+    CIDR4(5, 106, 128, 0, 20),   CIDR4(93, 110, 80, 0, 20),   CIDR4(83, 120, 48, 0, 20),   CIDR4(158, 58, 32, 0, 20),
+    CIDR4(5, 106, 50, 0, 24),    CIDR4(5, 218, 64, 0, 20),    CIDR4(5, 250, 32, 0, 20),    CIDR4(89, 198, 0, 0, 17),
+    CIDR4(83, 122, 64, 0, 18),   CIDR4(89, 196, 64, 0, 20),   CIDR4(192, 15, 128, 0, 18),  CIDR4(37, 129, 160, 0, 20),
+    CIDR4(83, 121, 64, 0, 20),   CIDR4(172, 80, 192, 0, 18),  CIDR4(5, 209, 0, 0, 16),     CIDR4(188, 229, 117, 0, 24),
+    CIDR4(91, 251, 0, 0, 17),    CIDR4(5, 106, 192, 0, 20),   CIDR4(91, 251, 96, 0, 20),   CIDR4(5, 106, 24, 0, 22),
+    CIDR4(91, 251, 240, 0, 20),  CIDR4(89, 196, 128, 0, 17),  CIDR4(37, 129, 176, 0, 20),  CIDR4(89, 45, 48, 0, 20),
+    CIDR4(172, 80, 255, 0, 24),  CIDR4(5, 213, 128, 0, 18),   CIDR4(5, 218, 160, 0, 20),   CIDR4(86, 55, 160, 0, 20),
+    CIDR4(164, 138, 160, 0, 19), CIDR4(188, 122, 96, 0, 20),  CIDR4(5, 211, 192, 0, 20),   CIDR4(5, 215, 144, 0, 20),
+    CIDR4(83, 122, 48, 0, 20),   CIDR4(94, 101, 240, 0, 20),  CIDR4(192, 15, 0, 0, 17),    CIDR4(5, 106, 80, 0, 20),
+    CIDR4(86, 55, 192, 0, 20),   CIDR4(85, 239, 208, 0, 20),  CIDR4(5, 214, 0, 0, 18),     CIDR4(89, 196, 160, 0, 20),
+    CIDR4(5, 106, 176, 0, 20),   CIDR4(5, 212, 144, 0, 20),   CIDR4(5, 217, 80, 0, 20),    CIDR4(204, 18, 144, 0, 20),
+    CIDR4(130, 255, 192, 0, 20), CIDR4(69, 194, 64, 0, 18),   CIDR4(5, 106, 23, 0, 24),    CIDR4(83, 120, 144, 0, 20),
+    CIDR4(5, 250, 16, 0, 20),    CIDR4(83, 121, 48, 0, 20),   CIDR4(5, 212, 16, 0, 20),    CIDR4(83, 122, 128, 0, 20),
+    CIDR4(5, 208, 176, 0, 20),   CIDR4(37, 129, 80, 0, 20),   CIDR4(5, 218, 224, 0, 20),   CIDR4(46, 51, 36, 0, 24),
+    CIDR4(5, 106, 9, 0, 24),     CIDR4(89, 199, 80, 0, 20),   CIDR4(37, 129, 128, 0, 18),  CIDR4(95, 64, 48, 0, 20),
+    CIDR4(5, 214, 112, 0, 20),   CIDR4(83, 121, 80, 0, 20),   CIDR4(192, 15, 208, 0, 20),  CIDR4(31, 2, 224, 0, 20),
+    CIDR4(86, 55, 96, 0, 20),    CIDR4(192, 15, 160, 0, 20),  CIDR4(5, 213, 64, 0, 20),    CIDR4(5, 215, 208, 0, 20),
+    CIDR4(5, 218, 32, 0, 20),    CIDR4(5, 52, 0, 0, 16),      CIDR4(5, 208, 0, 0, 20),     CIDR4(89, 199, 32, 0, 20),
+    CIDR4(192, 15, 80, 0, 20),   CIDR4(46, 51, 96, 0, 20),    CIDR4(89, 199, 224, 0, 20),  CIDR4(91, 251, 48, 0, 20),
+    CIDR4(5, 218, 16, 0, 20),    CIDR4(5, 218, 208, 0, 20),   CIDR4(83, 123, 16, 0, 20),   CIDR4(164, 138, 130, 0, 24),
+    CIDR4(5, 209, 144, 0, 20),   CIDR4(95, 64, 112, 0, 20),   CIDR4(89, 196, 240, 0, 20),  CIDR4(5, 213, 192, 0, 18),
+    CIDR4(5, 106, 52, 0, 24),    CIDR4(5, 250, 112, 0, 20),   CIDR4(89, 196, 0, 0, 17),    CIDR4(5, 211, 0, 0, 20),
+    CIDR4(5, 213, 128, 0, 20),   CIDR4(109, 108, 176, 0, 20), CIDR4(5, 216, 224, 0, 20),   CIDR4(130, 255, 240, 0, 20),
+    CIDR4(89, 196, 176, 0, 20),  CIDR4(5, 213, 144, 0, 20),   CIDR4(5, 213, 64, 0, 18),    CIDR4(5, 216, 208, 0, 20),
+    CIDR4(5, 216, 128, 0, 20),   CIDR4(204, 18, 128, 0, 20),  CIDR4(192, 15, 112, 0, 20),  CIDR4(5, 211, 160, 0, 20),
+    CIDR4(5, 215, 160, 0, 20),   CIDR4(188, 229, 0, 0, 18),   CIDR4(130, 255, 224, 0, 20), CIDR4(37, 63, 192, 0, 18),
+    CIDR4(89, 45, 48, 0, 24),    CIDR4(37, 63, 208, 0, 20),   CIDR4(5, 106, 16, 0, 20),    CIDR4(37, 129, 16, 0, 20),
+    CIDR4(5, 250, 96, 0, 20),    CIDR4(83, 122, 32, 0, 20),   CIDR4(83, 120, 128, 0, 17),  CIDR4(83, 122, 176, 0, 20),
+    CIDR4(89, 196, 0, 0, 16),    CIDR4(91, 251, 192, 0, 20),  CIDR4(93, 110, 112, 0, 20),  CIDR4(93, 110, 128, 0, 17),
+    CIDR4(5, 211, 128, 0, 17),   CIDR4(5, 52, 16, 0, 20),     CIDR4(5, 201, 192, 0, 18),   CIDR4(5, 106, 2, 0, 24),
+    CIDR4(5, 210, 0, 0, 16),     CIDR4(5, 215, 224, 0, 20),   CIDR4(192, 15, 192, 0, 18),  CIDR4(86, 55, 0, 0, 17),
+    CIDR4(37, 129, 240, 0, 20),  CIDR4(89, 199, 96, 0, 20),   CIDR4(5, 250, 80, 0, 20),    CIDR4(37, 98, 48, 0, 20),
+    CIDR4(5, 213, 160, 0, 20),   CIDR4(83, 122, 0, 0, 17),    CIDR4(5, 211, 112, 0, 20),   CIDR4(5, 212, 64, 0, 20),
+    CIDR4(83, 122, 16, 0, 20),   CIDR4(5, 218, 0, 0, 20),     CIDR4(5, 217, 0, 0, 20),     CIDR4(31, 2, 160, 0, 20),
+    CIDR4(5, 211, 240, 0, 20),   CIDR4(86, 55, 240, 0, 20),   CIDR4(113, 203, 16, 0, 20),  CIDR4(5, 215, 0, 0, 20),
+    CIDR4(5, 214, 192, 0, 20),   CIDR4(83, 123, 48, 0, 20),   CIDR4(89, 199, 112, 0, 20),  CIDR4(5, 52, 240, 0, 20),
+    CIDR4(5, 212, 96, 0, 20),    CIDR4(5, 218, 80, 0, 20),    CIDR4(37, 129, 192, 0, 20),  CIDR4(5, 216, 0, 0, 17),
+    CIDR4(89, 196, 128, 0, 20),  CIDR4(192, 15, 128, 0, 20),  CIDR4(91, 133, 176, 0, 20),  CIDR4(176, 65, 192, 0, 19),
+    CIDR4(83, 120, 224, 0, 20),  CIDR4(192, 15, 176, 0, 20),  CIDR4(5, 250, 0, 0, 20),     CIDR4(37, 129, 208, 0, 20),
+    CIDR4(83, 121, 0, 0, 16),    CIDR4(83, 123, 128, 0, 20),  CIDR4(188, 122, 96, 0, 19),  CIDR4(172, 80, 240, 0, 20),
+    CIDR4(83, 122, 64, 0, 20),   CIDR4(83, 123, 128, 0, 18),  CIDR4(5, 214, 144, 0, 20),   CIDR4(5, 106, 28, 0, 24),
+    CIDR4(5, 217, 128, 0, 20),   CIDR4(5, 218, 128, 0, 20),   CIDR4(83, 123, 160, 0, 20),  CIDR4(5, 212, 80, 0, 20),
+    CIDR4(5, 52, 160, 0, 20),    CIDR4(5, 214, 0, 0, 16),     CIDR4(37, 98, 0, 0, 18),     CIDR4(95, 64, 96, 0, 20),
+    CIDR4(5, 216, 192, 0, 20),   CIDR4(83, 122, 128, 0, 17),  CIDR4(109, 203, 144, 0, 20), CIDR4(5, 212, 0, 0, 17),
+    CIDR4(37, 129, 128, 0, 20),  CIDR4(5, 208, 224, 0, 20),   CIDR4(5, 106, 160, 0, 20),   CIDR4(5, 208, 192, 0, 20),
+    CIDR4(5, 210, 224, 0, 20),   CIDR4(5, 218, 112, 0, 20),   CIDR4(113, 203, 96, 0, 20),  CIDR4(46, 51, 64, 0, 18),
+    CIDR4(89, 199, 0, 0, 17),    CIDR4(93, 110, 144, 0, 20),  CIDR4(185, 5, 159, 0, 24),   CIDR4(89, 198, 224, 0, 20),
+    CIDR4(83, 123, 0, 0, 16),    CIDR4(5, 22, 0, 0, 20),      CIDR4(5, 208, 80, 0, 20),    CIDR4(5, 215, 112, 0, 20),
+    CIDR4(83, 123, 112, 0, 20),  CIDR4(89, 199, 144, 0, 20),  CIDR4(5, 212, 128, 0, 18),   CIDR4(89, 198, 192, 0, 20),
+    CIDR4(89, 198, 96, 0, 20),   CIDR4(83, 123, 176, 0, 20),  CIDR4(69, 194, 80, 0, 20),   CIDR4(89, 199, 128, 0, 17),
+    CIDR4(192, 15, 64, 0, 20),   CIDR4(5, 216, 16, 0, 20),    CIDR4(113, 203, 64, 0, 18),  CIDR4(93, 110, 0, 0, 20),
+    CIDR4(5, 106, 0, 0, 16),     CIDR4(69, 194, 96, 0, 20),   CIDR4(69, 194, 64, 0, 20),   CIDR4(113, 203, 32, 0, 20),
+    CIDR4(83, 120, 160, 0, 20),  CIDR4(5, 215, 96, 0, 20),    CIDR4(5, 212, 176, 0, 20),   CIDR4(164, 138, 160, 0, 20),
+    CIDR4(37, 63, 176, 0, 20),   CIDR4(5, 106, 22, 0, 24),    CIDR4(5, 210, 0, 0, 20),     CIDR4(5, 106, 96, 0, 20),
+    CIDR4(5, 208, 32, 0, 20),    CIDR4(83, 120, 32, 0, 20),   CIDR4(86, 55, 80, 0, 20),    CIDR4(95, 64, 32, 0, 20),
+    CIDR4(5, 106, 12, 0, 24),    CIDR4(5, 106, 0, 0, 24),     CIDR4(83, 120, 192, 0, 20),  CIDR4(89, 45, 52, 0, 24),
+    CIDR4(5, 213, 0, 0, 17),     CIDR4(172, 80, 192, 0, 19),  CIDR4(91, 251, 0, 0, 16),    CIDR4(5, 211, 80, 0, 20),
+    CIDR4(5, 218, 0, 0, 17),     CIDR4(82, 180, 192, 0, 18),  CIDR4(83, 120, 240, 0, 20),  CIDR4(83, 122, 192, 0, 20),
+    CIDR4(5, 216, 0, 0, 16),     CIDR4(91, 133, 160, 0, 20),  CIDR4(91, 251, 0, 0, 20),    CIDR4(5, 22, 16, 0, 20),
+    CIDR4(5, 215, 64, 0, 18),    CIDR4(93, 110, 64, 0, 18),   CIDR4(158, 58, 48, 0, 20),   CIDR4(93, 110, 240, 0, 20),
+    CIDR4(5, 208, 128, 0, 20),   CIDR4(83, 120, 16, 0, 20),   CIDR4(5, 216, 0, 0, 20),     CIDR4(5, 213, 48, 0, 20),
+    CIDR4(83, 121, 208, 0, 20),  CIDR4(46, 51, 16, 0, 20),    CIDR4(5, 217, 128, 0, 18),   CIDR4(83, 120, 96, 0, 20),
+    CIDR4(109, 225, 160, 0, 20), CIDR4(89, 198, 0, 0, 16),    CIDR4(89, 199, 240, 0, 20),  CIDR4(109, 108, 160, 0, 19),
+    CIDR4(93, 110, 128, 0, 20),  CIDR4(113, 203, 112, 0, 20), CIDR4(5, 210, 128, 0, 17),   CIDR4(204, 18, 64, 0, 18),
+    CIDR4(5, 209, 176, 0, 20),   CIDR4(5, 215, 240, 0, 20),   CIDR4(83, 121, 192, 0, 20),  CIDR4(5, 209, 0, 0, 17),
+    CIDR4(5, 215, 32, 0, 20),    CIDR4(5, 210, 208, 0, 20),   CIDR4(37, 129, 0, 0, 20),    CIDR4(5, 213, 96, 0, 20),
+    CIDR4(95, 64, 0, 0, 18),     CIDR4(5, 213, 0, 0, 16),     CIDR4(188, 229, 116, 0, 24), CIDR4(5, 217, 176, 0, 20),
+    CIDR4(83, 121, 176, 0, 20),  CIDR4(5, 22, 0, 0, 18),      CIDR4(91, 251, 160, 0, 20),  CIDR4(89, 198, 112, 0, 20),
+    CIDR4(109, 225, 144, 0, 20), CIDR4(37, 63, 128, 0, 20),   CIDR4(83, 122, 80, 0, 20),   CIDR4(91, 251, 112, 0, 20),
+    CIDR4(91, 133, 192, 0, 18),  CIDR4(89, 198, 176, 0, 20),  CIDR4(83, 121, 128, 0, 20),  CIDR4(83, 123, 96, 0, 20),
+    CIDR4(89, 45, 51, 0, 24),    CIDR4(5, 208, 160, 0, 20),   CIDR4(5, 210, 32, 0, 20),    CIDR4(5, 211, 176, 0, 20),
+    CIDR4(158, 58, 32, 0, 19),   CIDR4(5, 212, 64, 0, 18),    CIDR4(5, 210, 80, 0, 20),    CIDR4(86, 55, 0, 0, 16),
+    CIDR4(5, 217, 16, 0, 20),    CIDR4(5, 22, 0, 0, 17),      CIDR4(5, 106, 0, 0, 17),     CIDR4(204, 18, 128, 0, 18),
+    CIDR4(5, 106, 4, 0, 24),     CIDR4(5, 214, 64, 0, 18),    CIDR4(46, 51, 0, 0, 20),     CIDR4(89, 198, 0, 0, 20),
+    CIDR4(89, 198, 16, 0, 20),   CIDR4(91, 133, 192, 0, 20),  CIDR4(95, 64, 0, 0, 20),     CIDR4(89, 196, 112, 0, 20),
+    CIDR4(5, 217, 224, 0, 20),   CIDR4(93, 110, 64, 0, 20),   CIDR4(5, 215, 80, 0, 20),    CIDR4(31, 2, 176, 0, 20),
+    CIDR4(83, 122, 112, 0, 20),  CIDR4(86, 55, 208, 0, 20),   CIDR4(5, 208, 48, 0, 20),    CIDR4(5, 208, 240, 0, 20),
+    CIDR4(5, 214, 64, 0, 20),    CIDR4(89, 199, 16, 0, 20),   CIDR4(5, 209, 48, 0, 20),    CIDR4(83, 123, 224, 0, 20),
+    CIDR4(5, 212, 0, 0, 20),     CIDR4(83, 121, 0, 0, 17),    CIDR4(83, 121, 32, 0, 20),   CIDR4(109, 225, 128, 0, 18),
+    CIDR4(5, 212, 192, 0, 18),   CIDR4(5, 213, 128, 0, 17),   CIDR4(5, 218, 0, 0, 16),     CIDR4(5, 106, 13, 0, 24),
+    CIDR4(89, 198, 160, 0, 20),  CIDR4(5, 217, 0, 0, 17),     CIDR4(5, 52, 32, 0, 20),     CIDR4(5, 216, 128, 0, 17),
+    CIDR4(37, 63, 128, 0, 18),   CIDR4(5, 214, 192, 0, 18),   CIDR4(86, 107, 0, 0, 23),    CIDR4(91, 133, 128, 0, 18),
+    CIDR4(91, 133, 128, 0, 20),  CIDR4(5, 209, 224, 0, 20),   CIDR4(83, 122, 128, 0, 18),  CIDR4(5, 209, 16, 0, 20),
+    CIDR4(172, 80, 160, 0, 20),  CIDR4(83, 121, 240, 0, 20),  CIDR4(5, 209, 112, 0, 20),   CIDR4(188, 229, 32, 0, 20),
+    CIDR4(5, 209, 128, 0, 20),   CIDR4(172, 80, 176, 0, 20),  CIDR4(46, 164, 64, 0, 18),   CIDR4(89, 199, 0, 0, 16),
+    CIDR4(188, 229, 80, 0, 20),  CIDR4(37, 129, 144, 0, 20),  CIDR4(93, 110, 16, 0, 20),   CIDR4(5, 211, 64, 0, 20),
+    CIDR4(5, 213, 16, 0, 20),    CIDR4(83, 121, 144, 0, 20),  CIDR4(188, 229, 16, 0, 20),  CIDR4(5, 214, 0, 0, 20),
+    CIDR4(5, 215, 64, 0, 20),    CIDR4(5, 106, 10, 0, 24),    CIDR4(188, 229, 0, 0, 20),   CIDR4(158, 58, 16, 0, 20),
+    CIDR4(5, 216, 144, 0, 20),   CIDR4(46, 164, 112, 0, 20),  CIDR4(5, 106, 112, 0, 20),   CIDR4(5, 250, 0, 0, 17),
+    CIDR4(188, 212, 48, 0, 24),  CIDR4(93, 110, 224, 0, 20),  CIDR4(37, 129, 0, 0, 18),    CIDR4(192, 15, 224, 0, 20),
+    CIDR4(5, 214, 224, 0, 20),   CIDR4(5, 52, 224, 0, 20),    CIDR4(5, 106, 64, 0, 20),    CIDR4(5, 201, 208, 0, 20),
+    CIDR4(37, 63, 128, 0, 17),   CIDR4(83, 123, 80, 0, 20),   CIDR4(204, 18, 0, 0, 16),    CIDR4(204, 18, 48, 0, 20),
+    CIDR4(5, 218, 192, 0, 20),   CIDR4(46, 164, 96, 0, 20),   CIDR4(5, 106, 29, 0, 24),    CIDR4(82, 180, 240, 0, 20),
+    CIDR4(5, 213, 0, 0, 18),     CIDR4(188, 229, 0, 0, 17),   CIDR4(5, 217, 144, 0, 20),   CIDR4(192, 15, 192, 0, 20),
+    CIDR4(37, 129, 0, 0, 16),    CIDR4(83, 120, 0, 0, 17),    CIDR4(204, 18, 176, 0, 20),  CIDR4(5, 106, 0, 0, 20),
+    CIDR4(5, 106, 64, 0, 18),    CIDR4(5, 209, 96, 0, 20),    CIDR4(5, 250, 64, 0, 18),    CIDR4(91, 251, 224, 0, 20),
+    CIDR4(172, 80, 208, 0, 20),  CIDR4(185, 5, 156, 0, 22),   CIDR4(89, 199, 48, 0, 20),   CIDR4(5, 106, 8, 0, 24),
+    CIDR4(5, 52, 128, 0, 17),    CIDR4(5, 106, 144, 0, 20),   CIDR4(5, 216, 112, 0, 20),   CIDR4(83, 120, 0, 0, 16),
+    CIDR4(86, 55, 32, 0, 20),    CIDR4(37, 129, 96, 0, 20),   CIDR4(91, 251, 128, 0, 17),  CIDR4(113, 203, 64, 0, 20),
+    CIDR4(5, 210, 240, 0, 20),   CIDR4(95, 64, 64, 0, 18),    CIDR4(83, 122, 0, 0, 20),    CIDR4(5, 209, 0, 0, 20),
+    CIDR4(80, 242, 0, 0, 20),    CIDR4(5, 208, 208, 0, 20),   CIDR4(204, 18, 0, 0, 18),    CIDR4(5, 210, 0, 0, 17),
+    CIDR4(5, 217, 160, 0, 20),   CIDR4(86, 55, 176, 0, 20),   CIDR4(86, 107, 2, 0, 23),    CIDR4(5, 52, 144, 0, 20),
+    CIDR4(83, 123, 64, 0, 18),   CIDR4(89, 198, 240, 0, 20),  CIDR4(158, 58, 0, 0, 17),    CIDR4(5, 210, 160, 0, 20),
+    CIDR4(5, 217, 192, 0, 20),   CIDR4(31, 2, 240, 0, 20),    CIDR4(83, 121, 112, 0, 20),  CIDR4(86, 55, 224, 0, 20),
+    CIDR4(5, 211, 0, 0, 16),     CIDR4(5, 216, 64, 0, 20),    CIDR4(5, 218, 240, 0, 20),   CIDR4(86, 55, 128, 0, 17),
+    CIDR4(89, 196, 32, 0, 20),   CIDR4(5, 212, 128, 0, 17),   CIDR4(89, 198, 32, 0, 20),   CIDR4(192, 15, 0, 0, 16),
+    CIDR4(172, 80, 253, 0, 24),  CIDR4(192, 15, 64, 0, 18),   CIDR4(5, 211, 128, 0, 20),   CIDR4(86, 55, 16, 0, 20),
+    CIDR4(178, 131, 208, 0, 20), CIDR4(5, 217, 208, 0, 20),   CIDR4(5, 106, 20, 0, 24),    CIDR4(91, 251, 144, 0, 20),
+    CIDR4(83, 120, 208, 0, 20),  CIDR4(5, 215, 128, 0, 20),   CIDR4(185, 5, 157, 0, 24),   CIDR4(5, 211, 144, 0, 20),
+    CIDR4(91, 251, 208, 0, 20),  CIDR4(86, 107, 208, 0, 24),  CIDR4(5, 22, 64, 0, 20),     CIDR4(5, 214, 48, 0, 20),
+    CIDR4(5, 215, 192, 0, 18),   CIDR4(37, 129, 0, 0, 17),    CIDR4(89, 199, 160, 0, 20),  CIDR4(5, 216, 160, 0, 20),
+    CIDR4(5, 208, 144, 0, 20),   CIDR4(83, 121, 128, 0, 17),  CIDR4(86, 55, 128, 0, 20),   CIDR4(5, 213, 224, 0, 20),
+    CIDR4(5, 217, 32, 0, 20),    CIDR4(204, 18, 192, 0, 20),  CIDR4(5, 212, 240, 0, 20),   CIDR4(109, 203, 128, 0, 19),
+    CIDR4(172, 80, 254, 0, 24),  CIDR4(5, 212, 32, 0, 20),    CIDR4(192, 15, 32, 0, 20),   CIDR4(5, 106, 15, 0, 24),
+    CIDR4(89, 198, 128, 0, 17),  CIDR4(130, 255, 192, 0, 18), CIDR4(5, 212, 128, 0, 20),   CIDR4(5, 216, 128, 0, 18),
+    CIDR4(93, 110, 96, 0, 20),   CIDR4(5, 106, 6, 0, 24),     CIDR4(172, 80, 128, 0, 20),  CIDR4(5, 218, 128, 0, 17),
+    CIDR4(164, 138, 128, 0, 18), CIDR4(5, 106, 16, 0, 24),    CIDR4(83, 120, 112, 0, 20),  CIDR4(89, 199, 0, 0, 20),
+    CIDR4(83, 123, 128, 0, 17),  CIDR4(5, 209, 64, 0, 20),    CIDR4(91, 133, 144, 0, 20),  CIDR4(204, 18, 64, 0, 20),
+    CIDR4(185, 5, 156, 0, 24),   CIDR4(5, 52, 176, 0, 20),    CIDR4(37, 98, 16, 0, 20),    CIDR4(89, 198, 80, 0, 20),
+    CIDR4(5, 208, 64, 0, 20),    CIDR4(5, 210, 16, 0, 20),    CIDR4(5, 106, 11, 0, 24),    CIDR4(5, 214, 128, 0, 17),
+    CIDR4(37, 129, 224, 0, 20),  CIDR4(5, 250, 64, 0, 20),    CIDR4(31, 2, 192, 0, 20),    CIDR4(82, 180, 208, 0, 20),
+    CIDR4(5, 218, 144, 0, 20),   CIDR4(89, 196, 80, 0, 20),   CIDR4(5, 216, 0, 0, 18),     CIDR4(83, 123, 32, 0, 20),
+    CIDR4(89, 45, 54, 0, 24),    CIDR4(89, 196, 192, 0, 20),  CIDR4(37, 63, 192, 0, 20),   CIDR4(178, 131, 240, 0, 20),
+    CIDR4(91, 251, 80, 0, 20),   CIDR4(5, 208, 112, 0, 20),   CIDR4(46, 51, 80, 0, 20),    CIDR4(5, 213, 240, 0, 20),
+    CIDR4(158, 58, 96, 0, 19),   CIDR4(204, 18, 16, 0, 20),   CIDR4(93, 110, 0, 0, 16),    CIDR4(5, 216, 48, 0, 20),
+    CIDR4(158, 58, 0, 0, 19),    CIDR4(192, 15, 128, 0, 17),  CIDR4(83, 123, 0, 0, 17),    CIDR4(130, 255, 208, 0, 20),
+    CIDR4(89, 196, 224, 0, 20),  CIDR4(5, 211, 16, 0, 20),    CIDR4(37, 129, 32, 0, 20),   CIDR4(109, 225, 128, 0, 20),
+    CIDR4(158, 58, 112, 0, 20),  CIDR4(89, 198, 128, 0, 20),  CIDR4(83, 123, 0, 0, 18),    CIDR4(5, 211, 96, 0, 20),
+    CIDR4(83, 122, 144, 0, 20),  CIDR4(83, 123, 144, 0, 20),  CIDR4(5, 201, 224, 0, 20),   CIDR4(5, 212, 112, 0, 20),
+    CIDR4(86, 55, 64, 0, 20),    CIDR4(86, 55, 144, 0, 20),   CIDR4(5, 210, 48, 0, 20),    CIDR4(172, 80, 128, 0, 17),
+    CIDR4(5, 215, 48, 0, 20),    CIDR4(5, 22, 96, 0, 20),     CIDR4(31, 2, 128, 0, 17),    CIDR4(178, 131, 192, 0, 20),
+    CIDR4(31, 2, 144, 0, 20),    CIDR4(95, 64, 80, 0, 20),    CIDR4(5, 211, 48, 0, 20),    CIDR4(5, 216, 96, 0, 20),
+    CIDR4(83, 123, 0, 0, 20),    CIDR4(172, 80, 224, 0, 20),  CIDR4(89, 199, 64, 0, 20),   CIDR4(5, 213, 192, 0, 20),
+    CIDR4(89, 199, 176, 0, 20),  CIDR4(37, 98, 32, 0, 20),    CIDR4(5, 106, 208, 0, 20),   CIDR4(95, 64, 0, 0, 17),
+    CIDR4(192, 15, 144, 0, 20),  CIDR4(83, 122, 224, 0, 20),  CIDR4(83, 122, 192, 0, 18),  CIDR4(113, 203, 48, 0, 20),
+    CIDR4(85, 239, 192, 0, 19),  CIDR4(83, 123, 208, 0, 20),  CIDR4(192, 15, 48, 0, 20),   CIDR4(188, 122, 112, 0, 20),
+    CIDR4(5, 52, 0, 0, 17),      CIDR4(83, 121, 224, 0, 20),  CIDR4(5, 250, 48, 0, 20),    CIDR4(83, 123, 240, 0, 20),
+    CIDR4(5, 218, 48, 0, 20),    CIDR4(5, 212, 48, 0, 20)
+};
 
-unsigned int mci_ip_ranges_length = sizeof(mci_ip_ranges) / sizeof(mci_ip_ranges[0]);
+unsigned int mci_ip_ranges4_length = sizeof(mci_ip_ranges4) / sizeof(mci_ip_ranges4[0]);
+
+const cidr6_t mci_ip_ranges6[] = {
+    CIDR6(0x2a02, 0x4540, 0x7000, 0, 0, 0, 0, 0, 42), CIDR6(0x2a02, 0x4540, 0x5040, 0, 0, 0, 0, 0, 42),
+    CIDR6(0x2a02, 0x4540, 0xc000, 0, 0, 0, 0, 0, 42), CIDR6(0x2a02, 0x4540, 0xc0, 0, 0, 0, 0, 0, 43),
+    CIDR6(0x2a02, 0x4540, 0x7080, 0, 0, 0, 0, 0, 43), CIDR6(0x2a02, 0x4540, 0x5000, 0, 0, 0, 0, 0, 42),
+    CIDR6(0x2a02, 0x4540, 0x5080, 0, 0, 0, 0, 0, 44), CIDR6(0x2a02, 0x4540, 0xc040, 0, 0, 0, 0, 0, 42),
+    CIDR6(0x2a02, 0x4540, 0xe080, 0, 0, 0, 0, 0, 48), CIDR6(0x2a02, 0x4540, 0x40, 0, 0, 0, 0, 0, 42),
+    CIDR6(0x2a02, 0x4540, 0x7040, 0, 0, 0, 0, 0, 42), CIDR6(0x2a02, 0x4540, 0x90c0, 0, 0, 0, 0, 0, 42),
+    CIDR6(0x2a02, 0x4540, 0x9000, 0, 0, 0, 0, 0, 42), CIDR6(0x2a02, 0x4540, 0x80, 0, 0, 0, 0, 0, 42),
+    CIDR6(0x2a02, 0x4540, 0xe040, 0, 0, 0, 0, 0, 42), CIDR6(0x2a02, 0x4540, 0, 0, 0, 0, 0, 0, 42),
+    CIDR6(0x2a02, 0x4540, 0xe000, 0, 0, 0, 0, 0, 42), CIDR6(0x2a02, 0x4540, 0x9040, 0, 0, 0, 0, 0, 42),
+    CIDR6(0x2a02, 0x4540, 0x9080, 0, 0, 0, 0, 0, 42), CIDR6(0x2a02, 0x4540, 0x5090, 0, 0, 0, 0, 0, 44),
+    CIDR6(0x2a02, 0x4540, 0x70a0, 0, 0, 0, 0, 0, 43)
+};
+
+unsigned int mci_ip_ranges6_length = sizeof(mci_ip_ranges6) / sizeof(mci_ip_ranges6[0]);
@@ -14,278 +14,353 @@
     Updated	2 months ago on May 08, 2024
 */
 
-const char *mokhaberat_ip_ranges[] = {
-    "80.191.80.0/24",   "151.234.96.0/22",   "2.187.15.0/24",    "80.191.1.0/24",    "5.239.0.0/17",
-    "80.191.88.0/21",   "85.185.31.0/24",    "2.181.32.0/22",    "2.189.224.0/22",   "151.234.144.0/23",
-    "89.42.100.0/22",   "85.185.16.0/23",    "5.236.96.0/21",    "2.189.246.0/23",   "37.202.196.0/22",
-    "151.245.40.0/22",  "85.185.133.0/24",   "217.219.160.0/20", "217.77.120.0/21",  "78.39.158.0/24",
-    "89.39.8.0/22",     "2.182.168.0/23",    "5.238.0.0/17",     "85.185.12.0/23",   "5.239.144.0/20",
-    "37.202.192.0/22",  "151.243.214.0/23",  "151.245.160.0/22", "78.39.174.0/24",   "89.36.108.0/22",
-    "2.183.236.0/23",   "5.236.152.0/22",    "195.181.64.0/20",  "217.219.248.0/23", "5.237.192.0/18",
-    "109.74.224.0/20",  "5.235.211.0/24",    "212.33.208.0/23",  "217.219.144.0/21", "5.200.201.0/24",
-    "188.212.64.0/19",  "151.245.240.0/22",  "89.235.104.0/22",  "80.191.138.0/23",  "78.39.186.0/23",
-    "46.100.32.0/20",   "151.234.208.0/20",  "86.107.172.0/22",  "2.182.40.0/22",    "37.202.160.0/22",
-    "89.38.80.0/20",    "77.238.112.0/21",   "5.236.144.0/21",   "37.148.48.0/22",   "217.218.66.0/24",
-    "185.131.108.0/22", "217.218.208.0/21",  "78.39.42.0/24",    "89.44.128.0/21",   "46.100.156.0/22",
-    "151.247.172.0/22", "37.254.0.0/18",     "188.209.8.0/21",   "87.251.156.0/22",  "85.185.164.0/23",
-    "78.39.132.0/22",   "89.235.108.0/22",   "151.245.44.0/22",  "151.247.96.0/22",  "217.218.156.0/24",
-    "80.191.216.0/22",  "217.218.207.0/24",  "85.185.235.0/24",  "37.153.128.0/22",  "2.182.212.0/23",
-    "151.234.8.0/21",   "85.185.110.0/24",   "217.219.16.0/22",  "93.118.104.0/22",  "85.185.252.0/22",
-    "185.116.44.0/22",  "5.237.48.0/20",     "5.234.0.0/19",     "85.185.152.0/22",  "151.234.204.0/22",
-    "85.185.48.0/20",   "5.200.240.0/21",    "86.107.80.0/20",   "46.100.180.0/22",  "2.189.20.0/22",
-    "37.148.44.0/22",   "78.39.200.0/22",    "91.92.180.0/22",   "89.46.184.0/21",   "151.247.168.0/22",
-    "2.183.56.0/22",    "78.39.224.0/21",    "37.202.152.0/22",  "2.182.164.0/22",   "37.148.52.0/22",
-    "85.185.254.0/24",  "91.92.220.0/22",    "78.38.24.0/23",    "85.185.210.0/24",  "87.251.152.0/22",
-    "195.181.48.0/21",  "5.238.0.0/19",      "151.247.150.0/23", "46.100.58.0/24",   "2.182.208.0/22",
-    "151.235.64.0/18",  "5.236.24.0/21",     "80.191.174.0/23",  "2.185.240.0/21",   "89.219.64.0/18",
-    "188.209.16.0/20",  "217.218.158.0/23",  "2.181.160.0/20",   "217.219.216.0/22", "5.219.128.0/17",
-    "78.39.88.0/21",    "2.181.176.0/21",    "89.37.208.0/22",   "151.234.242.0/24", "46.100.164.0/22",
-    "5.232.176.0/20",   "5.236.40.0/21",     "84.47.220.0/22",   "2.183.192.0/21",   "89.37.152.0/22",
-    "2.185.160.0/19",   "37.148.8.0/22",     "2.182.104.0/22",   "151.232.0.0/17",   "185.131.148.0/22",
-    "37.156.128.0/20",  "89.36.176.0/20",    "151.245.164.0/22", "2.181.64.0/20",    "2.182.202.0/23",
-    "2.183.232.0/23",   "217.218.2.0/24",    "151.234.176.0/21", "5.238.96.0/21",    "37.202.156.0/22",
-    "151.234.0.0/22",   "2.187.208.0/20",    "2.179.176.0/20",   "2.179.224.0/19",   "37.255.137.0/24",
-    "151.234.6.0/24",   "151.245.120.0/22",  "217.219.254.0/24", "2.183.200.0/23",   "151.245.232.0/22",
-    "151.234.68.0/23",  "89.43.224.0/21",    "80.191.240.0/21",  "151.235.128.0/19", "5.200.224.0/20",
-    "2.181.216.0/22",   "78.38.128.0/20",    "151.245.32.0/22",  "2.182.32.0/22",    "188.210.232.0/22",
-    "2.183.136.0/22",   "151.245.20.0/22",   "151.234.240.0/24", "151.232.74.0/23",  "5.233.224.0/20",
-    "78.39.32.0/21",    "185.106.228.0/23",  "151.232.104.0/23", "5.235.192.0/20",   "92.246.144.0/22",
-    "91.92.124.0/22",   "2.183.184.0/22",    "2.187.18.0/24",    "2.179.224.0/20",   "46.100.140.0/24",
-    "188.215.176.0/20", "217.219.240.0/22",  "89.43.144.0/22",   "80.191.90.0/24",   "89.37.148.0/23",
-    "2.185.128.0/19",   "2.182.160.0/23",    "46.100.96.0/22",   "91.92.231.0/24",   "151.234.128.0/21",
-    "151.247.116.0/22", "5.200.192.0/21",    "78.39.222.0/23",   "5.200.248.0/21",   "37.148.90.0/23",
-    "85.185.154.0/24",  "85.185.212.0/22",   "151.234.146.0/23", "85.185.200.0/23",  "89.235.102.0/23",
-    "151.247.252.0/22", "78.38.192.0/19",    "80.191.198.0/24",  "5.236.198.0/23",   "2.182.112.0/21",
-    "85.185.234.0/24",  "85.185.4.0/23",     "151.234.148.0/24", "2.185.96.0/19",    "195.181.120.0/21",
-    "93.118.108.0/23",  "2.190.0.0/15",      "89.37.144.0/23",   "151.245.184.0/22", "217.218.154.0/24",
-    "151.234.252.0/22", "2.181.40.0/21",     "37.148.28.0/22",   "5.239.242.0/24",   "2.189.248.0/23",
-    "151.245.36.0/22",  "93.88.68.0/22",     "2.181.196.0/22",   "91.92.104.0/24",   "217.218.62.0/24",
-    "5.236.208.0/20",   "188.209.0.0/22",    "5.236.88.0/21",    "93.118.160.0/20",  "151.245.144.0/22",
-    "151.243.192.0/23", "89.37.150.0/23",    "2.187.40.0/21",    "87.251.146.0/24",  "151.234.200.0/22",
-    "185.131.128.0/22", "87.251.150.0/23",   "80.191.58.0/23",   "2.189.32.0/22",    "2.184.0.0/19",
-    "85.185.84.0/22",   "2.185.224.0/20",    "91.92.134.0/23",   "85.185.160.0/22",  "78.39.138.0/23",
-    "188.212.224.0/20", "5.200.144.0/20",    "5.238.192.0/18",   "217.219.192.0/21", "5.237.128.0/18",
-    "86.105.40.0/21",   "2.183.60.0/22",     "151.232.126.0/23", "86.104.240.0/21",  "188.0.247.0/24",
-    "2.182.216.0/21",   "2.182.152.0/22",    "5.104.208.0/21",   "2.182.100.0/22",   "5.200.128.0/20",
-    "151.234.48.0/22",  "217.219.244.0/22",  "217.218.124.0/24", "85.185.230.0/23",  "85.185.232.0/23",
-    "151.234.198.0/23", "5.239.172.0/22",    "188.213.176.0/20", "151.234.188.0/22", "217.218.220.0/22",
-    "46.100.228.0/22",  "2.187.17.0/24",     "2.181.80.0/20",    "151.247.124.0/22", "78.38.48.0/23",
-    "2.181.48.0/21",    "93.119.64.0/19",    "78.39.140.0/23",   "5.200.176.0/20",   "78.38.234.0/23",
-    "2.179.52.0/23",    "89.40.240.0/20",    "195.181.112.0/21", "2.179.192.0/21",   "217.218.188.0/22",
-    "80.191.128.0/20",  "151.234.4.0/23",    "217.218.183.0/24", "217.218.126.0/24", "78.39.129.0/24",
-    "185.107.34.0/23",  "85.185.172.0/24",   "93.118.112.0/20",  "93.115.120.0/21",  "78.38.104.0/23",
-    "151.234.104.0/21", "185.131.84.0/22",   "78.38.230.0/23",   "185.111.80.0/22",  "93.114.104.0/21",
-    "5.239.192.0/20",   "80.250.196.0/22",   "85.185.204.0/23",  "151.243.240.0/23", "151.247.100.0/22",
-    "91.92.121.0/24",   "31.7.112.0/21",     "217.172.112.0/23", "80.210.160.0/20",  "85.185.228.0/23",
-    "2.182.204.0/22",   "78.39.80.0/21",     "151.234.165.0/24", "2.179.0.0/21",     "217.218.248.0/21",
-    "80.191.224.0/21",  "151.247.52.0/22",   "37.254.128.0/18",  "37.156.240.0/22",  "85.185.211.0/24",
-    "92.246.156.0/22",  "2.184.172.0/22",    "78.38.56.0/21",    "78.39.180.0/22",   "188.214.96.0/22",
-    "2.183.234.0/23",   "78.39.240.0/22",    "188.211.216.0/21", "151.234.136.0/21", "2.187.240.0/21",
-    "80.191.192.0/23",  "93.117.0.0/19",     "5.234.128.0/19",   "31.7.120.0/24",    "91.92.156.0/22",
-    "2.182.64.0/19",    "2.182.136.0/21",    "2.176.0.0/15",     "31.7.96.0/21",     "78.39.252.0/23",
-    "78.39.176.0/23",   "85.185.156.0/22",   "2.182.98.0/23",    "151.247.48.0/22",  "151.247.144.0/22",
-    "185.131.100.0/22", "2.184.128.0/19",    "5.234.64.0/19",    "87.251.147.0/24",  "85.204.208.0/20",
-    "151.234.192.0/24", "5.234.208.0/21",    "46.100.76.0/22",   "151.234.112.0/21", "151.247.120.0/22",
-    "31.7.104.0/22",    "78.39.220.0/24",    "46.100.72.0/22",   "151.245.124.0/22", "213.109.240.0/21",
-    "2.189.216.0/22",   "2.182.248.0/22",    "2.184.160.0/23",   "37.255.0.0/18",    "151.235.180.0/22",
-    "2.182.252.0/24",   "78.39.142.0/23",    "5.235.212.0/22",   "185.124.156.0/22", "151.234.16.0/22",
-    "5.238.152.0/21",   "89.36.100.0/22",    "151.245.172.0/22", "2.182.176.0/20",   "5.190.128.0/17",
-    "5.236.128.0/20",   "80.191.20.0/24",    "217.218.204.0/23", "5.234.184.0/21",   "151.235.160.0/20",
-    "37.202.144.0/22",  "151.234.60.0/22",   "151.245.200.0/22", "151.232.106.0/23", "151.245.112.0/22",
-    "188.213.144.0/20", "151.234.154.0/23",  "5.238.48.0/22",    "66.79.96.0/21",    "5.234.48.0/20",
-    "151.235.184.0/21", "217.218.192.0/21",  "85.185.30.0/24",   "185.80.100.0/22",  "188.208.56.0/21",
-    "5.238.144.0/22",   "31.7.122.0/23",     "85.185.76.0/22",   "85.185.108.0/22",  "85.185.24.0/22",
-    "2.189.36.0/23",    "5.235.148.0/23",    "86.104.96.0/20",   "217.218.176.0/22", "217.219.184.0/21",
-    "151.245.100.0/22", "5.53.32.0/19",      "2.180.0.0/17",     "91.92.192.0/23",   "151.245.92.0/22",
-    "85.185.192.0/21",  "2.183.208.0/20",    "85.185.216.0/21",  "85.185.20.0/22",   "84.47.232.0/22",
-    "151.234.150.0/23", "151.232.64.0/22",   "151.235.0.0/19",   "46.100.56.0/23",   "37.254.0.0/15",
-    "85.185.248.0/23",  "2.179.172.0/22",    "78.39.154.0/24",   "89.33.100.0/22",   "5.233.248.0/23",
-    "5.239.128.0/20",   "78.38.50.0/24",     "94.176.8.0/21",    "31.7.121.0/24",    "185.131.168.0/23",
-    "185.131.140.0/22", "188.211.208.0/21",  "151.234.87.0/24",  "5.233.240.0/21",   "217.219.120.0/21",
-    "78.38.232.0/23",   "151.234.120.0/21",  "78.39.192.0/21",   "80.210.208.0/20",  "185.105.100.0/22",
-    "217.218.240.0/21", "188.213.208.0/23",  "77.238.124.0/22",  "185.107.32.0/23",  "80.191.26.0/23",
-    "217.219.0.0/20",   "5.235.150.0/23",    "2.181.112.0/20",   "85.185.208.0/23",  "80.210.20.0/22",
-    "2.179.112.0/20",   "217.218.232.0/21",  "217.218.128.0/20", "5.236.192.0/22",   "85.185.44.0/22",
-    "85.185.224.0/22",  "185.112.128.0/22",  "5.233.46.0/23",    "151.234.244.0/23", "178.238.192.0/23",
-    "185.131.136.0/22", "91.244.120.0/22",   "80.191.248.0/22",  "217.218.68.0/22",  "151.247.24.0/22",
-    "84.47.238.0/23",   "151.234.152.0/23",  "46.100.68.0/22",   "46.100.120.0/21",  "5.219.0.0/17",
-    "46.100.84.0/22",   "151.234.70.0/23",   "46.100.216.0/21",  "188.212.200.0/21", "151.247.86.0/23",
-    "151.245.176.0/22", "5.238.32.0/20",     "2.187.160.0/19",   "2.179.164.0/22",   "217.218.196.0/23",
-    "91.92.228.0/23",   "151.234.248.0/22",  "151.232.68.0/23",  "2.179.56.0/22",    "5.53.56.0/24",
-    "5.232.208.0/21",   "85.185.188.0/22",   "2.184.170.0/23",   "151.234.224.0/20", "78.38.40.0/23",
-    "5.237.0.0/16",     "5.237.32.0/20",     "217.218.202.0/23", "188.214.216.0/21", "188.209.32.0/20",
-    "78.38.0.0/21",     "151.247.112.0/22",  "85.185.43.0/24",   "80.191.188.0/22",  "2.189.24.0/23",
-    "80.250.192.0/22",  "85.185.112.0/21",   "78.38.96.0/22",    "80.210.176.0/20",  "151.247.152.0/22",
-    "2.179.8.0/22",     "151.234.100.0/22",  "2.183.120.0/22",   "151.234.24.0/21",  "2.187.192.0/20",
-    "78.39.0.0/20",     "151.245.196.0/22",  "217.219.52.0/22",  "2.183.64.0/20",    "77.81.144.0/20",
-    "46.100.152.0/22",  "46.102.184.0/22",   "46.100.102.0/23",  "5.234.220.0/22",   "78.39.64.0/20",
-    "5.234.168.0/21",   "176.223.80.0/21",   "78.39.232.0/22",   "188.0.248.0/21",   "5.236.80.0/21",
-    "151.234.186.0/23", "151.247.92.0/22",   "2.179.54.0/23",    "37.202.164.0/22",  "89.40.152.0/21",
-    "151.243.228.0/22", "217.172.104.0/21",  "80.191.110.0/23",  "2.184.192.0/18",   "78.38.224.0/23",
-    "80.191.96.0/22",   "84.47.236.0/24",    "91.190.88.0/21",   "89.37.146.0/23",   "85.185.136.0/24",
-    "178.236.96.0/20",  "89.38.184.0/21",    "85.185.0.0/22",    "46.100.236.0/22",  "217.219.32.0/21",
-    "178.238.206.0/23", "176.65.248.0/22",   "151.245.116.0/22", "2.179.208.0/20",   "2.187.32.0/19",
-    "5.235.216.0/21",   "2.181.56.0/21",     "85.185.28.0/23",   "5.234.160.0/21",   "185.136.172.0/22",
-    "5.238.104.0/22",   "5.233.40.0/22",     "85.185.186.0/23",  "151.233.56.0/22",  "5.236.0.0/20",
-    "91.92.130.0/23",   "5.198.166.0/23",    "2.181.194.0/23",   "87.251.128.0/21",  "5.233.128.0/19",
-    "2.182.96.0/23",    "78.39.166.0/24",    "185.131.124.0/22", "2.179.48.0/22",    "37.156.112.0/20",
-    "80.191.60.0/22",   "5.239.208.0/21",    "80.210.240.0/21",  "85.185.88.0/21",   "217.219.208.0/22",
-    "85.185.128.0/21",  "93.117.32.0/20",    "217.218.143.0/24", "217.218.180.0/24", "2.182.162.0/23",
-    "89.45.112.0/21",   "2.183.142.0/23",    "5.232.192.0/20",   "151.234.88.0/23",  "217.219.56.0/21",
-    "46.100.128.0/22",  "151.232.110.0/23",  "2.183.16.0/20",    "78.38.8.0/21",     "80.191.100.0/22",
-    "91.92.236.0/22",   "80.191.66.0/24",    "85.185.138.0/23",  "217.172.102.0/23", "46.248.32.0/19",
-    "84.47.254.0/23",   "85.185.100.0/22",   "84.47.212.0/22",   "5.235.152.0/21",   "176.65.232.0/21",
-    "86.104.80.0/20",   "151.245.72.0/22",   "89.42.184.0/21",   "151.234.32.0/20",  "2.185.32.0/19",
-    "2.189.228.0/22",   "185.106.230.0/23",  "78.38.44.0/22",    "2.181.36.0/22",    "176.65.224.0/21",
-    "151.245.60.0/22",  "188.211.192.0/19",  "31.7.108.0/23",    "2.179.160.0/22",   "217.218.206.0/24",
-    "89.45.152.0/21",   "78.39.254.0/23",    "151.232.10.0/24",  "2.182.240.0/21",   "151.245.108.0/22",
-    "80.191.252.0/22",  "188.0.244.0/24",    "80.191.61.0/24",   "217.218.178.0/24", "151.232.128.0/17",
-    "80.191.84.0/22",   "80.191.64.0/20",    "185.131.90.0/23",  "5.198.160.0/22",   "2.183.80.0/20",
-    "5.235.0.0/17",     "46.100.144.0/21",   "78.39.246.0/24",   "37.202.132.0/22",  "151.245.76.0/22",
-    "5.233.44.0/23",    "37.148.12.0/22",    "78.38.32.0/21",    "151.234.246.0/23", "151.245.88.0/22",
-    "2.183.152.0/22",   "46.100.61.0/24",    "85.185.40.0/23",   "188.213.96.0/19",  "5.238.148.0/22",
-    "5.237.64.0/20",    "78.39.16.0/21",     "2.184.162.0/23",   "185.131.164.0/22", "2.184.176.0/20",
-    "91.92.148.0/22",   "80.191.208.0/22",   "188.215.128.0/20", "5.232.64.0/19",    "5.233.192.0/19",
-    "2.183.160.0/20",   "89.42.96.0/23",     "5.235.176.0/21",   "151.247.136.0/22", "2.179.128.0/19",
-    "151.245.208.0/21", "2.179.20.0/22",     "78.39.136.0/24",   "188.215.240.0/23", "2.189.236.0/22",
-    "85.185.207.0/24",  "93.119.32.0/19",    "5.234.44.0/23",    "37.202.136.0/22",  "46.100.168.0/22",
-    "2.181.224.0/19",   "78.39.248.0/22",    "217.219.44.0/22",  "2.182.128.0/21",   "2.182.175.0/24",
-    "80.191.25.0/24",   "85.185.173.0/24",   "217.219.88.0/21",  "2.184.168.0/23",   "188.211.128.0/19",
-    "37.148.20.0/22",   "80.210.128.0/20",   "5.234.224.0/19",   "217.218.125.0/24", "2.181.220.0/23",
-    "185.131.92.0/22",  "212.33.214.0/23",   "151.245.188.0/22", "37.148.60.0/22",   "91.92.164.0/22",
-    "46.100.100.0/23",  "37.255.128.0/18",   "66.79.104.0/24",   "2.179.96.0/20",    "2.181.188.0/22",
-    "217.219.224.0/21", "89.235.80.0/21",    "151.234.194.0/23", "37.148.24.0/22",   "93.117.120.0/21",
-    "80.191.194.0/23",  "37.148.36.0/22",    "78.39.160.0/20",   "46.100.59.0/24",   "2.182.48.0/20",
-    "5.238.128.0/20",   "37.156.176.0/22",   "151.233.48.0/21",  "84.47.192.0/20",   "2.187.248.0/22",
-    "37.148.104.0/22",  "78.39.144.0/22",    "80.191.232.0/22",  "80.191.104.0/22",  "66.79.116.0/23",
-    "185.18.156.0/22",  "31.14.80.0/20",     "5.234.176.0/21",   "31.7.110.0/23",    "195.181.0.0/19",
-    "217.219.64.0/20",  "185.115.76.0/23",   "80.250.200.0/21",  "31.14.144.0/20",   "46.100.104.0/23",
-    "2.182.144.0/21",   "85.185.240.0/23",   "2.179.16.0/22",    "5.239.245.0/24",   "151.245.56.0/22",
-    "5.234.40.0/22",    "46.100.208.0/21",   "78.38.72.0/21",    "5.200.160.0/20",   "85.185.42.0/24",
-    "86.105.128.0/20",  "37.255.192.0/18",   "80.191.152.0/21",  "2.179.169.0/24",   "217.218.186.0/23",
-    "2.179.80.0/20",    "85.185.220.0/24",   "2.179.200.0/21",   "178.238.204.0/23", "212.33.210.0/23",
-    "93.115.216.0/21",  "2.179.60.0/23",     "78.38.152.0/21",   "89.40.245.0/24",   "151.233.128.0/17",
-    "80.191.160.0/21",  "93.118.96.0/21",    "46.100.160.0/22",  "2.189.244.0/23",   "185.133.164.0/22",
-    "2.181.200.0/21",   "151.234.80.0/22",   "185.120.246.0/23", "78.39.247.0/24",   "78.38.80.0/21",
-    "195.181.56.0/21",  "217.171.148.0/22",  "2.182.120.0/22",   "80.191.168.0/22",  "217.218.144.0/21",
-    "217.77.112.0/21",  "2.187.128.0/19",    "84.47.211.0/24",   "151.232.100.0/22", "217.171.145.0/24",
-    "151.232.76.0/24",  "46.100.172.0/22",   "80.191.0.0/20",    "78.39.44.0/23",    "151.245.104.0/22",
-    "151.245.64.0/22",  "2.187.48.0/20",     "185.131.88.0/22",  "151.232.124.0/23", "89.44.176.0/21",
-    "85.204.80.0/20",   "85.185.250.0/23",   "151.247.84.0/23",  "151.245.156.0/22", "2.179.64.0/20",
-    "31.7.124.0/22",    "2.183.188.0/22",    "5.233.252.0/23",   "5.200.208.0/20",   "5.200.202.0/23",
-    "46.100.6.0/23",    "78.39.178.0/23",    "217.218.120.0/22", "5.236.224.0/19",   "185.133.125.0/24",
-    "2.181.96.0/20",    "66.79.118.0/23",    "151.232.70.0/23",  "86.107.144.0/20",  "151.247.243.0/24",
-    "85.185.8.0/22",    "2.185.0.0/20",      "37.156.212.0/22",  "85.185.184.0/23",  "80.191.112.0/20",
-    "46.100.48.0/21",   "178.238.202.0/23",  "5.238.160.0/19",   "151.245.84.0/22",  "5.198.160.0/19",
-    "80.210.248.0/21",  "2a04:2680:13::/48", "5.234.192.0/20",   "188.213.210.0/23", "217.219.96.0/20",
-    "151.247.160.0/22", "185.88.48.0/23",    "78.38.168.0/21",   "2.180.128.0/17",   "5.239.224.0/20",
-    "78.38.52.0/24",    "5.239.252.0/22",    "80.210.192.0/20",  "93.88.72.0/23",    "2.183.112.0/21",
-    "5.239.216.0/21",   "91.250.224.0/20",   "217.219.176.0/21", "5.236.32.0/21",    "5.239.180.0/22",
-    "185.120.244.0/23", "37.148.0.0/22",     "5.236.160.0/19",   "85.185.120.0/21",  "5.235.128.0/20",
-    "37.202.200.0/22",  "80.210.32.0/19",    "217.219.24.0/21",  "217.218.164.0/24", "151.247.88.0/22",
-    "151.247.140.0/22", "46.100.64.0/22",    "151.234.241.0/24", "2.189.240.0/23",   "2.189.250.0/23",
-    "178.238.198.0/23", "2.178.0.0/16",      "2.189.8.0/22",     "176.65.160.0/19",  "188.211.64.0/18",
-    "2.181.184.0/22",   "2.183.144.0/21",    "78.39.221.0/24",   "178.238.200.0/23", "78.38.100.0/22",
-    "85.185.14.0/23",   "213.109.248.0/21",  "2.185.252.0/23",   "85.185.236.0/22",  "217.219.112.0/21",
-    "217.218.124.0/23", "185.131.152.0/21",  "188.212.160.0/19", "151.245.228.0/22", "2.182.124.0/22",
-    "78.38.42.0/23",    "151.247.72.0/22",   "217.218.72.0/21",  "78.38.26.0/23",    "151.243.250.0/23",
-    "37.148.124.0/22",  "2.183.48.0/21",     "151.232.108.0/23", "217.218.200.0/22", "5.236.108.0/23",
-    "78.39.137.0/24",   "46.100.98.0/24",    "84.47.210.0/24",   "2.187.6.0/23",     "80.191.182.0/23",
-    "5.236.112.0/20",   "5.236.16.0/21",     "78.38.228.0/23",   "46.235.76.0/23",   "217.218.218.0/23",
-    "37.202.188.0/22",  "151.247.156.0/22",  "80.191.180.0/23",  "188.210.80.0/21",  "2.182.170.0/23",
-    "5.234.96.0/19",    "84.47.240.0/21",    "151.243.224.0/22", "78.38.28.0/22",    "217.218.123.0/24",
-    "151.247.28.0/22",  "80.191.186.0/23",   "89.235.100.0/23",  "87.251.136.0/22",  "85.185.64.0/22",
-    "80.191.109.0/24",  "5.235.192.0/18",    "188.240.248.0/21", "217.24.144.0/20",  "78.38.108.0/22",
-    "85.185.80.0/22",   "78.39.112.0/22",    "217.219.128.0/20", "87.251.140.0/22",  "151.233.0.0/17",
-    "151.234.72.0/21",  "5.232.0.0/18",      "217.218.26.0/24",  "185.72.80.0/22",   "80.210.18.0/23",
-    "2.182.174.0/24",   "2.187.96.0/19",     "151.247.82.0/23",  "217.218.160.0/22", "217.218.180.0/22",
-    "2.179.40.0/21",    "80.191.178.0/24",   "91.92.129.0/24",   "217.218.0.0/18",   "46.100.5.0/24",
-    "85.185.203.0/24",  "91.92.204.0/22",    "37.156.160.0/21",  "46.100.224.0/22",  "2.183.140.0/23",
-    "151.245.168.0/22", "217.218.152.0/23",  "5.233.96.0/20",    "5.236.196.0/23",   "5.236.156.0/22",
-    "2.183.124.0/22",   "37.156.248.0/22",   "217.218.224.0/21", "217.219.152.0/21", "217.219.212.0/22",
-    "37.148.56.0/22",   "212.33.212.0/23",   "2.179.240.0/20",   "217.218.184.0/24", "46.100.112.0/22",
-    "80.191.200.0/21",  "5.236.64.0/20",     "151.243.242.0/23", "2.183.240.0/20",   "151.234.156.0/22",
-    "78.39.130.0/23",   "151.245.52.0/22",   "151.234.160.0/24", "188.209.64.0/20",  "151.232.77.0/24",
-    "217.172.118.0/24", "80.210.144.0/20",   "217.219.80.0/21",  "185.136.220.0/22", "78.38.226.0/23",
-    "5.233.120.0/21",   "78.38.16.0/21",     "78.38.148.0/22",   "2.185.48.0/20",    "84.47.252.0/24",
-    "5.239.176.0/22",   "2.182.173.0/24",    "85.185.168.0/22",  "188.211.200.0/21", "78.39.60.0/23",
-    "78.39.96.0/21",    "80.191.108.0/24",   "2.182.0.0/19",     "80.191.197.0/24",  "78.39.244.0/23",
-    "5.237.0.0/20",     "80.191.48.0/21",    "151.247.132.0/22", "37.148.100.0/22",  "80.191.28.0/22",
-    "80.191.82.0/23",   "80.191.82.0/24",    "151.245.132.0/22", "2.182.44.0/22",    "151.234.90.0/23",
-    "66.79.105.0/24",   "185.108.96.0/22",   "188.0.246.0/24",   "46.100.60.0/24",   "78.39.118.0/23",
-    "80.210.0.0/20",    "188.211.176.0/20",  "85.185.72.0/22",   "151.247.128.0/22", "217.172.116.0/23",
-    "66.79.114.0/23",   "2.189.232.0/22",    "5.235.144.0/22",   "151.245.80.0/22",  "151.243.232.0/22",
-    "46.100.240.0/22",  "176.65.244.0/22",   "77.81.128.0/21",   "78.39.216.0/22",   "151.234.243.0/24",
-    "217.218.117.0/24", "86.106.192.0/21",   "5.232.160.0/20",   "89.34.248.0/21",   "77.81.32.0/20",
-    "151.235.192.0/18", "151.245.192.0/22",  "5.235.188.0/22",   "91.92.208.0/21",   "89.37.248.0/21",
-    "151.235.32.0/19",  "5.235.160.0/20",    "188.208.202.0/23", "5.200.204.0/22",   "151.245.136.0/22",
-    "46.100.248.0/22",  "91.109.104.0/21",   "2.186.0.0/16",     "178.238.194.0/23", "5.233.160.0/19",
-    "89.43.148.0/22",   "85.185.202.0/24",   "2.184.64.0/18",    "217.218.216.0/23", "2.183.176.0/21",
-    "188.211.32.0/19",  "195.181.32.0/20",   "5.234.32.0/22",    "93.118.110.0/23",  "80.191.32.0/21",
-    "80.191.57.0/24",   "85.185.140.0/23",   "5.234.216.0/22",   "78.38.176.0/20",   "151.245.96.0/22",
-    "188.215.192.0/19", "37.148.32.0/22",    "78.38.236.0/24",   "78.39.148.0/22",   "151.235.176.0/22",
-    "78.38.64.0/21",    "80.191.16.0/21",    "2.183.204.0/22",   "185.117.48.0/22",  "85.185.231.0/24",
-    "2.183.0.0/20",     "5.233.0.0/19",      "151.245.244.0/22", "80.191.184.0/23",  "78.38.160.0/21",
-    "2.189.16.0/22",    "85.204.128.0/22",   "185.71.152.0/22",  "2.183.96.0/20",    "85.185.6.0/23",
-    "2.183.132.0/22",   "80.210.224.0/20",   "80.191.212.0/22",  "91.92.114.0/24",   "2.183.202.0/23",
-    "2.185.64.0/19",    "81.16.112.0/20",    "151.245.24.0/22",  "151.245.28.0/22",  "2.182.110.0/23",
-    "89.43.216.0/21",   "5.233.64.0/19",     "91.92.145.0/24",   "217.218.96.0/20",  "185.131.170.0/23",
-    "151.234.196.0/23", "185.165.206.0/24",  "93.115.224.0/20",  "78.39.159.0/24",   "91.147.64.0/20",
-    "89.235.112.0/20",  "46.100.8.0/21",     "78.38.213.0/24",   "2.182.254.0/24",   "80.191.74.0/24",
-    "46.100.118.0/23",  "217.219.232.0/21",  "89.40.240.0/22",   "217.218.166.0/23", "85.185.142.0/23",
-    "89.35.120.0/22",   "2.184.32.0/19",     "185.120.236.0/22", "89.38.192.0/21",   "178.238.196.0/23",
-    "85.185.186.0/24",  "37.202.140.0/22",   "80.191.8.0/24",    "5.239.244.0/24",   "46.100.252.0/23",
-    "5.239.184.0/21",   "2.183.238.0/23",    "151.232.9.0/24",   "2.189.38.0/23",    "2.179.62.0/23",
-    "5.235.186.0/23",   "85.185.95.0/24",    "85.185.206.0/24",  "151.247.208.0/22", "195.181.80.0/20",
-    "2.184.164.0/22",   "78.38.144.0/22",    "5.233.48.0/20",    "93.117.96.0/20",   "217.219.200.0/21",
-    "81.12.28.0/24",    "78.38.219.0/24",    "80.191.40.0/21",   "2.183.156.0/22",   "5.235.236.0/22",
-    "46.100.188.0/22",  "185.79.156.0/22",   "5.200.128.0/19",   "2.189.220.0/22",   "2.187.16.0/24",
-    "151.232.96.0/22",  "85.185.166.0/23",   "5.236.48.0/20",    "151.245.216.0/21", "2.179.170.0/24",
-    "85.185.176.0/21",  "2.189.252.0/23",    "78.38.106.0/23",   "217.219.40.0/22",  "46.100.116.0/23",
-    "85.185.71.0/24",   "5.239.244.0/23",    "46.100.88.0/21",   "5.236.200.0/21",   "66.79.112.0/23",
-    "78.39.188.0/22",   "217.218.87.0/24",   "5.236.110.0/23",   "46.100.62.0/23",   "2.185.192.0/19",
-    "217.219.250.0/23", "151.243.244.0/23",  "37.156.100.0/22",  "2.189.28.0/22",    "217.218.157.0/24",
-    "2.179.32.0/21",    "46.100.142.0/23",   "2.182.200.0/24",   "66.79.120.0/21",   "89.42.98.0/23",
-    "151.234.20.0/22",  "151.245.180.0/22",  "188.211.192.0/21", "213.195.52.0/22",  "2.182.224.0/20",
-    "5.237.16.0/20",    "5.233.254.0/23",    "46.100.176.0/22",  "89.36.48.0/20",    "46.100.136.0/22",
-    "2.182.253.0/24",   "78.38.54.0/24",     "85.185.104.0/22",  "89.38.244.0/22",   "89.219.192.0/18",
-    "185.120.228.0/22", "46.102.120.0/21",   "5.238.108.0/23",   "5.233.250.0/23",   "46.100.161.0/24",
-    "5.75.0.0/17",      "217.218.168.0/21",  "37.254.192.0/18",  "89.36.106.0/23",   "2.187.19.0/24",
-    "2.187.224.0/20",   "5.232.224.0/19",    "188.209.4.0/22",   "78.39.52.0/24",    "151.245.204.0/22",
-    "78.38.112.0/21",   "78.39.24.0/21",     "84.47.248.0/22",   "91.227.84.0/22",   "217.219.20.0/22",
-    "217.218.6.0/24",   "151.234.92.0/22",   "84.47.253.0/24",   "151.234.56.0/22",  "217.218.9.0/24",
-    "188.214.160.0/19", "151.245.236.0/22",  "66.79.106.0/23",   "2.187.0.0/19",     "188.212.144.0/21",
-    "85.185.244.0/22",  "80.191.144.0/21",   "80.210.17.0/24",   "188.215.242.0/23", "151.232.120.0/22",
-    "151.234.7.0/24",   "185.115.78.0/24",   "2.185.16.0/20",    "2.185.248.0/22",   "5.190.240.0/20",
-    "37.202.148.0/22",  "5.234.36.0/22",     "85.185.32.0/22",   "85.185.68.0/23",   "217.218.15.0/24",
-    "5.200.200.0/24",   "151.234.163.0/24",  "217.218.112.0/21", "5.238.64.0/19",    "151.234.52.0/22",
-    "151.234.166.0/24", "66.79.108.0/22",    "80.191.196.0/24",  "5.236.104.0/23",   "93.88.64.0/22",
-    "2.179.28.0/22",    "151.245.128.0/22",  "89.235.88.0/21",   "185.131.116.0/22", "5.233.112.0/21",
-    "91.92.132.0/23",   "91.92.146.0/23",    "78.39.236.0/22",   "78.39.204.0/22",   "151.245.140.0/22",
-    "5.190.0.0/17",     "5.234.46.0/23",     "212.33.216.0/21",  "5.235.240.0/20",   "5.62.160.0/19",
-    "217.172.114.0/23", "46.100.244.0/22",   "78.39.184.0/22",   "151.243.248.0/23", "46.182.32.0/21",
-    "78.38.120.0/21",   "78.39.104.0/21",    "2.183.128.0/22",   "5.74.0.0/16",      "78.39.120.0/21",
-    "78.38.88.0/21",    "185.131.112.0/22",  "93.118.128.0/19",  "37.202.128.0/22",  "85.185.96.0/22",
-    "80.191.176.0/23",  "80.191.236.0/22",   "46.100.80.0/22",   "188.208.200.0/23", "46.100.132.0/22",
-    "151.245.152.0/22", "151.247.56.0/22",   "2.189.12.0/22",    "91.222.204.0/22",  "2.187.64.0/19",
-    "37.148.4.0/22",    "91.92.184.0/21",    "151.234.193.0/24", "2.179.24.0/22",    "2.182.201.0/24",
-    "89.36.104.0/23",   "217.218.80.0/20",   "87.251.144.0/23",  "5.239.240.0/23",   "93.118.184.0/22",
-    "46.100.106.0/23",  "80.191.199.0/24",   "80.191.19.0/24",   "80.191.231.0/24",  "46.100.184.0/22",
-    "2.182.108.0/23",   "89.37.168.0/22",    "2.181.179.0/24",   "78.38.53.0/24",    "217.172.119.0/24",
-    "80.191.179.0/24",  "2.182.192.0/21",    "46.100.232.0/22",  "85.185.174.0/23",  "195.181.96.0/20",
-    "46.100.16.0/20",   "151.234.64.0/22",   "80.191.220.0/22",  "5.233.32.0/21",    "5.198.164.0/23",
-    "37.148.16.0/22",   "78.39.41.0/24",     "2.182.214.0/23",   "217.219.252.0/23", "37.255.210.0/24",
-    "151.245.48.0/22",  "185.120.212.0/22",  "2.181.0.0/19",     "5.232.216.0/21",   "2.182.156.0/22",
-    "5.235.184.0/23",   "151.234.84.0/23",   "151.243.200.0/23", "213.195.56.0/21",  "37.255.64.0/18",
-    "85.185.242.0/23",  "2.179.12.0/22",     "85.185.18.0/23",   "188.215.160.0/20", "2.181.208.0/21",
-    "91.92.122.0/23",   "151.245.68.0/22",   "5.232.96.0/19",    "37.156.232.0/21",  "151.234.86.0/24",
-    "37.148.40.0/22",   "46.100.0.0/22",     "188.212.208.0/20", "78.39.208.0/21",   "2.181.128.0/19",
-    "188.210.128.0/18", "151.234.160.0/20",  "151.247.164.0/22", "217.218.96.0/24",  "80.210.24.0/21",
-    "85.185.137.0/24",  "85.185.144.0/21",   "5.238.112.0/20",   "2.182.36.0/22",    "185.147.40.0/22",
-    "2.183.224.0/21",   "151.243.124.0/23",  "89.36.96.0/22",    "217.219.220.0/22", "2.184.68.0/23",
-    "89.37.240.0/20",   "217.218.53.0/24",   "78.38.55.0/24",    "2.183.32.0/20",    "151.247.80.0/23",
-    "80.191.22.0/24",   "185.115.79.0/24",   "5.232.128.0/19",   "151.232.117.0/24", "84.47.208.0/23",
-    "151.245.148.0/22", "78.39.116.0/23",    "46.100.192.0/20",  "78.38.196.0/24",   "5.235.224.0/21",
-    "84.47.216.0/22",   "92.43.160.0/22",    "195.146.50.0/24"};
+const cidr4_t mokhaberat_ip_ranges4[] = {
+    CIDR4(80, 191, 80, 0, 24),   CIDR4(151, 234, 96, 0, 22),  CIDR4(2, 187, 15, 0, 24),    CIDR4(80, 191, 1, 0, 24),
+    CIDR4(5, 239, 0, 0, 17),     CIDR4(80, 191, 88, 0, 21),   CIDR4(85, 185, 31, 0, 24),   CIDR4(2, 181, 32, 0, 22),
+    CIDR4(2, 189, 224, 0, 22),   CIDR4(151, 234, 144, 0, 23), CIDR4(89, 42, 100, 0, 22),   CIDR4(85, 185, 16, 0, 23),
+    CIDR4(5, 236, 96, 0, 21),    CIDR4(2, 189, 246, 0, 23),   CIDR4(37, 202, 196, 0, 22),  CIDR4(151, 245, 40, 0, 22),
+    CIDR4(85, 185, 133, 0, 24),  CIDR4(217, 219, 160, 0, 20), CIDR4(217, 77, 120, 0, 21),  CIDR4(78, 39, 158, 0, 24),
+    CIDR4(89, 39, 8, 0, 22),     CIDR4(2, 182, 168, 0, 23),   CIDR4(5, 238, 0, 0, 17),     CIDR4(85, 185, 12, 0, 23),
+    CIDR4(5, 239, 144, 0, 20),   CIDR4(37, 202, 192, 0, 22),  CIDR4(151, 243, 214, 0, 23), CIDR4(151, 245, 160, 0, 22),
+    CIDR4(78, 39, 174, 0, 24),   CIDR4(89, 36, 108, 0, 22),   CIDR4(2, 183, 236, 0, 23),   CIDR4(5, 236, 152, 0, 22),
+    CIDR4(195, 181, 64, 0, 20),  CIDR4(217, 219, 248, 0, 23), CIDR4(5, 237, 192, 0, 18),   CIDR4(109, 74, 224, 0, 20),
+    CIDR4(5, 235, 211, 0, 24),   CIDR4(212, 33, 208, 0, 23),  CIDR4(217, 219, 144, 0, 21), CIDR4(5, 200, 201, 0, 24),
+    CIDR4(188, 212, 64, 0, 19),  CIDR4(151, 245, 240, 0, 22), CIDR4(89, 235, 104, 0, 22),  CIDR4(80, 191, 138, 0, 23),
+    CIDR4(78, 39, 186, 0, 23),   CIDR4(46, 100, 32, 0, 20),   CIDR4(151, 234, 208, 0, 20), CIDR4(86, 107, 172, 0, 22),
+    CIDR4(2, 182, 40, 0, 22),    CIDR4(37, 202, 160, 0, 22),  CIDR4(89, 38, 80, 0, 20),    CIDR4(77, 238, 112, 0, 21),
+    CIDR4(5, 236, 144, 0, 21),   CIDR4(37, 148, 48, 0, 22),   CIDR4(217, 218, 66, 0, 24),  CIDR4(185, 131, 108, 0, 22),
+    CIDR4(217, 218, 208, 0, 21), CIDR4(78, 39, 42, 0, 24),    CIDR4(89, 44, 128, 0, 21),   CIDR4(46, 100, 156, 0, 22),
+    CIDR4(151, 247, 172, 0, 22), CIDR4(37, 254, 0, 0, 18),    CIDR4(188, 209, 8, 0, 21),   CIDR4(87, 251, 156, 0, 22),
+    CIDR4(85, 185, 164, 0, 23),  CIDR4(78, 39, 132, 0, 22),   CIDR4(89, 235, 108, 0, 22),  CIDR4(151, 245, 44, 0, 22),
+    CIDR4(151, 247, 96, 0, 22),  CIDR4(217, 218, 156, 0, 24), CIDR4(80, 191, 216, 0, 22),  CIDR4(217, 218, 207, 0, 24),
+    CIDR4(85, 185, 235, 0, 24),  CIDR4(37, 153, 128, 0, 22),  CIDR4(2, 182, 212, 0, 23),   CIDR4(151, 234, 8, 0, 21),
+    CIDR4(85, 185, 110, 0, 24),  CIDR4(217, 219, 16, 0, 22),  CIDR4(93, 118, 104, 0, 22),  CIDR4(85, 185, 252, 0, 22),
+    CIDR4(185, 116, 44, 0, 22),  CIDR4(5, 237, 48, 0, 20),    CIDR4(5, 234, 0, 0, 19),     CIDR4(85, 185, 152, 0, 22),
+    CIDR4(151, 234, 204, 0, 22), CIDR4(85, 185, 48, 0, 20),   CIDR4(5, 200, 240, 0, 21),   CIDR4(86, 107, 80, 0, 20),
+    CIDR4(46, 100, 180, 0, 22),  CIDR4(2, 189, 20, 0, 22),    CIDR4(37, 148, 44, 0, 22),   CIDR4(78, 39, 200, 0, 22),
+    CIDR4(91, 92, 180, 0, 22),   CIDR4(89, 46, 184, 0, 21),   CIDR4(151, 247, 168, 0, 22), CIDR4(2, 183, 56, 0, 22),
+    CIDR4(78, 39, 224, 0, 21),   CIDR4(37, 202, 152, 0, 22),  CIDR4(2, 182, 164, 0, 22),   CIDR4(37, 148, 52, 0, 22),
+    CIDR4(85, 185, 254, 0, 24),  CIDR4(91, 92, 220, 0, 22),   CIDR4(78, 38, 24, 0, 23),    CIDR4(85, 185, 210, 0, 24),
+    CIDR4(87, 251, 152, 0, 22),  CIDR4(195, 181, 48, 0, 21),  CIDR4(5, 238, 0, 0, 19),     CIDR4(151, 247, 150, 0, 23),
+    CIDR4(46, 100, 58, 0, 24),   CIDR4(2, 182, 208, 0, 22),   CIDR4(151, 235, 64, 0, 18),  CIDR4(5, 236, 24, 0, 21),
+    CIDR4(80, 191, 174, 0, 23),  CIDR4(2, 185, 240, 0, 21),   CIDR4(89, 219, 64, 0, 18),   CIDR4(188, 209, 16, 0, 20),
+    CIDR4(217, 218, 158, 0, 23), CIDR4(2, 181, 160, 0, 20),   CIDR4(217, 219, 216, 0, 22), CIDR4(5, 219, 128, 0, 17),
+    CIDR4(78, 39, 88, 0, 21),    CIDR4(2, 181, 176, 0, 21),   CIDR4(89, 37, 208, 0, 22),   CIDR4(151, 234, 242, 0, 24),
+    CIDR4(46, 100, 164, 0, 22),  CIDR4(5, 232, 176, 0, 20),   CIDR4(5, 236, 40, 0, 21),    CIDR4(84, 47, 220, 0, 22),
+    CIDR4(2, 183, 192, 0, 21),   CIDR4(89, 37, 152, 0, 22),   CIDR4(2, 185, 160, 0, 19),   CIDR4(37, 148, 8, 0, 22),
+    CIDR4(2, 182, 104, 0, 22),   CIDR4(151, 232, 0, 0, 17),   CIDR4(185, 131, 148, 0, 22), CIDR4(37, 156, 128, 0, 20),
+    CIDR4(89, 36, 176, 0, 20),   CIDR4(151, 245, 164, 0, 22), CIDR4(2, 181, 64, 0, 20),    CIDR4(2, 182, 202, 0, 23),
+    CIDR4(2, 183, 232, 0, 23),   CIDR4(217, 218, 2, 0, 24),   CIDR4(151, 234, 176, 0, 21), CIDR4(5, 238, 96, 0, 21),
+    CIDR4(37, 202, 156, 0, 22),  CIDR4(151, 234, 0, 0, 22),   CIDR4(2, 187, 208, 0, 20),   CIDR4(2, 179, 176, 0, 20),
+    CIDR4(2, 179, 224, 0, 19),   CIDR4(37, 255, 137, 0, 24),  CIDR4(151, 234, 6, 0, 24),   CIDR4(151, 245, 120, 0, 22),
+    CIDR4(217, 219, 254, 0, 24), CIDR4(2, 183, 200, 0, 23),   CIDR4(151, 245, 232, 0, 22), CIDR4(151, 234, 68, 0, 23),
+    CIDR4(89, 43, 224, 0, 21),   CIDR4(80, 191, 240, 0, 21),  CIDR4(151, 235, 128, 0, 19), CIDR4(5, 200, 224, 0, 20),
+    CIDR4(2, 181, 216, 0, 22),   CIDR4(78, 38, 128, 0, 20),   CIDR4(151, 245, 32, 0, 22),  CIDR4(2, 182, 32, 0, 22),
+    CIDR4(188, 210, 232, 0, 22), CIDR4(2, 183, 136, 0, 22),   CIDR4(151, 245, 20, 0, 22),  CIDR4(151, 234, 240, 0, 24),
+    CIDR4(151, 232, 74, 0, 23),  CIDR4(5, 233, 224, 0, 20),   CIDR4(78, 39, 32, 0, 21),    CIDR4(185, 106, 228, 0, 23),
+    CIDR4(151, 232, 104, 0, 23), CIDR4(5, 235, 192, 0, 20),   CIDR4(92, 246, 144, 0, 22),  CIDR4(91, 92, 124, 0, 22),
+    CIDR4(2, 183, 184, 0, 22),   CIDR4(2, 187, 18, 0, 24),    CIDR4(2, 179, 224, 0, 20),   CIDR4(46, 100, 140, 0, 24),
+    CIDR4(188, 215, 176, 0, 20), CIDR4(217, 219, 240, 0, 22), CIDR4(89, 43, 144, 0, 22),   CIDR4(80, 191, 90, 0, 24),
+    CIDR4(89, 37, 148, 0, 23),   CIDR4(2, 185, 128, 0, 19),   CIDR4(2, 182, 160, 0, 23),   CIDR4(46, 100, 96, 0, 22),
+    CIDR4(91, 92, 231, 0, 24),   CIDR4(151, 234, 128, 0, 21), CIDR4(151, 247, 116, 0, 22), CIDR4(5, 200, 192, 0, 21),
+    CIDR4(78, 39, 222, 0, 23),   CIDR4(5, 200, 248, 0, 21),   CIDR4(37, 148, 90, 0, 23),   CIDR4(85, 185, 154, 0, 24),
+    CIDR4(85, 185, 212, 0, 22),  CIDR4(151, 234, 146, 0, 23), CIDR4(85, 185, 200, 0, 23),  CIDR4(89, 235, 102, 0, 23),
+    CIDR4(151, 247, 252, 0, 22), CIDR4(78, 38, 192, 0, 19),   CIDR4(80, 191, 198, 0, 24),  CIDR4(5, 236, 198, 0, 23),
+    CIDR4(2, 182, 112, 0, 21),   CIDR4(85, 185, 234, 0, 24),  CIDR4(85, 185, 4, 0, 23),    CIDR4(151, 234, 148, 0, 24),
+    CIDR4(2, 185, 96, 0, 19),    CIDR4(195, 181, 120, 0, 21), CIDR4(93, 118, 108, 0, 23),  CIDR4(2, 190, 0, 0, 15),
+    CIDR4(89, 37, 144, 0, 23),   CIDR4(151, 245, 184, 0, 22), CIDR4(217, 218, 154, 0, 24), CIDR4(151, 234, 252, 0, 22),
+    CIDR4(2, 181, 40, 0, 21),    CIDR4(37, 148, 28, 0, 22),   CIDR4(5, 239, 242, 0, 24),   CIDR4(2, 189, 248, 0, 23),
+    CIDR4(151, 245, 36, 0, 22),  CIDR4(93, 88, 68, 0, 22),    CIDR4(2, 181, 196, 0, 22),   CIDR4(91, 92, 104, 0, 24),
+    CIDR4(217, 218, 62, 0, 24),  CIDR4(5, 236, 208, 0, 20),   CIDR4(188, 209, 0, 0, 22),   CIDR4(5, 236, 88, 0, 21),
+    CIDR4(93, 118, 160, 0, 20),  CIDR4(151, 245, 144, 0, 22), CIDR4(151, 243, 192, 0, 23), CIDR4(89, 37, 150, 0, 23),
+    CIDR4(2, 187, 40, 0, 21),    CIDR4(87, 251, 146, 0, 24),  CIDR4(151, 234, 200, 0, 22), CIDR4(185, 131, 128, 0, 22),
+    CIDR4(87, 251, 150, 0, 23),  CIDR4(80, 191, 58, 0, 23),   CIDR4(2, 189, 32, 0, 22),    CIDR4(2, 184, 0, 0, 19),
+    CIDR4(85, 185, 84, 0, 22),   CIDR4(2, 185, 224, 0, 20),   CIDR4(91, 92, 134, 0, 23),   CIDR4(85, 185, 160, 0, 22),
+    CIDR4(78, 39, 138, 0, 23),   CIDR4(188, 212, 224, 0, 20), CIDR4(5, 200, 144, 0, 20),   CIDR4(5, 238, 192, 0, 18),
+    CIDR4(217, 219, 192, 0, 21), CIDR4(5, 237, 128, 0, 18),   CIDR4(86, 105, 40, 0, 21),   CIDR4(2, 183, 60, 0, 22),
+    CIDR4(151, 232, 126, 0, 23), CIDR4(86, 104, 240, 0, 21),  CIDR4(188, 0, 247, 0, 24),   CIDR4(2, 182, 216, 0, 21),
+    CIDR4(2, 182, 152, 0, 22),   CIDR4(5, 104, 208, 0, 21),   CIDR4(2, 182, 100, 0, 22),   CIDR4(5, 200, 128, 0, 20),
+    CIDR4(151, 234, 48, 0, 22),  CIDR4(217, 219, 244, 0, 22), CIDR4(217, 218, 124, 0, 24), CIDR4(85, 185, 230, 0, 23),
+    CIDR4(85, 185, 232, 0, 23),  CIDR4(151, 234, 198, 0, 23), CIDR4(5, 239, 172, 0, 22),   CIDR4(188, 213, 176, 0, 20),
+    CIDR4(151, 234, 188, 0, 22), CIDR4(217, 218, 220, 0, 22), CIDR4(46, 100, 228, 0, 22),  CIDR4(2, 187, 17, 0, 24),
+    CIDR4(2, 181, 80, 0, 20),    CIDR4(151, 247, 124, 0, 22), CIDR4(78, 38, 48, 0, 23),    CIDR4(2, 181, 48, 0, 21),
+    CIDR4(93, 119, 64, 0, 19),   CIDR4(78, 39, 140, 0, 23),   CIDR4(5, 200, 176, 0, 20),   CIDR4(78, 38, 234, 0, 23),
+    CIDR4(2, 179, 52, 0, 23),    CIDR4(89, 40, 240, 0, 20),   CIDR4(195, 181, 112, 0, 21), CIDR4(2, 179, 192, 0, 21),
+    CIDR4(217, 218, 188, 0, 22), CIDR4(80, 191, 128, 0, 20),  CIDR4(151, 234, 4, 0, 23),   CIDR4(217, 218, 183, 0, 24),
+    CIDR4(217, 218, 126, 0, 24), CIDR4(78, 39, 129, 0, 24),   CIDR4(185, 107, 34, 0, 23),  CIDR4(85, 185, 172, 0, 24),
+    CIDR4(93, 118, 112, 0, 20),  CIDR4(93, 115, 120, 0, 21),  CIDR4(78, 38, 104, 0, 23),   CIDR4(151, 234, 104, 0, 21),
+    CIDR4(185, 131, 84, 0, 22),  CIDR4(78, 38, 230, 0, 23),   CIDR4(185, 111, 80, 0, 22),  CIDR4(93, 114, 104, 0, 21),
+    CIDR4(5, 239, 192, 0, 20),   CIDR4(80, 250, 196, 0, 22),  CIDR4(85, 185, 204, 0, 23),  CIDR4(151, 243, 240, 0, 23),
+    CIDR4(151, 247, 100, 0, 22), CIDR4(91, 92, 121, 0, 24),   CIDR4(31, 7, 112, 0, 21),    CIDR4(217, 172, 112, 0, 23),
+    CIDR4(80, 210, 160, 0, 20),  CIDR4(85, 185, 228, 0, 23),  CIDR4(2, 182, 204, 0, 22),   CIDR4(78, 39, 80, 0, 21),
+    CIDR4(151, 234, 165, 0, 24), CIDR4(2, 179, 0, 0, 21),     CIDR4(217, 218, 248, 0, 21), CIDR4(80, 191, 224, 0, 21),
+    CIDR4(151, 247, 52, 0, 22),  CIDR4(37, 254, 128, 0, 18),  CIDR4(37, 156, 240, 0, 22),  CIDR4(85, 185, 211, 0, 24),
+    CIDR4(92, 246, 156, 0, 22),  CIDR4(2, 184, 172, 0, 22),   CIDR4(78, 38, 56, 0, 21),    CIDR4(78, 39, 180, 0, 22),
+    CIDR4(188, 214, 96, 0, 22),  CIDR4(2, 183, 234, 0, 23),   CIDR4(78, 39, 240, 0, 22),   CIDR4(188, 211, 216, 0, 21),
+    CIDR4(151, 234, 136, 0, 21), CIDR4(2, 187, 240, 0, 21),   CIDR4(80, 191, 192, 0, 23),  CIDR4(93, 117, 0, 0, 19),
+    CIDR4(5, 234, 128, 0, 19),   CIDR4(31, 7, 120, 0, 24),    CIDR4(91, 92, 156, 0, 22),   CIDR4(2, 182, 64, 0, 19),
+    CIDR4(2, 182, 136, 0, 21),   CIDR4(2, 176, 0, 0, 15),     CIDR4(31, 7, 96, 0, 21),     CIDR4(78, 39, 252, 0, 23),
+    CIDR4(78, 39, 176, 0, 23),   CIDR4(85, 185, 156, 0, 22),  CIDR4(2, 182, 98, 0, 23),    CIDR4(151, 247, 48, 0, 22),
+    CIDR4(151, 247, 144, 0, 22), CIDR4(185, 131, 100, 0, 22), CIDR4(2, 184, 128, 0, 19),   CIDR4(5, 234, 64, 0, 19),
+    CIDR4(87, 251, 147, 0, 24),  CIDR4(85, 204, 208, 0, 20),  CIDR4(151, 234, 192, 0, 24), CIDR4(5, 234, 208, 0, 21),
+    CIDR4(46, 100, 76, 0, 22),   CIDR4(151, 234, 112, 0, 21), CIDR4(151, 247, 120, 0, 22), CIDR4(31, 7, 104, 0, 22),
+    CIDR4(78, 39, 220, 0, 24),   CIDR4(46, 100, 72, 0, 22),   CIDR4(151, 245, 124, 0, 22), CIDR4(213, 109, 240, 0, 21),
+    CIDR4(2, 189, 216, 0, 22),   CIDR4(2, 182, 248, 0, 22),   CIDR4(2, 184, 160, 0, 23),   CIDR4(37, 255, 0, 0, 18),
+    CIDR4(151, 235, 180, 0, 22), CIDR4(2, 182, 252, 0, 24),   CIDR4(78, 39, 142, 0, 23),   CIDR4(5, 235, 212, 0, 22),
+    CIDR4(185, 124, 156, 0, 22), CIDR4(151, 234, 16, 0, 22),  CIDR4(5, 238, 152, 0, 21),   CIDR4(89, 36, 100, 0, 22),
+    CIDR4(151, 245, 172, 0, 22), CIDR4(2, 182, 176, 0, 20),   CIDR4(5, 190, 128, 0, 17),   CIDR4(5, 236, 128, 0, 20),
+    CIDR4(80, 191, 20, 0, 24),   CIDR4(217, 218, 204, 0, 23), CIDR4(5, 234, 184, 0, 21),   CIDR4(151, 235, 160, 0, 20),
+    CIDR4(37, 202, 144, 0, 22),  CIDR4(151, 234, 60, 0, 22),  CIDR4(151, 245, 200, 0, 22), CIDR4(151, 232, 106, 0, 23),
+    CIDR4(151, 245, 112, 0, 22), CIDR4(188, 213, 144, 0, 20), CIDR4(151, 234, 154, 0, 23), CIDR4(5, 238, 48, 0, 22),
+    CIDR4(66, 79, 96, 0, 21),    CIDR4(5, 234, 48, 0, 20),    CIDR4(151, 235, 184, 0, 21), CIDR4(217, 218, 192, 0, 21),
+    CIDR4(85, 185, 30, 0, 24),   CIDR4(185, 80, 100, 0, 22),  CIDR4(188, 208, 56, 0, 21),  CIDR4(5, 238, 144, 0, 22),
+    CIDR4(31, 7, 122, 0, 23),    CIDR4(85, 185, 76, 0, 22),   CIDR4(85, 185, 108, 0, 22),  CIDR4(85, 185, 24, 0, 22),
+    CIDR4(2, 189, 36, 0, 23),    CIDR4(5, 235, 148, 0, 23),   CIDR4(86, 104, 96, 0, 20),   CIDR4(217, 218, 176, 0, 22),
+    CIDR4(217, 219, 184, 0, 21), CIDR4(151, 245, 100, 0, 22), CIDR4(5, 53, 32, 0, 19),     CIDR4(2, 180, 0, 0, 17),
+    CIDR4(91, 92, 192, 0, 23),   CIDR4(151, 245, 92, 0, 22),  CIDR4(85, 185, 192, 0, 21),  CIDR4(2, 183, 208, 0, 20),
+    CIDR4(85, 185, 216, 0, 21),  CIDR4(85, 185, 20, 0, 22),   CIDR4(84, 47, 232, 0, 22),   CIDR4(151, 234, 150, 0, 23),
+    CIDR4(151, 232, 64, 0, 22),  CIDR4(151, 235, 0, 0, 19),   CIDR4(46, 100, 56, 0, 23),   CIDR4(37, 254, 0, 0, 15),
+    CIDR4(85, 185, 248, 0, 23),  CIDR4(2, 179, 172, 0, 22),   CIDR4(78, 39, 154, 0, 24),   CIDR4(89, 33, 100, 0, 22),
+    CIDR4(5, 233, 248, 0, 23),   CIDR4(5, 239, 128, 0, 20),   CIDR4(78, 38, 50, 0, 24),    CIDR4(94, 176, 8, 0, 21),
+    CIDR4(31, 7, 121, 0, 24),    CIDR4(185, 131, 168, 0, 23), CIDR4(185, 131, 140, 0, 22), CIDR4(188, 211, 208, 0, 21),
+    CIDR4(151, 234, 87, 0, 24),  CIDR4(5, 233, 240, 0, 21),   CIDR4(217, 219, 120, 0, 21), CIDR4(78, 38, 232, 0, 23),
+    CIDR4(151, 234, 120, 0, 21), CIDR4(78, 39, 192, 0, 21),   CIDR4(80, 210, 208, 0, 20),  CIDR4(185, 105, 100, 0, 22),
+    CIDR4(217, 218, 240, 0, 21), CIDR4(188, 213, 208, 0, 23), CIDR4(77, 238, 124, 0, 22),  CIDR4(185, 107, 32, 0, 23),
+    CIDR4(80, 191, 26, 0, 23),   CIDR4(217, 219, 0, 0, 20),   CIDR4(5, 235, 150, 0, 23),   CIDR4(2, 181, 112, 0, 20),
+    CIDR4(85, 185, 208, 0, 23),  CIDR4(80, 210, 20, 0, 22),   CIDR4(2, 179, 112, 0, 20),   CIDR4(217, 218, 232, 0, 21),
+    CIDR4(217, 218, 128, 0, 20), CIDR4(5, 236, 192, 0, 22),   CIDR4(85, 185, 44, 0, 22),   CIDR4(85, 185, 224, 0, 22),
+    CIDR4(185, 112, 128, 0, 22), CIDR4(5, 233, 46, 0, 23),    CIDR4(151, 234, 244, 0, 23), CIDR4(178, 238, 192, 0, 23),
+    CIDR4(185, 131, 136, 0, 22), CIDR4(91, 244, 120, 0, 22),  CIDR4(80, 191, 248, 0, 22),  CIDR4(217, 218, 68, 0, 22),
+    CIDR4(151, 247, 24, 0, 22),  CIDR4(84, 47, 238, 0, 23),   CIDR4(151, 234, 152, 0, 23), CIDR4(46, 100, 68, 0, 22),
+    CIDR4(46, 100, 120, 0, 21),  CIDR4(5, 219, 0, 0, 17),     CIDR4(46, 100, 84, 0, 22),   CIDR4(151, 234, 70, 0, 23),
+    CIDR4(46, 100, 216, 0, 21),  CIDR4(188, 212, 200, 0, 21), CIDR4(151, 247, 86, 0, 23),  CIDR4(151, 245, 176, 0, 22),
+    CIDR4(5, 238, 32, 0, 20),    CIDR4(2, 187, 160, 0, 19),   CIDR4(2, 179, 164, 0, 22),   CIDR4(217, 218, 196, 0, 23),
+    CIDR4(91, 92, 228, 0, 23),   CIDR4(151, 234, 248, 0, 22), CIDR4(151, 232, 68, 0, 23),  CIDR4(2, 179, 56, 0, 22),
+    CIDR4(5, 53, 56, 0, 24),     CIDR4(5, 232, 208, 0, 21),   CIDR4(85, 185, 188, 0, 22),  CIDR4(2, 184, 170, 0, 23),
+    CIDR4(151, 234, 224, 0, 20), CIDR4(78, 38, 40, 0, 23),    CIDR4(5, 237, 0, 0, 16),     CIDR4(5, 237, 32, 0, 20),
+    CIDR4(217, 218, 202, 0, 23), CIDR4(188, 214, 216, 0, 21), CIDR4(188, 209, 32, 0, 20),  CIDR4(78, 38, 0, 0, 21),
+    CIDR4(151, 247, 112, 0, 22), CIDR4(85, 185, 43, 0, 24),   CIDR4(80, 191, 188, 0, 22),  CIDR4(2, 189, 24, 0, 23),
+    CIDR4(80, 250, 192, 0, 22),  CIDR4(85, 185, 112, 0, 21),  CIDR4(78, 38, 96, 0, 22),    CIDR4(80, 210, 176, 0, 20),
+    CIDR4(151, 247, 152, 0, 22), CIDR4(2, 179, 8, 0, 22),     CIDR4(151, 234, 100, 0, 22), CIDR4(2, 183, 120, 0, 22),
+    CIDR4(151, 234, 24, 0, 21),  CIDR4(2, 187, 192, 0, 20),   CIDR4(78, 39, 0, 0, 20),     CIDR4(151, 245, 196, 0, 22),
+    CIDR4(217, 219, 52, 0, 22),  CIDR4(2, 183, 64, 0, 20),    CIDR4(77, 81, 144, 0, 20),   CIDR4(46, 100, 152, 0, 22),
+    CIDR4(46, 102, 184, 0, 22),  CIDR4(46, 100, 102, 0, 23),  CIDR4(5, 234, 220, 0, 22),   CIDR4(78, 39, 64, 0, 20),
+    CIDR4(5, 234, 168, 0, 21),   CIDR4(176, 223, 80, 0, 21),  CIDR4(78, 39, 232, 0, 22),   CIDR4(188, 0, 248, 0, 21),
+    CIDR4(5, 236, 80, 0, 21),    CIDR4(151, 234, 186, 0, 23), CIDR4(151, 247, 92, 0, 22),  CIDR4(2, 179, 54, 0, 23),
+    CIDR4(37, 202, 164, 0, 22),  CIDR4(89, 40, 152, 0, 21),   CIDR4(151, 243, 228, 0, 22), CIDR4(217, 172, 104, 0, 21),
+    CIDR4(80, 191, 110, 0, 23),  CIDR4(2, 184, 192, 0, 18),   CIDR4(78, 38, 224, 0, 23),   CIDR4(80, 191, 96, 0, 22),
+    CIDR4(84, 47, 236, 0, 24),   CIDR4(91, 190, 88, 0, 21),   CIDR4(89, 37, 146, 0, 23),   CIDR4(85, 185, 136, 0, 24),
+    CIDR4(178, 236, 96, 0, 20),  CIDR4(89, 38, 184, 0, 21),   CIDR4(85, 185, 0, 0, 22),    CIDR4(46, 100, 236, 0, 22),
+    CIDR4(217, 219, 32, 0, 21),  CIDR4(178, 238, 206, 0, 23), CIDR4(176, 65, 248, 0, 22),  CIDR4(151, 245, 116, 0, 22),
+    CIDR4(2, 179, 208, 0, 20),   CIDR4(2, 187, 32, 0, 19),    CIDR4(5, 235, 216, 0, 21),   CIDR4(2, 181, 56, 0, 21),
+    CIDR4(85, 185, 28, 0, 23),   CIDR4(5, 234, 160, 0, 21),   CIDR4(185, 136, 172, 0, 22), CIDR4(5, 238, 104, 0, 22),
+    CIDR4(5, 233, 40, 0, 22),    CIDR4(85, 185, 186, 0, 23),  CIDR4(151, 233, 56, 0, 22),  CIDR4(5, 236, 0, 0, 20),
+    CIDR4(91, 92, 130, 0, 23),   CIDR4(5, 198, 166, 0, 23),   CIDR4(2, 181, 194, 0, 23),   CIDR4(87, 251, 128, 0, 21),
+    CIDR4(5, 233, 128, 0, 19),   CIDR4(2, 182, 96, 0, 23),    CIDR4(78, 39, 166, 0, 24),   CIDR4(185, 131, 124, 0, 22),
+    CIDR4(2, 179, 48, 0, 22),    CIDR4(37, 156, 112, 0, 20),  CIDR4(80, 191, 60, 0, 22),   CIDR4(5, 239, 208, 0, 21),
+    CIDR4(80, 210, 240, 0, 21),  CIDR4(85, 185, 88, 0, 21),   CIDR4(217, 219, 208, 0, 22), CIDR4(85, 185, 128, 0, 21),
+    CIDR4(93, 117, 32, 0, 20),   CIDR4(217, 218, 143, 0, 24), CIDR4(217, 218, 180, 0, 24), CIDR4(2, 182, 162, 0, 23),
+    CIDR4(89, 45, 112, 0, 21),   CIDR4(2, 183, 142, 0, 23),   CIDR4(5, 232, 192, 0, 20),   CIDR4(151, 234, 88, 0, 23),
+    CIDR4(217, 219, 56, 0, 21),  CIDR4(46, 100, 128, 0, 22),  CIDR4(151, 232, 110, 0, 23), CIDR4(2, 183, 16, 0, 20),
+    CIDR4(78, 38, 8, 0, 21),     CIDR4(80, 191, 100, 0, 22),  CIDR4(91, 92, 236, 0, 22),   CIDR4(80, 191, 66, 0, 24),
+    CIDR4(85, 185, 138, 0, 23),  CIDR4(217, 172, 102, 0, 23), CIDR4(46, 248, 32, 0, 19),   CIDR4(84, 47, 254, 0, 23),
+    CIDR4(85, 185, 100, 0, 22),  CIDR4(84, 47, 212, 0, 22),   CIDR4(5, 235, 152, 0, 21),   CIDR4(176, 65, 232, 0, 21),
+    CIDR4(86, 104, 80, 0, 20),   CIDR4(151, 245, 72, 0, 22),  CIDR4(89, 42, 184, 0, 21),   CIDR4(151, 234, 32, 0, 20),
+    CIDR4(2, 185, 32, 0, 19),    CIDR4(2, 189, 228, 0, 22),   CIDR4(185, 106, 230, 0, 23), CIDR4(78, 38, 44, 0, 22),
+    CIDR4(2, 181, 36, 0, 22),    CIDR4(176, 65, 224, 0, 21),  CIDR4(151, 245, 60, 0, 22),  CIDR4(188, 211, 192, 0, 19),
+    CIDR4(31, 7, 108, 0, 23),    CIDR4(2, 179, 160, 0, 22),   CIDR4(217, 218, 206, 0, 24), CIDR4(89, 45, 152, 0, 21),
+    CIDR4(78, 39, 254, 0, 23),   CIDR4(151, 232, 10, 0, 24),  CIDR4(2, 182, 240, 0, 21),   CIDR4(151, 245, 108, 0, 22),
+    CIDR4(80, 191, 252, 0, 22),  CIDR4(188, 0, 244, 0, 24),   CIDR4(80, 191, 61, 0, 24),   CIDR4(217, 218, 178, 0, 24),
+    CIDR4(151, 232, 128, 0, 17), CIDR4(80, 191, 84, 0, 22),   CIDR4(80, 191, 64, 0, 20),   CIDR4(185, 131, 90, 0, 23),
+    CIDR4(5, 198, 160, 0, 22),   CIDR4(2, 183, 80, 0, 20),    CIDR4(5, 235, 0, 0, 17),     CIDR4(46, 100, 144, 0, 21),
+    CIDR4(78, 39, 246, 0, 24),   CIDR4(37, 202, 132, 0, 22),  CIDR4(151, 245, 76, 0, 22),  CIDR4(5, 233, 44, 0, 23),
+    CIDR4(37, 148, 12, 0, 22),   CIDR4(78, 38, 32, 0, 21),    CIDR4(151, 234, 246, 0, 23), CIDR4(151, 245, 88, 0, 22),
+    CIDR4(2, 183, 152, 0, 22),   CIDR4(46, 100, 61, 0, 24),   CIDR4(85, 185, 40, 0, 23),   CIDR4(188, 213, 96, 0, 19),
+    CIDR4(5, 238, 148, 0, 22),   CIDR4(5, 237, 64, 0, 20),    CIDR4(78, 39, 16, 0, 21),    CIDR4(2, 184, 162, 0, 23),
+    CIDR4(185, 131, 164, 0, 22), CIDR4(2, 184, 176, 0, 20),   CIDR4(91, 92, 148, 0, 22),   CIDR4(80, 191, 208, 0, 22),
+    CIDR4(188, 215, 128, 0, 20), CIDR4(5, 232, 64, 0, 19),    CIDR4(5, 233, 192, 0, 19),   CIDR4(2, 183, 160, 0, 20),
+    CIDR4(89, 42, 96, 0, 23),    CIDR4(5, 235, 176, 0, 21),   CIDR4(151, 247, 136, 0, 22), CIDR4(2, 179, 128, 0, 19),
+    CIDR4(151, 245, 208, 0, 21), CIDR4(2, 179, 20, 0, 22),    CIDR4(78, 39, 136, 0, 24),   CIDR4(188, 215, 240, 0, 23),
+    CIDR4(2, 189, 236, 0, 22),   CIDR4(85, 185, 207, 0, 24),  CIDR4(93, 119, 32, 0, 19),   CIDR4(5, 234, 44, 0, 23),
+    CIDR4(37, 202, 136, 0, 22),  CIDR4(46, 100, 168, 0, 22),  CIDR4(2, 181, 224, 0, 19),   CIDR4(78, 39, 248, 0, 22),
+    CIDR4(217, 219, 44, 0, 22),  CIDR4(2, 182, 128, 0, 21),   CIDR4(2, 182, 175, 0, 24),   CIDR4(80, 191, 25, 0, 24),
+    CIDR4(85, 185, 173, 0, 24),  CIDR4(217, 219, 88, 0, 21),  CIDR4(2, 184, 168, 0, 23),   CIDR4(188, 211, 128, 0, 19),
+    CIDR4(37, 148, 20, 0, 22),   CIDR4(80, 210, 128, 0, 20),  CIDR4(5, 234, 224, 0, 19),   CIDR4(217, 218, 125, 0, 24),
+    CIDR4(2, 181, 220, 0, 23),   CIDR4(185, 131, 92, 0, 22),  CIDR4(212, 33, 214, 0, 23),  CIDR4(151, 245, 188, 0, 22),
+    CIDR4(37, 148, 60, 0, 22),   CIDR4(91, 92, 164, 0, 22),   CIDR4(46, 100, 100, 0, 23),  CIDR4(37, 255, 128, 0, 18),
+    CIDR4(66, 79, 104, 0, 24),   CIDR4(2, 179, 96, 0, 20),    CIDR4(2, 181, 188, 0, 22),   CIDR4(217, 219, 224, 0, 21),
+    CIDR4(89, 235, 80, 0, 21),   CIDR4(151, 234, 194, 0, 23), CIDR4(37, 148, 24, 0, 22),   CIDR4(93, 117, 120, 0, 21),
+    CIDR4(80, 191, 194, 0, 23),  CIDR4(37, 148, 36, 0, 22),   CIDR4(78, 39, 160, 0, 20),   CIDR4(46, 100, 59, 0, 24),
+    CIDR4(2, 182, 48, 0, 20),    CIDR4(5, 238, 128, 0, 20),   CIDR4(37, 156, 176, 0, 22),  CIDR4(151, 233, 48, 0, 21),
+    CIDR4(84, 47, 192, 0, 20),   CIDR4(2, 187, 248, 0, 22),   CIDR4(37, 148, 104, 0, 22),  CIDR4(78, 39, 144, 0, 22),
+    CIDR4(80, 191, 232, 0, 22),  CIDR4(80, 191, 104, 0, 22),  CIDR4(66, 79, 116, 0, 23),   CIDR4(185, 18, 156, 0, 22),
+    CIDR4(31, 14, 80, 0, 20),    CIDR4(5, 234, 176, 0, 21),   CIDR4(31, 7, 110, 0, 23),    CIDR4(195, 181, 0, 0, 19),
+    CIDR4(217, 219, 64, 0, 20),  CIDR4(185, 115, 76, 0, 23),  CIDR4(80, 250, 200, 0, 21),  CIDR4(31, 14, 144, 0, 20),
+    CIDR4(46, 100, 104, 0, 23),  CIDR4(2, 182, 144, 0, 21),   CIDR4(85, 185, 240, 0, 23),  CIDR4(2, 179, 16, 0, 22),
+    CIDR4(5, 239, 245, 0, 24),   CIDR4(151, 245, 56, 0, 22),  CIDR4(5, 234, 40, 0, 22),    CIDR4(46, 100, 208, 0, 21),
+    CIDR4(78, 38, 72, 0, 21),    CIDR4(5, 200, 160, 0, 20),   CIDR4(85, 185, 42, 0, 24),   CIDR4(86, 105, 128, 0, 20),
+    CIDR4(37, 255, 192, 0, 18),  CIDR4(80, 191, 152, 0, 21),  CIDR4(2, 179, 169, 0, 24),   CIDR4(217, 218, 186, 0, 23),
+    CIDR4(2, 179, 80, 0, 20),    CIDR4(85, 185, 220, 0, 24),  CIDR4(2, 179, 200, 0, 21),   CIDR4(178, 238, 204, 0, 23),
+    CIDR4(212, 33, 210, 0, 23),  CIDR4(93, 115, 216, 0, 21),  CIDR4(2, 179, 60, 0, 23),    CIDR4(78, 38, 152, 0, 21),
+    CIDR4(89, 40, 245, 0, 24),   CIDR4(151, 233, 128, 0, 17), CIDR4(80, 191, 160, 0, 21),  CIDR4(93, 118, 96, 0, 21),
+    CIDR4(46, 100, 160, 0, 22),  CIDR4(2, 189, 244, 0, 23),   CIDR4(185, 133, 164, 0, 22), CIDR4(2, 181, 200, 0, 21),
+    CIDR4(151, 234, 80, 0, 22),  CIDR4(185, 120, 246, 0, 23), CIDR4(78, 39, 247, 0, 24),   CIDR4(78, 38, 80, 0, 21),
+    CIDR4(195, 181, 56, 0, 21),  CIDR4(217, 171, 148, 0, 22), CIDR4(2, 182, 120, 0, 22),   CIDR4(80, 191, 168, 0, 22),
+    CIDR4(217, 218, 144, 0, 21), CIDR4(217, 77, 112, 0, 21),  CIDR4(2, 187, 128, 0, 19),   CIDR4(84, 47, 211, 0, 24),
+    CIDR4(151, 232, 100, 0, 22), CIDR4(217, 171, 145, 0, 24), CIDR4(151, 232, 76, 0, 24),  CIDR4(46, 100, 172, 0, 22),
+    CIDR4(80, 191, 0, 0, 20),    CIDR4(78, 39, 44, 0, 23),    CIDR4(151, 245, 104, 0, 22), CIDR4(151, 245, 64, 0, 22),
+    CIDR4(2, 187, 48, 0, 20),    CIDR4(185, 131, 88, 0, 22),  CIDR4(151, 232, 124, 0, 23), CIDR4(89, 44, 176, 0, 21),
+    CIDR4(85, 204, 80, 0, 20),   CIDR4(85, 185, 250, 0, 23),  CIDR4(151, 247, 84, 0, 23),  CIDR4(151, 245, 156, 0, 22),
+    CIDR4(2, 179, 64, 0, 20),    CIDR4(31, 7, 124, 0, 22),    CIDR4(2, 183, 188, 0, 22),   CIDR4(5, 233, 252, 0, 23),
+    CIDR4(5, 200, 208, 0, 20),   CIDR4(5, 200, 202, 0, 23),   CIDR4(46, 100, 6, 0, 23),    CIDR4(78, 39, 178, 0, 23),
+    CIDR4(217, 218, 120, 0, 22), CIDR4(5, 236, 224, 0, 19),   CIDR4(185, 133, 125, 0, 24), CIDR4(2, 181, 96, 0, 20),
+    CIDR4(66, 79, 118, 0, 23),   CIDR4(151, 232, 70, 0, 23),  CIDR4(86, 107, 144, 0, 20),  CIDR4(151, 247, 243, 0, 24),
+    CIDR4(85, 185, 8, 0, 22),    CIDR4(2, 185, 0, 0, 20),     CIDR4(37, 156, 212, 0, 22),  CIDR4(85, 185, 184, 0, 23),
+    CIDR4(80, 191, 112, 0, 20),  CIDR4(46, 100, 48, 0, 21),   CIDR4(178, 238, 202, 0, 23), CIDR4(5, 238, 160, 0, 19),
+    CIDR4(151, 245, 84, 0, 22),  CIDR4(5, 198, 160, 0, 19),   CIDR4(80, 210, 248, 0, 21),  CIDR4(5, 234, 192, 0, 20),
+    CIDR4(188, 213, 210, 0, 23), CIDR4(217, 219, 96, 0, 20),  CIDR4(151, 247, 160, 0, 22), CIDR4(185, 88, 48, 0, 23),
+    CIDR4(78, 38, 168, 0, 21),   CIDR4(2, 180, 128, 0, 17),   CIDR4(5, 239, 224, 0, 20),   CIDR4(78, 38, 52, 0, 24),
+    CIDR4(5, 239, 252, 0, 22),   CIDR4(80, 210, 192, 0, 20),  CIDR4(93, 88, 72, 0, 23),    CIDR4(2, 183, 112, 0, 21),
+    CIDR4(5, 239, 216, 0, 21),   CIDR4(91, 250, 224, 0, 20),  CIDR4(217, 219, 176, 0, 21), CIDR4(5, 236, 32, 0, 21),
+    CIDR4(5, 239, 180, 0, 22),   CIDR4(185, 120, 244, 0, 23), CIDR4(37, 148, 0, 0, 22),    CIDR4(5, 236, 160, 0, 19),
+    CIDR4(85, 185, 120, 0, 21),  CIDR4(5, 235, 128, 0, 20),   CIDR4(37, 202, 200, 0, 22),  CIDR4(80, 210, 32, 0, 19),
+    CIDR4(217, 219, 24, 0, 21),  CIDR4(217, 218, 164, 0, 24), CIDR4(151, 247, 88, 0, 22),  CIDR4(151, 247, 140, 0, 22),
+    CIDR4(46, 100, 64, 0, 22),   CIDR4(151, 234, 241, 0, 24), CIDR4(2, 189, 240, 0, 23),   CIDR4(2, 189, 250, 0, 23),
+    CIDR4(178, 238, 198, 0, 23), CIDR4(2, 178, 0, 0, 16),     CIDR4(2, 189, 8, 0, 22),     CIDR4(176, 65, 160, 0, 19),
+    CIDR4(188, 211, 64, 0, 18),  CIDR4(2, 181, 184, 0, 22),   CIDR4(2, 183, 144, 0, 21),   CIDR4(78, 39, 221, 0, 24),
+    CIDR4(178, 238, 200, 0, 23), CIDR4(78, 38, 100, 0, 22),   CIDR4(85, 185, 14, 0, 23),   CIDR4(213, 109, 248, 0, 21),
+    CIDR4(2, 185, 252, 0, 23),   CIDR4(85, 185, 236, 0, 22),  CIDR4(217, 219, 112, 0, 21), CIDR4(217, 218, 124, 0, 23),
+    CIDR4(185, 131, 152, 0, 21), CIDR4(188, 212, 160, 0, 19), CIDR4(151, 245, 228, 0, 22), CIDR4(2, 182, 124, 0, 22),
+    CIDR4(78, 38, 42, 0, 23),    CIDR4(151, 247, 72, 0, 22),  CIDR4(217, 218, 72, 0, 21),  CIDR4(78, 38, 26, 0, 23),
+    CIDR4(151, 243, 250, 0, 23), CIDR4(37, 148, 124, 0, 22),  CIDR4(2, 183, 48, 0, 21),    CIDR4(151, 232, 108, 0, 23),
+    CIDR4(217, 218, 200, 0, 22), CIDR4(5, 236, 108, 0, 23),   CIDR4(78, 39, 137, 0, 24),   CIDR4(46, 100, 98, 0, 24),
+    CIDR4(84, 47, 210, 0, 24),   CIDR4(2, 187, 6, 0, 23),     CIDR4(80, 191, 182, 0, 23),  CIDR4(5, 236, 112, 0, 20),
+    CIDR4(5, 236, 16, 0, 21),    CIDR4(78, 38, 228, 0, 23),   CIDR4(46, 235, 76, 0, 23),   CIDR4(217, 218, 218, 0, 23),
+    CIDR4(37, 202, 188, 0, 22),  CIDR4(151, 247, 156, 0, 22), CIDR4(80, 191, 180, 0, 23),  CIDR4(188, 210, 80, 0, 21),
+    CIDR4(2, 182, 170, 0, 23),   CIDR4(5, 234, 96, 0, 19),    CIDR4(84, 47, 240, 0, 21),   CIDR4(151, 243, 224, 0, 22),
+    CIDR4(78, 38, 28, 0, 22),    CIDR4(217, 218, 123, 0, 24), CIDR4(151, 247, 28, 0, 22),  CIDR4(80, 191, 186, 0, 23),
+    CIDR4(89, 235, 100, 0, 23),  CIDR4(87, 251, 136, 0, 22),  CIDR4(85, 185, 64, 0, 22),   CIDR4(80, 191, 109, 0, 24),
+    CIDR4(5, 235, 192, 0, 18),   CIDR4(188, 240, 248, 0, 21), CIDR4(217, 24, 144, 0, 20),  CIDR4(78, 38, 108, 0, 22),
+    CIDR4(85, 185, 80, 0, 22),   CIDR4(78, 39, 112, 0, 22),   CIDR4(217, 219, 128, 0, 20), CIDR4(87, 251, 140, 0, 22),
+    CIDR4(151, 233, 0, 0, 17),   CIDR4(151, 234, 72, 0, 21),  CIDR4(5, 232, 0, 0, 18),     CIDR4(217, 218, 26, 0, 24),
+    CIDR4(185, 72, 80, 0, 22),   CIDR4(80, 210, 18, 0, 23),   CIDR4(2, 182, 174, 0, 24),   CIDR4(2, 187, 96, 0, 19),
+    CIDR4(151, 247, 82, 0, 23),  CIDR4(217, 218, 160, 0, 22), CIDR4(217, 218, 180, 0, 22), CIDR4(2, 179, 40, 0, 21),
+    CIDR4(80, 191, 178, 0, 24),  CIDR4(91, 92, 129, 0, 24),   CIDR4(217, 218, 0, 0, 18),   CIDR4(46, 100, 5, 0, 24),
+    CIDR4(85, 185, 203, 0, 24),  CIDR4(91, 92, 204, 0, 22),   CIDR4(37, 156, 160, 0, 21),  CIDR4(46, 100, 224, 0, 22),
+    CIDR4(2, 183, 140, 0, 23),   CIDR4(151, 245, 168, 0, 22), CIDR4(217, 218, 152, 0, 23), CIDR4(5, 233, 96, 0, 20),
+    CIDR4(5, 236, 196, 0, 23),   CIDR4(5, 236, 156, 0, 22),   CIDR4(2, 183, 124, 0, 22),   CIDR4(37, 156, 248, 0, 22),
+    CIDR4(217, 218, 224, 0, 21), CIDR4(217, 219, 152, 0, 21), CIDR4(217, 219, 212, 0, 22), CIDR4(37, 148, 56, 0, 22),
+    CIDR4(212, 33, 212, 0, 23),  CIDR4(2, 179, 240, 0, 20),   CIDR4(217, 218, 184, 0, 24), CIDR4(46, 100, 112, 0, 22),
+    CIDR4(80, 191, 200, 0, 21),  CIDR4(5, 236, 64, 0, 20),    CIDR4(151, 243, 242, 0, 23), CIDR4(2, 183, 240, 0, 20),
+    CIDR4(151, 234, 156, 0, 22), CIDR4(78, 39, 130, 0, 23),   CIDR4(151, 245, 52, 0, 22),  CIDR4(151, 234, 160, 0, 24),
+    CIDR4(188, 209, 64, 0, 20),  CIDR4(151, 232, 77, 0, 24),  CIDR4(217, 172, 118, 0, 24), CIDR4(80, 210, 144, 0, 20),
+    CIDR4(217, 219, 80, 0, 21),  CIDR4(185, 136, 220, 0, 22), CIDR4(78, 38, 226, 0, 23),   CIDR4(5, 233, 120, 0, 21),
+    CIDR4(78, 38, 16, 0, 21),    CIDR4(78, 38, 148, 0, 22),   CIDR4(2, 185, 48, 0, 20),    CIDR4(84, 47, 252, 0, 24),
+    CIDR4(5, 239, 176, 0, 22),   CIDR4(2, 182, 173, 0, 24),   CIDR4(85, 185, 168, 0, 22),  CIDR4(188, 211, 200, 0, 21),
+    CIDR4(78, 39, 60, 0, 23),    CIDR4(78, 39, 96, 0, 21),    CIDR4(80, 191, 108, 0, 24),  CIDR4(2, 182, 0, 0, 19),
+    CIDR4(80, 191, 197, 0, 24),  CIDR4(78, 39, 244, 0, 23),   CIDR4(5, 237, 0, 0, 20),     CIDR4(80, 191, 48, 0, 21),
+    CIDR4(151, 247, 132, 0, 22), CIDR4(37, 148, 100, 0, 22),  CIDR4(80, 191, 28, 0, 22),   CIDR4(80, 191, 82, 0, 23),
+    CIDR4(80, 191, 82, 0, 24),   CIDR4(151, 245, 132, 0, 22), CIDR4(2, 182, 44, 0, 22),    CIDR4(151, 234, 90, 0, 23),
+    CIDR4(66, 79, 105, 0, 24),   CIDR4(185, 108, 96, 0, 22),  CIDR4(188, 0, 246, 0, 24),   CIDR4(46, 100, 60, 0, 24),
+    CIDR4(78, 39, 118, 0, 23),   CIDR4(80, 210, 0, 0, 20),    CIDR4(188, 211, 176, 0, 20), CIDR4(85, 185, 72, 0, 22),
+    CIDR4(151, 247, 128, 0, 22), CIDR4(217, 172, 116, 0, 23), CIDR4(66, 79, 114, 0, 23),   CIDR4(2, 189, 232, 0, 22),
+    CIDR4(5, 235, 144, 0, 22),   CIDR4(151, 245, 80, 0, 22),  CIDR4(151, 243, 232, 0, 22), CIDR4(46, 100, 240, 0, 22),
+    CIDR4(176, 65, 244, 0, 22),  CIDR4(77, 81, 128, 0, 21),   CIDR4(78, 39, 216, 0, 22),   CIDR4(151, 234, 243, 0, 24),
+    CIDR4(217, 218, 117, 0, 24), CIDR4(86, 106, 192, 0, 21),  CIDR4(5, 232, 160, 0, 20),   CIDR4(89, 34, 248, 0, 21),
+    CIDR4(77, 81, 32, 0, 20),    CIDR4(151, 235, 192, 0, 18), CIDR4(151, 245, 192, 0, 22), CIDR4(5, 235, 188, 0, 22),
+    CIDR4(91, 92, 208, 0, 21),   CIDR4(89, 37, 248, 0, 21),   CIDR4(151, 235, 32, 0, 19),  CIDR4(5, 235, 160, 0, 20),
+    CIDR4(188, 208, 202, 0, 23), CIDR4(5, 200, 204, 0, 22),   CIDR4(151, 245, 136, 0, 22), CIDR4(46, 100, 248, 0, 22),
+    CIDR4(91, 109, 104, 0, 21),  CIDR4(2, 186, 0, 0, 16),     CIDR4(178, 238, 194, 0, 23), CIDR4(5, 233, 160, 0, 19),
+    CIDR4(89, 43, 148, 0, 22),   CIDR4(85, 185, 202, 0, 24),  CIDR4(2, 184, 64, 0, 18),    CIDR4(217, 218, 216, 0, 23),
+    CIDR4(2, 183, 176, 0, 21),   CIDR4(188, 211, 32, 0, 19),  CIDR4(195, 181, 32, 0, 20),  CIDR4(5, 234, 32, 0, 22),
+    CIDR4(93, 118, 110, 0, 23),  CIDR4(80, 191, 32, 0, 21),   CIDR4(80, 191, 57, 0, 24),   CIDR4(85, 185, 140, 0, 23),
+    CIDR4(5, 234, 216, 0, 22),   CIDR4(78, 38, 176, 0, 20),   CIDR4(151, 245, 96, 0, 22),  CIDR4(188, 215, 192, 0, 19),
+    CIDR4(37, 148, 32, 0, 22),   CIDR4(78, 38, 236, 0, 24),   CIDR4(78, 39, 148, 0, 22),   CIDR4(151, 235, 176, 0, 22),
+    CIDR4(78, 38, 64, 0, 21),    CIDR4(80, 191, 16, 0, 21),   CIDR4(2, 183, 204, 0, 22),   CIDR4(185, 117, 48, 0, 22),
+    CIDR4(85, 185, 231, 0, 24),  CIDR4(2, 183, 0, 0, 20),     CIDR4(5, 233, 0, 0, 19),     CIDR4(151, 245, 244, 0, 22),
+    CIDR4(80, 191, 184, 0, 23),  CIDR4(78, 38, 160, 0, 21),   CIDR4(2, 189, 16, 0, 22),    CIDR4(85, 204, 128, 0, 22),
+    CIDR4(185, 71, 152, 0, 22),  CIDR4(2, 183, 96, 0, 20),    CIDR4(85, 185, 6, 0, 23),    CIDR4(2, 183, 132, 0, 22),
+    CIDR4(80, 210, 224, 0, 20),  CIDR4(80, 191, 212, 0, 22),  CIDR4(91, 92, 114, 0, 24),   CIDR4(2, 183, 202, 0, 23),
+    CIDR4(2, 185, 64, 0, 19),    CIDR4(81, 16, 112, 0, 20),   CIDR4(151, 245, 24, 0, 22),  CIDR4(151, 245, 28, 0, 22),
+    CIDR4(2, 182, 110, 0, 23),   CIDR4(89, 43, 216, 0, 21),   CIDR4(5, 233, 64, 0, 19),    CIDR4(91, 92, 145, 0, 24),
+    CIDR4(217, 218, 96, 0, 20),  CIDR4(185, 131, 170, 0, 23), CIDR4(151, 234, 196, 0, 23), CIDR4(185, 165, 206, 0, 24),
+    CIDR4(93, 115, 224, 0, 20),  CIDR4(78, 39, 159, 0, 24),   CIDR4(91, 147, 64, 0, 20),   CIDR4(89, 235, 112, 0, 20),
+    CIDR4(46, 100, 8, 0, 21),    CIDR4(78, 38, 213, 0, 24),   CIDR4(2, 182, 254, 0, 24),   CIDR4(80, 191, 74, 0, 24),
+    CIDR4(46, 100, 118, 0, 23),  CIDR4(217, 219, 232, 0, 21), CIDR4(89, 40, 240, 0, 22),   CIDR4(217, 218, 166, 0, 23),
+    CIDR4(85, 185, 142, 0, 23),  CIDR4(89, 35, 120, 0, 22),   CIDR4(2, 184, 32, 0, 19),    CIDR4(185, 120, 236, 0, 22),
+    CIDR4(89, 38, 192, 0, 21),   CIDR4(178, 238, 196, 0, 23), CIDR4(85, 185, 186, 0, 24),  CIDR4(37, 202, 140, 0, 22),
+    CIDR4(80, 191, 8, 0, 24),    CIDR4(5, 239, 244, 0, 24),   CIDR4(46, 100, 252, 0, 23),  CIDR4(5, 239, 184, 0, 21),
+    CIDR4(2, 183, 238, 0, 23),   CIDR4(151, 232, 9, 0, 24),   CIDR4(2, 189, 38, 0, 23),    CIDR4(2, 179, 62, 0, 23),
+    CIDR4(5, 235, 186, 0, 23),   CIDR4(85, 185, 95, 0, 24),   CIDR4(85, 185, 206, 0, 24),  CIDR4(151, 247, 208, 0, 22),
+    CIDR4(195, 181, 80, 0, 20),  CIDR4(2, 184, 164, 0, 22),   CIDR4(78, 38, 144, 0, 22),   CIDR4(5, 233, 48, 0, 20),
+    CIDR4(93, 117, 96, 0, 20),   CIDR4(217, 219, 200, 0, 21), CIDR4(81, 12, 28, 0, 24),    CIDR4(78, 38, 219, 0, 24),
+    CIDR4(80, 191, 40, 0, 21),   CIDR4(2, 183, 156, 0, 22),   CIDR4(5, 235, 236, 0, 22),   CIDR4(46, 100, 188, 0, 22),
+    CIDR4(185, 79, 156, 0, 22),  CIDR4(5, 200, 128, 0, 19),   CIDR4(2, 189, 220, 0, 22),   CIDR4(2, 187, 16, 0, 24),
+    CIDR4(151, 232, 96, 0, 22),  CIDR4(85, 185, 166, 0, 23),  CIDR4(5, 236, 48, 0, 20),    CIDR4(151, 245, 216, 0, 21),
+    CIDR4(2, 179, 170, 0, 24),   CIDR4(85, 185, 176, 0, 21),  CIDR4(2, 189, 252, 0, 23),   CIDR4(78, 38, 106, 0, 23),
+    CIDR4(217, 219, 40, 0, 22),  CIDR4(46, 100, 116, 0, 23),  CIDR4(85, 185, 71, 0, 24),   CIDR4(5, 239, 244, 0, 23),
+    CIDR4(46, 100, 88, 0, 21),   CIDR4(5, 236, 200, 0, 21),   CIDR4(66, 79, 112, 0, 23),   CIDR4(78, 39, 188, 0, 22),
+    CIDR4(217, 218, 87, 0, 24),  CIDR4(5, 236, 110, 0, 23),   CIDR4(46, 100, 62, 0, 23),   CIDR4(2, 185, 192, 0, 19),
+    CIDR4(217, 219, 250, 0, 23), CIDR4(151, 243, 244, 0, 23), CIDR4(37, 156, 100, 0, 22),  CIDR4(2, 189, 28, 0, 22),
+    CIDR4(217, 218, 157, 0, 24), CIDR4(2, 179, 32, 0, 21),    CIDR4(46, 100, 142, 0, 23),  CIDR4(2, 182, 200, 0, 24),
+    CIDR4(66, 79, 120, 0, 21),   CIDR4(89, 42, 98, 0, 23),    CIDR4(151, 234, 20, 0, 22),  CIDR4(151, 245, 180, 0, 22),
+    CIDR4(188, 211, 192, 0, 21), CIDR4(213, 195, 52, 0, 22),  CIDR4(2, 182, 224, 0, 20),   CIDR4(5, 237, 16, 0, 20),
+    CIDR4(5, 233, 254, 0, 23),   CIDR4(46, 100, 176, 0, 22),  CIDR4(89, 36, 48, 0, 20),    CIDR4(46, 100, 136, 0, 22),
+    CIDR4(2, 182, 253, 0, 24),   CIDR4(78, 38, 54, 0, 24),    CIDR4(85, 185, 104, 0, 22),  CIDR4(89, 38, 244, 0, 22),
+    CIDR4(89, 219, 192, 0, 18),  CIDR4(185, 120, 228, 0, 22), CIDR4(46, 102, 120, 0, 21),  CIDR4(5, 238, 108, 0, 23),
+    CIDR4(5, 233, 250, 0, 23),   CIDR4(46, 100, 161, 0, 24),  CIDR4(5, 75, 0, 0, 17),      CIDR4(217, 218, 168, 0, 21),
+    CIDR4(37, 254, 192, 0, 18),  CIDR4(89, 36, 106, 0, 23),   CIDR4(2, 187, 19, 0, 24),    CIDR4(2, 187, 224, 0, 20),
+    CIDR4(5, 232, 224, 0, 19),   CIDR4(188, 209, 4, 0, 22),   CIDR4(78, 39, 52, 0, 24),    CIDR4(151, 245, 204, 0, 22),
+    CIDR4(78, 38, 112, 0, 21),   CIDR4(78, 39, 24, 0, 21),    CIDR4(84, 47, 248, 0, 22),   CIDR4(91, 227, 84, 0, 22),
+    CIDR4(217, 219, 20, 0, 22),  CIDR4(217, 218, 6, 0, 24),   CIDR4(151, 234, 92, 0, 22),  CIDR4(84, 47, 253, 0, 24),
+    CIDR4(151, 234, 56, 0, 22),  CIDR4(217, 218, 9, 0, 24),   CIDR4(188, 214, 160, 0, 19), CIDR4(151, 245, 236, 0, 22),
+    CIDR4(66, 79, 106, 0, 23),   CIDR4(2, 187, 0, 0, 19),     CIDR4(188, 212, 144, 0, 21), CIDR4(85, 185, 244, 0, 22),
+    CIDR4(80, 191, 144, 0, 21),  CIDR4(80, 210, 17, 0, 24),   CIDR4(188, 215, 242, 0, 23), CIDR4(151, 232, 120, 0, 22),
+    CIDR4(151, 234, 7, 0, 24),   CIDR4(185, 115, 78, 0, 24),  CIDR4(2, 185, 16, 0, 20),    CIDR4(2, 185, 248, 0, 22),
+    CIDR4(5, 190, 240, 0, 20),   CIDR4(37, 202, 148, 0, 22),  CIDR4(5, 234, 36, 0, 22),    CIDR4(85, 185, 32, 0, 22),
+    CIDR4(85, 185, 68, 0, 23),   CIDR4(217, 218, 15, 0, 24),  CIDR4(5, 200, 200, 0, 24),   CIDR4(151, 234, 163, 0, 24),
+    CIDR4(217, 218, 112, 0, 21), CIDR4(5, 238, 64, 0, 19),    CIDR4(151, 234, 52, 0, 22),  CIDR4(151, 234, 166, 0, 24),
+    CIDR4(66, 79, 108, 0, 22),   CIDR4(80, 191, 196, 0, 24),  CIDR4(5, 236, 104, 0, 23),   CIDR4(93, 88, 64, 0, 22),
+    CIDR4(2, 179, 28, 0, 22),    CIDR4(151, 245, 128, 0, 22), CIDR4(89, 235, 88, 0, 21),   CIDR4(185, 131, 116, 0, 22),
+    CIDR4(5, 233, 112, 0, 21),   CIDR4(91, 92, 132, 0, 23),   CIDR4(91, 92, 146, 0, 23),   CIDR4(78, 39, 236, 0, 22),
+    CIDR4(78, 39, 204, 0, 22),   CIDR4(151, 245, 140, 0, 22), CIDR4(5, 190, 0, 0, 17),     CIDR4(5, 234, 46, 0, 23),
+    CIDR4(212, 33, 216, 0, 21),  CIDR4(5, 235, 240, 0, 20),   CIDR4(5, 62, 160, 0, 19),    CIDR4(217, 172, 114, 0, 23),
+    CIDR4(46, 100, 244, 0, 22),  CIDR4(78, 39, 184, 0, 22),   CIDR4(151, 243, 248, 0, 23), CIDR4(46, 182, 32, 0, 21),
+    CIDR4(78, 38, 120, 0, 21),   CIDR4(78, 39, 104, 0, 21),   CIDR4(2, 183, 128, 0, 22),   CIDR4(5, 74, 0, 0, 16),
+    CIDR4(78, 39, 120, 0, 21),   CIDR4(78, 38, 88, 0, 21),    CIDR4(185, 131, 112, 0, 22), CIDR4(93, 118, 128, 0, 19),
+    CIDR4(37, 202, 128, 0, 22),  CIDR4(85, 185, 96, 0, 22),   CIDR4(80, 191, 176, 0, 23),  CIDR4(80, 191, 236, 0, 22),
+    CIDR4(46, 100, 80, 0, 22),   CIDR4(188, 208, 200, 0, 23), CIDR4(46, 100, 132, 0, 22),  CIDR4(151, 245, 152, 0, 22),
+    CIDR4(151, 247, 56, 0, 22),  CIDR4(2, 189, 12, 0, 22),    CIDR4(91, 222, 204, 0, 22),  CIDR4(2, 187, 64, 0, 19),
+    CIDR4(37, 148, 4, 0, 22),    CIDR4(91, 92, 184, 0, 21),   CIDR4(151, 234, 193, 0, 24), CIDR4(2, 179, 24, 0, 22),
+    CIDR4(2, 182, 201, 0, 24),   CIDR4(89, 36, 104, 0, 23),   CIDR4(217, 218, 80, 0, 20),  CIDR4(87, 251, 144, 0, 23),
+    CIDR4(5, 239, 240, 0, 23),   CIDR4(93, 118, 184, 0, 22),  CIDR4(46, 100, 106, 0, 23),  CIDR4(80, 191, 199, 0, 24),
+    CIDR4(80, 191, 19, 0, 24),   CIDR4(80, 191, 231, 0, 24),  CIDR4(46, 100, 184, 0, 22),  CIDR4(2, 182, 108, 0, 23),
+    CIDR4(89, 37, 168, 0, 22),   CIDR4(2, 181, 179, 0, 24),   CIDR4(78, 38, 53, 0, 24),    CIDR4(217, 172, 119, 0, 24),
+    CIDR4(80, 191, 179, 0, 24),  CIDR4(2, 182, 192, 0, 21),   CIDR4(46, 100, 232, 0, 22),  CIDR4(85, 185, 174, 0, 23),
+    CIDR4(195, 181, 96, 0, 20),  CIDR4(46, 100, 16, 0, 20),   CIDR4(151, 234, 64, 0, 22),  CIDR4(80, 191, 220, 0, 22),
+    CIDR4(5, 233, 32, 0, 21),    CIDR4(5, 198, 164, 0, 23),   CIDR4(37, 148, 16, 0, 22),   CIDR4(78, 39, 41, 0, 24),
+    CIDR4(2, 182, 214, 0, 23),   CIDR4(217, 219, 252, 0, 23), CIDR4(37, 255, 210, 0, 24),  CIDR4(151, 245, 48, 0, 22),
+    CIDR4(185, 120, 212, 0, 22), CIDR4(2, 181, 0, 0, 19),     CIDR4(5, 232, 216, 0, 21),   CIDR4(2, 182, 156, 0, 22),
+    CIDR4(5, 235, 184, 0, 23),   CIDR4(151, 234, 84, 0, 23),  CIDR4(151, 243, 200, 0, 23), CIDR4(213, 195, 56, 0, 21),
+    CIDR4(37, 255, 64, 0, 18),   CIDR4(85, 185, 242, 0, 23),  CIDR4(2, 179, 12, 0, 22),    CIDR4(85, 185, 18, 0, 23),
+    CIDR4(188, 215, 160, 0, 20), CIDR4(2, 181, 208, 0, 21),   CIDR4(91, 92, 122, 0, 23),   CIDR4(151, 245, 68, 0, 22),
+    CIDR4(5, 232, 96, 0, 19),    CIDR4(37, 156, 232, 0, 21),  CIDR4(151, 234, 86, 0, 24),  CIDR4(37, 148, 40, 0, 22),
+    CIDR4(46, 100, 0, 0, 22),    CIDR4(188, 212, 208, 0, 20), CIDR4(78, 39, 208, 0, 21),   CIDR4(2, 181, 128, 0, 19),
+    CIDR4(188, 210, 128, 0, 18), CIDR4(151, 234, 160, 0, 20), CIDR4(151, 247, 164, 0, 22), CIDR4(217, 218, 96, 0, 24),
+    CIDR4(80, 210, 24, 0, 21),   CIDR4(85, 185, 137, 0, 24),  CIDR4(85, 185, 144, 0, 21),  CIDR4(5, 238, 112, 0, 20),
+    CIDR4(2, 182, 36, 0, 22),    CIDR4(185, 147, 40, 0, 22),  CIDR4(2, 183, 224, 0, 21),   CIDR4(151, 243, 124, 0, 23),
+    CIDR4(89, 36, 96, 0, 22),    CIDR4(217, 219, 220, 0, 22), CIDR4(2, 184, 68, 0, 23),    CIDR4(89, 37, 240, 0, 20),
+    CIDR4(217, 218, 53, 0, 24),  CIDR4(78, 38, 55, 0, 24),    CIDR4(2, 183, 32, 0, 20),    CIDR4(151, 247, 80, 0, 23),
+    CIDR4(80, 191, 22, 0, 24),   CIDR4(185, 115, 79, 0, 24),  CIDR4(5, 232, 128, 0, 19),   CIDR4(151, 232, 117, 0, 24),
+    CIDR4(84, 47, 208, 0, 23),   CIDR4(151, 245, 148, 0, 22), CIDR4(78, 39, 116, 0, 23),   CIDR4(46, 100, 192, 0, 20),
+    CIDR4(78, 38, 196, 0, 24),   CIDR4(5, 235, 224, 0, 21),   CIDR4(84, 47, 216, 0, 22),   CIDR4(92, 43, 160, 0, 22),
+    CIDR4(195, 146, 50, 0, 24)
+};
 
-unsigned int mokhaberat_ip_ranges_length = sizeof(mokhaberat_ip_ranges) / sizeof(mokhaberat_ip_ranges[0]);
+unsigned int mokhaberat_ip_ranges4_length = sizeof(mokhaberat_ip_ranges4) / sizeof(mokhaberat_ip_ranges4[0]);
+
+const cidr6_t mokhaberat_ip_ranges6[] = {
+    CIDR6(0x2a04, 0x2680, 0x13, 0, 0, 0, 0, 0, 48)
+};
+
+unsigned int mokhaberat_ip_ranges6_length = sizeof(mokhaberat_ip_ranges6) / sizeof(mokhaberat_ip_ranges6[0]);
@@ -15,37 +15,53 @@
     Updated	5 years ago on Feb 13, 2019
 
 */
-const char *rightel_ip_ranges[] = {
-    "37.156.156.0/22",     "5.134.168.0/22",      "213.195.48.0/22",     "89.34.128.0/20",      "77.81.192.0/20",
-    "188.208.64.0/19",     "94.24.80.0/21",       "5.72.160.0/19",       "188.208.240.0/20",    "37.44.60.0/22",
-    "5.62.192.0/19",       "92.114.64.0/21",      "185.24.136.0/24",     "188.208.152.0/21",    "37.156.48.0/20",
-    "5.62.224.0/19",       "92.114.72.0/21",      "188.215.26.0/23",     "5.134.191.0/24",      "94.24.16.0/21",
-    "5.200.112.0/20",      "5.134.160.0/22",      "185.24.230.0/23",     "5.73.64.0/19",        "5.200.96.0/20",
-    "188.214.84.0/22",     "5.134.176.0/22",      "5.134.172.0/22",      "91.229.215.0/24",     "5.72.64.0/19",
-    "185.24.136.0/23",     "2a03:ef43:c000::/48", "185.24.137.0/24",     "5.73.96.0/19",        "37.156.56.0/21",
-    "213.195.32.0/20",     "37.137.128.0/18",     "37.137.128.0/17",     "94.24.8.0/21",        "5.72.128.0/19",
-    "89.41.192.0/20",      "5.73.192.0/19",       "2a03:ef44::/34",      "77.81.192.0/19",      "5.134.164.0/22",
-    "37.156.152.0/22",     "213.195.50.0/23",     "5.73.0.0/19",         "91.229.214.0/24",     "188.214.6.0/23",
-    "188.214.84.0/23",     "94.24.0.0/21",        "94.24.16.0/22",       "188.215.88.0/23",     "5.134.180.0/22",
-    "37.156.152.0/21",     "89.32.16.0/20",       "93.114.24.0/21",      "95.162.0.0/20",       "188.208.160.0/20",
-    "95.162.32.0/19",      "95.162.224.0/20",     "37.153.176.0/21",     "89.32.0.0/19",        "188.208.80.0/20",
-    "5.72.0.0/19",         "5.72.32.0/19",        "95.162.0.0/19",       "37.156.48.0/21",      "37.137.192.0/18",
-    "37.153.176.0/20",     "92.114.64.0/20",      "37.44.56.0/21",       "94.24.80.0/20",       "95.162.128.0/17",
-    "2a03:ef43::/43",      "5.134.152.0/22",      "2a03:ef42:c000::/34", "93.114.16.0/21",      "89.34.144.0/20",
-    "213.195.40.0/21",     "5.134.156.0/22",      "185.24.228.0/22",     "188.214.86.0/23",     "94.24.88.0/21",
-    "95.162.176.0/21",     "89.41.192.0/19",      "89.47.64.0/21",       "77.81.208.0/20",      "2a03:ef43:3::/48",
-    "5.72.96.0/19",        "89.41.208.0/20",      "94.24.20.0/22",       "185.24.228.0/23",     "188.214.4.0/22",
-    "37.44.56.0/22",       "89.47.64.0/20",       "188.215.24.0/22",     "188.208.144.0/21",    "188.208.144.0/20",
-    "89.34.128.0/19",      "5.134.128.0/18",      "89.32.96.0/20",       "188.208.224.0/19",    "94.24.100.0/22",
-    "94.24.96.0/22",       "188.214.4.0/23",      "213.195.48.0/23",     "188.208.160.0/19",    "89.47.128.0/19",
-    "188.208.64.0/20",     "89.47.128.0/20",      "95.162.0.0/17",       "188.215.24.0/23",     "2a03:ef42::/34",
-    "188.215.88.0/22",     "5.134.136.0/22",      "5.72.192.0/19",       "188.208.224.0/20",    "37.137.0.0/17",
-    "89.34.48.0/20",       "89.32.0.0/20",        "37.137.64.0/18",      "89.34.32.0/20",       "188.215.90.0/23",
-    "5.72.0.0/16",         "5.73.224.0/19",       "93.114.16.0/20",      "89.32.96.0/21",       "94.24.96.0/21",
-    "213.195.32.0/21",     "5.72.224.0/19",       "5.73.128.0/19",       "5.62.192.0/18",       "5.73.32.0/19",
-    "5.73.160.0/19",       "89.47.72.0/21",       "94.24.0.0/20",        "5.73.0.0/16",         "89.34.32.0/19",
-    "37.153.184.0/21",     "188.208.176.0/20",    "91.229.214.0/23",     "2a03:ef42:4000::/34", "5.200.96.0/19",
-    "2a03:ef42:8000::/34", "2a03:ef43::/34",      "89.32.104.0/21",      "89.47.144.0/20",      "5.134.184.0/22",
-    "37.137.0.0/18"};
+const cidr4_t rightel_ip_ranges4[] = {
+    CIDR4(37, 156, 156, 0, 22),  CIDR4(5, 134, 168, 0, 22),   CIDR4(213, 195, 48, 0, 22),  CIDR4(89, 34, 128, 0, 20),
+    CIDR4(77, 81, 192, 0, 20),   CIDR4(188, 208, 64, 0, 19),  CIDR4(94, 24, 80, 0, 21),    CIDR4(5, 72, 160, 0, 19),
+    CIDR4(188, 208, 240, 0, 20), CIDR4(37, 44, 60, 0, 22),    CIDR4(5, 62, 192, 0, 19),    CIDR4(92, 114, 64, 0, 21),
+    CIDR4(185, 24, 136, 0, 24),  CIDR4(188, 208, 152, 0, 21), CIDR4(37, 156, 48, 0, 20),   CIDR4(5, 62, 224, 0, 19),
+    CIDR4(92, 114, 72, 0, 21),   CIDR4(188, 215, 26, 0, 23),  CIDR4(5, 134, 191, 0, 24),   CIDR4(94, 24, 16, 0, 21),
+    CIDR4(5, 200, 112, 0, 20),   CIDR4(5, 134, 160, 0, 22),   CIDR4(185, 24, 230, 0, 23),  CIDR4(5, 73, 64, 0, 19),
+    CIDR4(5, 200, 96, 0, 20),    CIDR4(188, 214, 84, 0, 22),  CIDR4(5, 134, 176, 0, 22),   CIDR4(5, 134, 172, 0, 22),
+    CIDR4(91, 229, 215, 0, 24),  CIDR4(5, 72, 64, 0, 19),     CIDR4(185, 24, 136, 0, 23),  CIDR4(185, 24, 137, 0, 24),
+    CIDR4(5, 73, 96, 0, 19),     CIDR4(37, 156, 56, 0, 21),   CIDR4(213, 195, 32, 0, 20),  CIDR4(37, 137, 128, 0, 18),
+    CIDR4(37, 137, 128, 0, 17),  CIDR4(94, 24, 8, 0, 21),     CIDR4(5, 72, 128, 0, 19),    CIDR4(89, 41, 192, 0, 20),
+    CIDR4(5, 73, 192, 0, 19),    CIDR4(77, 81, 192, 0, 19),   CIDR4(5, 134, 164, 0, 22),   CIDR4(37, 156, 152, 0, 22),
+    CIDR4(213, 195, 50, 0, 23),  CIDR4(5, 73, 0, 0, 19),      CIDR4(91, 229, 214, 0, 24),  CIDR4(188, 214, 6, 0, 23),
+    CIDR4(188, 214, 84, 0, 23),  CIDR4(94, 24, 0, 0, 21),     CIDR4(94, 24, 16, 0, 22),    CIDR4(188, 215, 88, 0, 23),
+    CIDR4(5, 134, 180, 0, 22),   CIDR4(37, 156, 152, 0, 21),  CIDR4(89, 32, 16, 0, 20),    CIDR4(93, 114, 24, 0, 21),
+    CIDR4(95, 162, 0, 0, 20),    CIDR4(188, 208, 160, 0, 20), CIDR4(95, 162, 32, 0, 19),   CIDR4(95, 162, 224, 0, 20),
+    CIDR4(37, 153, 176, 0, 21),  CIDR4(89, 32, 0, 0, 19),     CIDR4(188, 208, 80, 0, 20),  CIDR4(5, 72, 0, 0, 19),
+    CIDR4(5, 72, 32, 0, 19),     CIDR4(95, 162, 0, 0, 19),    CIDR4(37, 156, 48, 0, 21),   CIDR4(37, 137, 192, 0, 18),
+    CIDR4(37, 153, 176, 0, 20),  CIDR4(92, 114, 64, 0, 20),   CIDR4(37, 44, 56, 0, 21),    CIDR4(94, 24, 80, 0, 20),
+    CIDR4(95, 162, 128, 0, 17),  CIDR4(5, 134, 152, 0, 22),   CIDR4(93, 114, 16, 0, 21),   CIDR4(89, 34, 144, 0, 20),
+    CIDR4(213, 195, 40, 0, 21),  CIDR4(5, 134, 156, 0, 22),   CIDR4(185, 24, 228, 0, 22),  CIDR4(188, 214, 86, 0, 23),
+    CIDR4(94, 24, 88, 0, 21),    CIDR4(95, 162, 176, 0, 21),  CIDR4(89, 41, 192, 0, 19),   CIDR4(89, 47, 64, 0, 21),
+    CIDR4(77, 81, 208, 0, 20),   CIDR4(5, 72, 96, 0, 19),     CIDR4(89, 41, 208, 0, 20),   CIDR4(94, 24, 20, 0, 22),
+    CIDR4(185, 24, 228, 0, 23),  CIDR4(188, 214, 4, 0, 22),   CIDR4(37, 44, 56, 0, 22),    CIDR4(89, 47, 64, 0, 20),
+    CIDR4(188, 215, 24, 0, 22),  CIDR4(188, 208, 144, 0, 21), CIDR4(188, 208, 144, 0, 20), CIDR4(89, 34, 128, 0, 19),
+    CIDR4(5, 134, 128, 0, 18),   CIDR4(89, 32, 96, 0, 20),    CIDR4(188, 208, 224, 0, 19), CIDR4(94, 24, 100, 0, 22),
+    CIDR4(94, 24, 96, 0, 22),    CIDR4(188, 214, 4, 0, 23),   CIDR4(213, 195, 48, 0, 23),  CIDR4(188, 208, 160, 0, 19),
+    CIDR4(89, 47, 128, 0, 19),   CIDR4(188, 208, 64, 0, 20),  CIDR4(89, 47, 128, 0, 20),   CIDR4(95, 162, 0, 0, 17),
+    CIDR4(188, 215, 24, 0, 23),  CIDR4(188, 215, 88, 0, 22),  CIDR4(5, 134, 136, 0, 22),   CIDR4(5, 72, 192, 0, 19),
+    CIDR4(188, 208, 224, 0, 20), CIDR4(37, 137, 0, 0, 17),    CIDR4(89, 34, 48, 0, 20),    CIDR4(89, 32, 0, 0, 20),
+    CIDR4(37, 137, 64, 0, 18),   CIDR4(89, 34, 32, 0, 20),    CIDR4(188, 215, 90, 0, 23),  CIDR4(5, 72, 0, 0, 16),
+    CIDR4(5, 73, 224, 0, 19),    CIDR4(93, 114, 16, 0, 20),   CIDR4(89, 32, 96, 0, 21),    CIDR4(94, 24, 96, 0, 21),
+    CIDR4(213, 195, 32, 0, 21),  CIDR4(5, 72, 224, 0, 19),    CIDR4(5, 73, 128, 0, 19),    CIDR4(5, 62, 192, 0, 18),
+    CIDR4(5, 73, 32, 0, 19),     CIDR4(5, 73, 160, 0, 19),    CIDR4(89, 47, 72, 0, 21),    CIDR4(94, 24, 0, 0, 20),
+    CIDR4(5, 73, 0, 0, 16),      CIDR4(89, 34, 32, 0, 19),    CIDR4(37, 153, 184, 0, 21),  CIDR4(188, 208, 176, 0, 20),
+    CIDR4(91, 229, 214, 0, 23),  CIDR4(5, 200, 96, 0, 19),    CIDR4(89, 32, 104, 0, 21),   CIDR4(89, 47, 144, 0, 20),
+    CIDR4(5, 134, 184, 0, 22),   CIDR4(37, 137, 0, 0, 18)
+};
 
-unsigned int rightel_ip_ranges_length = sizeof(rightel_ip_ranges) / sizeof(rightel_ip_ranges[0]);
+unsigned int rightel_ip_ranges4_length = sizeof(rightel_ip_ranges4) / sizeof(rightel_ip_ranges4[0]);
+
+const cidr6_t rightel_ip_ranges6[] = {
+    CIDR6(0x2a03, 0xef43, 0xc000, 0, 0, 0, 0, 0, 48), CIDR6(0x2a03, 0xef44, 0, 0, 0, 0, 0, 0, 34),
+    CIDR6(0x2a03, 0xef43, 0, 0, 0, 0, 0, 0, 43),      CIDR6(0x2a03, 0xef42, 0xc000, 0, 0, 0, 0, 0, 34),
+    CIDR6(0x2a03, 0xef43, 0x3, 0, 0, 0, 0, 0, 48),    CIDR6(0x2a03, 0xef42, 0, 0, 0, 0, 0, 0, 34),
+    CIDR6(0x2a03, 0xef42, 0x4000, 0, 0, 0, 0, 0, 34), CIDR6(0x2a03, 0xef42, 0x8000, 0, 0, 0, 0, 0, 34),
+    CIDR6(0x2a03, 0xef43, 0, 0, 0, 0, 0, 0, 34)
+};
+
+unsigned int rightel_ip_ranges6_length = sizeof(rightel_ip_ranges6) / sizeof(rightel_ip_ranges6[0]);
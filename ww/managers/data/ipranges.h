@@ -1,16 +1,34 @@
 #pragma once
 
-extern const char  *irancell_ip_ranges[];
-extern unsigned int irancell_ip_ranges_length;
+#include "cidr_set.h"
 
-extern const char  *mci_ip_ranges[];
-extern unsigned int mci_ip_ranges_length;
+/*
+    built-in ip range data sets, stored pre-parsed so loading one into a cidr_set_t does no string parsing
 
-extern const char  *rightel_ip_ranges[];
-extern unsigned int rightel_ip_ranges_length;
+        cidrsetAddRanges4(set, mci_ip_ranges4, mci_ip_ranges4_length);
+        cidrsetAddRanges6(set, mci_ip_ranges6, mci_ip_ranges6_length);
+        cidrsetCompile(set);
+*/
 
-extern const char  *mokhaberat_ip_ranges[];
-extern unsigned int mokhaberat_ip_ranges_length;
+extern const cidr4_t irancell_ip_ranges4[];
+extern unsigned int  irancell_ip_ranges4_length;
+extern const cidr6_t irancell_ip_ranges6[];
+extern unsigned int  irancell_ip_ranges6_length;
 
-extern const char  *iran_ip_ranges[];
-extern unsigned int iran_ip_ranges_length;
+extern const cidr4_t mci_ip_ranges4[];
+extern unsigned int  mci_ip_ranges4_length;
+extern const cidr6_t mci_ip_ranges6[];
+extern unsigned int  mci_ip_ranges6_length;
+
+extern const cidr4_t rightel_ip_ranges4[];
+extern unsigned int  rightel_ip_ranges4_length;
+extern const cidr6_t rightel_ip_ranges6[];
+extern unsigned int  rightel_ip_ranges6_length;
+
+extern const cidr4_t mokhaberat_ip_ranges4[];
+extern unsigned int  mokhaberat_ip_ranges4_length;
+extern const cidr6_t mokhaberat_ip_ranges6[];
+extern unsigned int  mokhaberat_ip_ranges6_length;
+
+extern const cidr4_t iran_ip_ranges4[];
+extern unsigned int  iran_ip_ranges4_length;
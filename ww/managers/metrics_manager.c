@@ -0,0 +1,641 @@
+#include "metrics_manager.h"
+#include "global_state.h"
+#include "loggers/internal_logger.h"
+#include "node_manager.h"
+#include "tunnel.h"
+#include "wsocket.h"
+#include "wthread.h"
+
+// the device readers (and their backpressure) are only built on these platforms, see ww/CMakeLists.txt
+#if defined(OS_UNIX) && ! defined(OS_DARWIN) && ! defined(OS_ANDROID)
+#include "device_backpressure.h"
+#define METRICS_HAVE_DEVICES 1
+#endif
+
+enum
+{
+    kMetricsPollIntervalMs  = 250,
+    kMetricsSocketTimeoutMs = 1000,
+    kMetricsRequestMaxSize  = 4096,
+    kMetricsTextInitialCap  = 16384
+};
+
+typedef struct metrics_manager_s
+{
+    char       *listen_address;
+    int         listen_fd;
+    uint16_t    listen_port;
+    bool        started;
+    atomic_bool stop;
+    wthread_t   thread;
+
+} metrics_manager_t;
+
+static metrics_manager_t *state = NULL;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// snapshots, every slot is read once with a relaxed load and summed here
+
+enum
+{
+    kNodeBytes = 0,
+    kNodePackets,
+    kNodePauses,
+    kNodeResumes,
+    kNodeCountersCount
+};
+
+typedef struct node_snapshot_s
+{
+    node_t  *node;
+    uint64_t up[kNodeCountersCount];
+    uint64_t down[kNodeCountersCount];
+
+} node_snapshot_t;
+
+#define i_type vec_node_snapshot_t // NOLINT
+#define i_key  node_snapshot_t     // NOLINT
+#include "stc/vec.h"
+
+typedef struct worker_snapshot_s
+{
+    uint64_t      buffer_pool_gets;
+    uint64_t      buffer_pool_misses;
+    uint64_t      context_pool_gets;
+    uint64_t      context_pool_misses;
+    uint64_t      pipetunnel_msg_pool_gets;
+    uint64_t      pipetunnel_msg_pool_misses;
+    int64_t       queued_buffers;
+    bool          has_loop;
+    wloop_stats_t loop;
+
+} worker_snapshot_t;
+
+typedef struct device_snapshot_s
+{
+    char    *name;
+    int      limit;
+    uint64_t stalls;
+    int     *occupancy; // one per worker
+
+} device_snapshot_t;
+
+#define i_type vec_device_snapshot_t // NOLINT
+#define i_key  device_snapshot_t     // NOLINT
+#include "stc/vec.h"
+
+static const char *node_counter_names[kNodeCountersCount] = {"bytes", "packets", "pauses", "resumes"};
+static const char *node_counter_helps[kNodeCountersCount] = {
+    "Bytes a node received from its neighbours",
+    "Payloads (or spliced chunks) a node received from its neighbours",
+    "Pause signals a node received",
+    "Resume signals a node received",
+};
+
+// upper bounds of the loop busy buckets in seconds, the last one is +Inf
+static const char *loop_bucket_bounds[kWloopBusyBuckets] = {"0.0001", "0.001", "0.01", "0.1", "+Inf"};
+
+static void snapshotNode(node_t *node, void *userdata)
+{
+    vec_node_snapshot_t *nodes = userdata;
+    tunnel_t            *t     = node->instance;
+
+    if (t == NULL || t->metrics == NULL)
+    {
+        return;
+    }
+
+    node_snapshot_t snap = {.node = node};
+    for (wid_t wid = 0; wid < getWorkersCount(); wid++)
+    {
+        tunnel_metrics_t *m = &t->metrics[wid];
+
+        snap.up[kNodeBytes] += atomicLoadRelaxed(&m->up_bytes);
+        snap.up[kNodePackets] += atomicLoadRelaxed(&m->up_packets);
+        snap.up[kNodePauses] += atomicLoadRelaxed(&m->up_pauses);
+        snap.up[kNodeResumes] += atomicLoadRelaxed(&m->up_resumes);
+        snap.down[kNodeBytes] += atomicLoadRelaxed(&m->down_bytes);
+        snap.down[kNodePackets] += atomicLoadRelaxed(&m->down_packets);
+        snap.down[kNodePauses] += atomicLoadRelaxed(&m->down_pauses);
+        snap.down[kNodeResumes] += atomicLoadRelaxed(&m->down_resumes);
+    }
+    vec_node_snapshot_t_push(nodes, snap);
+}
+
+static void snapshotWorker(worker_t *worker, worker_snapshot_t *snap)
+{
+    *snap = (worker_snapshot_t) {0};
+
+    bufferpoolGetStats(worker->buffer_pool, &snap->buffer_pool_gets, &snap->buffer_pool_misses);
+    genericpoolGetStats(worker->context_pool, &snap->context_pool_gets, &snap->context_pool_misses);
+    genericpoolGetStats(worker->pipetunnel_msg_pool, &snap->pipetunnel_msg_pool_gets,
+                        &snap->pipetunnel_msg_pool_misses);
+
+    snap->queued_buffers = atomicLoadRelaxed(&worker->queued_buffers);
+
+    // the lwip worker has no loop
+    if (worker->loop != NULL)
+    {
+        snap->has_loop = true;
+        wloopGetStats(worker->loop, &snap->loop);
+    }
+}
+
+#ifdef METRICS_HAVE_DEVICES
+static void snapshotDevice(device_backpressure_t *bp, void *userdata)
+{
+    vec_device_snapshot_t *devices = userdata;
+
+    device_snapshot_t snap = {.name      = stringDuplicate(bp->name),
+                              .limit     = bp->limit,
+                              .stalls    = devicebackpressureGetStalls(bp),
+                              .occupancy = memoryAllocate(sizeof(int) * getWorkersCount())};
+
+    for (wid_t wid = 0; wid < getWorkersCount(); wid++)
+    {
+        snap.occupancy[wid] = devicebackpressureGetOccupancy(bp, wid);
+    }
+    vec_device_snapshot_t_push(devices, snap);
+}
+#endif
+
+// ---------------------------------------------------------------------------------------------------------------------
+// text output
+
+typedef struct metrics_text_s
+{
+    char  *buf;
+    size_t len;
+    size_t cap;
+
+} metrics_text_t;
+
+static void textAppend(metrics_text_t *text, const char *format, ...)
+{
+    while (true)
+    {
+        size_t  room = text->cap - text->len;
+        va_list args;
+        va_start(args, format);
+        int written = vsnprintf(text->buf + text->len, room, format, args);
+        va_end(args);
+
+        if (written < 0)
+        {
+            return;
+        }
+        if ((size_t) written < room)
+        {
+            text->len += (size_t) written;
+            return;
+        }
+        text->cap = max(text->cap * 2, text->len + (size_t) written + 1);
+        text->buf = memoryReAllocate(text->buf, text->cap);
+    }
+}
+
+// escapes a label value (Prometheus) or a string (json), both accept the same escapes for these characters
+static void textAppendEscaped(metrics_text_t *text, const char *str)
+{
+    for (; *str != '\0'; str++)
+    {
+        if (*str == '\\' || *str == '"')
+        {
+            textAppend(text, "\\%c", *str);
+        }
+        else if (*str == '\n')
+        {
+            textAppend(text, "\\n");
+        }
+        else if ((unsigned char) *str >= 0x20)
+        {
+            textAppend(text, "%c", *str);
+        }
+    }
+}
+
+static void textAppendNodeLabels(metrics_text_t *text, node_t *node, const char *direction)
+{
+    textAppend(text, "{node=\"");
+    textAppendEscaped(text, node->name);
+    textAppend(text, "\",type=\"");
+    textAppendEscaped(text, node->type);
+    textAppend(text, "\",direction=\"%s\"}", direction);
+}
+
+static void renderPrometheusDevices(metrics_text_t *text, vec_device_snapshot_t *devices, wid_t workers_count)
+{
+    textAppend(text, "# HELP ww_device_queue_occupancy Packets a device reader queued on a worker that are not "
+                     "consumed yet\n");
+    textAppend(text, "# TYPE ww_device_queue_occupancy gauge\n");
+    c_foreach(d, vec_device_snapshot_t, *devices)
+    {
+        for (wid_t w = 0; w < workers_count; w++)
+        {
+            textAppend(text, "ww_device_queue_occupancy{device=\"");
+            textAppendEscaped(text, d.ref->name);
+            textAppend(text, "\",worker=\"%u\"} %d\n", w, d.ref->occupancy[w]);
+        }
+    }
+
+    textAppend(text, "# HELP ww_device_queue_limit Packets a device reader may queue on one worker before it waits\n");
+    textAppend(text, "# TYPE ww_device_queue_limit gauge\n");
+    c_foreach(d, vec_device_snapshot_t, *devices)
+    {
+        textAppend(text, "ww_device_queue_limit{device=\"");
+        textAppendEscaped(text, d.ref->name);
+        textAppend(text, "\"} %d\n", d.ref->limit);
+    }
+
+    textAppend(text, "# HELP ww_device_reader_stalls_total Times a device reader waited for a saturated worker\n");
+    textAppend(text, "# TYPE ww_device_reader_stalls_total counter\n");
+    c_foreach(d, vec_device_snapshot_t, *devices)
+    {
+        textAppend(text, "ww_device_reader_stalls_total{device=\"");
+        textAppendEscaped(text, d.ref->name);
+        textAppend(text, "\"} %llu\n", (unsigned long long) d.ref->stalls);
+    }
+}
+
+static void renderPrometheus(metrics_text_t *text, vec_node_snapshot_t *nodes, vec_device_snapshot_t *devices,
+                             worker_snapshot_t *workers, wid_t workers_count)
+{
+    for (int c = 0; c < kNodeCountersCount; c++)
+    {
+        textAppend(text, "# HELP ww_node_%s_total %s\n", node_counter_names[c], node_counter_helps[c]);
+        textAppend(text, "# TYPE ww_node_%s_total counter\n", node_counter_names[c]);
+
+        c_foreach(n, vec_node_snapshot_t, *nodes)
+        {
+            textAppend(text, "ww_node_%s_total", node_counter_names[c]);
+            textAppendNodeLabels(text, n.ref->node, "up");
+            textAppend(text, " %llu\n", (unsigned long long) n.ref->up[c]);
+
+            textAppend(text, "ww_node_%s_total", node_counter_names[c]);
+            textAppendNodeLabels(text, n.ref->node, "down");
+            textAppend(text, " %llu\n", (unsigned long long) n.ref->down[c]);
+        }
+    }
+
+    textAppend(text, "# HELP ww_pool_gets_total Items taken from the pools of a worker\n");
+    textAppend(text, "# TYPE ww_pool_gets_total counter\n");
+    for (wid_t w = 0; w < workers_count; w++)
+    {
+        textAppend(text, "ww_pool_gets_total{worker=\"%u\",pool=\"buffer\"} %llu\n", w,
+                   (unsigned long long) workers[w].buffer_pool_gets);
+        textAppend(text, "ww_pool_gets_total{worker=\"%u\",pool=\"context\"} %llu\n", w,
+                   (unsigned long long) workers[w].context_pool_gets);
+        textAppend(text, "ww_pool_gets_total{worker=\"%u\",pool=\"pipetunnel_msg\"} %llu\n", w,
+                   (unsigned long long) workers[w].pipetunnel_msg_pool_gets);
+    }
+
+    textAppend(text, "# HELP ww_pool_misses_total Takes that found the pool empty and recharged it from the master "
+                     "pool\n");
+    textAppend(text, "# TYPE ww_pool_misses_total counter\n");
+    for (wid_t w = 0; w < workers_count; w++)
+    {
+        textAppend(text, "ww_pool_misses_total{worker=\"%u\",pool=\"buffer\"} %llu\n", w,
+                   (unsigned long long) workers[w].buffer_pool_misses);
+        textAppend(text, "ww_pool_misses_total{worker=\"%u\",pool=\"context\"} %llu\n", w,
+                   (unsigned long long) workers[w].context_pool_misses);
+        textAppend(text, "ww_pool_misses_total{worker=\"%u\",pool=\"pipetunnel_msg\"} %llu\n", w,
+                   (unsigned long long) workers[w].pipetunnel_msg_pool_misses);
+    }
+
+    textAppend(text, "# HELP ww_buffer_queue_depth Buffers waiting in the buffer queues of a worker\n");
+    textAppend(text, "# TYPE ww_buffer_queue_depth gauge\n");
+    for (wid_t w = 0; w < workers_count; w++)
+    {
+        textAppend(text, "ww_buffer_queue_depth{worker=\"%u\"} %lld\n", w, (long long) workers[w].queued_buffers);
+    }
+
+    textAppend(text, "# HELP ww_loop_busy_seconds Time an event loop iteration spent running callbacks\n");
+    textAppend(text, "# TYPE ww_loop_busy_seconds histogram\n");
+    for (wid_t w = 0; w < workers_count; w++)
+    {
+        if (! workers[w].has_loop)
+        {
+            continue;
+        }
+        const wloop_stats_t *loop       = &workers[w].loop;
+        uint64_t             cumulative = 0;
+        for (int b = 0; b < kWloopBusyBuckets; b++)
+        {
+            cumulative += loop->busy_buckets[b];
+            textAppend(text, "ww_loop_busy_seconds_bucket{worker=\"%u\",le=\"%s\"} %llu\n", w, loop_bucket_bounds[b],
+                       (unsigned long long) cumulative);
+        }
+        textAppend(text, "ww_loop_busy_seconds_sum{worker=\"%u\"} %.6f\n", w, (double) loop->busy_us / 1e6);
+        textAppend(text, "ww_loop_busy_seconds_count{worker=\"%u\"} %llu\n", w,
+                   (unsigned long long) loop->iterations);
+    }
+
+    renderPrometheusDevices(text, devices, workers_count);
+}
+
+static void renderJsonCounters(metrics_text_t *text, const uint64_t counters[kNodeCountersCount])
+{
+    textAppend(text, "{");
+    for (int c = 0; c < kNodeCountersCount; c++)
+    {
+        textAppend(text, "%s\"%s\":%llu", c == 0 ? "" : ",", node_counter_names[c], (unsigned long long) counters[c]);
+    }
+    textAppend(text, "}");
+}
+
+static void renderJson(metrics_text_t *text, vec_node_snapshot_t *nodes, vec_device_snapshot_t *devices,
+                       worker_snapshot_t *workers, wid_t workers_count)
+{
+    textAppend(text, "{\"nodes\":[");
+    bool first = true;
+    c_foreach(n, vec_node_snapshot_t, *nodes)
+    {
+        textAppend(text, "%s{\"name\":\"", first ? "" : ",");
+        textAppendEscaped(text, n.ref->node->name);
+        textAppend(text, "\",\"type\":\"");
+        textAppendEscaped(text, n.ref->node->type);
+        textAppend(text, "\",\"up\":");
+        renderJsonCounters(text, n.ref->up);
+        textAppend(text, ",\"down\":");
+        renderJsonCounters(text, n.ref->down);
+        textAppend(text, "}");
+        first = false;
+    }
+
+    textAppend(text, "],\"workers\":[");
+    for (wid_t w = 0; w < workers_count; w++)
+    {
+        const worker_snapshot_t *ws = &workers[w];
+
+        textAppend(text,
+                   "%s{\"worker\":%u,\"buffer_pool\":{\"gets\":%llu,\"misses\":%llu},"
+                   "\"context_pool\":{\"gets\":%llu,\"misses\":%llu},"
+                   "\"pipetunnel_msg_pool\":{\"gets\":%llu,\"misses\":%llu},\"buffer_queue_depth\":%lld",
+                   w == 0 ? "" : ",", w, (unsigned long long) ws->buffer_pool_gets,
+                   (unsigned long long) ws->buffer_pool_misses, (unsigned long long) ws->context_pool_gets,
+                   (unsigned long long) ws->context_pool_misses, (unsigned long long) ws->pipetunnel_msg_pool_gets,
+                   (unsigned long long) ws->pipetunnel_msg_pool_misses, (long long) ws->queued_buffers);
+
+        if (ws->has_loop)
+        {
+            textAppend(text, ",\"loop\":{\"iterations\":%llu,\"busy_us\":%llu,\"busy_buckets\":{",
+                       (unsigned long long) ws->loop.iterations, (unsigned long long) ws->loop.busy_us);
+            for (int b = 0; b < kWloopBusyBuckets; b++)
+            {
+                textAppend(text, "%s\"%s\":%llu", b == 0 ? "" : ",", loop_bucket_bounds[b],
+                           (unsigned long long) ws->loop.busy_buckets[b]);
+            }
+            textAppend(text, "}}");
+        }
+        textAppend(text, "}");
+    }
+
+    textAppend(text, "],\"devices\":[");
+    first = true;
+    c_foreach(d, vec_device_snapshot_t, *devices)
+    {
+        textAppend(text, "%s{\"name\":\"", first ? "" : ",");
+        textAppendEscaped(text, d.ref->name);
+        textAppend(text, "\",\"queue_limit\":%d,\"reader_stalls\":%llu,\"queue_occupancy\":[", d.ref->limit,
+                   (unsigned long long) d.ref->stalls);
+        for (wid_t w = 0; w < workers_count; w++)
+        {
+            textAppend(text, "%s%d", w == 0 ? "" : ",", d.ref->occupancy[w]);
+        }
+        textAppend(text, "]}");
+        first = false;
+    }
+    textAppend(text, "]}\n");
+}
+
+static void renderMetrics(metrics_text_t *text, bool json)
+{
+    wid_t              workers_count = (wid_t) getWorkersCount();
+    worker_snapshot_t *workers       = memoryAllocate(sizeof(worker_snapshot_t) * workers_count);
+    for (wid_t w = 0; w < workers_count; w++)
+    {
+        snapshotWorker(getWorker(w), &workers[w]);
+    }
+
+    vec_node_snapshot_t nodes = vec_node_snapshot_t_init();
+    nodemanagerForEachNode(snapshotNode, &nodes);
+
+    vec_device_snapshot_t devices = vec_device_snapshot_t_init();
+#ifdef METRICS_HAVE_DEVICES
+    devicebackpressureForEach(snapshotDevice, &devices);
+#endif
+
+    if (json)
+    {
+        renderJson(text, &nodes, &devices, workers, workers_count);
+    }
+    else
+    {
+        renderPrometheus(text, &nodes, &devices, workers, workers_count);
+    }
+
+    c_foreach(d, vec_device_snapshot_t, devices)
+    {
+        memoryFree(d.ref->name);
+        memoryFree(d.ref->occupancy);
+    }
+    vec_device_snapshot_t_drop(&devices);
+    vec_node_snapshot_t_drop(&nodes);
+    memoryFree(workers);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// endpoint
+
+static bool sendAll(int fd, const char *data, size_t len)
+{
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL;
+#else
+    const int flags = 0;
+#endif
+    while (len > 0)
+    {
+        int sent = (int) send(fd, data, (int) min(len, (size_t) INT32_MAX), flags);
+        if (sent <= 0)
+        {
+            return false;
+        }
+        data += sent;
+        len -= (size_t) sent;
+    }
+    return true;
+}
+
+static void sendResponse(int fd, const char *status, const char *content_type, const char *body, size_t body_len)
+{
+    char header[256];
+    int  header_len = snprintf(header, sizeof(header),
+                               "HTTP/1.0 %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n",
+                               status, content_type, body_len);
+
+    if (sendAll(fd, header, (size_t) header_len))
+    {
+        sendAll(fd, body, body_len);
+    }
+}
+
+static void serveClient(int fd)
+{
+    char   request[kMetricsRequestMaxSize];
+    size_t len = 0;
+
+    socketOptionRecvTime(fd, kMetricsSocketTimeoutMs);
+    socketOptionSNDTIME(fd, kMetricsSocketTimeoutMs);
+
+    // reads the whole head, closing with unread bytes would reset the connection before the client reads the reply
+    while (len < sizeof(request) - 1)
+    {
+        int received = (int) recv(fd, request + len, (int) (sizeof(request) - 1 - len), 0);
+        if (received <= 0)
+        {
+            return;
+        }
+        len += (size_t) received;
+        request[len] = '\0';
+        if (strstr(request, "\r\n\r\n") != NULL || strstr(request, "\n\n") != NULL)
+        {
+            break;
+        }
+    }
+    request[len] = '\0';
+
+    bool json  = false;
+    bool found = false;
+    if (strncmp(request, "GET ", 4) == 0)
+    {
+        const char *path     = request + 4;
+        size_t      path_len = strcspn(path, " ?\r\n");
+
+        if (path_len == stringLength("/metrics") && strncmp(path, "/metrics", path_len) == 0)
+        {
+            found = true;
+        }
+        else if (path_len == stringLength("/metrics.json") && strncmp(path, "/metrics.json", path_len) == 0)
+        {
+            found = true;
+            json  = true;
+        }
+    }
+
+    if (! found)
+    {
+        static const char kNotFound[] = "not found, try /metrics or /metrics.json\n";
+        sendResponse(fd, "404 Not Found", "text/plain", kNotFound, sizeof(kNotFound) - 1);
+        return;
+    }
+
+    metrics_text_t text = {.buf = memoryAllocate(kMetricsTextInitialCap), .len = 0, .cap = kMetricsTextInitialCap};
+    text.buf[0]         = '\0';
+
+    renderMetrics(&text, json);
+    sendResponse(fd, "200 OK", json ? "application/json" : "text/plain; version=0.0.4", text.buf, text.len);
+
+    memoryFree(text.buf);
+}
+
+static bool isStopping(void)
+{
+    return atomicLoadExplicit(&state->stop, memory_order_acquire) ||
+           atomicLoadExplicit(&GSTATE.application_stopping_flag, memory_order_acquire);
+}
+
+static WTHREAD_ROUTINE(metricsThread)
+{
+    discard userdata;
+
+    while (! isStopping())
+    {
+        fd_set readfds;
+        FD_ZERO(&readfds);
+        FD_SET(state->listen_fd, &readfds);
+        struct timeval timeout = {.tv_sec = 0, .tv_usec = kMetricsPollIntervalMs * 1000};
+
+        if (select(state->listen_fd + 1, &readfds, NULL, NULL, &timeout) <= 0 || isStopping())
+        {
+            continue;
+        }
+
+        int fd = (int) accept(state->listen_fd, NULL, NULL);
+        if (fd < 0)
+        {
+            continue;
+        }
+        blocking(fd);
+        serveClient(fd);
+        closesocket(fd);
+    }
+    return 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+metrics_manager_t *metricsmanagerCreate(const char *listen_address, uint16_t listen_port)
+{
+    assert(state == NULL);
+
+    state  = memoryAllocate(sizeof(metrics_manager_t));
+    *state = (metrics_manager_t) {
+        .listen_address = stringDuplicate(listen_address), .listen_fd = -1, .listen_port = listen_port};
+    atomicStoreRelaxed(&state->stop, false);
+
+    return state;
+}
+
+void metricsmanagerStart(void)
+{
+    assert(state != NULL && ! state->started);
+
+    state->listen_fd = wwListen(state->listen_port, state->listen_address);
+    if (state->listen_fd < 0)
+    {
+        LOGF("MetricsManager: could not listen on %s:%u", state->listen_address, state->listen_port);
+        terminateProgram(1);
+    }
+
+    state->started = true;
+    state->thread  = threadCreate(metricsThread, NULL);
+
+    LOGI("MetricsManager: serving /metrics and /metrics.json on %s:%u", state->listen_address, state->listen_port);
+}
+
+void metricsmanagerDestroy(void)
+{
+    if (state == NULL)
+    {
+        return;
+    }
+    if (state->started)
+    {
+        atomicStoreExplicit(&state->stop, true, memory_order_release);
+        threadJoin(state->thread);
+    }
+    if (state->listen_fd >= 0)
+    {
+        closesocket(state->listen_fd);
+    }
+    memoryFree(state->listen_address);
+    memoryFree(state);
+    state = NULL;
+}
+
+metrics_manager_t *metricsmanagerGet(void)
+{
+    return state;
+}
+
+void metricsmanagerSet(metrics_manager_t *new_state)
+{
+    assert(state == NULL);
+    state = new_state;
+}
+
+bool metricsmanagerIsEnabled(void)
+{
+    return state != NULL;
+}
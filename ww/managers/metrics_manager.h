@@ -0,0 +1,36 @@
+#pragma once
+
+#include "wlibc.h"
+
+/*
+    Metrics
+
+    the counters live next to the code that updates them, one slot per worker:
+
+        tunnels         bytes, packets, pauses and resumes they received in each direction (tunnel_metrics_t)
+        pools           gets and misses of the buffer pool and the generic pools of each worker
+        buffer queues   buffers waiting in the buffer queues of each worker
+        event loops     iterations and the time each one was busy
+        devices         packets each device reader queued on each worker, its queue limit and its stalls
+
+    a slot is only written by its worker so counting is a plain add (no lock and no locked instruction), the sums
+    are only made when the endpoint is scraped
+
+    the endpoint runs on its own thread and answers
+
+        GET /metrics        Prometheus text format
+        GET /metrics.json   the same values as json
+
+    tunnels only get their counters when the manager is created before the config files run, the endpoint is
+    started after that
+*/
+
+struct metrics_manager_s;
+
+struct metrics_manager_s *metricsmanagerCreate(const char *listen_address, uint16_t listen_port);
+void                      metricsmanagerStart(void);
+// stops the endpoint thread, does nothing when the manager was not created
+void                      metricsmanagerDestroy(void);
+struct metrics_manager_s *metricsmanagerGet(void);
+void                      metricsmanagerSet(struct metrics_manager_s *state);
+bool                      metricsmanagerIsEnabled(void);
@@ -333,6 +333,17 @@ struct node_manager_s *nodemanagerGetState(void)
     return state;
 }
 
+void nodemanagerForEachNode(NodeVisitor visitor, void *userdata)
+{
+    c_foreach(conf, vec_configs_t, state->configs)
+    {
+        c_foreach(node_key_pair, map_node_t, (*conf.ref)->node_map)
+        {
+            visitor((node_key_pair.ref)->second, userdata);
+        }
+    }
+}
+
 void nodemanagerSetState(struct node_manager_s *new_state)
 {
     assert(state == NULL);
@@ -30,6 +30,9 @@ node_t                *nodemanagerNewNode(void);
 void                   nodemanagerCreateNodeInstance(node_manager_config_t *cfg, cJSON *node_json);
 void                   nodemanagerRunConfigFile(config_file_t *config_file);
 struct node_manager_s *nodemanagerGetState(void);
+// visits the nodes of every config file, the configs must not be added or destroyed while it runs
+typedef void (*NodeVisitor)(node_t *node, void *userdata);
+void                   nodemanagerForEachNode(NodeVisitor visitor, void *userdata);
 void                   nodemanagerSetState(struct node_manager_s *state);
 struct node_manager_s *nodemanagerCreate(void);
 
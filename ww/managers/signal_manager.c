@@ -1,5 +1,7 @@
 #include "signal_manager.h"
 
+#include "wlog.h"
+
 static signal_manager_t *state = NULL;
 
 void registerAtExitCallBack(SignalHandler handle, void *userdata)
@@ -95,6 +97,10 @@ static void exitHandler(void)
 
     exit_handler_ran_once = true;
 
+    // records still waiting in the log rings would be lost by the exit at the end of the handlers
+    // this runs inside a signal handler, so only a flush that never waits for a log mutex is safe here
+    loggerTryFlushAll();
+
     for (unsigned int i = 0; i < kMaxSigHandles; i++)
     {
         if (state->handlers[i].handle != NULL)
@@ -299,6 +305,8 @@ _Noreturn void terminateProgram(int exit_code)
     }
     double_terminated = true;
 
+    // the logs that explain the termination are written before this message
+    loggerFlushAll();
     printError("SignalManager: Terminating program with exit-code %d, please read above logs to understand why\n", exit_code);
     if (state)
     {
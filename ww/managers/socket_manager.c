@@ -10,6 +10,11 @@
 #include "wloop.h"
 #include "wmutex.h"
 #include "wproc.h"
+#include "wsysinfo.h"
+
+#ifdef OS_LINUX
+#include <linux/filter.h>
+#endif
 
 #define i_type balancegroup_registry_t // NOLINT
 #define i_key  hash_t                  // NOLINT
@@ -42,7 +47,8 @@ enum
     kSoOriginalDest         = 80,
     kFilterLevels           = 4,
     kMaxBalanceSelections   = 64,
-    kDefaultBalanceInterval = 60 * 1000
+    kDefaultBalanceInterval = 60 * 1000,
+    kUdpReadBatchMax        = 32 // payloads distributed per batch, matches the event loop recvmmsg batch
 };
 
 typedef struct socket_manager_s
@@ -220,6 +226,21 @@ static inline bool needsV4SocketStrategy(const ip6_addr_t addr)
             segments[5] == 0xFFFF);
 }
 
+static cidr_set_t *compileIpMaskList(const vec_ipmask_t *list)
+{
+    if (vec_ipmask_t_size(list) == 0)
+    {
+        return NULL;
+    }
+    cidr_set_t *set = cidrsetCreate();
+    c_foreach(k, vec_ipmask_t, *list)
+    {
+        cidrsetAddIpMask(set, k.ref);
+    }
+    cidrsetCompile(set);
+    return set;
+}
+
 void socketacceptorRegister(tunnel_t *tunnel, socket_filter_option_t option, onAccept cb)
 {
     if (state->started)
@@ -253,7 +274,7 @@ void socketacceptorRegister(tunnel_t *tunnel, socket_filter_option_t option, onA
 
         if (find_result.ref == balancegroup_registry_t_end(&(state->balance_groups)).ref)
         {
-            b_table = idleTableCreate(state->worker->loop);
+            b_table = idleTableCreate();
             balancegroup_registry_t_insert(&(state->balance_groups), name_hash, b_table);
         }
         else
@@ -266,6 +287,9 @@ void socketacceptorRegister(tunnel_t *tunnel, socket_filter_option_t option, onA
         option.shared_balance_table = b_table;
     }
 
+    option.white_set = compileIpMaskList(&option.white_list);
+    option.black_set = compileIpMaskList(&option.black_list);
+
     *filter = (socket_filter_t) {.tunnel = tunnel, .option = option, .cb = cb, .listen_io = NULL};
 
     mutexLock(&(state->mutex));
@@ -314,59 +338,36 @@ static void noTcpSocketConsumerFound(wio_t *io)
     wioClose(io);
 }
 
-static bool checkIpIsWhiteList(const ip_addr_t addr, const socket_filter_option_t option)
+static bool checkIpIsAllowed(const ip_addr_t *addr, const socket_filter_option_t *option)
 {
-    const bool is_v4 = addr.type == IPADDR_TYPE_V4;
-    ip4_addr_t ipv4_addr;
-
-    if (is_v4)
+    // the whitelist takes precedence, ipv4 mapped ipv6 peers are matched as ipv4 by the set
+    if (option->white_set != NULL)
     {
-        ip4_addr_copy(ipv4_addr, addr.u_addr.ip4);
-    v4checks:
-        for (int i = 0; i < vec_ipmask_t_size(&option.white_list); i++)
-        {
-
-            if (checkIPRange4(ipv4_addr, vec_ipmask_t_at(&option.white_list, i)->ip.u_addr.ip4,
-                              vec_ipmask_t_at(&option.white_list, i)->mask.u_addr.ip4))
-            {
-                return true;
-            }
-        }
-    }
-    else
-    {
-        if (needsV4SocketStrategy(addr.u_addr.ip6))
-        {
-            memoryCopy(&ipv4_addr, &(addr.u_addr.ip6.addr[3]), sizeof(ipv4_addr.addr));
-            goto v4checks;
-        }
-
-        for (int i = 0; i < vec_ipmask_t_size(&option.white_list); i++)
-        {
-
-            if (checkIPRange6(addr.u_addr.ip6, vec_ipmask_t_at(&option.white_list, i)->ip.u_addr.ip6,
-                              vec_ipmask_t_at(&option.white_list, i)->mask.u_addr.ip6))
-            {
-                return true;
-            }
-        }
+        return cidrsetContains(option->white_set, addr);
     }
-
-    return false;
+    return ! cidrsetContains(option->black_set, addr);
 }
 
-static void distributeTcpSocket(wio_t *io, uint16_t local_port)
+/**
+ * @brief Finds the socket filter that consumes an accepted tcp socket
+ * @param io: the accepted socket
+ * @param local_port: the port the client connected to (differs from the socket port with iptables multiport)
+ * @param this_wid: the worker running the lookup
+ * @param balance_elsewhere: set when the socket reaches a balance group and this_wid is not the socket manager
+ * worker, the balance tables are only used on that worker so one source ip sees the same choice from any listener
+ * @return the filter, or NULL if no filter accepts the socket (or balance_elsewhere is set)
+ */
+static socket_filter_t *findTcpSocketFilter(wio_t *io, uint16_t local_port, wid_t this_wid, bool *balance_elsewhere)
 {
     ip_addr_t paddr;
 
     sockaddrToIpAddr(wioGetPeerAddrU(io), &paddr);
 
-    static socket_filter_t *balance_selection_filters[kMaxBalanceSelections];
-    uint8_t                 balance_selection_filters_length = 0;
-    widle_table_t          *selected_balance_table           = NULL;
-    hash_t                  src_hash                         = 0x0;
-    bool                    src_hashed                       = false;
-    const uint8_t           this_wid                         = state->wid;
+    socket_filter_t *balance_selection_filters[kMaxBalanceSelections];
+    uint8_t          balance_selection_filters_length = 0;
+    widle_table_t   *selected_balance_table           = NULL;
+    hash_t           src_hash                         = 0x0;
+    bool             src_hashed                       = false;
 
     for (int ri = (kFilterLevels - 1); ri >= 0; ri--)
     {
@@ -387,9 +388,9 @@ static void distributeTcpSocket(wio_t *io, uint16_t local_port)
                 continue;
             }
 
-            if (vec_ipmask_t_size(&option.white_list) > 0)
+            if (option.white_set != NULL || option.black_set != NULL)
             {
-                if (! checkIpIsWhiteList(paddr, option))
+                if (! checkIpIsAllowed(&paddr, &option))
                 {
                     continue;
                 }
@@ -397,9 +398,15 @@ static void distributeTcpSocket(wio_t *io, uint16_t local_port)
 
             if (option.shared_balance_table)
             {
+                if (this_wid != state->wid)
+                {
+                    *balance_elsewhere = true;
+                    return NULL;
+                }
                 if (! src_hashed)
                 {
-                    src_hash = ipaddrCalcHashNoPort(paddr);
+                    src_hash   = ipaddrCalcHashNoPort(paddr);
+                    src_hashed = true;
                 }
                 widle_item_t *idle_item = idleTableGetIdleItemByHash(this_wid, option.shared_balance_table, src_hash);
 
@@ -409,13 +416,7 @@ static void distributeTcpSocket(wio_t *io, uint16_t local_port)
                     idleTableKeepIdleItemForAtleast(option.shared_balance_table, idle_item,
                                                     option.balance_group_interval == 0 ? kDefaultBalanceInterval
                                                                                        : option.balance_group_interval);
-                    if (option.no_delay)
-                    {
-                        tcpNoDelay(wioGetFD(io), 1);
-                    }
-                    wioDetach(io);
-                    distributeSocket(io, target_filter, local_port);
-                    return;
+                    return target_filter;
                 }
 
                 if (UNLIKELY(balance_selection_filters_length >= kMaxBalanceSelections))
@@ -429,13 +430,7 @@ static void distributeTcpSocket(wio_t *io, uint16_t local_port)
                 continue;
             }
 
-            if (option.no_delay)
-            {
-                tcpNoDelay(wioGetFD(io), 1);
-            }
-            wioDetach(io);
-            distributeSocket(io, filter, local_port);
-            return;
+            return filter;
         }
     }
 
@@ -445,24 +440,89 @@ static void distributeTcpSocket(wio_t *io, uint16_t local_port)
         idleItemNew(filter->option.shared_balance_table, src_hash, filter, NULL, this_wid,
                     filter->option.balance_group_interval == 0 ? kDefaultBalanceInterval
                                                                : filter->option.balance_group_interval);
-        if (filter->option.no_delay)
-        {
-            tcpNoDelay(wioGetFD(io), 1);
-        }
-        distributeSocket(io, filter, local_port);
+        return filter;
     }
-    else
+    return NULL;
+}
+
+static void distributeTcpSocket(wio_t *io, uint16_t local_port)
+{
+    bool             balance_elsewhere = false;
+    socket_filter_t *filter            = findTcpSocketFilter(io, local_port, state->wid, &balance_elsewhere);
+
+    if (filter == NULL)
     {
         noTcpSocketConsumerFound(io);
+        return;
     }
+    if (filter->option.no_delay)
+    {
+        tcpNoDelay(wioGetFD(io), 1);
+    }
+    wioDetach(io);
+    distributeSocket(io, filter, local_port);
 }
 
-static void onAcceptTcpSinglePort(wio_t *io)
+/*
+ * reuse-port mode: a socket that reached a balance group is handed to the socket manager worker, which owns the
+ * balance tables, and goes the classic distribution way from there
+ */
+static void adoptBalancedTcpSocket(worker_t *worker, void *arg1, void *arg2, void *arg3)
 {
-    distributeTcpSocket(io, sockaddrPort(wioGetLocaladdrU(io)));
+    wio_t   *io         = arg1;
+    uint16_t local_port = (uint16_t) (intptr_t) arg2;
+    discard  arg3;
+
+    wioAttach(worker->loop, io);
+    distributeTcpSocket(io, local_port);
 }
 
-static void onAcceptTcpMultiPort(wio_t *io)
+/*
+ * reuse-port mode: the socket was accepted by the listener of this worker, it stays on this worker
+ */
+static void deliverTcpSocketThisWorker(wio_t *io, uint16_t local_port)
+{
+    const wid_t      wid               = getWID();
+    bool             balance_elsewhere = false;
+    socket_filter_t *filter            = findTcpSocketFilter(io, local_port, wid, &balance_elsewhere);
+
+    if (balance_elsewhere)
+    {
+        wioDetach(io);
+        sendWorkerMessageForceQueue(state->wid, adoptBalancedTcpSocket, io, (void *) (intptr_t) local_port, NULL);
+        return;
+    }
+
+    if (filter == NULL)
+    {
+        noTcpSocketConsumerFound(io);
+        return;
+    }
+    if (filter->option.no_delay)
+    {
+        tcpNoDelay(wioGetFD(io), 1);
+    }
+
+    mutexLock(&(state->tcp_pools[wid].mutex));
+    socket_accept_result_t *result = genericpoolGetItem(state->tcp_pools[wid].pool);
+    mutexUnlock(&(state->tcp_pools[wid].mutex));
+
+    *result = (socket_accept_result_t) {
+        .io             = io,
+        .tunnel         = filter->tunnel,
+        .real_localport = local_port,
+        .wid            = wid,
+    };
+
+    wevent_t ev = (wevent_t) {.loop = getWorkerLoop(wid), .cb = filter->cb};
+    ev.userdata = result;
+    filter->cb(&ev);
+}
+
+/*
+ * iptables multiport: the port the client actually connected to, closes the socket on failure
+ */
+static uint16_t getTcpOriginalDestPort(wio_t *io, bool *ok)
 {
 #ifdef OS_UNIX
     ip_addr_t paddr;
@@ -470,7 +530,8 @@ static void onAcceptTcpMultiPort(wio_t *io)
     {
         LOGE("SocketManger: address parse failure");
         wioClose(io);
-        return;
+        *ok = false;
+        return 0;
     }
 
     bool          use_v4_strategy = paddr.type == IPADDR_TYPE_V6 ? needsV4SocketStrategy(paddr.u_addr.ip6) : true;
@@ -486,15 +547,48 @@ static void onAcceptTcpMultiPort(wio_t *io)
         LOGE("SocketManger: multiport failure getting origin port FD:%x [%s] <= [%s]", wioGetFD(io),
              SOCKADDR_STR(wioGetLocaladdrU(io), localaddrstr), SOCKADDR_STR(wioGetPeerAddrU(io), peeraddrstr));
         wioClose(io);
-        return;
+        *ok = false;
+        return 0;
     }
 
-    distributeTcpSocket(io, (uint16_t) ((pbuf[2] << 8) | pbuf[3]));
+    *ok = true;
+    return (uint16_t) ((pbuf[2] << 8) | pbuf[3]);
 #else
-    onAcceptTcpSinglePort(io);
+    *ok = true;
+    return sockaddrPort(wioGetLocaladdrU(io));
 #endif
 }
 
+static void onAcceptTcpMultiPort(wio_t *io)
+{
+    bool     ok   = false;
+    uint16_t port = getTcpOriginalDestPort(io, &ok);
+    if (ok)
+    {
+        distributeTcpSocket(io, port);
+    }
+}
+
+static void onAcceptTcpReusePort(wio_t *io)
+{
+    deliverTcpSocketThisWorker(io, sockaddrPort(wioGetLocaladdrU(io)));
+}
+
+static void onAcceptTcpReusePortMultiPort(wio_t *io)
+{
+    bool     ok   = false;
+    uint16_t port = getTcpOriginalDestPort(io, &ok);
+    if (ok)
+    {
+        deliverTcpSocketThisWorker(io, port);
+    }
+}
+
+static void onAcceptTcpSinglePort(wio_t *io)
+{
+    distributeTcpSocket(io, sockaddrPort(wioGetLocaladdrU(io)));
+}
+
 static multiport_backend_t getDefaultMultiPortBackend(void)
 {
     if (state->iptables_installed)
@@ -504,6 +598,161 @@ static multiport_backend_t getDefaultMultiPortBackend(void)
     return kMultiportBackendSockets;
 }
 
+/*
+ * reuse-port mode: every worker owns one SO_REUSEPORT listener of the port, the kernel picks the listener (and so
+ * the worker) of each connection, the accept happens on the worker that will own the line and there is no cross
+ * thread hop per connection
+ */
+static void adoptReusePortListener(worker_t *worker, void *arg1, void *arg2, void *arg3)
+{
+    int        fd        = (int) (intptr_t) arg1;
+    bool       multiport = (bool) (intptr_t) arg2;
+    waccept_cb cb        = multiport ? onAcceptTcpReusePortMultiPort : onAcceptTcpReusePort;
+    discard    arg3;
+
+    wio_t *io = waccept(worker->loop, fd, cb);
+    if (io == NULL)
+    {
+        LOGF("SocketManager: worker %d could not accept on its reuse-port listener", worker->wid);
+        terminateProgram(1);
+    }
+    weventSetPriority(io, WEVENT_HIGH_PRIORITY);
+}
+
+static int createReusePortListenFD(sockaddr_u *addr)
+{
+    int sockfd = (int) socket(addr->sa.sa_family, SOCK_STREAM, 0);
+    if (sockfd < 0)
+    {
+        return -1;
+    }
+    socketOptionReuseAddr(sockfd, 1);
+    if (socketOptionReusePort(sockfd, 1) != 0)
+    {
+        closesocket(sockfd);
+        return -1;
+    }
+    if (addr->sa.sa_family == AF_INET6)
+    {
+        ipV6Only(sockfd, 0);
+    }
+    if (bind(sockfd, &addr->sa, sockaddrLen(addr)) < 0 || listen(sockfd, SOMAXCONN) < 0)
+    {
+        closesocket(sockfd);
+        return -1;
+    }
+    return sockfd;
+}
+
+/*
+ * classic bpf reuseport program: listener index = cpu that handles the SYN % group size; the listener index is the
+ * wid, and pinWorkerToSteeredCpus keeps each worker on the cpus that pick its listener
+ */
+static bool attachReusePortCpuSteering(int sockfd, uint32_t group_size)
+{
+#if defined(OS_LINUX) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    struct sock_filter code[] = {
+        {BPF_LD | BPF_W | BPF_ABS, 0, 0, (uint32_t) (SKF_AD_OFF + SKF_AD_CPU)},
+        {BPF_ALU | BPF_MOD | BPF_K, 0, 0, group_size},
+        {BPF_RET | BPF_A, 0, 0, 0},
+    };
+    struct sock_fprog prog = {.len = ARRAY_SIZE(code), .filter = code};
+    return setsockopt(sockfd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog, sizeof(prog)) == 0;
+#else
+    discard sockfd;
+    discard group_size;
+    return false;
+#endif
+}
+
+/*
+ * runs on the worker: pins it to the cpus whose SYNs the steering program gives to its listener (cpu % group size ==
+ * wid), so the accept and the connection stay on the cpu RSS / RPS steered the flow to. a worker past the last cpu
+ * never gets a connection from the program and is left as it is
+ */
+static void pinWorkerToSteeredCpus(worker_t *worker, void *arg1, void *arg2, void *arg3)
+{
+    discard arg2;
+    discard arg3;
+#if defined(OS_LINUX)
+    const int group_size = (int) (intptr_t) arg1;
+    const int ncpu       = min(getNCPU(), CPU_SETSIZE);
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (int cpu = worker->wid; cpu < ncpu; cpu += group_size)
+    {
+        CPU_SET(cpu, &cpus);
+    }
+    if (CPU_COUNT(&cpus) == 0)
+    {
+        return;
+    }
+    int err = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    if (err != 0)
+    {
+        LOGW("SocketManager: could not pin worker %d to its steered cpus, error: %d", worker->wid, err);
+    }
+#else
+    discard worker;
+    discard arg1;
+#endif
+}
+
+static bool listenTcpReusePort(socket_filter_t *filter, char *host, uint16_t port, bool multiport)
+{
+    sockaddr_u addr;
+    memorySet(&addr, 0, sizeof(addr));
+    if (sockaddrSetIpPort(&addr, host, port) != 0)
+    {
+        return false;
+    }
+
+    // we dont consider lwip thread
+    const wid_t workers = (wid_t) (getWorkersCount() - WORKER_ADDITIONS);
+    int        *fds     = memoryAllocate(sizeof(int) * workers);
+
+    // the group is built here in worker order, so the listener index the kernel (or the steering program) picks
+    // is the wid of the worker that adopts it
+    for (wid_t wid = 0; wid < workers; wid++)
+    {
+        fds[wid] = createReusePortListenFD(&addr);
+        if (fds[wid] < 0)
+        {
+            for (wid_t i = 0; i < wid; i++)
+            {
+                closesocket(fds[i]);
+            }
+            memoryFree(fds);
+            return false;
+        }
+    }
+
+    bool pin_workers = false;
+    if (filter->option.reuse_port_steering == kReusePortSteeringCpu)
+    {
+        pin_workers = attachReusePortCpuSteering(fds[0], workers);
+        if (! pin_workers)
+        {
+            LOGW("SocketManager: could not attach cpu steering to %s:[%u], using the kernel hash", host, port);
+        }
+    }
+
+    for (wid_t wid = 0; wid < workers; wid++)
+    {
+        if (pin_workers)
+        {
+            sendWorkerMessage(wid, pinWorkerToSteeredCpus, (void *) (intptr_t) workers, NULL, NULL);
+        }
+        sendWorkerMessage(wid, adoptReusePortListener, (void *) (intptr_t) fds[wid], (void *) (intptr_t) multiport,
+                          NULL);
+    }
+    memoryFree(fds);
+
+    filter->v6_dualstack = addr.sa.sa_family == AF_INET6;
+    return true;
+}
+
 static void listenTcpMultiPortIptables(wloop_t *loop, socket_filter_t *filter, char *host, uint16_t port_min,
                                        uint8_t *ports_overlapped, uint16_t port_max)
 {
@@ -523,25 +772,38 @@ static void listenTcpMultiPortIptables(wloop_t *loop, socket_filter_t *filter, c
         state->iptable_cleaned = true;
     }
     uint16_t main_port = port_max;
+    bool     listening = false;
     // select main port
     {
         do
         {
             if (ports_overlapped[main_port] != 1)
             {
-                filter->listen_io           = wloopCreateTcpServer(loop, host, main_port, onAcceptTcpMultiPort);
                 ports_overlapped[main_port] = 1;
-                if (filter->listen_io != NULL)
+                if (filter->option.reuse_port)
+                {
+                    if (listenTcpReusePort(filter, host, main_port, true))
+                    {
+                        listening = true;
+                        break;
+                    }
+                }
+                else
                 {
-                    filter->v6_dualstack = wioGetLocaladdr(filter->listen_io)->sa_family == AF_INET6;
-                    break;
+                    filter->listen_io = wloopCreateTcpServer(loop, host, main_port, onAcceptTcpMultiPort);
+                    if (filter->listen_io != NULL)
+                    {
+                        filter->v6_dualstack = wioGetLocaladdr(filter->listen_io)->sa_family == AF_INET6;
+                        listening            = true;
+                        break;
+                    }
                 }
 
                 main_port--;
             }
         } while (main_port >= port_min);
 
-        if (filter->listen_io == NULL)
+        if (! listening)
         {
             LOGF("SocketManager: stopping due to null socket handle");
             terminateProgram(1);
@@ -554,6 +816,10 @@ static void listenTcpMultiPortIptables(wloop_t *loop, socket_filter_t *filter, c
 static void listenTcpMultiPortSockets(wloop_t *loop, socket_filter_t *filter, char *host, uint16_t port_min,
                                       uint8_t *ports_overlapped, uint16_t port_max)
 {
+    if (filter->option.reuse_port)
+    {
+        LOGW("SocketManager: reuse-port is not supported with the \"socket\" multiport backend, ignored");
+    }
     const int length           = (port_max - port_min);
     filter->listen_ios         = (wio_t **) memoryAllocate(sizeof(wio_t *) * ((size_t) length + 1));
     filter->listen_ios[length] = 0x0;
@@ -591,6 +857,15 @@ static void listenTcpSinglePort(wloop_t *loop, socket_filter_t *filter, char *ho
     }
     ports_overlapped[port] = 1;
     LOGI("SocketManager: listening on %s:[%u] (%s)", host, port, "TCP");
+    if (filter->option.reuse_port)
+    {
+        if (! listenTcpReusePort(filter, host, port, false))
+        {
+            LOGF("SocketManager: stopping due to reuse-port listen failure on %s:[%u]", host, port);
+            terminateProgram(1);
+        }
+        return;
+    }
     filter->listen_io = wloopCreateTcpServer(loop, host, port, onAcceptTcpSinglePort);
 
     if (filter->listen_io == NULL)
@@ -644,52 +919,64 @@ static void listenTcp(wloop_t *loop, uint8_t *ports_overlapped)
     }
 }
 
-static void noUdpSocketConsumerFound(const udp_payload_t upl)
+static void noUdpSocketConsumerFound(const udp_payload_t *upl)
 {
     char localaddrstr[SOCKADDR_STRLEN] = {0};
     char peeraddrstr[SOCKADDR_STRLEN]  = {0};
     LOGE("SocketManager: could not find consumer for Udp socket  [%s] <= [%s]",
-         SOCKADDR_STR(wioGetLocaladdrU(upl.sock->io), localaddrstr),
-         SOCKADDR_STR(wioGetPeerAddrU(upl.sock->io), peeraddrstr));
+         SOCKADDR_STR(wioGetLocaladdrU(upl->sock->io), localaddrstr), SOCKADDR_STR(&upl->peer_addr, peeraddrstr));
 }
 
 /*
- * @brief Post udp payload to the worker loop
- * @param post_pl: udp payload to post
- * @param filter: socket filter to use
+ * @brief Post a batch of udp payloads to the worker loop, pool items are taken under one lock
+ * @param post_pls: udp payloads to post, all of them target the same worker
+ * @param filters: socket filter of each payload
+ * @param count: number of payloads
  */
-static void postUdpPayload(udp_payload_t post_pl, socket_filter_t *filter)
+static void postUdpPayloads(const udp_payload_t *post_pls, socket_filter_t **filters, unsigned int count)
 {
+    udp_payload_t *pls[kUdpReadBatchMax];
+    const wid_t    wid = post_pls[0].wid;
 
-    mutexLock(&(state->udp_pools[post_pl.wid].mutex));
-    udp_payload_t *pl = genericpoolGetItem(state->udp_pools[post_pl.wid].pool);
-    mutexUnlock(&(state->udp_pools[post_pl.wid].mutex));
-    *pl = post_pl;
+    mutexLock(&(state->udp_pools[wid].mutex));
+    for (unsigned int i = 0; i < count; i++)
+    {
+        pls[i] = genericpoolGetItem(state->udp_pools[wid].pool);
+    }
+    mutexUnlock(&(state->udp_pools[wid].mutex));
 
-    pl->tunnel           = filter->tunnel;
-    wloop_t *worker_loop = getWorkerLoop(pl->wid);
-    wevent_t ev          = (wevent_t) {.loop = worker_loop, .cb = filter->cb};
-    ev.userdata          = (void *) pl;
+    wloop_t *worker_loop = getWorkerLoop(wid);
 
-    if (pl->wid == state->wid)
+    for (unsigned int i = 0; i < count; i++)
     {
-        filter->cb(&ev);
-        return;
+        udp_payload_t *pl = pls[i];
+        *pl               = post_pls[i];
+        pl->tunnel        = filters[i]->tunnel;
+
+        wevent_t ev = (wevent_t) {.loop = worker_loop, .cb = filters[i]->cb};
+        ev.userdata = (void *) pl;
+
+        if (wid == state->wid)
+        {
+            filters[i]->cb(&ev);
+            continue;
+        }
+        wloopPostEvent(worker_loop, &ev);
     }
-    wloopPostEvent(worker_loop, &ev);
 }
 
 /**
- * @brief Distribute udp payload to the appropriate socket filter
- * @param pl: udp payload to distribute
+ * @brief Finds the socket filter that consumes a udp payload
+ * @param pl: udp payload to match
+ * @return the filter, or NULL if no filter accepts the payload
  */
-static void distributeUdpPayload(const udp_payload_t pl)
+static socket_filter_t *findUdpPayloadFilter(const udp_payload_t *pl)
 {
 
     ip_addr_t paddr;
-    sockaddrToIpAddr(wioGetPeerAddrU(pl.sock->io), &paddr);
+    sockaddrToIpAddr(&pl->peer_addr, &paddr);
 
-    uint16_t local_port = pl.real_localport;
+    uint16_t local_port = pl->real_localport;
 
     static socket_filter_t *balance_selection_filters[kMaxBalanceSelections];
     uint8_t                 balance_selection_filters_length = 0;
@@ -717,9 +1004,9 @@ static void distributeUdpPayload(const udp_payload_t pl)
             {
                 continue;
             }
-            if (vec_ipmask_t_size(&option.white_list) > 0)
+            if (option.white_set != NULL || option.black_set != NULL)
             {
-                if (! checkIpIsWhiteList(paddr, option))
+                if (! checkIpIsAllowed(&paddr, &option))
                 {
                     continue;
                 }
@@ -728,7 +1015,8 @@ static void distributeUdpPayload(const udp_payload_t pl)
             {
                 if (! src_hashed)
                 {
-                    src_hash = ipaddrCalcHashNoPort(paddr);
+                    src_hash   = ipaddrCalcHashNoPort(paddr);
+                    src_hashed = true;
                 }
                 widle_item_t *idle_item = idleTableGetIdleItemByHash(this_wid, option.shared_balance_table, src_hash);
 
@@ -738,8 +1026,7 @@ static void distributeUdpPayload(const udp_payload_t pl)
                     idleTableKeepIdleItemForAtleast(option.shared_balance_table, idle_item,
                                                     option.balance_group_interval == 0 ? kDefaultBalanceInterval
                                                                                        : option.balance_group_interval);
-                    postUdpPayload(pl, target_filter);
-                    return;
+                    return target_filter;
                 }
 
                 if (UNLIKELY(balance_selection_filters_length >= kMaxBalanceSelections))
@@ -753,8 +1040,7 @@ static void distributeUdpPayload(const udp_payload_t pl)
                 continue;
             }
 
-            postUdpPayload(pl, filter);
-            return;
+            return filter;
         }
     }
     if (balance_selection_filters_length > 0)
@@ -763,24 +1049,61 @@ static void distributeUdpPayload(const udp_payload_t pl)
         idleItemNew(filter->option.shared_balance_table, src_hash, filter, NULL, this_wid,
                     filter->option.balance_group_interval == 0 ? kDefaultBalanceInterval
                                                                : filter->option.balance_group_interval);
-        postUdpPayload(pl, filter);
+        return filter;
     }
-    else
+    return NULL;
+}
+
+/**
+ * @brief Distribute a vector of udp payloads (one recvmmsg batch) to the appropriate socket filters
+ * @param pls: udp payloads to distribute, all of them target the same worker
+ * @param count: number of payloads, at most kUdpReadBatchMax
+ */
+static void distributeUdpPayload(udp_payload_t *pls, unsigned int count)
+{
+    socket_filter_t *filters[kUdpReadBatchMax];
+    unsigned int     accepted = 0;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        socket_filter_t *filter = findUdpPayloadFilter(&pls[i]);
+        if (filter == NULL)
+        {
+            noUdpSocketConsumerFound(&pls[i]);
+            bufferpoolReuseBuffer(getWorkerBufferPool(state->wid), pls[i].buf);
+            continue;
+        }
+        pls[accepted]       = pls[i];
+        filters[accepted++] = filter;
+    }
+    if (accepted > 0)
     {
-        noUdpSocketConsumerFound(pl);
+        postUdpPayloads(pls, filters, accepted);
     }
 }
 
-static void onUdpPacketReceived(wio_t *io, sbuf_t *buf)
+static void onUdpPacketsReceived(wio_t *io, wio_datagram_t *datagrams, unsigned int count)
 {
-    udpsock_t *socket     = weventGetUserdata(io);
-    uint16_t   local_port = sockaddrPort(wioGetLocaladdrU(io));
-    wid_t      target_wid = (wid_t) local_port % getWorkersCount();
+    udpsock_t    *socket     = weventGetUserdata(io);
+    uint16_t      local_port = sockaddrPort(wioGetLocaladdrU(io));
+    wid_t         target_wid = (wid_t) local_port % getWorkersCount();
+    udp_payload_t items[kUdpReadBatchMax];
 
-    udp_payload_t item = (udp_payload_t) {
-        .sock = socket, .buf = buf, .wid = target_wid, .peer_addr = *wioGetPeerAddrU(io), .real_localport = local_port};
-
-    distributeUdpPayload(item);
+    while (count > 0)
+    {
+        unsigned int n = min(count, (unsigned int) kUdpReadBatchMax);
+        for (unsigned int i = 0; i < n; i++)
+        {
+            items[i] = (udp_payload_t) {.sock           = socket,
+                                        .buf            = datagrams[i].buf,
+                                        .wid            = target_wid,
+                                        .peer_addr      = datagrams[i].peer,
+                                        .real_localport = local_port};
+        }
+        distributeUdpPayload(items, n);
+        datagrams += n;
+        count -= n;
+    }
 }
 
 static void listenUdpSinglePort(wloop_t *loop, socket_filter_t *filter, char *host, uint16_t port,
@@ -800,9 +1123,9 @@ static void listenUdpSinglePort(wloop_t *loop, socket_filter_t *filter, char *ho
         terminateProgram(1);
     }
     udpsock_t *socket = memoryAllocate(sizeof(udpsock_t));
-    *socket           = (udpsock_t) {.io = filter->listen_io, .table = idleTableCreate(loop)};
+    *socket           = (udpsock_t) {.io = filter->listen_io, .table = idleTableCreate()};
     weventSetUserData(filter->listen_io, socket);
-    wioSetCallBackRead(filter->listen_io, onUdpPacketReceived);
+    wioSetCallBackReadBatch(filter->listen_io, onUdpPacketsReceived);
     wioRead(filter->listen_io);
 }
 
@@ -854,16 +1177,17 @@ static void listenUdp(wloop_t *loop, uint8_t *ports_overlapped)
 static void writeUdpThisLoop(wevent_t *ev)
 {
     udp_payload_t *upl    = weventGetUserdata(ev);
-    int            nwrite = wioWrite(upl->sock->io, upl->buf);
+    int            nwrite = wioWriteTo(upl->sock->io, upl->buf, &upl->peer_addr);
     discard        nwrite;
     udppayloadDestroy(upl);
 }
 
-void postUdpWrite(udpsock_t *socket_io, wid_t wid_from, sbuf_t *buf)
+void postUdpWrite(udpsock_t *socket_io, wid_t wid_from, sbuf_t *buf, const sockaddr_u *peer_addr)
 {
     if (wid_from == state->wid)
     {
-        int     nwrite = wioWrite(socket_io->io, buf);
+        // queued on the socket, the loop sends everything queued in this iteration with one sendmmsg
+        int     nwrite = wioWriteTo(socket_io->io, buf, peer_addr);
         discard nwrite;
 
         return;
@@ -871,7 +1195,7 @@ void postUdpWrite(udpsock_t *socket_io, wid_t wid_from, sbuf_t *buf)
 
     udp_payload_t *item = newUpdPayload(wid_from);
 
-    *item = (udp_payload_t) {.sock = socket_io, .buf = buf, .wid = wid_from};
+    *item = (udp_payload_t) {.sock = socket_io, .buf = buf, .wid = wid_from, .peer_addr = *peer_addr};
 
     wevent_t ev = (wevent_t) {.loop = weventGetLoop(socket_io->io), .userdata = item, .cb = writeUdpThisLoop};
 
@@ -47,6 +47,26 @@ static void disabledPayloadRoutine(tunnel_t *t, line_t *line, sbuf_t *payload)
     terminateProgram(1);
 }
 
+static splice_retcode_t disabledSpliceRoutine(tunnel_t *t, line_t *line, int pipe_fd, size_t len)
+{
+    discard t;
+    discard line;
+    discard pipe_fd;
+    discard len;
+    LOGF("Illegal call to splice routine on Adapter %s", t->node->name);
+    terminateProgram(1);
+}
+
+// the adapter did not set its own splice routine, its socket (if any) only takes buffers
+static splice_retcode_t noSpliceRoutine(tunnel_t *t, line_t *line, int pipe_fd, size_t len)
+{
+    discard t;
+    discard line;
+    discard pipe_fd;
+    discard len;
+    return kSCRequiredBytes;
+}
+
 static void disabledRoutine(tunnel_t *t, line_t *line)
 {
     discard t;
@@ -70,6 +90,8 @@ tunnel_t *adapterCreate(node_t *node, uint16_t tstate_size, uint16_t lstate_size
         t->fnEstD     = disabledRoutine;
         t->fnFinD     = disabledRoutine;
         t->fnPayloadD = disabledPayloadRoutine;
+        t->fnSpliceD  = disabledSpliceRoutine;
+        t->fnSpliceU  = noSpliceRoutine;
     }
     else
     {
@@ -82,6 +104,8 @@ tunnel_t *adapterCreate(node_t *node, uint16_t tstate_size, uint16_t lstate_size
         t->fnEstU     = disabledRoutine;
         t->fnFinU     = disabledRoutine;
         t->fnPayloadU = disabledPayloadRoutine;
+        t->fnSpliceU  = disabledSpliceRoutine;
+        t->fnSpliceD  = noSpliceRoutine;
     }
     return t;
 }
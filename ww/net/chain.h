@@ -12,12 +12,16 @@ enum
     kMaxChainLen = (16 * 4)
 };
 
+/*
+    Result of passing a pipe (fnSpliceU / fnSpliceD) along the chain, the bytes are in the pipe and never enter a
+    buffer; a probe is the same call with no pipe (-1) and len 0
+*/
 typedef enum
 {
-    kSCBlocked,
-    kSCRequiredBytes,
-    kSCSuccessNoData,
-    kSCSuccess
+    kSCBlocked,       // the destination took the bytes but can not write more now, the source is paused as usual
+    kSCRequiredBytes, // a node on the way needs to see the bytes, the source reads them and sends a payload instead
+    kSCSuccessNoData, // probe answer, every node on the way lets the pipe through
+    kSCSuccess        // the bytes were written to the destination socket
 
 } splice_retcode_t;
 
@@ -0,0 +1,347 @@
+#include "cidr_set.h"
+
+enum
+{
+    kCidrInitialCap = 16,
+    kCidrScanLength = 16 // below this many candidates a counting loop (vectorized by the compiler) beats bisecting
+};
+
+typedef struct cidr_interval4_s
+{
+    uint32_t first;
+    uint32_t last;
+
+} cidr_interval4_t;
+
+typedef struct cidr_u128_s
+{
+    uint64_t hi;
+    uint64_t lo;
+
+} cidr_u128_t;
+
+typedef struct cidr_interval6_s
+{
+    cidr_u128_t first;
+    cidr_u128_t last;
+
+} cidr_interval6_t;
+
+struct cidr_set_s
+{
+    // compiled ipv4 intervals, split in two arrays so the search only walks the first addresses
+    uint32_t *v4_first;
+    uint32_t *v4_last;
+    uint32_t  v4_count;
+    // v4_index[i] is the first interval whose first address is >= (i << 24)
+    uint32_t v4_index[257];
+
+    cidr_interval6_t *v6;
+    uint32_t          v6_count;
+
+    // ranges added since the last compile
+    cidr_interval4_t *pending4;
+    uint32_t          pending4_count;
+    uint32_t          pending4_cap;
+    cidr_interval6_t *pending6;
+    uint32_t          pending6_count;
+    uint32_t          pending6_cap;
+};
+
+static int compareInterval4(const void *a, const void *b)
+{
+    const cidr_interval4_t *x = a;
+    const cidr_interval4_t *y = b;
+    return (x->first > y->first) - (x->first < y->first);
+}
+
+static int compareU128(const cidr_u128_t a, const cidr_u128_t b)
+{
+    if (a.hi != b.hi)
+    {
+        return a.hi < b.hi ? -1 : 1;
+    }
+    return (a.lo > b.lo) - (a.lo < b.lo);
+}
+
+static int compareInterval6(const void *a, const void *b)
+{
+    return compareU128(((const cidr_interval6_t *) a)->first, ((const cidr_interval6_t *) b)->first);
+}
+
+static cidr_u128_t u128FromIp6(const ip6_addr_t *ip6)
+{
+    return (cidr_u128_t){.hi = ((uint64_t) ntohl(ip6->addr[0]) << 32) | ntohl(ip6->addr[1]),
+                         .lo = ((uint64_t) ntohl(ip6->addr[2]) << 32) | ntohl(ip6->addr[3])};
+}
+
+cidr_set_t *cidrsetCreate(void)
+{
+    return memoryAllocateZero(sizeof(cidr_set_t));
+}
+
+void cidrsetDestroy(cidr_set_t *set)
+{
+    memoryFree(set->v4_first);
+    memoryFree(set->v4_last);
+    memoryFree(set->v6);
+    memoryFree(set->pending4);
+    memoryFree(set->pending6);
+    memoryFree(set);
+}
+
+static void pushInterval4(cidr_set_t *set, uint32_t first, uint32_t last)
+{
+    if (set->pending4_count == set->pending4_cap)
+    {
+        set->pending4_cap = set->pending4_cap == 0 ? kCidrInitialCap : set->pending4_cap * 2;
+        set->pending4     = memoryReAllocate(set->pending4, sizeof(cidr_interval4_t) * set->pending4_cap);
+    }
+    set->pending4[set->pending4_count++] = (cidr_interval4_t){.first = first, .last = last};
+}
+
+static void pushInterval6(cidr_set_t *set, cidr_u128_t first, cidr_u128_t last)
+{
+    if (set->pending6_count == set->pending6_cap)
+    {
+        set->pending6_cap = set->pending6_cap == 0 ? kCidrInitialCap : set->pending6_cap * 2;
+        set->pending6     = memoryReAllocate(set->pending6, sizeof(cidr_interval6_t) * set->pending6_cap);
+    }
+    set->pending6[set->pending6_count++] = (cidr_interval6_t){.first = first, .last = last};
+}
+
+void cidrsetAddIpMask(cidr_set_t *set, const ipmask_t *ipmask)
+{
+    if (IP_IS_V4(&ipmask->ip))
+    {
+        uint32_t ip   = ntohl(ip4_addr_get_u32(ip_2_ip4(&ipmask->ip)));
+        uint32_t mask = ntohl(ip4_addr_get_u32(ip_2_ip4(&ipmask->mask)));
+
+        pushInterval4(set, ip & mask, (ip & mask) | ~mask);
+        return;
+    }
+
+    cidr_u128_t ip    = u128FromIp6(ip_2_ip6(&ipmask->ip));
+    cidr_u128_t mask  = u128FromIp6(ip_2_ip6(&ipmask->mask));
+    cidr_u128_t first = {.hi = ip.hi & mask.hi, .lo = ip.lo & mask.lo};
+
+    pushInterval6(set, first, (cidr_u128_t){.hi = first.hi | ~mask.hi, .lo = first.lo | ~mask.lo});
+}
+
+void cidrsetAddRanges4(cidr_set_t *set, const cidr4_t *ranges, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; i++)
+    {
+        assert(ranges[i].prefix_len <= 32);
+        uint32_t mask = ranges[i].prefix_len == 0 ? 0 : (0xFFFFFFFFU << (32 - ranges[i].prefix_len));
+
+        pushInterval4(set, ranges[i].addr & mask, (ranges[i].addr & mask) | ~mask);
+    }
+}
+
+static cidr_u128_t u128PrefixMask(unsigned int prefix_len)
+{
+    assert(prefix_len <= 128);
+    if (prefix_len == 0)
+    {
+        return (cidr_u128_t){0};
+    }
+    if (prefix_len <= 64)
+    {
+        return (cidr_u128_t){.hi = UINT64_MAX << (64 - prefix_len), .lo = 0};
+    }
+    return (cidr_u128_t){.hi = UINT64_MAX, .lo = prefix_len == 128 ? UINT64_MAX : UINT64_MAX << (128 - prefix_len)};
+}
+
+void cidrsetAddRanges6(cidr_set_t *set, const cidr6_t *ranges, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; i++)
+    {
+        const uint16_t *g    = ranges[i].groups;
+        cidr_u128_t     mask = u128PrefixMask(ranges[i].prefix_len);
+        cidr_u128_t     addr = {0};
+
+        for (int k = 0; k < 4; k++)
+        {
+            addr.hi = (addr.hi << 16) | g[k];
+            addr.lo = (addr.lo << 16) | g[k + 4];
+        }
+        cidr_u128_t first = {.hi = addr.hi & mask.hi, .lo = addr.lo & mask.lo};
+
+        pushInterval6(set, first, (cidr_u128_t){.hi = first.hi | ~mask.hi, .lo = first.lo | ~mask.lo});
+    }
+}
+
+static void compile4(cidr_set_t *set)
+{
+    // the already compiled intervals are merged again with the new ones
+    for (uint32_t i = 0; i < set->v4_count; i++)
+    {
+        pushInterval4(set, set->v4_first[i], set->v4_last[i]);
+    }
+    qsort(set->pending4, set->pending4_count, sizeof(cidr_interval4_t), compareInterval4);
+
+    uint32_t merged = 0;
+    for (uint32_t i = 0; i < set->pending4_count; i++)
+    {
+        cidr_interval4_t cur = set->pending4[i];
+        // adjacent or overlapping, (last + 1) can not overflow when last is below the next first
+        if (merged > 0 && (set->pending4[merged - 1].last == UINT32_MAX ||
+                           cur.first <= set->pending4[merged - 1].last + 1))
+        {
+            set->pending4[merged - 1].last = max(set->pending4[merged - 1].last, cur.last);
+            continue;
+        }
+        set->pending4[merged++] = cur;
+    }
+
+    memoryFree(set->v4_first);
+    memoryFree(set->v4_last);
+    set->v4_count = merged;
+    set->v4_first = memoryAllocate(sizeof(uint32_t) * max(merged, 1U));
+    set->v4_last  = memoryAllocate(sizeof(uint32_t) * max(merged, 1U));
+
+    for (uint32_t i = 0; i < merged; i++)
+    {
+        set->v4_first[i] = set->pending4[i].first;
+        set->v4_last[i]  = set->pending4[i].last;
+    }
+
+    uint32_t pos = 0;
+    for (uint32_t octet = 0; octet < 256; octet++)
+    {
+        while (pos < merged && (set->v4_first[pos] >> 24) < octet)
+        {
+            pos++;
+        }
+        set->v4_index[octet] = pos;
+    }
+    set->v4_index[256] = merged;
+
+    set->pending4_count = 0;
+}
+
+static void compile6(cidr_set_t *set)
+{
+    for (uint32_t i = 0; i < set->v6_count; i++)
+    {
+        pushInterval6(set, set->v6[i].first, set->v6[i].last);
+    }
+    qsort(set->pending6, set->pending6_count, sizeof(cidr_interval6_t), compareInterval6);
+
+    uint32_t merged = 0;
+    for (uint32_t i = 0; i < set->pending6_count; i++)
+    {
+        cidr_interval6_t cur = set->pending6[i];
+        if (merged > 0)
+        {
+            cidr_interval6_t *prev = &set->pending6[merged - 1];
+            cidr_u128_t       next = {.hi = prev->last.hi + (prev->last.lo == UINT64_MAX), .lo = prev->last.lo + 1};
+            bool              full = prev->last.hi == UINT64_MAX && prev->last.lo == UINT64_MAX;
+
+            if (full || compareU128(cur.first, next) <= 0)
+            {
+                if (compareU128(cur.last, prev->last) > 0)
+                {
+                    prev->last = cur.last;
+                }
+                continue;
+            }
+        }
+        set->pending6[merged++] = cur;
+    }
+
+    memoryFree(set->v6);
+    set->v6_count = merged;
+    set->v6       = memoryAllocate(sizeof(cidr_interval6_t) * max(merged, 1U));
+    memoryCopy(set->v6, set->pending6, sizeof(cidr_interval6_t) * merged);
+
+    set->pending6_count = 0;
+}
+
+void cidrsetCompile(cidr_set_t *set)
+{
+    compile4(set);
+    compile6(set);
+
+    // the staging arrays are only needed while building
+    memoryFree(set->pending4);
+    memoryFree(set->pending6);
+    set->pending4     = NULL;
+    set->pending6     = NULL;
+    set->pending4_cap = 0;
+    set->pending6_cap = 0;
+}
+
+bool cidrsetContains4(const cidr_set_t *set, uint32_t addr)
+{
+    if (set->v4_count == 0)
+    {
+        return false;
+    }
+
+    const uint32_t  octet = addr >> 24;
+    const uint32_t *base  = set->v4_first + set->v4_index[octet];
+    uint32_t        len   = set->v4_index[octet + 1] - set->v4_index[octet];
+
+    // branchless bisection down to a short run, then count the candidates that start at or below addr
+    while (len > kCidrScanLength)
+    {
+        uint32_t half = len / 2;
+        base          = (base[half] <= addr) ? base + half : base;
+        len -= half;
+    }
+
+    uint32_t below = 0;
+    for (uint32_t i = 0; i < len; i++)
+    {
+        below += base[i] <= addr;
+    }
+
+    // the interval that may contain addr is the last one starting at or below it, possibly in a lower octet
+    const uint32_t idx = (uint32_t) (base - set->v4_first) + below;
+    return idx > 0 && set->v4_last[idx - 1] >= addr;
+}
+
+static bool cidrsetContains6(const cidr_set_t *set, const ip6_addr_t *ip6)
+{
+    const cidr_u128_t addr = u128FromIp6(ip6);
+    uint32_t          lo   = 0;
+    uint32_t          hi   = set->v6_count;
+
+    // upper bound on the first addresses
+    while (lo < hi)
+    {
+        uint32_t mid = lo + ((hi - lo) / 2);
+        if (compareU128(set->v6[mid].first, addr) <= 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo > 0 && compareU128(set->v6[lo - 1].last, addr) >= 0;
+}
+
+bool cidrsetContains(const cidr_set_t *set, const ip_addr_t *addr)
+{
+    if (IP_IS_V4(addr))
+    {
+        return cidrsetContains4(set, ntohl(ip4_addr_get_u32(ip_2_ip4(addr))));
+    }
+
+    const ip6_addr_t *ip6 = ip_2_ip6(addr);
+    if (ip6->addr[0] == 0 && ip6->addr[1] == 0 && ip6->addr[2] == htonl(0x0000FFFFU))
+    {
+        return cidrsetContains4(set, ntohl(ip6->addr[3]));
+    }
+    return cidrsetContains6(set, ip6);
+}
+
+bool cidrsetIsEmpty(const cidr_set_t *set)
+{
+    return set->v4_count == 0 && set->v6_count == 0 && set->pending4_count == 0 && set->pending6_count == 0;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "wlibc.h"
+#include "wsocket.h"
+
+/*
+    Compiled set of CIDR ranges
+
+    ranges are collected with cidrsetAdd*() and then compiled once into sorted, merged and non overlapping
+    [first, last] intervals kept in flat arrays, a lookup is a direct index on the first octet (ipv4) followed by a
+    short branchless search, so the cost barely grows with the number of ranges
+
+    a compiled set is read only and can be shared by all the workers
+*/
+
+/**
+ * An ipv4 range in host byte order, the form used by the built-in data sets (ww/managers/data).
+ */
+typedef struct cidr4_s
+{
+    uint32_t addr;
+    uint8_t  prefix_len;
+
+} cidr4_t;
+
+// a cidr4_t constant, CIDR4(10, 0, 0, 0, 8) is 10.0.0.0/8
+#define CIDR4(a, b, c, d, len)                                                                                         \
+    {(((uint32_t) (a) << 24) | ((uint32_t) (b) << 16) | ((uint32_t) (c) << 8) | (uint32_t) (d)), (len)}
+
+/**
+ * An ipv6 range, the address is given as 8 groups of 16 bits like in its text form.
+ */
+typedef struct cidr6_s
+{
+    uint16_t groups[8];
+    uint8_t  prefix_len;
+
+} cidr6_t;
+
+// a cidr6_t constant, CIDR6(0x2a01, 0x5ec0, 0x7800, 0, 0, 0, 0, 0, 37) is 2a01:5ec0:7800::/37
+#define CIDR6(a, b, c, d, e, f, g, h, len)                                                                             \
+    {{(a), (b), (c), (d), (e), (f), (g), (h)}, (len)}
+
+typedef struct cidr_set_s cidr_set_t;
+
+cidr_set_t *cidrsetCreate(void);
+void        cidrsetDestroy(cidr_set_t *set);
+
+/**
+ * @brief Adds a range parsed with parseIPWithSubnetMask().
+ */
+void cidrsetAddIpMask(cidr_set_t *set, const ipmask_t *ipmask);
+
+/**
+ * @brief Adds ipv4 ranges, such as a built-in data set.
+ */
+void cidrsetAddRanges4(cidr_set_t *set, const cidr4_t *ranges, unsigned int count);
+
+/**
+ * @brief Adds ipv6 ranges, such as a built-in data set.
+ */
+void cidrsetAddRanges6(cidr_set_t *set, const cidr6_t *ranges, unsigned int count);
+
+/**
+ * @brief Sorts and merges the added ranges and builds the lookup index, must be called before cidrsetContains().
+ *
+ * Ranges can be added again after a compile, the set has to be compiled again.
+ */
+void cidrsetCompile(cidr_set_t *set);
+
+/**
+ * @brief Checks if the address is inside one of the ranges, ipv4 mapped ipv6 addresses are checked as ipv4.
+ */
+bool cidrsetContains(const cidr_set_t *set, const ip_addr_t *addr);
+
+/**
+ * @brief Checks an ipv4 address in host byte order.
+ */
+bool cidrsetContains4(const cidr_set_t *set, uint32_t addr);
+
+/**
+ * @brief Returns true if no range was added.
+ */
+bool cidrsetIsEmpty(const cidr_set_t *set);
@@ -0,0 +1,1046 @@
+#include "dns_resolver.h"
+#include "global_state.h"
+#include "sync_dns.h"
+#include "wloop.h"
+#include "worker.h"
+#include "wsocket.h"
+
+#include "loggers/dns_logger.h"
+
+enum
+{
+    kDnsMaxServers        = 4,
+    kDnsDefaultPort       = 53,
+    kDnsMaxAddrs          = 8, // addresses kept per family
+    kDnsMaxNameLen        = 255,
+    kDnsHeaderSize        = 12,
+    kDnsQueryTimeoutMs    = 1000,
+    kDnsQueryAttempts     = 4, // retransmissions rotate over the servers
+    kDnsResolutionDelayMs = 50, // rfc 8305 resolution delay
+    kDnsMinTtlSec         = 5,
+    kDnsMaxTtlSec         = 86400,
+    kDnsNegativeTtlSec    = 60, // NXDOMAIN / no data without a SOA record
+    kDnsFailureTtlSec     = 5,  // SERVFAIL, REFUSED, timeouts
+    kDnsCacheMaxEntries   = 4096,
+    kDnsMaxCompressJumps  = 16,
+    kDnsTypeA             = 1,
+    kDnsTypeSoa           = 6,
+    kDnsTypeAAAA          = 28,
+    kDnsClassIn           = 1,
+    kDnsRcodeNoError      = 0,
+    kDnsRcodeNxDomain     = 3
+};
+
+enum dns_family_e
+{
+    kDnsFamilyV4 = 0,
+    kDnsFamilyV6 = 1,
+    kDnsFamilyCount
+};
+
+enum dns_rrset_state_e
+{
+    kDnsRrsetEmpty = 0,
+    kDnsRrsetPending,
+    kDnsRrsetPositive,
+    kDnsRrsetNegative
+};
+
+typedef enum dns_pick_e
+{
+    kDnsPickWait,
+    kDnsPickWaitDelay, // only the non preferred family is ready, wait the resolution delay
+    kDnsPickDone
+
+} dns_pick_e;
+
+struct dns_cache_entry_s;
+
+typedef struct dns_rrset_s
+{
+    ip_addr_t                 addrs[kDnsMaxAddrs];
+    struct dns_cache_entry_s *entry;
+    wtimer_t                 *timer; // retransmission timer while pending
+    uint64_t                  expire_ms;
+    uint16_t                  query_id;
+    uint8_t                   count;
+    uint8_t                   next; // round robin over addrs
+    uint8_t                   attempts;
+    uint8_t                   server; // server of the pending query
+    uint8_t                   family;
+    uint8_t                   state;
+
+} dns_rrset_t;
+
+typedef struct dns_cache_entry_s
+{
+    dns_rrset_t     rrsets[kDnsFamilyCount];
+    dns_resolver_t *resolver;
+    dns_request_t  *waiters;
+    hash_t          hash;
+    uint8_t         domain_len;
+    char            domain[kDnsMaxNameLen + 1]; // lower case
+
+} dns_cache_entry_t;
+
+struct dns_request_s
+{
+    dns_request_t           *prev;
+    dns_request_t           *next;
+    dns_cache_entry_t       *entry; // NULL once the request is taken out for its callback
+    wtimer_t                *delay_timer;
+    DnsResolveCallback       cb;
+    void                    *userdata;
+    ip_addr_t                addr;
+    enum domain_strategy     strategy;
+    bool                     resolved : 1;
+    bool                     delay_expired : 1;
+    bool                     canceled : 1;
+};
+
+// hash of the lower case domain -> entry
+#define i_type hmap_dnscache_t     // NOLINT
+#define i_key  hash_t              // NOLINT
+#define i_val  dns_cache_entry_t * // NOLINT
+#include "stc/hmap.h"
+
+// transaction id of a pending query -> rrset
+#define i_type hmap_dnsquery_t // NOLINT
+#define i_key  uint16_t        // NOLINT
+#define i_val  dns_rrset_t *   // NOLINT
+#include "stc/hmap.h"
+
+struct dns_resolver_s
+{
+    wloop_t        *loop;
+    wio_t          *ios[kDnsFamilyCount]; // one udp socket per address family of the servers
+    hmap_dnscache_t cache;
+    hmap_dnsquery_t queries;
+    sockaddr_u      servers[kDnsMaxServers];
+    uint8_t         servers_count;
+};
+
+// filled by dnsresolverAddNameServer() before the workers start, read only afterwards
+static sockaddr_u name_servers[kDnsMaxServers];
+static uint8_t    name_servers_count;
+
+static bool dnsParseServer(const char *address, sockaddr_u *out)
+{
+    char        host[INET6_ADDRSTRLEN];
+    const char *port_str = NULL;
+    size_t      host_len;
+    int         port = kDnsDefaultPort;
+
+    if (address[0] == '[')
+    {
+        const char *end = stringChr(address, ']');
+        if (end == NULL)
+        {
+            return false;
+        }
+        host_len = (size_t) (end - address - 1);
+        address++;
+        if (end[1] == ':')
+        {
+            port_str = end + 2;
+        }
+        else if (end[1] != '\0')
+        {
+            return false;
+        }
+    }
+    else
+    {
+        const char *colon = stringChr(address, ':');
+        // a single colon separates the port of an ipv4 address, more colons make an ipv6 address
+        if (colon != NULL && stringChr(colon + 1, ':') == NULL)
+        {
+            host_len = (size_t) (colon - address);
+            port_str = colon + 1;
+        }
+        else
+        {
+            host_len = stringLength(address);
+        }
+    }
+
+    if (host_len == 0 || host_len >= sizeof(host))
+    {
+        return false;
+    }
+    memoryCopy(host, address, host_len);
+    host[host_len] = '\0';
+
+    if (port_str != NULL)
+    {
+        port = atoi(port_str);
+        if (port <= 0 || port > 65535)
+        {
+            return false;
+        }
+    }
+
+    if (! isIpAddr(host))
+    {
+        return false;
+    }
+    memorySet(out, 0, sizeof(*out));
+    return sockaddrSetIpPort(out, host, port) == 0;
+}
+
+bool dnsresolverAddNameServer(const char *address)
+{
+    if (name_servers_count >= kDnsMaxServers)
+    {
+        LOGE("DnsResolver: at most %d name servers can be configured", kDnsMaxServers);
+        return false;
+    }
+    if (! dnsParseServer(address, &name_servers[name_servers_count]))
+    {
+        LOGE("DnsResolver: invalid name server address \"%s\"", address);
+        return false;
+    }
+    name_servers_count++;
+    return true;
+}
+
+static uint8_t dnsLoadSystemNameServers(sockaddr_u *servers)
+{
+    uint8_t count = 0;
+
+#if defined(OS_UNIX)
+    char *content = readFile("/etc/resolv.conf");
+    if (content == NULL)
+    {
+        return 0;
+    }
+
+    char *line = content;
+    while (line != NULL && *line != '\0' && count < kDnsMaxServers)
+    {
+        char *next = stringChr(line, '\n');
+        if (next != NULL)
+        {
+            *next++ = '\0';
+        }
+
+        while (*line == ' ' || *line == '\t')
+        {
+            line++;
+        }
+        if (stringStartsWith(line, "nameserver") && (line[10] == ' ' || line[10] == '\t'))
+        {
+            char *value = line + 10;
+            while (*value == ' ' || *value == '\t')
+            {
+                value++;
+            }
+            char *end = value;
+            while (*end != '\0' && *end != ' ' && *end != '\t' && *end != '\r' && *end != '#')
+            {
+                end++;
+            }
+            *end = '\0';
+
+            // scoped addresses (fe80::1%eth0) are not valid ip strings here and are skipped
+            if (*value != '\0' && isIpAddr(value) && sockaddrSetIpPort(&servers[count], value, kDnsDefaultPort) == 0)
+            {
+                count++;
+            }
+        }
+        line = next;
+    }
+    memoryFree(content);
+#else
+    discard servers;
+#endif
+
+    return count;
+}
+
+static dns_resolver_t *dnsresolverCreate(wloop_t *loop)
+{
+    dns_resolver_t *r = memoryAllocateZero(sizeof(dns_resolver_t));
+
+    r->loop    = loop;
+    r->cache   = hmap_dnscache_t_with_capacity(64);
+    r->queries = hmap_dnsquery_t_with_capacity(16);
+
+    if (name_servers_count > 0)
+    {
+        memoryCopy(r->servers, name_servers, sizeof(name_servers));
+        r->servers_count = name_servers_count;
+    }
+    else
+    {
+        r->servers_count = dnsLoadSystemNameServers(r->servers);
+    }
+
+    if (r->servers_count == 0)
+    {
+        LOGW("DnsResolver: no name server found, domains are resolved with blocking calls");
+    }
+    return r;
+}
+
+static dns_resolver_t *dnsresolverGetWorkerInstance(void)
+{
+    worker_t *worker = getWorker(getWID());
+
+    if (worker->dns_resolver == NULL)
+    {
+        worker->dns_resolver = dnsresolverCreate(worker->loop);
+    }
+    return worker->dns_resolver;
+}
+
+static bool dnsentryIsIdle(const dns_cache_entry_t *e)
+{
+    return e->waiters == NULL && e->rrsets[kDnsFamilyV4].state != kDnsRrsetPending &&
+           e->rrsets[kDnsFamilyV6].state != kDnsRrsetPending;
+}
+
+static bool dnsentryIsExpired(const dns_cache_entry_t *e, uint64_t now)
+{
+    return e->rrsets[kDnsFamilyV4].expire_ms <= now && e->rrsets[kDnsFamilyV6].expire_ms <= now;
+}
+
+// drops idle entries, expired ones first, until a quarter of the cache is free
+static void dnsresolverEvict(dns_resolver_t *r, uint64_t now)
+{
+    const ptrdiff_t target = (kDnsCacheMaxEntries / 4) * 3;
+
+    for (int pass = 0; pass < 2 && hmap_dnscache_t_size(&r->cache) > target; pass++)
+    {
+        hmap_dnscache_t_iter it = hmap_dnscache_t_begin(&r->cache);
+        while (it.ref != NULL && hmap_dnscache_t_size(&r->cache) > target)
+        {
+            dns_cache_entry_t *e = it.ref->second;
+            if (dnsentryIsIdle(e) && (pass == 1 || dnsentryIsExpired(e, now)))
+            {
+                memoryFree(e);
+                it = hmap_dnscache_t_erase_at(&r->cache, it);
+            }
+            else
+            {
+                hmap_dnscache_t_next(&it);
+            }
+        }
+    }
+}
+
+static dns_cache_entry_t *dnsresolverGetEntry(dns_resolver_t *r, const char *domain, uint8_t domain_len)
+{
+    char lower[kDnsMaxNameLen + 1];
+
+    for (uint8_t i = 0; i < domain_len; i++)
+    {
+        char c   = domain[i];
+        lower[i] = (c >= 'A' && c <= 'Z') ? (char) (c - 'A' + 'a') : c;
+    }
+    // "example.com." and "example.com" are the same name
+    if (domain_len > 1 && lower[domain_len - 1] == '.')
+    {
+        domain_len--;
+    }
+    lower[domain_len] = '\0';
+
+    hash_t hash = calcHashBytes(lower, domain_len);
+
+    const hmap_dnscache_t_value *v = hmap_dnscache_t_get(&r->cache, hash);
+    if (v != NULL)
+    {
+        dns_cache_entry_t *e = v->second;
+        if (e->domain_len == domain_len && memoryCompare(e->domain, lower, domain_len) == 0)
+        {
+            return e;
+        }
+        // hash collision, the old name gives its place if nobody waits on it
+        if (! dnsentryIsIdle(e))
+        {
+            return NULL;
+        }
+        memoryFree(e);
+        hmap_dnscache_t_erase(&r->cache, hash);
+    }
+
+    if (hmap_dnscache_t_size(&r->cache) >= kDnsCacheMaxEntries)
+    {
+        dnsresolverEvict(r, wloopNowMS(r->loop));
+    }
+
+    dns_cache_entry_t *e = memoryAllocateZero(sizeof(dns_cache_entry_t));
+    e->resolver          = r;
+    e->hash              = hash;
+    e->domain_len        = domain_len;
+    memoryCopy(e->domain, lower, (size_t) domain_len + 1);
+    for (int f = 0; f < kDnsFamilyCount; f++)
+    {
+        e->rrsets[f].entry  = e;
+        e->rrsets[f].family = (uint8_t) f;
+    }
+    hmap_dnscache_t_insert(&r->cache, hash, e);
+    return e;
+}
+
+static int dnsBuildQuery(uint8_t *out, uint16_t id, const char *domain, uint8_t domain_len, uint16_t qtype)
+{
+    memorySet(out, 0, kDnsHeaderSize);
+    out[0] = (uint8_t) (id >> 8);
+    out[1] = (uint8_t) id;
+    out[2] = 0x01; // recursion desired
+    out[5] = 1;    // one question
+
+    int    pos   = kDnsHeaderSize;
+    size_t start = 0;
+    for (size_t i = 0; i <= domain_len; i++)
+    {
+        if (i == domain_len || domain[i] == '.')
+        {
+            size_t label_len = i - start;
+            if (label_len == 0 || label_len > 63)
+            {
+                return -1;
+            }
+            out[pos++] = (uint8_t) label_len;
+            memoryCopy(out + pos, domain + start, label_len);
+            pos += (int) label_len;
+            start = i + 1;
+        }
+    }
+    out[pos++] = 0;
+    out[pos++] = (uint8_t) (qtype >> 8);
+    out[pos++] = (uint8_t) qtype;
+    out[pos++] = 0;
+    out[pos++] = kDnsClassIn;
+    return pos;
+}
+
+static uint16_t dnsRead16(const uint8_t *p)
+{
+    return (uint16_t) ((p[0] << 8) | p[1]);
+}
+
+static uint32_t dnsRead32(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | (uint32_t) p[3];
+}
+
+// reads a (possibly compressed) name at *pos into out as lower case dotted text, out can be NULL to skip it
+static bool dnsReadName(const uint8_t *msg, size_t len, size_t *pos, char *out, size_t *out_len)
+{
+    size_t p       = *pos;
+    size_t written = 0;
+    int    jumps   = 0;
+    bool   jumped  = false;
+
+    while (true)
+    {
+        if (p >= len)
+        {
+            return false;
+        }
+        uint8_t label_len = msg[p];
+
+        if ((label_len & 0xC0) == 0xC0)
+        {
+            if (p + 1 >= len || ++jumps > kDnsMaxCompressJumps)
+            {
+                return false;
+            }
+            if (! jumped)
+            {
+                *pos   = p + 2;
+                jumped = true;
+            }
+            p = (size_t) (((label_len & 0x3F) << 8) | msg[p + 1]);
+            continue;
+        }
+        if ((label_len & 0xC0) != 0)
+        {
+            return false;
+        }
+        p++;
+        if (label_len == 0)
+        {
+            break;
+        }
+        if (p + label_len > len || written + label_len + 1 > kDnsMaxNameLen + 1)
+        {
+            return false;
+        }
+        if (out != NULL)
+        {
+            if (written > 0)
+            {
+                out[written] = '.';
+            }
+            for (uint8_t i = 0; i < label_len; i++)
+            {
+                char c                                     = (char) msg[p + i];
+                out[written + (written > 0 ? 1 : 0) + i] = (c >= 'A' && c <= 'Z') ? (char) (c - 'A' + 'a') : c;
+            }
+        }
+        written += label_len + (written > 0 ? 1 : 0);
+        p += label_len;
+    }
+
+    if (! jumped)
+    {
+        *pos = p;
+    }
+    if (out_len != NULL)
+    {
+        *out_len = written;
+    }
+    return true;
+}
+
+static uint32_t dnsClampTtl(uint32_t ttl)
+{
+    if (ttl < kDnsMinTtlSec)
+    {
+        return kDnsMinTtlSec;
+    }
+    return ttl > kDnsMaxTtlSec ? kDnsMaxTtlSec : ttl;
+}
+
+static uint16_t dnsFamilyType(uint8_t family)
+{
+    return family == kDnsFamilyV4 ? kDnsTypeA : kDnsTypeAAAA;
+}
+
+static const ip_addr_t *dnsrrsetPick(dns_rrset_t *rr)
+{
+    return &rr->addrs[(rr->next++) % rr->count];
+}
+
+static dns_pick_e dnsEvaluate(dns_cache_entry_t *e, enum domain_strategy strategy, bool delay_expired,
+                              const ip_addr_t **out)
+{
+    dns_rrset_t *preferred;
+    dns_rrset_t *other;
+
+    switch (strategy)
+    {
+    case kDsOnlyIpV4:
+        preferred = &e->rrsets[kDnsFamilyV4];
+        other     = NULL;
+        break;
+    case kDsOnlyIpV6:
+        preferred = &e->rrsets[kDnsFamilyV6];
+        other     = NULL;
+        break;
+    case kDsPreferIpV6:
+        preferred = &e->rrsets[kDnsFamilyV6];
+        other     = &e->rrsets[kDnsFamilyV4];
+        break;
+    default:
+    case kDsInvalid:
+    case kDsPreferIpV4:
+        preferred = &e->rrsets[kDnsFamilyV4];
+        other     = &e->rrsets[kDnsFamilyV6];
+        break;
+    }
+
+    *out = NULL;
+
+    if (preferred->state == kDnsRrsetPositive)
+    {
+        *out = dnsrrsetPick(preferred);
+        return kDnsPickDone;
+    }
+    if (other == NULL)
+    {
+        return preferred->state == kDnsRrsetNegative ? kDnsPickDone : kDnsPickWait;
+    }
+    if (other->state == kDnsRrsetPositive)
+    {
+        if (preferred->state == kDnsRrsetNegative || delay_expired)
+        {
+            *out = dnsrrsetPick(other);
+            return kDnsPickDone;
+        }
+        return kDnsPickWaitDelay;
+    }
+    if (preferred->state == kDnsRrsetNegative && other->state == kDnsRrsetNegative)
+    {
+        return kDnsPickDone;
+    }
+    return kDnsPickWait;
+}
+
+static void dnsrequestUnlink(dns_request_t *req)
+{
+    dns_cache_entry_t *e = req->entry;
+
+    if (req->prev != NULL)
+    {
+        req->prev->next = req->next;
+    }
+    else
+    {
+        e->waiters = req->next;
+    }
+    if (req->next != NULL)
+    {
+        req->next->prev = req->prev;
+    }
+    req->prev  = NULL;
+    req->next  = NULL;
+    req->entry = NULL;
+
+    if (req->delay_timer != NULL)
+    {
+        wtimerDelete(req->delay_timer);
+        req->delay_timer = NULL;
+    }
+}
+
+static void dnsresolverDispatch(dns_cache_entry_t *e);
+
+static void dnsrequestOnResolutionDelay(wtimer_t *timer)
+{
+    dns_request_t *req = weventGetUserdata(timer);
+
+    // one shot timer, the loop frees it
+    req->delay_timer   = NULL;
+    req->delay_expired = true;
+    dnsresolverDispatch(req->entry);
+}
+
+static void dnsrequestStartDelay(dns_request_t *req)
+{
+    req->delay_timer = wtimerAdd(req->entry->resolver->loop, dnsrequestOnResolutionDelay, kDnsResolutionDelayMs, 1);
+    weventSetUserData(req->delay_timer, req);
+}
+
+// re-evaluates the waiters of the entry and calls the ones that are done
+static void dnsresolverDispatch(dns_cache_entry_t *e)
+{
+    dns_request_t  *ready = NULL;
+    dns_request_t **tail  = &ready;
+    dns_request_t  *req   = e->waiters;
+
+    // the callbacks may cancel other requests of this entry, so they are all taken out before any of them runs
+    while (req != NULL)
+    {
+        dns_request_t   *next = req->next;
+        const ip_addr_t *addr = NULL;
+
+        switch (dnsEvaluate(e, req->strategy, req->delay_expired, &addr))
+        {
+        case kDnsPickDone:
+            dnsrequestUnlink(req);
+            if (addr != NULL)
+            {
+                req->addr     = *addr;
+                req->resolved = true;
+            }
+            *tail = req;
+            tail  = &req->next;
+            break;
+        case kDnsPickWaitDelay:
+            if (req->delay_timer == NULL)
+            {
+                dnsrequestStartDelay(req);
+            }
+            break;
+        default:
+        case kDnsPickWait:
+            break;
+        }
+        req = next;
+    }
+
+    while (ready != NULL)
+    {
+        req   = ready;
+        ready = req->next;
+        if (! req->canceled)
+        {
+            req->cb(req->userdata, req->resolved ? &req->addr : NULL);
+        }
+        memoryFree(req);
+    }
+}
+
+static void dnsresolverOnRecv(wio_t *io, sbuf_t *buf);
+
+static wio_t *dnsresolverGetIo(dns_resolver_t *r, const sockaddr_u *server)
+{
+    int family = server->sa.sa_family == AF_INET6 ? kDnsFamilyV6 : kDnsFamilyV4;
+
+    if (r->ios[family] == NULL)
+    {
+        int fd = (int) socket(server->sa.sa_family, SOCK_DGRAM, 0);
+        if (fd < 0)
+        {
+            LOGE("DnsResolver: could not create udp socket");
+            return NULL;
+        }
+        r->ios[family] = wioGet(r->loop, fd);
+        weventSetUserData(r->ios[family], r);
+        wioSetCallBackRead(r->ios[family], dnsresolverOnRecv);
+        wioRead(r->ios[family]);
+    }
+    return r->ios[family];
+}
+
+static void dnsrrsetFinish(dns_rrset_t *rr, uint8_t state, uint32_t ttl_sec)
+{
+    dns_resolver_t *r = rr->entry->resolver;
+
+    hmap_dnsquery_t_erase(&r->queries, rr->query_id);
+    if (rr->timer != NULL)
+    {
+        wtimerDelete(rr->timer);
+        rr->timer = NULL;
+    }
+    rr->state     = state;
+    rr->expire_ms = wloopNowMS(r->loop) + (uint64_t) ttl_sec * 1000;
+
+    dnsresolverDispatch(rr->entry);
+}
+
+static bool dnsrrsetSendQuery(dns_rrset_t *rr)
+{
+    dns_cache_entry_t *e = rr->entry;
+    dns_resolver_t    *r = e->resolver;
+    uint16_t           id;
+
+    do
+    {
+        getRandomBytes(&id, sizeof(id));
+    } while (hmap_dnsquery_t_contains(&r->queries, id));
+
+    rr->server         = (uint8_t) (rr->attempts % r->servers_count);
+    sockaddr_u *server = &r->servers[rr->server];
+    wio_t      *io     = dnsresolverGetIo(r, server);
+
+    if (io == NULL)
+    {
+        return false;
+    }
+
+    sbuf_t *buf = bufferpoolGetSmallBuffer(getWorkerBufferPool(getWID()));
+    int     len = dnsBuildQuery(sbufGetMutablePtr(buf), id, e->domain, e->domain_len, dnsFamilyType(rr->family));
+
+    if (len < 0)
+    {
+        LOGE("DnsResolver: invalid domain name \"%s\"", e->domain);
+        bufferpoolReuseBuffer(getWorkerBufferPool(getWID()), buf);
+        return false;
+    }
+    sbufSetLength(buf, (uint32_t) len);
+
+    rr->query_id = id;
+    hmap_dnsquery_t_insert(&r->queries, id, rr);
+
+    wioWriteTo(io, buf, server);
+    return true;
+}
+
+static void dnsrrsetOnTimeout(wtimer_t *timer)
+{
+    dns_rrset_t *rr = weventGetUserdata(timer);
+
+    hmap_dnsquery_t_erase(&rr->entry->resolver->queries, rr->query_id);
+
+    if (++rr->attempts < kDnsQueryAttempts && dnsrrsetSendQuery(rr))
+    {
+        return;
+    }
+    LOGW("DnsResolver: query %s for \"%s\" timed out", rr->family == kDnsFamilyV4 ? "A" : "AAAA",
+         rr->entry->domain);
+    dnsrrsetFinish(rr, kDnsRrsetNegative, kDnsFailureTtlSec);
+}
+
+static void dnsrrsetStartQuery(dns_rrset_t *rr)
+{
+    dns_resolver_t *r = rr->entry->resolver;
+
+    rr->state    = kDnsRrsetPending;
+    rr->count    = 0;
+    rr->attempts = 0;
+
+    if (! dnsrrsetSendQuery(rr))
+    {
+        rr->state     = kDnsRrsetNegative;
+        rr->expire_ms = wloopNowMS(r->loop) + (uint64_t) kDnsFailureTtlSec * 1000;
+        return;
+    }
+    rr->timer = wtimerAdd(r->loop, dnsrrsetOnTimeout, kDnsQueryTimeoutMs, INFINITE);
+    weventSetUserData(rr->timer, rr);
+}
+
+// negative ttl of rfc 2308: the smaller of the SOA record ttl and its minimum field
+static uint32_t dnsNegativeTtl(const uint8_t *msg, size_t len, size_t pos, uint16_t answers, uint16_t authorities)
+{
+    for (uint32_t i = 0; i < (uint32_t) answers + authorities; i++)
+    {
+        if (! dnsReadName(msg, len, &pos, NULL, NULL) || pos + 10 > len)
+        {
+            break;
+        }
+        uint16_t type     = dnsRead16(msg + pos);
+        uint32_t ttl      = dnsRead32(msg + pos + 4);
+        uint16_t rdlength = dnsRead16(msg + pos + 8);
+        pos += 10;
+        if (pos + rdlength > len)
+        {
+            break;
+        }
+        if (i >= answers && type == kDnsTypeSoa)
+        {
+            size_t rd = pos;
+            if (dnsReadName(msg, len, &rd, NULL, NULL) && dnsReadName(msg, len, &rd, NULL, NULL) &&
+                rd + 20 <= pos + rdlength)
+            {
+                uint32_t minimum = dnsRead32(msg + rd + 16);
+                return dnsClampTtl(ttl < minimum ? ttl : minimum);
+            }
+        }
+        pos += rdlength;
+    }
+    return kDnsNegativeTtlSec;
+}
+
+static void dnsresolverHandleResponse(dns_resolver_t *r, const uint8_t *msg, size_t len, sockaddr_u *from)
+{
+    if (len < kDnsHeaderSize || (msg[2] & 0x80) == 0)
+    {
+        return;
+    }
+
+    const hmap_dnsquery_t_value *v = hmap_dnsquery_t_get(&r->queries, dnsRead16(msg));
+    if (v == NULL)
+    {
+        // late answer of a retransmitted query, or not ours
+        return;
+    }
+    dns_rrset_t       *rr     = v->second;
+    dns_cache_entry_t *e      = rr->entry;
+    sockaddr_u        *server = &r->servers[rr->server];
+
+    if (! sockaddrCmpIP(from, server) || sockaddrPort(from) != sockaddrPort(server))
+    {
+        return;
+    }
+
+    uint8_t  rcode       = msg[3] & 0x0F;
+    uint16_t questions   = dnsRead16(msg + 4);
+    uint16_t answers     = dnsRead16(msg + 6);
+    uint16_t authorities = dnsRead16(msg + 8);
+    size_t   pos         = kDnsHeaderSize;
+    char     name[kDnsMaxNameLen + 1];
+    size_t   name_len;
+
+    // the question must be the one we asked
+    if (questions != 1 || ! dnsReadName(msg, len, &pos, name, &name_len) || pos + 4 > len ||
+        dnsRead16(msg + pos) != dnsFamilyType(rr->family) || dnsRead16(msg + pos + 2) != kDnsClassIn ||
+        name_len != e->domain_len || memoryCompare(name, e->domain, name_len) != 0)
+    {
+        return;
+    }
+    pos += 4;
+
+    if (rcode != kDnsRcodeNoError && rcode != kDnsRcodeNxDomain)
+    {
+        // SERVFAIL / REFUSED, give the next server a chance
+        LOGD("DnsResolver: server answered rcode %d for \"%s\"", rcode, e->domain);
+        hmap_dnsquery_t_erase(&r->queries, rr->query_id);
+        if (++rr->attempts < kDnsQueryAttempts && rr->attempts < r->servers_count && dnsrrsetSendQuery(rr))
+        {
+            return;
+        }
+        dnsrrsetFinish(rr, kDnsRrsetNegative, kDnsFailureTtlSec);
+        return;
+    }
+
+    const size_t answers_pos = pos;
+    uint32_t     min_ttl     = kDnsMaxTtlSec;
+    const size_t addr_len    = rr->family == kDnsFamilyV4 ? 4 : 16;
+
+    rr->count = 0;
+    rr->next  = 0;
+
+    // recursive servers put the cname chain before the addresses, only the records of our type are taken
+    for (uint16_t i = 0; rcode == kDnsRcodeNoError && i < answers; i++)
+    {
+        if (! dnsReadName(msg, len, &pos, NULL, NULL) || pos + 10 > len)
+        {
+            break;
+        }
+        uint16_t type     = dnsRead16(msg + pos);
+        uint16_t rclass   = dnsRead16(msg + pos + 2);
+        uint32_t ttl      = dnsRead32(msg + pos + 4);
+        uint16_t rdlength = dnsRead16(msg + pos + 8);
+        pos += 10;
+        if (pos + rdlength > len)
+        {
+            break;
+        }
+        if (type == dnsFamilyType(rr->family) && rclass == kDnsClassIn && rdlength == addr_len &&
+            rr->count < kDnsMaxAddrs)
+        {
+            ip_addr_t *addr = &rr->addrs[rr->count++];
+            memorySet(addr, 0, sizeof(*addr));
+            if (rr->family == kDnsFamilyV4)
+            {
+                memoryCopy(&addr->u_addr.ip4.addr, msg + pos, 4);
+                addr->type = IPADDR_TYPE_V4;
+            }
+            else
+            {
+                memoryCopy(&addr->u_addr.ip6.addr, msg + pos, 16);
+                addr->type = IPADDR_TYPE_V6;
+            }
+            min_ttl = ttl < min_ttl ? ttl : min_ttl;
+        }
+        pos += rdlength;
+    }
+
+    if (rr->count > 0)
+    {
+        if (loggerCheckWriteLevel(getDnsLogger(), (log_level_e) LOG_LEVEL_INFO))
+        {
+            char ip[64];
+            ipAddrNetworkToAaddressR(&rr->addrs[0], ip, sizeof(ip));
+            LOGI("DnsResolver: %s resolved to %s (%d records, ttl %u)", e->domain, ip, rr->count, min_ttl);
+        }
+        dnsrrsetFinish(rr, kDnsRrsetPositive, dnsClampTtl(min_ttl));
+        return;
+    }
+
+    LOGD("DnsResolver: no %s record for \"%s\"", rr->family == kDnsFamilyV4 ? "A" : "AAAA", e->domain);
+    dnsrrsetFinish(rr, kDnsRrsetNegative, dnsNegativeTtl(msg, len, answers_pos, answers, authorities));
+}
+
+static void dnsresolverOnRecv(wio_t *io, sbuf_t *buf)
+{
+    dns_resolver_t *r = weventGetUserdata(io);
+
+    dnsresolverHandleResponse(r, sbufGetRawPtr(buf), sbufGetLength(buf), wioGetPeerAddrU(io));
+    bufferpoolReuseBuffer(wloopGetBufferPool(weventGetLoop(io)), buf);
+}
+
+static bool dnsStrategyWants(enum domain_strategy strategy, int family)
+{
+    if (strategy == kDsOnlyIpV4)
+    {
+        return family == kDnsFamilyV4;
+    }
+    if (strategy == kDsOnlyIpV6)
+    {
+        return family == kDnsFamilyV6;
+    }
+    return true;
+}
+
+dns_result_e dnsresolverResolve(address_context_t *ctx, DnsResolveCallback cb, void *userdata,
+                                dns_request_t **request)
+{
+    assert(ctx->type_ip == false && ctx->domain != NULL);
+
+    *request = NULL;
+
+    if (isIpAddr(ctx->domain))
+    {
+        // literal address in the domain field, nothing to ask
+        return resolveContextSync(ctx) ? kDnsResultResolved : kDnsResultFailed;
+    }
+
+    dns_resolver_t *r = dnsresolverGetWorkerInstance();
+
+    if (r->servers_count == 0 || r->loop == NULL)
+    {
+        return resolveContextSync(ctx) ? kDnsResultResolved : kDnsResultFailed;
+    }
+
+    dns_cache_entry_t *e = dnsresolverGetEntry(r, ctx->domain, ctx->domain_len);
+    if (e == NULL)
+    {
+        LOGE("DnsResolver: cache slot of \"%s\" is busy", ctx->domain);
+        return kDnsResultFailed;
+    }
+
+    const uint64_t now = wloopNowMS(r->loop);
+
+    for (int f = 0; f < kDnsFamilyCount; f++)
+    {
+        dns_rrset_t *rr = &e->rrsets[f];
+        if (dnsStrategyWants(ctx->domain_strategy, f) && rr->state != kDnsRrsetPending &&
+            (rr->state == kDnsRrsetEmpty || rr->expire_ms <= now))
+        {
+            dnsrrsetStartQuery(rr);
+        }
+    }
+
+    const ip_addr_t *addr = NULL;
+    dns_pick_e       pick = dnsEvaluate(e, ctx->domain_strategy, false, &addr);
+
+    if (pick == kDnsPickDone)
+    {
+        if (addr == NULL)
+        {
+            LOGD("DnsResolver: \"%s\" could not be resolved (cached)", e->domain);
+            return kDnsResultFailed;
+        }
+        ctx->ip_address = *addr;
+        ctx->type_ip    = true;
+        return kDnsResultResolved;
+    }
+
+    dns_request_t *req = memoryAllocateZero(sizeof(dns_request_t));
+    req->entry         = e;
+    req->cb            = cb;
+    req->userdata      = userdata;
+    req->strategy      = ctx->domain_strategy;
+    req->next          = e->waiters;
+    if (e->waiters != NULL)
+    {
+        e->waiters->prev = req;
+    }
+    e->waiters = req;
+
+    if (pick == kDnsPickWaitDelay)
+    {
+        dnsrequestStartDelay(req);
+    }
+
+    *request = req;
+    return kDnsResultPending;
+}
+
+void dnsresolverCancel(dns_request_t *request)
+{
+    if (request->entry == NULL)
+    {
+        // already taken out for its callback, the dispatcher frees it
+        request->canceled = true;
+        return;
+    }
+    dnsrequestUnlink(request);
+    memoryFree(request);
+}
+
+void dnsresolverDestroy(dns_resolver_t *resolver)
+{
+    // the loop (and with it the timers and sockets) is already gone, only the memory is left
+    c_foreach(it, hmap_dnscache_t, resolver->cache)
+    {
+        dns_cache_entry_t *e   = it.ref->second;
+        dns_request_t     *req = e->waiters;
+        while (req != NULL)
+        {
+            dns_request_t *next = req->next;
+            memoryFree(req);
+            req = next;
+        }
+        memoryFree(e);
+    }
+    hmap_dnscache_t_drop(&resolver->cache);
+    hmap_dnsquery_t_drop(&resolver->queries);
+    memoryFree(resolver);
+}
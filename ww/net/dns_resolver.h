@@ -0,0 +1,76 @@
+#pragma once
+
+#include "address_context.h"
+#include "wlibc.h"
+
+/*
+    Asynchronous DNS resolver
+
+    every worker owns one resolver (created on first use), it sends A / AAAA queries over udp to the configured
+    name servers from the worker loop and never blocks it, answers are kept in a per worker cache for their ttl,
+    failures (NXDOMAIN, no data, timeouts) are cached for a shorter time
+
+    concurrent lookups of the same name share the same queries, each waiting request gets its callback when an
+    address family allowed by its domain strategy is ready
+
+    kDsPreferIpV4 / kDsPreferIpV6 send both queries at once (happy eyeballs, rfc 8305), if the other family
+    answers first the request waits a short resolution delay for the preferred one before taking it
+
+    name servers come from the core settings ("dns": {"servers": [...]}) or from /etc/resolv.conf, when there is
+    none (e.g. windows) the resolver falls back to the blocking resolveContextSync()
+
+    everything here runs on the thread of the worker that owns the resolver
+*/
+
+typedef struct dns_resolver_s dns_resolver_t;
+typedef struct dns_request_s  dns_request_t;
+
+typedef enum dns_result_e
+{
+    kDnsResultResolved, // address written to the context, no callback
+    kDnsResultPending,  // callback will be called later, unless the request is canceled
+    kDnsResultFailed    // no address, no callback
+
+} dns_result_e;
+
+/**
+ * @brief Called on the worker thread when a pending request completes, the request handle is invalid afterwards.
+ *
+ * @param userdata The userdata given to dnsresolverResolve.
+ * @param addr The resolved address, or NULL if the name could not be resolved.
+ */
+typedef void (*DnsResolveCallback)(void *userdata, const ip_addr_t *addr);
+
+/**
+ * @brief Adds a name server, "ip", "ip:port" or "[ipv6]:port" (default port 53).
+ *
+ * Must be called before the workers start resolving, overrides the system name servers.
+ *
+ * @return false if the address is invalid or too many servers are configured.
+ */
+bool dnsresolverAddNameServer(const char *address);
+
+/**
+ * @brief Resolves the domain of ctx on the current worker.
+ *
+ * On kDnsResultResolved the address is written to ctx->ip_address and ctx->type_ip is set, on kDnsResultPending
+ * *request receives a handle that can be passed to dnsresolverCancel() before the callback is called.
+ *
+ * @param ctx Address context with a domain (ctx->type_ip == false).
+ * @param cb Callback for the pending case.
+ * @param userdata Passed to the callback.
+ * @param request Receives the pending request handle.
+ * @return dns_result_e
+ */
+dns_result_e dnsresolverResolve(address_context_t *ctx, DnsResolveCallback cb, void *userdata,
+                                dns_request_t **request);
+
+/**
+ * @brief Cancels a pending request, its callback will not be called.
+ */
+void dnsresolverCancel(dns_request_t *request);
+
+/**
+ * @brief Frees a resolver, called by the worker after its loop is destroyed.
+ */
+void dnsresolverDestroy(dns_resolver_t *resolver);
@@ -12,4 +12,12 @@ void socketfilteroptionDeInit(socket_filter_option_t *sfo)
 {
     vec_ipmask_t_drop(&sfo->white_list);
     vec_ipmask_t_drop(&sfo->black_list);
+    if (sfo->white_set != NULL)
+    {
+        cidrsetDestroy(sfo->white_set);
+    }
+    if (sfo->black_set != NULL)
+    {
+        cidrsetDestroy(sfo->black_set);
+    }
 }
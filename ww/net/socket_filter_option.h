@@ -1,6 +1,7 @@
 #include "wlibc.h"
 #include "wsocket.h"
 #include "net/address_context.h"
+#include "net/cidr_set.h"
 #include "widle_table.h"
 
 #define i_type vec_ipmask_t,ipmask_t 
@@ -14,6 +15,12 @@ typedef enum
     kMultiportBackendSockets
 } multiport_backend_t;
 
+typedef enum
+{
+    kReusePortSteeringKernel, // the kernel hashes the 4 tuple
+    kReusePortSteeringCpu     // classic bpf program, listener of the worker matching the cpu of the SYN
+} reuseport_steering_t;
+
 
 /*
     socket_filter_option_t provides information about which protocol (tcp? udp?)
@@ -33,6 +40,8 @@ typedef struct socket_filter_option_s
     uint16_t                     port_max;
     bool                         fast_open;
     bool                         no_delay;
+    bool                         reuse_port; // one SO_REUSEPORT listener per worker (tcp)
+    reuseport_steering_t         reuse_port_steering;
     unsigned int                 balance_group_interval;
 
     vec_ipmask_t white_list;
@@ -40,6 +49,8 @@ typedef struct socket_filter_option_s
     // Internal use
 
     widle_table_t *shared_balance_table;
+    cidr_set_t    *white_set; // white_list compiled at registration, NULL if empty
+    cidr_set_t    *black_set; // black_list compiled at registration, NULL if empty
 
 } socket_filter_option_t;
 
@@ -2,6 +2,6 @@
 #include "wlibc.h"
 #include "address_context.h"
 
-// TODO (internal cache , prefer v4/6)
+// blocking lookup, the worker loops use dnsresolverResolve() (dns_resolver.h) which caches and never blocks
 bool resolveContextSync(address_context_t *s_ctx);
 
@@ -1,5 +1,8 @@
 #include "tunnel.h"
+#include "global_state.h"
+#include "line.h"
 #include "loggers/internal_logger.h"
+#include "managers/metrics_manager.h"
 #include "managers/node_manager.h"
 #include "node.h"
 
@@ -50,21 +53,72 @@ void tunnelDefaultUpStreamFin(tunnel_t *self, line_t *line)
 void tunnelDefaultUpStreamPayload(tunnel_t *self, line_t *line, sbuf_t *payload)
 {
     assert(self->next != NULL);
-    self->next->fnPayloadU(self->next, line, payload);
+    tunnelNextUpStreamPayload(self, line, payload);
 }
 
 // Default upstream pause function
 void tunnelDefaultUpStreamPause(tunnel_t *self, line_t *line)
 {
     assert(self->next != NULL);
-    self->next->fnPauseU(self->next, line);
+    tunnelNextUpStreamPause(self, line);
 }
 
 // Default upstream resume function
 void tunnelDefaultUpStreamResume(tunnel_t *self, line_t *line)
 {
     assert(self->next != NULL);
-    self->next->fnResumeU(self->next, line);
+    tunnelNextUpStreamResume(self, line);
+}
+
+// Default upstream splice function
+splice_retcode_t tunnelDefaultUpStreamSplice(tunnel_t *self, line_t *line, int pipe_fd, size_t len)
+{
+    assert(self->next != NULL);
+    // a tunnel that handles the payload itself has to see the bytes
+    if (self->fnPayloadU != &tunnelDefaultUpStreamPayload)
+    {
+        return kSCRequiredBytes;
+    }
+    return tunnelNextUpStreamSplice(self, line, pipe_fd, len);
+}
+
+// Flattens a chained payload, for an accepting tunnel that queues it
+sbuf_t *tunnelLinearizePayload(line_t *line, sbuf_t *payload)
+{
+    return sbufchainLinearize(payload, lineGetBufferPool(line));
+}
+
+// Walks over the tunnels that only hand the payload on, to the first one that reads it
+bool tunnelNextAcceptsChainU(tunnel_t *self)
+{
+    for (tunnel_t *t = self->next; t != NULL; t = t->next)
+    {
+        if (t->accepts_chain_u)
+        {
+            return true;
+        }
+        if (t->fnPayloadU != &tunnelDefaultUpStreamPayload)
+        {
+            return false;
+        }
+    }
+    return false;
+}
+
+bool tunnelPrevAcceptsChainD(tunnel_t *self)
+{
+    for (tunnel_t *t = self->prev; t != NULL; t = t->prev)
+    {
+        if (t->accepts_chain_d)
+        {
+            return true;
+        }
+        if (t->fnPayloadD != &tunnelDefaultdownStreamPayload)
+        {
+            return false;
+        }
+    }
+    return false;
 }
 
 // Default downstream initialization function
@@ -92,21 +146,33 @@ void tunnelDefaultdownStreamFinish(tunnel_t *self, line_t *line)
 void tunnelDefaultdownStreamPayload(tunnel_t *self, line_t *line, sbuf_t *payload)
 {
     assert(self->prev != NULL);
-    self->prev->fnPayloadD(self->prev, line, payload);
+    tunnelPrevDownStreamPayload(self, line, payload);
 }
 
 // Default downstream pause function
 void tunnelDefaultDownStreamPause(tunnel_t *self, line_t *line)
 {
     assert(self->prev != NULL);
-    self->prev->fnPauseD(self->prev, line);
+    tunnelPrevDownStreamPause(self, line);
 }
 
 // Default downstream resume function
 void tunnelDefaultDownStreamResume(tunnel_t *self, line_t *line)
 {
     assert(self->prev != NULL);
-    self->prev->fnResumeD(self->prev, line);
+    tunnelPrevDownStreamResume(self, line);
+}
+
+// Default downstream splice function
+splice_retcode_t tunnelDefaultDownStreamSplice(tunnel_t *self, line_t *line, int pipe_fd, size_t len)
+{
+    assert(self->prev != NULL);
+    // a tunnel that handles the payload itself has to see the bytes
+    if (self->fnPayloadD != &tunnelDefaultdownStreamPayload)
+    {
+        return kSCRequiredBytes;
+    }
+    return tunnelPrevDownStreamSplice(self, line, pipe_fd, len);
 }
 
 // Default function to handle tunnel chaining
@@ -191,7 +257,10 @@ tunnel_t *tunnelCreate(node_t *node, uint32_t tstate_size, uint32_t lstate_size)
     tstate_size = tunnelGetCorrectAllignedStateSize(tstate_size);
     lstate_size = tunnelGetCorrectAllignedLineStateSize(lstate_size);
 
-    size_t tsize = sizeof(tunnel_t) + tstate_size;
+    // the metrics slots live after the state, both sizes keep them on a line cache boundary
+    size_t metrics_size = metricsmanagerIsEnabled() ? sizeof(tunnel_metrics_t) * getWorkersCount() : 0;
+
+    size_t tsize = sizeof(tunnel_t) + tstate_size + metrics_size;
     // ensure we have enough space to offset the allocation by line cache (for alignment)
     tsize = ALIGN2(tsize + ((kCpuLineCacheSize + 1) / 2), kCpuLineCacheSize);
 
@@ -206,7 +275,7 @@ tunnel_t *tunnelCreate(node_t *node, uint32_t tstate_size, uint32_t lstate_size)
     // align pointer to line cache boundary
     tunnel_t *tunnel_ptr = (tunnel_t *) ALIGN2(ptr, kCpuLineCacheSize); // NOLINT
 
-    memorySet(tunnel_ptr, 0, sizeof(tunnel_t) + tstate_size);
+    memorySet(tunnel_ptr, 0, sizeof(tunnel_t) + tstate_size + metrics_size);
 
     *tunnel_ptr = (tunnel_t) {.memptr      = ptr,
                               .fnInitU     = &tunnelDefaultUpStreamInit,
@@ -221,6 +290,8 @@ tunnel_t *tunnelCreate(node_t *node, uint32_t tstate_size, uint32_t lstate_size)
                               .fnPauseD    = &tunnelDefaultDownStreamPause,
                               .fnResumeU   = &tunnelDefaultUpStreamResume,
                               .fnResumeD   = &tunnelDefaultDownStreamResume,
+                              .fnSpliceU   = &tunnelDefaultUpStreamSplice,
+                              .fnSpliceD   = &tunnelDefaultDownStreamSplice,
                               .onChain     = &tunnelDefaultOnChain,
                               .onIndex     = &tunnelDefaultOnIndex,
                               .onPrepair   = &tunnelDefaultOnPrepair,
@@ -229,6 +300,11 @@ tunnel_t *tunnelCreate(node_t *node, uint32_t tstate_size, uint32_t lstate_size)
                               .lstate_size = lstate_size,
                               .node        = node};
 
+    if (metrics_size > 0)
+    {
+        tunnel_ptr->metrics = (tunnel_metrics_t *) ((uint8_t *) tunnel_ptr + sizeof(tunnel_t) + tstate_size);
+    }
+
     return tunnel_ptr;
 }
 
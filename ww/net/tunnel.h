@@ -3,6 +3,7 @@
 #include "chain.h"
 #include "address_context.h"
 #include "generic_pool.h"
+#include "sbuf_chain.h"
 #include "shiftbuffer.h"
 #include "wlibc.h"
 #include "wloop.h"
@@ -51,6 +52,25 @@ typedef void (*TunnelFlowRoutinePause)(tunnel_t *, line_t *line);
 typedef void (*TunnelFlowRoutineResume)(tunnel_t *, line_t *line);
 typedef splice_retcode_t (*TunnelFlowRoutineSplice)(tunnel_t *, line_t *line, int pipe_fd, size_t len);
 
+/*
+    Traffic counters of a tunnel, one slot per worker (the lwip worker included), each slot is only written by its
+    worker so the counters are plain adds, the metrics manager sums the slots when it is scraped
+
+    bytes and packets are what the tunnel received from its neighbours, upstream from prev and downstream from next
+*/
+typedef MSVC_ATTR_ALIGNED_LINE_CACHE struct tunnel_metrics_s
+{
+    atomic_ullong up_bytes;
+    atomic_ullong up_packets;
+    atomic_ullong down_bytes;
+    atomic_ullong down_packets;
+    atomic_ullong up_pauses;
+    atomic_ullong up_resumes;
+    atomic_ullong down_pauses;
+    atomic_ullong down_resumes;
+
+} GNU_ATTR_ALIGNED_LINE_CACHE tunnel_metrics_t;
+
 /*
     Tunnel is just a doubly linked list, it has its own state, per connection state is stored in line structure
     which later gets accessed by the chain_index which is fixed.
@@ -73,6 +93,8 @@ struct tunnel_s
     TunnelFlowRoutinePause   fnPauseD;
     TunnelFlowRoutineResume  fnResumeU;
     TunnelFlowRoutineResume  fnResumeD;
+    TunnelFlowRoutineSplice  fnSpliceU;
+    TunnelFlowRoutineSplice  fnSpliceD;
 
     TunnelChainFn  onChain;
     TunnelIndexFn  onIndex;
@@ -86,9 +108,14 @@ struct tunnel_s
     uint16_t lstate_offset;
     uint16_t chain_index;
 
-    node_t         *node;
-    tunnel_chain_t *chain;
-    uintptr_t       memptr;
+    // the payload routines consume chained buffers (sbuf_chain.h), nobody sends chains to the other tunnels
+    bool accepts_chain_u;
+    bool accepts_chain_d;
+
+    node_t           *node;
+    tunnel_chain_t   *chain;
+    tunnel_metrics_t *metrics; // NULL when the metrics manager is not enabled
+    uintptr_t         memptr;
 
     // tunnel itself will be aligned to cache line when allocating memory
     MSVC_ATTR_ALIGNED_LINE_CACHE uint8_t state[] GNU_ATTR_ALIGNED_LINE_CACHE;
@@ -197,6 +224,17 @@ void tunnelDefaultUpStreamPause(tunnel_t *self, line_t *line);
  */
 void tunnelDefaultUpStreamResume(tunnel_t *self, line_t *line);
 
+/**
+ * @brief Default upstream splice function, the pipe only passes tunnels that do not replace the payload function.
+ * 
+ * @param self Pointer to the tunnel.
+ * @param line Pointer to the line.
+ * @param pipe_fd Read end of the pipe that holds the bytes (-1 for a probe).
+ * @param len Number of bytes in the pipe (0 for a probe).
+ * @return splice_retcode_t Result of the destination, kSCRequiredBytes if this tunnel needs the bytes.
+ */
+splice_retcode_t tunnelDefaultUpStreamSplice(tunnel_t *self, line_t *line, int pipe_fd, size_t len);
+
 /**
  * @brief Default downstream initialization function.
  * 
@@ -246,6 +284,17 @@ void tunnelDefaultDownStreamPause(tunnel_t *self, line_t *line);
  */
 void tunnelDefaultDownStreamResume(tunnel_t *self, line_t *line);
 
+/**
+ * @brief Default downstream splice function, the pipe only passes tunnels that do not replace the payload function.
+ * 
+ * @param self Pointer to the tunnel.
+ * @param line Pointer to the line.
+ * @param pipe_fd Read end of the pipe that holds the bytes (-1 for a probe).
+ * @param len Number of bytes in the pipe (0 for a probe).
+ * @return splice_retcode_t Result of the destination, kSCRequiredBytes if this tunnel needs the bytes.
+ */
+splice_retcode_t tunnelDefaultDownStreamSplice(tunnel_t *self, line_t *line, int pipe_fd, size_t len);
+
 /**
  * @brief Default function to handle tunnel chaining.
  * 
@@ -355,6 +404,34 @@ static uint16_t tunnelGetCorrectAllignedLineStateSize(uint16_t size)
     return (size + kCpuLineCacheSize - 1) & ~(kCpuLineCacheSize - 1);
 }
 
+/**
+ * @brief Turns a chained payload into one contiguous buffer, for an accepting tunnel that has to keep it.
+ * 
+ * @param line Pointer to the line.
+ * @param payload Pointer to the chained payload.
+ * @return sbuf_t* The contiguous payload.
+ */
+sbuf_t *tunnelLinearizePayload(line_t *line, sbuf_t *payload);
+
+/**
+ * @brief Checks if a chained payload this tunnel sends upstream reaches a tunnel that takes it.
+ * 
+ * Tunnels that keep the default payload routine only hand the buffer on and are passed over. The answer does not
+ * change after the chains are built, so a producer asks once (onPrepair) and sends plain buffers when it is false.
+ * 
+ * @param self Pointer to the tunnel.
+ * @return bool True if the next tunnel that reads the payload set accepts_chain_u.
+ */
+bool tunnelNextAcceptsChainU(tunnel_t *self);
+
+/**
+ * @brief Checks if a chained payload this tunnel sends downstream reaches a tunnel that takes it.
+ * 
+ * @param self Pointer to the tunnel.
+ * @return bool True if the previous tunnel that reads the payload set accepts_chain_d.
+ */
+bool tunnelPrevAcceptsChainD(tunnel_t *self);
+
 /**
  * @brief Initializes the upstream pipeline.
  * 
@@ -489,6 +566,17 @@ static inline void tunnelDownStreamResume(tunnel_t *self, line_t *line)
     self->fnResumeD(self, line);
 }
 
+/**
+ * @brief Gets the metrics slot of the current worker.
+ * 
+ * @param self Pointer to the tunnel.
+ * @return tunnel_metrics_t* The slot, or NULL when metrics are not enabled.
+ */
+static inline tunnel_metrics_t *tunnelGetMetrics(tunnel_t *self)
+{
+    return UNLIKELY(self->metrics != NULL) ? &self->metrics[getWID()] : NULL;
+}
+
 /**
  * @brief Initializes the next upstream pipeline.
  * 
@@ -531,6 +619,12 @@ static inline void tunnelNextUpStreamFinish(tunnel_t *self, line_t *line)
  */
 static inline void tunnelNextUpStreamPayload(tunnel_t *self, line_t *line, sbuf_t *payload)
 {
+    tunnel_metrics_t *metrics = tunnelGetMetrics(self->next);
+    if (metrics)
+    {
+        atomicAddSingleWriter(&metrics->up_bytes, sbufGetLength(payload));
+        atomicAddSingleWriter(&metrics->up_packets, 1);
+    }
     self->next->fnPayloadU(self->next, line, payload);
 }
 
@@ -542,6 +636,11 @@ static inline void tunnelNextUpStreamPayload(tunnel_t *self, line_t *line, sbuf_
  */
 static inline void tunnelNextUpStreamPause(tunnel_t *self, line_t *line)
 {
+    tunnel_metrics_t *metrics = tunnelGetMetrics(self->next);
+    if (metrics)
+    {
+        atomicAddSingleWriter(&metrics->up_pauses, 1);
+    }
     self->next->fnPauseU(self->next, line);
 }
 
@@ -553,9 +652,35 @@ static inline void tunnelNextUpStreamPause(tunnel_t *self, line_t *line)
  */
 static inline void tunnelNextUpStreamResume(tunnel_t *self, line_t *line)
 {
+    tunnel_metrics_t *metrics = tunnelGetMetrics(self->next);
+    if (metrics)
+    {
+        atomicAddSingleWriter(&metrics->up_resumes, 1);
+    }
     self->next->fnResumeU(self->next, line);
 }
 
+/**
+ * @brief Passes a pipe to the next upstream tunnel.
+ * 
+ * @param self Pointer to the tunnel.
+ * @param line Pointer to the line.
+ * @param pipe_fd Read end of the pipe that holds the bytes (-1 for a probe).
+ * @param len Number of bytes in the pipe (0 for a probe).
+ * @return splice_retcode_t Result of the splice.
+ */
+static inline splice_retcode_t tunnelNextUpStreamSplice(tunnel_t *self, line_t *line, int pipe_fd, size_t len)
+{
+    splice_retcode_t  ret     = self->next->fnSpliceU(self->next, line, pipe_fd, len);
+    tunnel_metrics_t *metrics = tunnelGetMetrics(self->next);
+    if (metrics && (ret == kSCSuccess || ret == kSCBlocked))
+    {
+        atomicAddSingleWriter(&metrics->up_bytes, len);
+        atomicAddSingleWriter(&metrics->up_packets, 1);
+    }
+    return ret;
+}
+
 /**
  * @brief Initializes the prev downstream pipeline.
  * 
@@ -598,6 +723,12 @@ static inline void tunnelPrevDownStreamFinish(tunnel_t *self, line_t *line)
  */
 static inline void tunnelPrevDownStreamPayload(tunnel_t *self, line_t *line, sbuf_t *payload)
 {
+    tunnel_metrics_t *metrics = tunnelGetMetrics(self->prev);
+    if (metrics)
+    {
+        atomicAddSingleWriter(&metrics->down_bytes, sbufGetLength(payload));
+        atomicAddSingleWriter(&metrics->down_packets, 1);
+    }
     self->prev->fnPayloadD(self->prev, line, payload);
 }
 
@@ -609,6 +740,11 @@ static inline void tunnelPrevDownStreamPayload(tunnel_t *self, line_t *line, sbu
  */
 static inline void tunnelPrevDownStreamPause(tunnel_t *self, line_t *line)
 {
+    tunnel_metrics_t *metrics = tunnelGetMetrics(self->prev);
+    if (metrics)
+    {
+        atomicAddSingleWriter(&metrics->down_pauses, 1);
+    }
     self->prev->fnPauseD(self->prev, line);
 }
 
@@ -620,9 +756,35 @@ static inline void tunnelPrevDownStreamPause(tunnel_t *self, line_t *line)
  */
 static inline void tunnelPrevDownStreamResume(tunnel_t *self, line_t *line)
 {
+    tunnel_metrics_t *metrics = tunnelGetMetrics(self->prev);
+    if (metrics)
+    {
+        atomicAddSingleWriter(&metrics->down_resumes, 1);
+    }
     self->prev->fnResumeD(self->prev, line);
 }
 
+/**
+ * @brief Passes a pipe to the prev downstream tunnel.
+ * 
+ * @param self Pointer to the tunnel.
+ * @param line Pointer to the line.
+ * @param pipe_fd Read end of the pipe that holds the bytes (-1 for a probe).
+ * @param len Number of bytes in the pipe (0 for a probe).
+ * @return splice_retcode_t Result of the splice.
+ */
+static inline splice_retcode_t tunnelPrevDownStreamSplice(tunnel_t *self, line_t *line, int pipe_fd, size_t len)
+{
+    splice_retcode_t  ret     = self->prev->fnSpliceD(self->prev, line, pipe_fd, len);
+    tunnel_metrics_t *metrics = tunnelGetMetrics(self->prev);
+    if (metrics && (ret == kSCSuccess || ret == kSCBlocked))
+    {
+        atomicAddSingleWriter(&metrics->down_bytes, len);
+        atomicAddSingleWriter(&metrics->down_packets, 1);
+    }
+    return ret;
+}
+
 
 
 
@@ -5,7 +5,9 @@
 #include "buffer_pool.h"
 #include "buffer_queue.h"
 #include "context_queue.h"
+#include "dns_resolver.h"
 #include "global_state.h"
+#include "managers/metrics_manager.h"
 #include "managers/node_manager.h"
 #include "managers/socket_manager.h"
 #include "managers/signal_manager.h"